@@ -352,6 +352,7 @@ private:
 
     SSL_CTX* ctx_;
     std::mutex ctx_mutex_;
+    SSL_SESSION* session_;
 };
 #endif
 
@@ -2151,13 +2152,13 @@ inline std::shared_ptr<Response> Client::Options(const char* path, const Headers
 #ifdef CPPHTTPLIB_OPENSSL_SUPPORT
 namespace detail {
 
-template <typename U, typename V, typename T>
+template <typename U, typename V, typename W, typename T>
 inline bool read_and_close_socket_ssl(
         socket_t sock, size_t keep_alive_max_count,
         // TODO: OpenSSL 1.0.2 occasionally crashes...
         // The upcoming 1.1.0 is going to be thread safe.
         SSL_CTX* ctx, std::mutex& ctx_mutex,
-        U SSL_connect_or_accept, V setup,
+        U SSL_connect_or_accept, V setup, W post_handshake,
         T callback)
 {
     SSL* ssl = nullptr;
@@ -2177,6 +2178,8 @@ inline bool read_and_close_socket_ssl(
 
     SSL_connect_or_accept(ssl);
 
+    post_handshake(ssl);
+
     bool ret = false;
 
     if (keep_alive_max_count > 0) {
@@ -2298,6 +2301,7 @@ inline bool SSLServer::read_and_close_socket(socket_t sock)
             ctx_, ctx_mutex_,
             SSL_accept,
             [](SSL* /*ssl*/) {},
+            [](SSL* /*ssl*/) {},
             [this](Stream& strm, bool last_connection, bool& connection_close) {
                 return process_request(strm, last_connection, connection_close);
             });
@@ -2308,10 +2312,15 @@ inline SSLClient::SSLClient(const char* host, int port, size_t timeout_sec)
         : Client(host, port, timeout_sec)
 {
     ctx_ = SSL_CTX_new(SSLv23_client_method());
+    SSL_CTX_set_session_cache_mode(ctx_, SSL_SESS_CACHE_CLIENT);
+    session_ = nullptr;
 }
 
 inline SSLClient::~SSLClient()
 {
+    if (session_) {
+        SSL_SESSION_free(session_);
+    }
     if (ctx_) {
         SSL_CTX_free(ctx_);
     }
@@ -2330,6 +2339,19 @@ inline bool SSLClient::read_and_close_socket(socket_t sock, Request& req, Respon
             SSL_connect,
             [&](SSL* ssl) {
                 SSL_set_tlsext_host_name(ssl, host_.c_str());
+                // Resume the previous TLS session if the server still caches it, which turns
+                // the full handshake into an abbreviated one.
+                std::lock_guard<std::mutex> guard(ctx_mutex_);
+                if (session_) {
+                    SSL_set_session(ssl, session_);
+                }
+            },
+            [&](SSL* ssl) {
+                std::lock_guard<std::mutex> guard(ctx_mutex_);
+                if (session_) {
+                    SSL_SESSION_free(session_);
+                }
+                session_ = SSL_get1_session(ssl);
             },
             [&](Stream& strm, bool /*last_connection*/, bool& connection_close) {
                 return process_request(strm, req, res, connection_close);
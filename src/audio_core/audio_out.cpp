@@ -38,9 +38,9 @@ StreamPtr AudioOut::OpenStream(u32 sample_rate, u32 num_channels, std::string&&
         sink->AcquireSinkStream(sample_rate, num_channels, name), std::move(name));
 }
 
-std::vector<Buffer::Tag> AudioOut::GetTagsAndReleaseBuffers(StreamPtr stream,
-                                                            std::size_t max_count) {
-    return stream->GetTagsAndReleaseBuffers(max_count);
+std::size_t AudioOut::GetTagsAndReleaseBuffers(StreamPtr stream, Buffer::Tag* tags,
+                                               std::size_t max_count) {
+    return stream->GetTagsAndReleaseBuffers(tags, max_count);
 }
 
 void AudioOut::StartStream(StreamPtr stream) {
@@ -24,8 +24,10 @@ public:
     StreamPtr OpenStream(u32 sample_rate, u32 num_channels, std::string&& name,
                          Stream::ReleaseCallback&& release_callback);
 
-    /// Returns a vector of recently released buffers specified by tag for the specified stream
-    std::vector<Buffer::Tag> GetTagsAndReleaseBuffers(StreamPtr stream, std::size_t max_count);
+    /// Drains tags of recently released buffers for the specified stream into the
+    /// caller-provided array, returning the number of tags written
+    std::size_t GetTagsAndReleaseBuffers(StreamPtr stream, Buffer::Tag* tags,
+                                         std::size_t max_count);
 
     /// Starts an audio stream for playback
     void StartStream(StreamPtr stream);
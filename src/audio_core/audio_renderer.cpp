@@ -8,7 +8,9 @@
 #include "audio_core/codec.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 #include "core/hle/kernel/writable_event.h"
+#include "core/host_scheduling.h"
 #include "core/memory.h"
 
 namespace AudioCore {
@@ -45,6 +47,8 @@ private:
     std::size_t wave_index{};
     std::size_t offset{};
     Codec::ADPCMState adpcm_state{};
+    Codec::ADPCM_Coeff adpcm_coeffs{};
+    VAddr adpcm_coeffs_addr{};
     InterpolationState interp_state{};
     std::vector<s16> samples;
     VoiceOutStatus out_status{};
@@ -84,9 +88,18 @@ AudioRenderer::AudioRenderer(AudioRendererParameter params,
     QueueMixedBuffer(0);
     QueueMixedBuffer(1);
     QueueMixedBuffer(2);
+
+    mix_thread = std::thread([this] { MixThreadFunc(); });
 }
 
-AudioRenderer::~AudioRenderer() = default;
+AudioRenderer::~AudioRenderer() {
+    {
+        std::lock_guard<std::mutex> lock(mix_mutex);
+        mix_thread_running = false;
+    }
+    mix_cv.notify_one();
+    mix_thread.join();
+}
 
 u32 AudioRenderer::GetSampleRate() const {
     return worker_params.sample_rate;
@@ -105,6 +118,9 @@ Stream::State AudioRenderer::GetStreamState() const {
 }
 
 std::vector<u8> AudioRenderer::UpdateAudioRenderer(const std::vector<u8>& input_params) {
+    // Voice and effect state is also read by the mixer thread.
+    std::lock_guard<std::mutex> lock(voice_mutex);
+
     // Copy UpdateDataHeader struct
     UpdateDataHeader config{};
     std::memcpy(&config, input_params.data(), sizeof(UpdateDataHeader));
@@ -237,6 +253,9 @@ void AudioRenderer::VoiceState::UpdateState() {
         wave_index = 0;
         offset = 0;
         out_status = {};
+        // The next voice assigned to this slot may reuse the same guest address for a different
+        // coefficient table, so drop the cached one.
+        adpcm_coeffs_addr = 0;
     }
     is_in_use = info.is_in_use;
 }
@@ -252,11 +271,17 @@ void AudioRenderer::VoiceState::RefreshBuffer() {
         break;
     }
     case Codec::PcmFormat::Adpcm: {
-        // Decode ADPCM to PCM16
-        Codec::ADPCM_Coeff coeffs;
-        Memory::ReadBlock(info.additional_params_addr, coeffs.data(), sizeof(Codec::ADPCM_Coeff));
-        new_samples = Codec::DecodeADPCM(reinterpret_cast<u8*>(new_samples.data()),
-                                         new_samples.size() * sizeof(s16), coeffs, adpcm_state);
+        // Decode ADPCM to PCM16. The coefficient table is fixed for the lifetime of a voice, so
+        // it only has to be read from guest memory again when the game points the voice at a
+        // different table.
+        if (adpcm_coeffs_addr != info.additional_params_addr) {
+            Memory::ReadBlock(info.additional_params_addr, adpcm_coeffs.data(),
+                              sizeof(Codec::ADPCM_Coeff));
+            adpcm_coeffs_addr = info.additional_params_addr;
+        }
+        new_samples =
+            Codec::DecodeADPCM(reinterpret_cast<u8*>(new_samples.data()),
+                               new_samples.size() * sizeof(s16), adpcm_coeffs, adpcm_state);
         break;
     }
     default:
@@ -315,15 +340,21 @@ static constexpr s16 ClampToS16(s32 value) {
     return static_cast<s16>(std::clamp(value, -32768, 32767));
 }
 
-void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
+MICROPROFILE_DEFINE(Audio_MixBuffer, "Audio", "Mix Buffer", MP_RGB(70, 200, 200));
+
+std::vector<s16> AudioRenderer::MixBuffer() {
+    MICROPROFILE_SCOPE(Audio_MixBuffer);
+
     constexpr std::size_t BUFFER_SIZE{512};
     std::vector<s16> buffer(BUFFER_SIZE * stream->GetNumChannels());
 
+    std::lock_guard<std::mutex> lock(voice_mutex);
     for (auto& voice : voices) {
         if (!voice.IsPlaying()) {
             continue;
         }
 
+        const float volume{voice.GetInfo().volume};
         std::size_t offset{};
         s64 samples_remaining{BUFFER_SIZE};
         while (samples_remaining > 0) {
@@ -335,20 +366,64 @@ void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
 
             samples_remaining -= samples.size() / stream->GetNumChannels();
 
-            for (const auto& sample : samples) {
-                const s32 buffer_sample{buffer[offset]};
-                buffer[offset++] =
-                    ClampToS16(buffer_sample + static_cast<s32>(sample * voice.GetInfo().volume));
+            // Kept free of loop-carried dependencies so the compiler can vectorize it.
+            const std::size_t sample_count{samples.size()};
+            for (std::size_t i = 0; i < sample_count; ++i) {
+                buffer[offset + i] = ClampToS16(static_cast<s32>(buffer[offset + i]) +
+                                                static_cast<s32>(samples[i] * volume));
+            }
+            offset += sample_count;
+        }
+    }
+    return buffer;
+}
+
+void AudioRenderer::QueueMixedBuffer(Buffer::Tag tag) {
+    audio_out->QueueBuffer(stream, tag, MixBuffer());
+}
+
+void AudioRenderer::MixThreadFunc() {
+    Core::HostScheduling::ApplyPolicy(Core::HostScheduling::HostThread::Audio);
+    while (true) {
+        Buffer::Tag tag{};
+        {
+            std::unique_lock<std::mutex> lock(mix_mutex);
+            mix_cv.wait(lock, [this] { return !mix_thread_running || !mix_requests.empty(); });
+            if (!mix_thread_running) {
+                return;
             }
+            tag = mix_requests.front();
+            mix_requests.pop();
         }
+
+        auto samples = MixBuffer();
+
+        std::lock_guard<std::mutex> lock(mix_mutex);
+        mixed_buffers.emplace(tag, std::move(samples));
     }
-    audio_out->QueueBuffer(stream, tag, std::move(buffer));
 }
 
 void AudioRenderer::ReleaseAndQueueBuffers() {
-    const auto released_buffers{audio_out->GetTagsAndReleaseBuffers(stream, 2)};
-    for (const auto& tag : released_buffers) {
-        QueueMixedBuffer(tag);
+    // Queue everything the mixer thread finished since the last update, then hand the tags of
+    // the buffers that completed playback over to be remixed.
+    {
+        std::lock_guard<std::mutex> lock(mix_mutex);
+        while (!mixed_buffers.empty()) {
+            auto& mixed = mixed_buffers.front();
+            audio_out->QueueBuffer(stream, mixed.first, std::move(mixed.second));
+            mixed_buffers.pop();
+        }
+    }
+
+    std::array<Buffer::Tag, 2> released_buffers;
+    const std::size_t released_count{
+        audio_out->GetTagsAndReleaseBuffers(stream, released_buffers.data(), 2)};
+    if (released_count > 0) {
+        std::lock_guard<std::mutex> lock(mix_mutex);
+        for (std::size_t i = 0; i < released_count; ++i) {
+            mix_requests.push(released_buffers[i]);
+        }
+        mix_cv.notify_one();
     }
 }
 
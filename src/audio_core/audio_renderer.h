@@ -5,7 +5,12 @@
 #pragma once
 
 #include <array>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "audio_core/stream.h"
@@ -224,12 +229,26 @@ private:
     class EffectState;
     class VoiceState;
 
+    std::vector<s16> MixBuffer();
+    void MixThreadFunc();
+
     AudioRendererParameter worker_params;
     Kernel::SharedPtr<Kernel::WritableEvent> buffer_event;
     std::vector<VoiceState> voices;
     std::vector<EffectState> effects;
     std::unique_ptr<AudioOut> audio_out;
     AudioCore::StreamPtr stream;
+
+    // Mixing runs on a dedicated thread so active voices stop costing emulation-thread time.
+    // voice_mutex guards the voice/effect state shared between mixing and UpdateAudioRenderer;
+    // mix_mutex guards the request/result queues exchanged with the mixer thread.
+    std::mutex voice_mutex;
+    std::mutex mix_mutex;
+    std::condition_variable mix_cv;
+    std::queue<Buffer::Tag> mix_requests;
+    std::queue<std::pair<Buffer::Tag, std::vector<s16>>> mixed_buffers;
+    bool mix_thread_running = true;
+    std::thread mix_thread;
 };
 
 } // namespace AudioCore
@@ -10,6 +10,8 @@
 #include "audio_core/time_stretch.h"
 #include "common/logging/log.h"
 #include "common/ring_buffer.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 
 namespace AudioCore {
@@ -180,6 +182,11 @@ long CubebSinkStream::DataCallback(cubeb_stream* stream, void* user_data, const
         samples_written = impl->queue.Pop(buffer, samples_to_write);
     }
 
+    if (samples_written < samples_to_write) {
+        // AddAudioUnderrun is wait-free, so this cannot stall the real-time audio thread.
+        Core::System::GetInstance().GetPerfStats().AddAudioUnderrun();
+    }
+
     if (samples_written >= num_channels) {
         std::memcpy(&impl->last_frame[0], buffer + (samples_written - num_channels) * sizeof(s16),
                     num_channels * sizeof(s16));
@@ -17,8 +17,6 @@
 
 namespace AudioCore {
 
-constexpr std::size_t MaxAudioBufferCount{32};
-
 u32 Stream::GetNumChannels() const {
     switch (format) {
     case Format::Mono16:
@@ -39,12 +37,13 @@ Stream::Stream(u32 sample_rate, Format format, ReleaseCallback&& release_callbac
       sink_stream{sink_stream}, name{std::move(name_)} {
 
     release_event = CoreTiming::RegisterEvent(
-        name, [this](u64 userdata, int cycles_late) { ReleaseActiveBuffer(); });
+        name, [this](u64 userdata, int cycles_late) { ReleaseDueBuffers(); });
 }
 
 void Stream::Play() {
     state = State::Playing;
     PlayNextBuffer();
+    ArmReleaseEvent();
 }
 
 void Stream::Stop() {
@@ -87,36 +86,61 @@ void Stream::PlayNextBuffer() {
         return;
     }
 
-    if (queued_buffers.empty()) {
+    if (queued_buffers.Empty()) {
         // No queued buffers - we are effectively paused
         sink_stream.Flush();
         return;
     }
 
-    active_buffer = queued_buffers.front();
-    queued_buffers.pop();
+    active_buffer = queued_buffers.Pop();
 
     VolumeAdjustSamples(active_buffer->Samples());
 
     sink_stream.EnqueueSamples(GetNumChannels(), active_buffer->GetSamples());
 
-    CoreTiming::ScheduleEventThreadsafe(GetBufferReleaseCycles(*active_buffer), release_event, {});
+    active_buffer_release_time = CoreTiming::GetTicks() + GetBufferReleaseCycles(*active_buffer);
 }
 
 void Stream::ReleaseActiveBuffer() {
     ASSERT(active_buffer);
-    released_buffers.push(std::move(active_buffer));
+    if (!released_buffers.Push(std::move(active_buffer))) {
+        // The guest has gone a very long time without retrieving released buffers; drop the
+        // oldest tag so that the stream can keep making progress.
+        LOG_WARNING(Audio, "released buffer ring is full, dropping oldest tag");
+        released_buffers.Pop();
+        released_buffers.Push(std::move(active_buffer));
+    }
     release_callback();
     PlayNextBuffer();
 }
 
+void Stream::ReleaseDueBuffers() {
+    release_event_pending = false;
+    // With very small buffers more than one can come due between servicings; release them all in
+    // one pass so that the stream only ever keeps a single timing event in flight instead of
+    // scheduling one per buffer.
+    while (active_buffer && CoreTiming::GetTicks() >= active_buffer_release_time) {
+        ReleaseActiveBuffer();
+    }
+    ArmReleaseEvent();
+}
+
+void Stream::ArmReleaseEvent() {
+    if (release_event_pending || !active_buffer) {
+        return;
+    }
+    release_event_pending = true;
+    const s64 cycles{static_cast<s64>(active_buffer_release_time - CoreTiming::GetTicks())};
+    CoreTiming::ScheduleEventThreadsafe(std::max<s64>(cycles, 0), release_event, {});
+}
+
 bool Stream::QueueBuffer(BufferPtr&& buffer) {
-    if (queued_buffers.size() < MaxAudioBufferCount) {
-        queued_buffers.push(std::move(buffer));
-        PlayNextBuffer();
-        return true;
+    if (!queued_buffers.Push(std::move(buffer))) {
+        return false;
     }
-    return false;
+    PlayNextBuffer();
+    ArmReleaseEvent();
+    return true;
 }
 
 bool Stream::ContainsBuffer(Buffer::Tag tag) const {
@@ -124,13 +148,12 @@ bool Stream::ContainsBuffer(Buffer::Tag tag) const {
     return {};
 }
 
-std::vector<Buffer::Tag> Stream::GetTagsAndReleaseBuffers(std::size_t max_count) {
-    std::vector<Buffer::Tag> tags;
-    for (std::size_t count = 0; count < max_count && !released_buffers.empty(); ++count) {
-        tags.push_back(released_buffers.front()->GetTag());
-        released_buffers.pop();
+std::size_t Stream::GetTagsAndReleaseBuffers(Buffer::Tag* tags, std::size_t max_count) {
+    std::size_t count{};
+    while (count < max_count && !released_buffers.Empty()) {
+        tags[count++] = released_buffers.Pop()->GetTag();
     }
-    return tags;
+    return count;
 }
 
 } // namespace AudioCore
@@ -4,11 +4,10 @@
 
 #pragma once
 
+#include <array>
 #include <functional>
 #include <memory>
 #include <string>
-#include <vector>
-#include <queue>
 
 #include "audio_core/buffer.h"
 #include "common/common_types.h"
@@ -57,8 +56,9 @@ public:
     /// Returns true if the audio stream contains a buffer with the specified tag
     bool ContainsBuffer(Buffer::Tag tag) const;
 
-    /// Returns a vector of recently released buffers specified by tag
-    std::vector<Buffer::Tag> GetTagsAndReleaseBuffers(std::size_t max_count);
+    /// Drains the tags of recently released buffers into the caller-provided array, up to
+    /// max_count of them, and returns the number of tags written
+    std::size_t GetTagsAndReleaseBuffers(Buffer::Tag* tags, std::size_t max_count);
 
     /// Returns true if the stream is currently playing
     bool IsPlaying() const {
@@ -67,7 +67,7 @@ public:
 
     /// Returns the number of queued buffers
     std::size_t GetQueueSize() const {
-        return queued_buffers.size();
+        return queued_buffers.Size();
     }
 
     /// Gets the sample rate
@@ -82,12 +82,58 @@ public:
     State GetState() const;
 
 private:
+    /// Maximum number of buffers a stream can hold queued at one time
+    static constexpr std::size_t MaxAudioBufferCount{32};
+
+    /// Fixed-capacity FIFO of buffers. Stream buffer counts are small and bounded, so slots are
+    /// recycled in place instead of std::queue allocating a node per push.
+    template <std::size_t Capacity>
+    struct BufferRing {
+        /// Appends a buffer to the ring, returning false if the ring is full
+        bool Push(BufferPtr&& buffer) {
+            if (count == Capacity) {
+                return false;
+            }
+            slots[write_index] = std::move(buffer);
+            write_index = (write_index + 1) % Capacity;
+            ++count;
+            return true;
+        }
+
+        /// Removes and returns the oldest buffer in the ring
+        BufferPtr Pop() {
+            BufferPtr buffer{std::move(slots[read_index])};
+            read_index = (read_index + 1) % Capacity;
+            --count;
+            return buffer;
+        }
+
+        std::size_t Size() const {
+            return count;
+        }
+
+        bool Empty() const {
+            return count == 0;
+        }
+
+        std::array<BufferPtr, Capacity> slots;
+        std::size_t read_index{};
+        std::size_t write_index{};
+        std::size_t count{};
+    };
+
     /// Plays the next queued buffer in the audio stream, starting playback if necessary
     void PlayNextBuffer();
 
     /// Releases the actively playing buffer, signalling that it has been completed
     void ReleaseActiveBuffer();
 
+    /// Releases every buffer whose playback window has elapsed and re-arms the release event
+    void ReleaseDueBuffers();
+
+    /// Schedules the release timing event for the active buffer if one is not already pending
+    void ArmReleaseEvent();
+
     /// Gets the number of core cycles when the specified buffer will be released
     s64 GetBufferReleaseCycles(const Buffer& buffer) const;
 
@@ -96,11 +142,14 @@ private:
     ReleaseCallback release_callback;       ///< Buffer release callback for the stream
     State state{State::Stopped};            ///< Playback state of the stream
     CoreTiming::EventType* release_event{}; ///< Core timing release event for the stream
+    bool release_event_pending{};           ///< Whether the release event is currently scheduled
+    u64 active_buffer_release_time{};       ///< Tick count at which the active buffer is due
     BufferPtr active_buffer;                ///< Actively playing buffer in the stream
-    std::queue<BufferPtr> queued_buffers;   ///< Buffers queued to be played in the stream
-    std::queue<BufferPtr> released_buffers; ///< Buffers recently released from the stream
-    SinkStream& sink_stream;                ///< Output sink for the stream
-    std::string name;                       ///< Name of the stream, must be unique
+    BufferRing<MaxAudioBufferCount> queued_buffers; ///< Buffers queued to be played in the stream
+    BufferRing<MaxAudioBufferCount * 2>
+        released_buffers;  ///< Buffers recently released from the stream
+    SinkStream& sink_stream; ///< Output sink for the stream
+    std::string name;        ///< Name of the stream, must be unique
 };
 
 using StreamPtr = std::shared_ptr<Stream>;
@@ -3,14 +3,18 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include "audio_core/time_stretch.h"
 #include "common/logging/log.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
 
 namespace AudioCore {
 
-TimeStretcher::TimeStretcher(u32 sample_rate, u32 channel_count) : m_sample_rate{sample_rate} {
+TimeStretcher::TimeStretcher(u32 sample_rate, u32 channel_count)
+    : m_sample_rate{sample_rate}, m_channel_count{channel_count} {
     m_sound_touch.setChannels(channel_count);
     m_sound_touch.setSampleRate(sample_rate);
     m_sound_touch.setPitch(1.0);
@@ -19,6 +23,8 @@ TimeStretcher::TimeStretcher(u32 sample_rate, u32 channel_count) : m_sample_rate
 
 void TimeStretcher::Clear() {
     m_sound_touch.clear();
+    m_linear_backlog.clear();
+    m_linear_pos = 0.0;
 }
 
 void TimeStretcher::Flush() {
@@ -29,12 +35,67 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
                                    std::size_t num_out) {
     const double time_delta = static_cast<double>(num_out) / m_sample_rate; // seconds
 
+    SelectTier(time_delta);
+
+    if (m_use_linear_tier) {
+        return ProcessLinear(in, num_in, out, num_out);
+    }
+    return ProcessWsola(in, num_in, out, num_out);
+}
+
+void TimeStretcher::SelectTier(double time_delta) {
+    const double frame_scale = Core::System::GetInstance().GetPerfStats().GetLastFrameTimeScale();
+
+    // Smooth over a couple of seconds so a single slow frame doesn't flip tiers back and forth.
+    constexpr double lpf_time_scale = 2.0; // seconds
+    const double lpf_gain = 1.0 - std::exp(-time_delta / lpf_time_scale);
+    m_smoothed_frame_scale += lpf_gain * (frame_scale - m_smoothed_frame_scale);
+
+    // WSOLA costs the most CPU exactly when the host has none to spare, so drop to linear
+    // interpolation under sustained slowdown. The thresholds overlap so the tiers don't
+    // oscillate around the switch point.
+    const bool use_linear =
+        m_use_linear_tier ? m_smoothed_frame_scale > 1.05 : m_smoothed_frame_scale > 1.15;
+    if (use_linear == m_use_linear_tier) {
+        return;
+    }
+    m_use_linear_tier = use_linear;
+
+    if (use_linear) {
+        LOG_DEBUG(Audio, "Sustained slowdown (x{:.2f} frame time): using linear stretch tier",
+                  m_smoothed_frame_scale);
+
+        // Migrate whatever WSOLA still has buffered so nothing is dropped on the switch.
+        m_sound_touch.flush();
+        std::array<s16, 4096> chunk;
+        const u32 chunk_frames = static_cast<u32>(chunk.size()) / m_channel_count;
+        u32 received;
+        while ((received = m_sound_touch.receiveSamples(chunk.data(), chunk_frames)) > 0) {
+            m_linear_backlog.insert(m_linear_backlog.end(), chunk.begin(),
+                                    chunk.begin() + received * m_channel_count);
+        }
+        m_sound_touch.clear();
+    } else {
+        LOG_DEBUG(Audio, "Slowdown over (x{:.2f} frame time): using WSOLA stretch tier",
+                  m_smoothed_frame_scale);
+
+        m_sound_touch.putSamples(m_linear_backlog.data(),
+                                 static_cast<u32>(m_linear_backlog.size() / m_channel_count));
+        m_linear_backlog.clear();
+        m_linear_pos = 0.0;
+    }
+}
+
+std::size_t TimeStretcher::UpdateStretchRatio(std::size_t backlog_frames, std::size_t num_in,
+                                              std::size_t num_out) {
+    const double time_delta = static_cast<double>(num_out) / m_sample_rate; // seconds
+
     // We were given actual_samples number of samples, and num_samples were requested from us.
     double current_ratio = static_cast<double>(num_in) / static_cast<double>(num_out);
 
     const double max_latency = 0.25; // seconds
     const double max_backlog = m_sample_rate * max_latency;
-    const double backlog_fullness = m_sound_touch.numSamples() / max_backlog;
+    const double backlog_fullness = backlog_frames / max_backlog;
     if (backlog_fullness > 4.0) {
         // Too many samples in backlog: Don't push anymore on
         num_in = 0;
@@ -56,13 +117,57 @@ std::size_t TimeStretcher::Process(const s16* in, std::size_t num_in, s16* out,
     // Place a lower limit of 5% speed.  When a game boots up, there will be
     // many silence samples.  These do not need to be timestretched.
     m_stretch_ratio = std::max(m_stretch_ratio, 0.05);
-    m_sound_touch.setTempo(m_stretch_ratio);
 
     LOG_TRACE(Audio, "{:5}/{:5} ratio:{:0.6f} backlog:{:0.6f}", num_in, num_out, m_stretch_ratio,
               backlog_fullness);
 
+    return num_in;
+}
+
+std::size_t TimeStretcher::ProcessWsola(const s16* in, std::size_t num_in, s16* out,
+                                        std::size_t num_out) {
+    num_in = UpdateStretchRatio(m_sound_touch.numSamples(), num_in, num_out);
+    m_sound_touch.setTempo(m_stretch_ratio);
+
     m_sound_touch.putSamples(in, static_cast<u32>(num_in));
     return m_sound_touch.receiveSamples(out, static_cast<u32>(num_out));
 }
 
+std::size_t TimeStretcher::ProcessLinear(const s16* in, std::size_t num_in, s16* out,
+                                         std::size_t num_out) {
+    num_in = UpdateStretchRatio(m_linear_backlog.size() / m_channel_count, num_in, num_out);
+
+    m_linear_backlog.insert(m_linear_backlog.end(), in, in + num_in * m_channel_count);
+
+    // Resample the backlog by linear interpolation, consuming m_stretch_ratio input frames per
+    // output frame. This trades WSOLA's pitch preservation for a near-zero per-sample cost.
+    const std::size_t available = m_linear_backlog.size() / m_channel_count;
+    const double step = m_stretch_ratio;
+
+    std::size_t written = 0;
+    for (; written < num_out; ++written) {
+        const double pos = m_linear_pos + static_cast<double>(written) * step;
+        const std::size_t index = static_cast<std::size_t>(pos);
+        if (index + 1 >= available) {
+            // Underrun: the sink pads the remainder with the last frame
+            break;
+        }
+        const double frac = pos - static_cast<double>(index);
+        const s16* const frame0 = &m_linear_backlog[index * m_channel_count];
+        const s16* const frame1 = frame0 + m_channel_count;
+        for (std::size_t ch = 0; ch < m_channel_count; ++ch) {
+            out[written * m_channel_count + ch] =
+                static_cast<s16>(frame0[ch] + frac * (frame1[ch] - frame0[ch]));
+        }
+    }
+
+    m_linear_pos += static_cast<double>(written) * step;
+    const std::size_t consumed = std::min(static_cast<std::size_t>(m_linear_pos), available);
+    m_linear_backlog.erase(m_linear_backlog.begin(),
+                           m_linear_backlog.begin() + consumed * m_channel_count);
+    m_linear_pos -= static_cast<double>(consumed);
+
+    return written;
+}
+
 } // namespace AudioCore
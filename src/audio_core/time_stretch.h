@@ -5,6 +5,7 @@
 #pragma once
 
 #include <cstddef>
+#include <vector>
 #include <SoundTouch.h>
 #include "common/common_types.h"
 
@@ -26,9 +27,31 @@ public:
     void Flush();
 
 private:
+    std::size_t ProcessWsola(const s16* in, std::size_t num_in, s16* out, std::size_t num_out);
+    std::size_t ProcessLinear(const s16* in, std::size_t num_in, s16* out, std::size_t num_out);
+
+    /// Updates m_stretch_ratio from the current backlog fullness and in/out frame counts,
+    /// and returns the number of input frames to actually accept (0 when the backlog is full).
+    std::size_t UpdateStretchRatio(std::size_t backlog_frames, std::size_t num_in,
+                                   std::size_t num_out);
+
+    /// Picks the processing tier for this callback based on sustained emulation slowdown.
+    void SelectTier(double time_delta);
+
     u32 m_sample_rate;
+    u32 m_channel_count;
     soundtouch::SoundTouch m_sound_touch;
     double m_stretch_ratio = 1.0;
+
+    /// Low-pass filtered walltime/emulated-time ratio used for tier selection
+    double m_smoothed_frame_scale = 1.0;
+    /// True while the cheap linear-interpolation tier is active instead of WSOLA
+    bool m_use_linear_tier = false;
+
+    /// Pending interleaved input frames for the linear tier
+    std::vector<s16> m_linear_backlog;
+    /// Fractional read position (in frames) into m_linear_backlog
+    double m_linear_pos = 0.0;
 };
 
 } // namespace AudioCore
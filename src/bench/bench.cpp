@@ -0,0 +1,222 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include <fmt/format.h>
+#include "common/cityhash.h"
+#include "common/common_types.h"
+#include "common/fast_hash.h"
+#include "core/core_timing.h"
+#include "core/core_timing_util.h"
+#include "video_core/morton.h"
+#include "video_core/textures/astc.h"
+#include "video_core/textures/decoders.h"
+
+// Microbenchmarks for the hot emulation kernels. Each benchmark prints a single JSON line so CI
+// can diff per-commit results; timings are the minimum over several repetitions of a calibrated
+// batch, which filters out scheduler noise without requiring a quiesced machine.
+
+namespace {
+
+/// Prevents the compiler from optimizing away a computed value.
+template <typename T>
+void DoNotOptimize(const T& value) {
+#if defined(_MSC_VER) && !defined(__clang__)
+    static volatile const T* sink;
+    sink = &value;
+#else
+    asm volatile("" : : "r,m"(value) : "memory");
+#endif
+}
+
+/// Runs func in calibrated batches and reports the best time per iteration as one JSON line.
+/// bytes_per_iteration may be zero for benchmarks where throughput is meaningless.
+template <typename Func>
+void RunBenchmark(const std::string& name, std::size_t bytes_per_iteration, Func&& func) {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::chrono::nanoseconds target_batch_time{100'000'000};
+    constexpr int num_repetitions = 5;
+
+    // Calibrate the batch size so a batch runs for roughly target_batch_time
+    u64 batch_iterations = 1;
+    while (true) {
+        const auto start = Clock::now();
+        for (u64 i = 0; i < batch_iterations; ++i) {
+            func();
+        }
+        const auto elapsed = Clock::now() - start;
+        if (elapsed >= target_batch_time || batch_iterations >= (1ULL << 30)) {
+            break;
+        }
+        batch_iterations *= 2;
+    }
+
+    auto best = std::chrono::nanoseconds::max();
+    for (int rep = 0; rep < num_repetitions; ++rep) {
+        const auto start = Clock::now();
+        for (u64 i = 0; i < batch_iterations; ++i) {
+            func();
+        }
+        const auto elapsed =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+        best = std::min(best, elapsed);
+    }
+
+    const double ns_per_iteration = static_cast<double>(best.count()) / batch_iterations;
+    const double bytes_per_second =
+        bytes_per_iteration != 0 ? bytes_per_iteration / (ns_per_iteration * 1e-9) : 0.0;
+    fmt::print("{{\"name\":\"{}\",\"iterations\":{},\"ns_per_iteration\":{:.1f},"
+               "\"bytes_per_second\":{:.0f}}}\n",
+               name, batch_iterations, ns_per_iteration, bytes_per_second);
+}
+
+std::vector<u8> MakeRandomBuffer(std::size_t size) {
+    std::mt19937_64 rng{0xF00DBEEFDEADCAFE};
+    std::vector<u8> buffer(size);
+    for (auto& byte : buffer) {
+        byte = static_cast<u8>(rng());
+    }
+    return buffer;
+}
+
+void BenchCityHash() {
+    const auto small = MakeRandomBuffer(64);
+    const auto page = MakeRandomBuffer(4096);
+    const auto shader = MakeRandomBuffer(1024 * 1024);
+    const auto texture = MakeRandomBuffer(8 * 1024 * 1024);
+
+    RunBenchmark("cityhash64_64b", small.size(), [&] {
+        DoNotOptimize(Common::CityHash64(reinterpret_cast<const char*>(small.data()), small.size()));
+    });
+    RunBenchmark("cityhash64_4k", page.size(), [&] {
+        DoNotOptimize(Common::CityHash64(reinterpret_cast<const char*>(page.data()), page.size()));
+    });
+    RunBenchmark("cityhash64_1m", shader.size(), [&] {
+        DoNotOptimize(
+            Common::CityHash64(reinterpret_cast<const char*>(shader.data()), shader.size()));
+    });
+    RunBenchmark("cityhash64_8m", texture.size(), [&] {
+        DoNotOptimize(
+            Common::CityHash64(reinterpret_cast<const char*>(texture.data()), texture.size()));
+    });
+}
+
+void BenchFastHash() {
+    const auto page = MakeRandomBuffer(4096);
+    const auto shader = MakeRandomBuffer(1024 * 1024);
+    const auto texture = MakeRandomBuffer(8 * 1024 * 1024);
+
+    RunBenchmark("fast_hash64_4k", page.size(),
+                 [&] { DoNotOptimize(Common::FastHash64(page.data(), page.size())); });
+    RunBenchmark("fast_hash64_1m", shader.size(),
+                 [&] { DoNotOptimize(Common::FastHash64(shader.data(), shader.size())); });
+    RunBenchmark("fast_hash64_8m", texture.size(),
+                 [&] { DoNotOptimize(Common::FastHash64(texture.data(), texture.size())); });
+
+    // Streaming in cache-sized chunks, as a consumer hashing while copying would
+    RunBenchmark("fast_hash64_stream_8m", texture.size(), [&] {
+        Common::FastHashState state;
+        constexpr std::size_t chunk_size = 64 * 1024;
+        for (std::size_t offset = 0; offset < texture.size(); offset += chunk_size) {
+            state.Update(texture.data() + offset, chunk_size);
+        }
+        DoNotOptimize(state.Finalize());
+    });
+}
+
+void BenchSwizzle() {
+    constexpr u32 width = 1024;
+    constexpr u32 height = 1024;
+    constexpr u32 bytes_per_pixel = 4;
+    constexpr u32 block_height = 16;
+
+    auto swizzled = MakeRandomBuffer(width * height * bytes_per_pixel);
+    std::vector<u8> unswizzled(swizzled.size());
+
+    RunBenchmark("unswizzle_1024x1024_4bpp", swizzled.size(), [&] {
+        Tegra::Texture::CopySwizzledData(width, height, 1, bytes_per_pixel, bytes_per_pixel,
+                                         swizzled.data(), unswizzled.data(), true, block_height, 1,
+                                         0);
+        DoNotOptimize(unswizzled[0]);
+    });
+    RunBenchmark("swizzle_1024x1024_4bpp", swizzled.size(), [&] {
+        Tegra::Texture::CopySwizzledData(width, height, 1, bytes_per_pixel, bytes_per_pixel,
+                                         swizzled.data(), unswizzled.data(), false, block_height, 1,
+                                         0);
+        DoNotOptimize(swizzled[0]);
+    });
+}
+
+void BenchMortonCopy() {
+    constexpr u32 width = 1280;
+    constexpr u32 height = 720;
+    constexpr u32 bytes_per_pixel = 4;
+
+    auto morton = MakeRandomBuffer(width * height * bytes_per_pixel);
+    std::vector<u8> linear(morton.size());
+
+    RunBenchmark("morton_copy_128_1280x720_4bpp", morton.size(), [&] {
+        VideoCore::MortonCopyPixels128(width, height, bytes_per_pixel, bytes_per_pixel,
+                                       morton.data(), linear.data(), true);
+        DoNotOptimize(linear[0]);
+    });
+}
+
+void BenchAstcDecompress() {
+    constexpr u32 width = 256;
+    constexpr u32 height = 256;
+    constexpr u32 block_width = 8;
+    constexpr u32 block_height = 8;
+
+    // 16 bytes per block, regardless of the block footprint
+    auto data =
+        MakeRandomBuffer(((width + block_width - 1) / block_width) *
+                         ((height + block_height - 1) / block_height) * 16);
+
+    RunBenchmark("astc_decompress_256x256_8x8", width * height * 4, [&] {
+        DoNotOptimize(
+            Tegra::Texture::ASTC::Decompress(data, width, height, 1, block_width, block_height));
+    });
+}
+
+void BenchCoreTiming() {
+    CoreTiming::Init();
+    CoreTiming::EventType* event =
+        CoreTiming::RegisterEvent("bench_event", [](u64, s64) {});
+
+    // Schedule/unschedule keeps the event queue at a steady size, which isolates the cost of
+    // maintaining the heap from the cost of running callbacks.
+    RunBenchmark("core_timing_schedule_unschedule", 0, [&] {
+        CoreTiming::ScheduleEvent(10000, event, 0);
+        CoreTiming::UnscheduleEvent(event, 0);
+    });
+
+    RunBenchmark("core_timing_get_ticks", 0, [&] { DoNotOptimize(CoreTiming::GetTicks()); });
+
+    // A moving input keeps the compiler from hoisting the whole conversion out of the loop.
+    s64 ns = 0;
+    RunBenchmark("core_timing_ns_to_cycles", 0, [&] {
+        ns += 16667;
+        DoNotOptimize(CoreTiming::nsToCycles(ns));
+    });
+
+    CoreTiming::Shutdown();
+}
+
+} // Anonymous namespace
+
+int main() {
+    BenchCityHash();
+    BenchFastHash();
+    BenchSwizzle();
+    BenchMortonCopy();
+    BenchAstcDecompress();
+    BenchCoreTiming();
+    return 0;
+}
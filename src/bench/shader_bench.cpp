@@ -0,0 +1,215 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#define SDL_MAIN_HANDLED
+#include <SDL.h>
+#include <fmt/format.h>
+#include <glad/glad.h>
+
+#include "common/common_paths.h"
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/renderer_opengl/gl_shader_gen.h"
+
+// Offline compile benchmark for the shader corpus captured with the dump_shader_corpus setting.
+// Each corpus file holds the raw Maxwell bytecode of one guest shader, named
+// <unique_identifier>-<stage>.bin; this tool replays every file through the GLSL decompiler and
+// a real driver compile/link against a hidden GL 4.3 context, printing one JSON line per shader
+// plus aggregate totals so decompiler and driver regressions can be measured without a title.
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct CorpusEntry {
+    std::string path;
+    std::string name;  ///< File name without the .bin extension, used as the report key
+    std::string stage; ///< vs, vsa, vsb, gs or fs
+};
+
+struct ShaderTiming {
+    s64 decompile_ns = 0;
+    s64 compile_ns = 0;
+    std::size_t glsl_bytes = 0;
+    bool compiled = false;
+};
+
+/// Reads a corpus file into a zero-padded program buffer of the size the decompiler expects
+OpenGL::GLShader::ProgramCode ReadProgram(const std::string& path) {
+    OpenGL::GLShader::ProgramCode code(OpenGL::GLShader::MAX_PROGRAM_CODE_LENGTH);
+    FileUtil::IOFile file{path, "rb"};
+    if (file.IsOpen()) {
+        const std::size_t size =
+            std::min<std::size_t>(file.GetSize(), code.size() * sizeof(u64)) / sizeof(u64);
+        file.ReadBytes(code.data(), size * sizeof(u64));
+    }
+    return code;
+}
+
+/// Compiles the generated GLSL the way the shader cache does: one shader object linked into a
+/// separable program. Forces completion by querying the link status.
+bool CompileAndLink(const std::string& source, GLenum gl_type) {
+    const GLuint shader = glCreateShader(gl_type);
+    const char* source_string = source.c_str();
+    glShaderSource(shader, 1, &source_string, nullptr);
+    glCompileShader(shader);
+
+    const GLuint program = glCreateProgram();
+    glProgramParameteri(program, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    glAttachShader(program, shader);
+    glLinkProgram(program);
+
+    GLint link_status = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+
+    glDetachShader(program, shader);
+    glDeleteShader(shader);
+    glDeleteProgram(program);
+    return link_status == GL_TRUE;
+}
+
+/// Decompiles and compiles one corpus entry, timing both phases separately
+ShaderTiming BenchmarkShader(const CorpusEntry& entry, const std::string& corpus_dir) {
+    OpenGL::GLShader::ShaderSetup setup{ReadProgram(entry.path)};
+    if (entry.stage == "vsa") {
+        // Dual vertex programs are captured as a pair; the VertexB half shares the identifier
+        const std::string path_b = corpus_dir + entry.name.substr(0, 16) + "-vsb.bin";
+        setup.SetProgramB(ReadProgram(path_b));
+    }
+
+    GLenum gl_type{};
+    ShaderTiming timing;
+    OpenGL::GLShader::ProgramResult result;
+
+    const auto decompile_start = Clock::now();
+    if (entry.stage == "vs" || entry.stage == "vsa") {
+        result = OpenGL::GLShader::GenerateVertexShader(setup);
+        gl_type = GL_VERTEX_SHADER;
+    } else if (entry.stage == "gs") {
+        result = OpenGL::GLShader::GenerateGeometryShader(setup);
+        gl_type = GL_GEOMETRY_SHADER;
+    } else if (entry.stage == "fs") {
+        result = OpenGL::GLShader::GenerateFragmentShader(setup);
+        gl_type = GL_FRAGMENT_SHADER;
+    }
+    timing.decompile_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - decompile_start)
+            .count();
+
+    std::string source = result.first;
+    if (gl_type == GL_GEOMETRY_SHADER) {
+        // Geometry sources carry no topology header; the cache prepends one per input topology.
+        // Benchmark a single representative variant.
+        source = "#version 430 core\nlayout (triangles) in;\n#define MAX_VERTEX_INPUT 3\n" +
+                 result.first;
+    }
+    timing.glsl_bytes = source.size();
+
+    const auto compile_start = Clock::now();
+    timing.compiled = CompileAndLink(source, gl_type);
+    timing.compile_ns =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - compile_start).count();
+    return timing;
+}
+
+/// Collects every parseable corpus file. VertexB pair halves are skipped, they are consumed
+/// together with their VertexA file.
+std::vector<CorpusEntry> CollectCorpus(const std::string& corpus_dir) {
+    std::vector<CorpusEntry> entries;
+    FileUtil::ForeachDirectoryEntry(
+        nullptr, corpus_dir,
+        [&entries](u64*, const std::string& directory, const std::string& virtual_name) {
+            constexpr char extension[] = ".bin";
+            const auto separator = virtual_name.find('-');
+            if (separator != 16 || virtual_name.size() <= separator + sizeof(extension)) {
+                return true;
+            }
+            const std::string stage = virtual_name.substr(
+                separator + 1, virtual_name.size() - separator - sizeof(extension));
+            if (stage != "vs" && stage != "vsa" && stage != "gs" && stage != "fs") {
+                return true;
+            }
+            entries.push_back({directory + DIR_SEP + virtual_name,
+                               virtual_name.substr(0, virtual_name.size() + 1 -
+                                                          sizeof(extension)),
+                               stage});
+            return true;
+        });
+    std::sort(entries.begin(), entries.end(),
+              [](const CorpusEntry& lhs, const CorpusEntry& rhs) { return lhs.name < rhs.name; });
+    return entries;
+}
+
+} // Anonymous namespace
+
+int main(int argc, char** argv) {
+    const std::string corpus_dir =
+        argc > 1 ? std::string(argv[1]) + DIR_SEP
+                 : FileUtil::GetUserPath(FileUtil::UserPath::DumpDir) + "shader_corpus/";
+
+    const auto entries = CollectCorpus(corpus_dir);
+    if (entries.empty()) {
+        fmt::print(stderr, "No corpus files found in {}\n", corpus_dir);
+        fmt::print(stderr, "Capture one by running a title with dump_shader_corpus enabled,\n");
+        fmt::print(stderr, "or pass the corpus directory as the first argument.\n");
+        return EXIT_FAILURE;
+    }
+
+    SDL_SetMainReady();
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        fmt::print(stderr, "Failed to initialize SDL2: {}\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 4);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+    SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+    SDL_Window* const window = SDL_CreateWindow("yuzu-shader-bench", SDL_WINDOWPOS_UNDEFINED,
+                                                SDL_WINDOWPOS_UNDEFINED, 64, 64,
+                                                SDL_WINDOW_OPENGL | SDL_WINDOW_HIDDEN);
+    if (window == nullptr) {
+        fmt::print(stderr, "Failed to create window: {}\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    const SDL_GLContext context = SDL_GL_CreateContext(window);
+    if (context == nullptr) {
+        fmt::print(stderr, "Failed to create GL 4.3 context: {}\n", SDL_GetError());
+        return EXIT_FAILURE;
+    }
+    if (!gladLoadGLLoader(static_cast<GLADloadproc>(SDL_GL_GetProcAddress))) {
+        fmt::print(stderr, "Failed to initialize GL function pointers\n");
+        return EXIT_FAILURE;
+    }
+    fmt::print(stderr, "GL_RENDERER: {}\n", reinterpret_cast<const char*>(glGetString(GL_RENDERER)));
+
+    s64 total_decompile_ns = 0;
+    s64 total_compile_ns = 0;
+    std::size_t failed = 0;
+    for (const auto& entry : entries) {
+        const ShaderTiming timing = BenchmarkShader(entry, corpus_dir);
+        total_decompile_ns += timing.decompile_ns;
+        total_compile_ns += timing.compile_ns;
+        if (!timing.compiled) {
+            ++failed;
+        }
+        fmt::print("{{\"name\":\"{}\",\"stage\":\"{}\",\"decompile_ns\":{},\"compile_ns\":{},"
+                   "\"glsl_bytes\":{},\"compiled\":{}}}\n",
+                   entry.name, entry.stage, timing.decompile_ns, timing.compile_ns,
+                   timing.glsl_bytes, timing.compiled);
+    }
+    fmt::print("{{\"name\":\"total\",\"shaders\":{},\"decompile_ns\":{},\"compile_ns\":{},"
+               "\"failed\":{}}}\n",
+               entries.size(), total_decompile_ns, total_compile_ns, failed);
+
+    SDL_GL_DeleteContext(context);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+    return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -36,6 +36,7 @@
 #define LOAD_DIR "load"
 #define DUMP_DIR "dump"
 #define LOG_DIR "log"
+#define SHADER_DIR "shader"
 
 // Filenames
 // Files in the directory returned by GetUserPath(UserPath::ConfigDir)
@@ -2,12 +2,26 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
-#include <thread>
+#include <algorithm>
+#include <chrono>
 #include "common/assert.h"
 #include "common/detached_tasks.h"
+#include "common/logging/log.h"
 
 namespace Common {
 
+/// Upper bound on queued fire-and-forget tasks; excess ones are dropped.
+constexpr std::size_t MAX_QUEUED_TASKS = 64;
+
+/// How long program exit may wait for in-flight tasks before abandoning them.
+constexpr std::chrono::seconds MAX_SHUTDOWN_WAIT{5};
+
+/// Number of pool threads. Small and fixed: the pool exists to absorb occasional asynchronous
+/// work (telemetry, decoding, readahead), not to saturate the machine.
+static std::size_t NumWorkers() {
+    return std::clamp<std::size_t>(std::thread::hardware_concurrency() / 4, 2, 4);
+}
+
 DetachedTasks* DetachedTasks::instance = nullptr;
 
 DetachedTasks::DetachedTasks() {
@@ -16,26 +30,115 @@ DetachedTasks::DetachedTasks() {
 }
 
 void DetachedTasks::WaitForAllTasks() {
-    std::unique_lock<std::mutex> lock(mutex);
-    cv.wait(lock, [this]() { return count == 0; });
+    std::unique_lock<std::mutex> lock(state->mutex);
+    const bool done = state->cv.wait_for(lock, MAX_SHUTDOWN_WAIT, [this] {
+        return state->QueuesEmpty() && state->busy_workers == 0;
+    });
+    if (done) {
+        return;
+    }
+
+    // A task is stuck, likely on network I/O. Exiting promptly matters more than completing it,
+    // so abandon the workers; they only reference the shared state, which outlives this object.
+    LOG_WARNING(Common, "Abandoning {} unfinished detached task(s) after waiting {} seconds",
+                state->QueuedTasks() + state->busy_workers, MAX_SHUTDOWN_WAIT.count());
+    for (auto& queue : state->queues) {
+        queue.clear();
+    }
+    state->stop = true;
+    abandoned = true;
+    lock.unlock();
+    state->cv.notify_all();
+    for (auto& worker : workers) {
+        worker.detach();
+    }
 }
 
 DetachedTasks::~DetachedTasks() {
-    std::unique_lock<std::mutex> lock(mutex);
-    ASSERT(count == 0);
+    if (abandoned) {
+        instance = nullptr;
+        return;
+    }
+    {
+        std::unique_lock<std::mutex> lock(state->mutex);
+        ASSERT(state->QueuesEmpty() && state->busy_workers == 0);
+        state->stop = true;
+    }
+    state->cv.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
     instance = nullptr;
 }
 
 void DetachedTasks::AddTask(std::function<void()> task) {
-    std::unique_lock<std::mutex> lock(instance->mutex);
-    ++instance->count;
-    std::thread([task{std::move(task)}]() {
+    AddTask(Priority::Background, std::move(task));
+}
+
+void DetachedTasks::AddTask(Priority priority, std::function<void()> task) {
+    {
+        std::unique_lock<std::mutex> lock(instance->state->mutex);
+        if (instance->state->QueuedTasks() >= MAX_QUEUED_TASKS) {
+            LOG_WARNING(Common, "Detached task queue is full, dropping task");
+            return;
+        }
+    }
+    Enqueue(priority, std::move(task));
+}
+
+std::future<void> DetachedTasks::AddTaskWithHandle(Priority priority, std::function<void()> task) {
+    auto promise = std::make_shared<std::promise<void>>();
+    auto future = promise->get_future();
+    Enqueue(priority, [promise = std::move(promise), task = std::move(task)] {
+        task();
+        promise->set_value();
+    });
+    return future;
+}
+
+void DetachedTasks::Enqueue(Priority priority, std::function<void()> task) {
+    auto& state = instance->state;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    state->queues[static_cast<std::size_t>(priority)].push_back(std::move(task));
+
+    // The pool is created on first use so that invocations which never submit a task don't pay
+    // for idle threads.
+    if (instance->workers.empty()) {
+        const std::size_t num_workers = NumWorkers();
+        instance->workers.reserve(num_workers);
+        for (std::size_t i = 0; i < num_workers; ++i) {
+            instance->workers.emplace_back(&DetachedTasks::RunWorker, instance);
+        }
+    }
+    lock.unlock();
+    state->cv.notify_all();
+}
+
+void DetachedTasks::RunWorker() {
+    // Keep the state alive even if WaitForAllTasks() abandons this thread.
+    const auto state = this->state;
+    std::unique_lock<std::mutex> lock(state->mutex);
+    while (true) {
+        state->cv.wait(lock, [&state] { return state->stop || !state->QueuesEmpty(); });
+        if (state->QueuesEmpty()) {
+            return;
+        }
+        // Drain the latency-sensitive lane before the background one
+        auto& queue = state->queues[0].empty() ? state->queues[1] : state->queues[0];
+        auto task = std::move(queue.front());
+        queue.pop_front();
+        ++state->busy_workers;
+        lock.unlock();
         task();
-        std::unique_lock<std::mutex> lock(instance->mutex);
-        --instance->count;
-        std::notify_all_at_thread_exit(instance->cv, std::move(lock));
-    })
-        .detach();
+        lock.lock();
+        --state->busy_workers;
+        state->cv.notify_all();
+        if (state->stop) {
+            return;
+        }
+    }
 }
 
 } // namespace Common
@@ -4,8 +4,15 @@
 
 #pragma once
 
+#include <array>
 #include <condition_variable>
+#include <deque>
 #include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace Common {
 
@@ -20,21 +27,72 @@ namespace Common {
  * To make detached task safe, a single DetachedTasks object should be placed in the main(), and
  * call WaitForAllTasks() after all program execution but before global/static variable destruction.
  * Any potentially unsafe detached task should be executed via DetachedTasks::AddTask.
+ *
+ * Tasks run on a small fixed pool of worker threads shared by all submitters, so asynchronous
+ * features can offload work here instead of each spawning threads of their own. Two priority
+ * lanes are provided: latency-sensitive tasks are always dequeued before background ones.
+ * Fire-and-forget submissions go through a bounded queue and are dropped when it is full;
+ * tasks submitted with a wait-handle are never dropped, since their callers block on them and
+ * thereby bound the queue themselves.
  */
 class DetachedTasks {
 public:
+    /// Which queue a task is dispatched from. Latency-sensitive tasks preempt background ones
+    /// in dispatch order only: a running background task is never interrupted.
+    enum class Priority {
+        LatencySensitive,
+        Background,
+    };
+
     DetachedTasks();
     ~DetachedTasks();
+
+    /**
+     * Blocks until all queued tasks have completed, up to a bounded wait. If a task is stuck on
+     * network I/O past the bound, the workers are abandoned so that program exit is not held up;
+     * the remaining tasks are dropped.
+     */
     void WaitForAllTasks();
 
+    /// Queues a fire-and-forget background task; it may be dropped when the queue is full.
     static void AddTask(std::function<void()> task);
 
+    /// Queues a fire-and-forget task on the given lane; it may be dropped when the queue is full.
+    static void AddTask(Priority priority, std::function<void()> task);
+
+    /**
+     * Queues a task and returns a future that becomes ready once it has run, for callers that
+     * need to wait for completion or sequence further work after it. Such tasks are never
+     * dropped. The future carries no value; exceptions must be handled inside the task.
+     */
+    static std::future<void> AddTaskWithHandle(Priority priority, std::function<void()> task);
+
 private:
+    /// Shared with the worker threads so abandoned workers can outlive this object safely.
+    struct State {
+        std::condition_variable cv;
+        std::mutex mutex;
+        /// One queue per Priority value; lower-indexed lanes are dispatched first
+        std::array<std::deque<std::function<void()>>, 2> queues;
+        std::size_t busy_workers = 0;
+        bool stop = false;
+
+        bool QueuesEmpty() const {
+            return queues[0].empty() && queues[1].empty();
+        }
+        std::size_t QueuedTasks() const {
+            return queues[0].size() + queues[1].size();
+        }
+    };
+
+    static void Enqueue(Priority priority, std::function<void()> task);
+    void RunWorker();
+
     static DetachedTasks* instance;
 
-    std::condition_variable cv;
-    std::mutex mutex;
-    int count = 0;
+    std::shared_ptr<State> state = std::make_shared<State>();
+    std::vector<std::thread> workers;
+    bool abandoned = false;
 };
 
 } // namespace Common
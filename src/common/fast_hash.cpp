@@ -0,0 +1,232 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+
+#include "common/fast_hash.h"
+#include "common/uint128.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#endif
+
+// The hash follows the xxHash3 structure: eight 64-bit accumulator lanes absorb 64-byte stripes
+// with a per-stripe rotating key, the lanes are scrambled every 16 stripes to keep the high bits
+// diffusing, and the lanes are folded together with 128-bit multiplies at the end. The stripe
+// kernel is expressed so that the scalar and AVX2 implementations compute bit-identical results,
+// which keeps hashes portable between hosts with different instruction sets.
+
+namespace Common {
+
+namespace {
+
+constexpr std::size_t StripeSize = 64;
+constexpr std::size_t StripesPerBlock = 16;
+
+constexpr u64 Prime64_1 = 0x9E3779B185EBCA87ULL;
+constexpr u64 Prime64_2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr u64 Prime64_3 = 0x165667B19E3779F9ULL;
+constexpr u64 Prime64_4 = 0x85EBCA77C2B2AE63ULL;
+constexpr u64 Prime64_5 = 0x27D4EB2F165667C5ULL;
+constexpr u32 Prime32_1 = 0x9E3779B1U;
+
+constexpr u64 SplitMix64(u64 x) {
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/// 192 bytes of key material; stripe s reads 64 bytes starting at offset s * 8
+constexpr std::array<u64, 24> MakeSecret() {
+    std::array<u64, 24> secret{};
+    u64 seed = 0x5851F42D4C957F2DULL;
+    for (std::size_t i = 0; i < secret.size(); ++i) {
+        seed = SplitMix64(seed);
+        secret[i] = seed;
+    }
+    return secret;
+}
+
+alignas(32) constexpr std::array<u64, 24> Secret = MakeSecret();
+constexpr std::size_t ScrambleKeyOffset = 128; ///< Byte offset of the scramble key in Secret
+
+u64 Read64(const u8* data) {
+    u64 value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+const u8* SecretBytes() {
+    return reinterpret_cast<const u8*>(Secret.data());
+}
+
+void ScrambleScalar(std::array<u64, 8>& acc) {
+    const u8* const key = SecretBytes() + ScrambleKeyOffset;
+    for (std::size_t i = 0; i < 8; ++i) {
+        const u64 value = acc[i] ^ (acc[i] >> 47) ^ Read64(key + 8 * i);
+        acc[i] = value * static_cast<u64>(Prime32_1);
+    }
+}
+
+void ProcessStripesScalar(std::array<u64, 8>& acc, const u8* data, std::size_t count,
+                          std::size_t& stripe_in_block) {
+    for (std::size_t stripe = 0; stripe < count; ++stripe, data += StripeSize) {
+        const u8* const key = SecretBytes() + stripe_in_block * 8;
+        for (std::size_t i = 0; i < 8; ++i) {
+            const u64 input = Read64(data + 8 * i);
+            const u64 mixed = input ^ Read64(key + 8 * i);
+            acc[i] += static_cast<u64>(static_cast<u32>(mixed)) * (mixed >> 32) +
+                      Read64(data + 8 * (i ^ 1));
+        }
+        if (++stripe_in_block == StripesPerBlock) {
+            ScrambleScalar(acc);
+            stripe_in_block = 0;
+        }
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define FASTHASH_AVX2_TARGET
+#else
+#define FASTHASH_AVX2_TARGET __attribute__((target("avx2")))
+#endif
+
+FASTHASH_AVX2_TARGET
+__m256i AccumulateAvx2(__m256i accumulator, const u8* input, const u8* key) {
+    const __m256i data_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(input));
+    const __m256i key_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+    const __m256i mixed = _mm256_xor_si256(data_vec, key_vec);
+    // (u32)mixed * (u32)(mixed >> 32) per 64-bit lane, as in the scalar kernel
+    const __m256i product = _mm256_mul_epu32(mixed, _mm256_srli_epi64(mixed, 32));
+    // Adds each lane's 64-bit neighbour (lane i ^ 1) to the accumulator
+    const __m256i swapped = _mm256_shuffle_epi32(data_vec, _MM_SHUFFLE(1, 0, 3, 2));
+    return _mm256_add_epi64(accumulator, _mm256_add_epi64(product, swapped));
+}
+
+FASTHASH_AVX2_TARGET
+__m256i ScrambleAvx2(__m256i accumulator, const u8* key) {
+    const __m256i key_vec = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key));
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(Prime32_1));
+    __m256i value = _mm256_xor_si256(accumulator, _mm256_srli_epi64(accumulator, 47));
+    value = _mm256_xor_si256(value, key_vec);
+    // 64x32-bit multiply by Prime32_1 modulo 2^64, matching the scalar 64-bit multiply
+    const __m256i product_lo = _mm256_mul_epu32(value, prime);
+    const __m256i product_hi = _mm256_mul_epu32(_mm256_srli_epi64(value, 32), prime);
+    return _mm256_add_epi64(product_lo, _mm256_slli_epi64(product_hi, 32));
+}
+
+FASTHASH_AVX2_TARGET
+void ProcessStripesAvx2(std::array<u64, 8>& acc, const u8* data, std::size_t count,
+                        std::size_t& stripe_in_block) {
+    __m256i acc_lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data()));
+    __m256i acc_hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(acc.data() + 4));
+
+    for (std::size_t stripe = 0; stripe < count; ++stripe, data += StripeSize) {
+        const u8* const key = SecretBytes() + stripe_in_block * 8;
+        acc_lo = AccumulateAvx2(acc_lo, data, key);
+        acc_hi = AccumulateAvx2(acc_hi, data + 32, key + 32);
+        if (++stripe_in_block == StripesPerBlock) {
+            acc_lo = ScrambleAvx2(acc_lo, SecretBytes() + ScrambleKeyOffset);
+            acc_hi = ScrambleAvx2(acc_hi, SecretBytes() + ScrambleKeyOffset + 32);
+            stripe_in_block = 0;
+        }
+    }
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data()), acc_lo);
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(acc.data() + 4), acc_hi);
+}
+
+#undef FASTHASH_AVX2_TARGET
+
+#endif // ARCHITECTURE_x86_64
+
+void ProcessStripes(std::array<u64, 8>& acc, const u8* data, std::size_t count,
+                    std::size_t& stripe_in_block) {
+#ifdef ARCHITECTURE_x86_64
+    static const bool use_avx2 = GetCPUCaps().avx2;
+    if (use_avx2) {
+        ProcessStripesAvx2(acc, data, count, stripe_in_block);
+        return;
+    }
+#endif
+    ProcessStripesScalar(acc, data, count, stripe_in_block);
+}
+
+u64 MixPair(u64 a, u64 b) {
+    return (a * b) ^ MultiplyHigh64(a, b);
+}
+
+u64 Avalanche(u64 x) {
+    x ^= x >> 37;
+    x *= Prime64_3;
+    x ^= x >> 32;
+    return x;
+}
+
+} // Anonymous namespace
+
+FastHashState::FastHashState()
+    : accumulators{{Prime64_1, Prime64_2, Prime64_3, Prime64_4, Prime64_5,
+                    static_cast<u64>(Prime32_1), Prime64_1 ^ Prime64_5, Prime64_2 ^ Prime64_4}} {}
+
+void FastHashState::Update(const void* data, std::size_t len) {
+    const u8* p = static_cast<const u8*>(data);
+    total_len += len;
+
+    if (partial_size > 0) {
+        const std::size_t to_copy = std::min(len, StripeSize - partial_size);
+        std::memcpy(partial.data() + partial_size, p, to_copy);
+        partial_size += to_copy;
+        p += to_copy;
+        len -= to_copy;
+        if (partial_size < StripeSize) {
+            return;
+        }
+        ProcessStripes(accumulators, partial.data(), 1, stripe_in_block);
+        partial_size = 0;
+    }
+
+    const std::size_t stripes = len / StripeSize;
+    if (stripes > 0) {
+        ProcessStripes(accumulators, p, stripes, stripe_in_block);
+        p += stripes * StripeSize;
+        len -= stripes * StripeSize;
+    }
+
+    if (len > 0) {
+        std::memcpy(partial.data(), p, len);
+        partial_size = len;
+    }
+}
+
+u64 FastHashState::Finalize() const {
+    std::array<u64, 8> acc{accumulators};
+    if (partial_size > 0) {
+        // Hash the tail as one zero-padded stripe; the overall length below disambiguates inputs
+        // that only differ in trailing zero bytes.
+        std::array<u8, StripeSize> stripe{};
+        std::memcpy(stripe.data(), partial.data(), partial_size);
+        std::size_t stripe_index = stripe_in_block;
+        ProcessStripes(acc, stripe.data(), 1, stripe_index);
+    }
+
+    u64 result = total_len * Prime64_1;
+    for (std::size_t i = 0; i < 8; i += 2) {
+        result += MixPair(acc[i] ^ Secret[i], acc[i + 1] ^ Secret[i + 1]);
+    }
+    return Avalanche(result);
+}
+
+u64 FastHash64(const void* data, std::size_t len) {
+    FastHashState state;
+    state.Update(data, len);
+    return state.Finalize();
+}
+
+} // namespace Common
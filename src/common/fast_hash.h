@@ -0,0 +1,44 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Computes a fast non-cryptographic 64-bit hash over a block of data. The result does not match
+ * any standard hash function, but it is stable across runs, platforms and instruction-set paths,
+ * so it is safe to persist in on-disk caches. On CPUs with AVX2 the bulk loop is vectorized and
+ * reaches xxHash-class throughput; elsewhere a scalar loop computes the same function.
+ */
+u64 FastHash64(const void* data, std::size_t len);
+
+/**
+ * Incremental variant of FastHash64 for producers that generate data in chunks, e.g. hashing
+ * while copying out of guest memory. Feeding the same bytes through any sequence of Update()
+ * calls yields the same value as a single FastHash64() over the concatenated data.
+ */
+class FastHashState {
+public:
+    FastHashState();
+
+    /// Absorbs the specified bytes into the hash state
+    void Update(const void* data, std::size_t len);
+
+    /// Returns the hash of all data absorbed so far; the state remains usable for more updates
+    u64 Finalize() const;
+
+private:
+    std::array<u64, 8> accumulators;
+    std::array<u8, 64> partial; ///< Buffered tail that has not yet filled a 64-byte stripe
+    std::size_t partial_size = 0;
+    std::size_t stripe_in_block = 0; ///< Stripes absorbed since the last accumulator scramble
+    u64 total_len = 0;
+};
+
+} // namespace Common
@@ -42,7 +42,9 @@
 #include <cstdlib>
 #include <cstring>
 #include <dirent.h>
+#include <fcntl.h>
 #include <pwd.h>
+#include <sys/mman.h>
 #include <unistd.h>
 #endif
 
@@ -377,6 +379,67 @@ u64 GetSize(FILE* f) {
     return size;
 }
 
+u8* MapReadOnlyFile(const std::string& filename, std::size_t size) {
+    // Zero-length mappings are invalid on both platforms.
+    if (size == 0)
+        return nullptr;
+
+#ifdef _WIN32
+    HANDLE file =
+        CreateFileW(Common::UTF8ToUTF16W(filename).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                    OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        LOG_ERROR(Common_Filesystem, "failed to open {}: {}", filename, GetLastErrorMsg());
+        return nullptr;
+    }
+
+    HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    // The view keeps the file and mapping objects alive, so the handles can be closed right away.
+    CloseHandle(file);
+    if (mapping == nullptr) {
+        LOG_ERROR(Common_Filesystem, "failed to create mapping of {}: {}", filename,
+                  GetLastErrorMsg());
+        return nullptr;
+    }
+
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size);
+    CloseHandle(mapping);
+    if (data == nullptr) {
+        LOG_ERROR(Common_Filesystem, "failed to map view of {}: {}", filename, GetLastErrorMsg());
+        return nullptr;
+    }
+    return static_cast<u8*>(data);
+#else
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd == -1) {
+        LOG_ERROR(Common_Filesystem, "failed to open {}: {}", filename, GetLastErrorMsg());
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    // The mapping holds its own reference to the file, so the descriptor can be closed right away.
+    close(fd);
+    if (data == MAP_FAILED) {
+        LOG_ERROR(Common_Filesystem, "failed to map {}: {}", filename, GetLastErrorMsg());
+        return nullptr;
+    }
+    // Mapped files are mostly streamed front to back (RomFS, NCA content), so ask the kernel for
+    // aggressive read-ahead. This is only a hint; failure is harmless.
+    madvise(data, size, MADV_SEQUENTIAL);
+    return static_cast<u8*>(data);
+#endif
+}
+
+void UnmapFile(u8* data, std::size_t size) {
+    if (data == nullptr)
+        return;
+#ifdef _WIN32
+    UnmapViewOfFile(data);
+#else
+    munmap(data, size);
+#endif
+}
+
 // creates an empty file filename, returns true on success
 bool CreateEmptyFile(const std::string& filename) {
     LOG_TRACE(Common_Filesystem, "{}", filename);
@@ -400,12 +463,13 @@ bool ForeachDirectoryEntry(u64* num_entries_out, const std::string& directory,
     bool callback_error = false;
 
 #ifdef _WIN32
-    // Find the first file in the directory.
+    // Find the first file in the directory, fetching entries in large batches.
     WIN32_FIND_DATAW ffd;
 
-    HANDLE handle_find = FindFirstFileW(Common::UTF8ToUTF16W(directory + "\\*").c_str(), &ffd);
+    HANDLE handle_find =
+        FindFirstFileExW(Common::UTF8ToUTF16W(directory + "\\*").c_str(), FindExInfoBasic, &ffd,
+                         FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
     if (handle_find == INVALID_HANDLE_VALUE) {
-        FindClose(handle_find);
         return false;
     }
     // windows loop
@@ -448,16 +512,98 @@ bool ForeachDirectoryEntry(u64* num_entries_out, const std::string& directory,
     return true;
 }
 
+bool ForeachDirectoryEntryInfo(u64* num_entries_out, const std::string& directory,
+                               DirectoryEntryInfoCallable callback) {
+    LOG_TRACE(Common_Filesystem, "directory {}", directory);
+
+    // How many files + directories we found
+    u64 found_entries = 0;
+
+    // Save the status of callback function
+    bool callback_error = false;
+
+#ifdef _WIN32
+    // The extended API batches entries into a large buffer and reports attributes and sizes as
+    // part of the enumeration records, so no per-entry stat is needed at all.
+    WIN32_FIND_DATAW ffd;
+
+    HANDLE handle_find =
+        FindFirstFileExW(Common::UTF8ToUTF16W(directory + "\\*").c_str(), FindExInfoBasic, &ffd,
+                         FindExSearchNameMatch, nullptr, FIND_FIRST_EX_LARGE_FETCH);
+    if (handle_find == INVALID_HANDLE_VALUE) {
+        return false;
+    }
+    // windows loop
+    do {
+        DirectoryEntryInfo entry;
+        entry.virtual_name = Common::UTF16ToUTF8(ffd.cFileName);
+        entry.is_directory = (ffd.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY) != 0;
+        entry.size = entry.is_directory
+                         ? 0
+                         : (static_cast<u64>(ffd.nFileSizeHigh) << 32) | ffd.nFileSizeLow;
+#else
+    DIR* dirp = opendir(directory.c_str());
+    if (!dirp)
+        return false;
+
+    const int directory_fd = dirfd(dirp);
+
+    // non windows loop
+    while (struct dirent* result = readdir(dirp)) {
+        DirectoryEntryInfo entry;
+        entry.virtual_name = result->d_name;
+        // readdir batches entries through getdents64 and carries the entry type; only the size
+        // of non-directories has to come from fstatat, which resolves relative to the already
+        // open directory and on network filesystems is served from the attribute cache that the
+        // batched enumeration filled.
+        entry.is_directory = result->d_type == DT_DIR;
+        entry.size = 0;
+        if (result->d_type != DT_DIR) {
+            struct stat file_info;
+            if (fstatat(directory_fd, result->d_name, &file_info, 0) == 0) {
+                entry.is_directory = S_ISDIR(file_info.st_mode);
+                entry.size = entry.is_directory ? 0 : static_cast<u64>(file_info.st_size);
+            }
+        }
+#endif
+
+        if (entry.virtual_name == "." || entry.virtual_name == "..")
+            continue;
+
+        u64 ret_entries = 0;
+        if (!callback(&ret_entries, directory, entry)) {
+            callback_error = true;
+            break;
+        }
+        found_entries += ret_entries;
+
+#ifdef _WIN32
+    } while (FindNextFileW(handle_find, &ffd) != 0);
+    FindClose(handle_find);
+#else
+    }
+    closedir(dirp);
+#endif
+
+    if (callback_error)
+        return false;
+
+    // num_entries_out is allowed to be specified nullptr, in which case we shouldn't try to set it
+    if (num_entries_out != nullptr)
+        *num_entries_out = found_entries;
+    return true;
+}
+
 u64 ScanDirectoryTree(const std::string& directory, FSTEntry& parent_entry,
                       unsigned int recursion) {
     const auto callback = [recursion, &parent_entry](u64* num_entries_out,
                                                      const std::string& directory,
-                                                     const std::string& virtual_name) -> bool {
+                                                     const DirectoryEntryInfo& info) -> bool {
         FSTEntry entry;
-        entry.virtualName = virtual_name;
-        entry.physicalName = directory + DIR_SEP + virtual_name;
+        entry.virtualName = info.virtual_name;
+        entry.physicalName = directory + DIR_SEP + info.virtual_name;
 
-        if (IsDirectory(entry.physicalName)) {
+        if (info.is_directory) {
             entry.isDirectory = true;
             // is a directory, lets go inside if we didn't recurse to often
             if (recursion > 0) {
@@ -468,7 +614,7 @@ u64 ScanDirectoryTree(const std::string& directory, FSTEntry& parent_entry,
             }
         } else { // is a file
             entry.isDirectory = false;
-            entry.size = GetSize(entry.physicalName);
+            entry.size = info.size;
         }
         (*num_entries_out)++;
 
@@ -478,7 +624,7 @@ u64 ScanDirectoryTree(const std::string& directory, FSTEntry& parent_entry,
     };
 
     u64 num_entries;
-    return ForeachDirectoryEntry(&num_entries, directory, callback) ? num_entries : 0;
+    return ForeachDirectoryEntryInfo(&num_entries, directory, callback) ? num_entries : 0;
 }
 
 bool DeleteDirRecursively(const std::string& directory, unsigned int recursion) {
@@ -710,6 +856,7 @@ const std::string& GetUserPath(UserPath path, const std::string& new_path) {
         paths.emplace(UserPath::NANDDir, user_path + NAND_DIR DIR_SEP);
         paths.emplace(UserPath::LoadDir, user_path + LOAD_DIR DIR_SEP);
         paths.emplace(UserPath::DumpDir, user_path + DUMP_DIR DIR_SEP);
+        paths.emplace(UserPath::ShaderDir, user_path + SHADER_DIR DIR_SEP);
         paths.emplace(UserPath::SysDataDir, user_path + SYSDATA_DIR DIR_SEP);
         paths.emplace(UserPath::KeysDir, user_path + KEYS_DIR DIR_SEP);
         // TODO: Put the logs in a better location for each OS
@@ -973,6 +1120,28 @@ bool IOFile::Seek(s64 off, int origin) const {
     return IsOpen() && 0 == fseeko(m_file, off, origin);
 }
 
+std::size_t IOFile::ReadBytesAt(void* data, std::size_t length, u64 offset) const {
+    if (!IsOpen()) {
+        return std::numeric_limits<std::size_t>::max();
+    }
+
+#ifdef _WIN32
+    // The CRT has no pread equivalent; hand the offset to ReadFile directly instead. This reads
+    // the OS file, so it must not race against buffered stdio writes to the same IOFile.
+    HANDLE handle = reinterpret_cast<HANDLE>(_get_osfhandle(_fileno(m_file)));
+    OVERLAPPED overlapped{};
+    overlapped.Offset = static_cast<DWORD>(offset);
+    overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+    DWORD bytes_read = 0;
+    if (!ReadFile(handle, data, static_cast<DWORD>(length), &bytes_read, &overlapped))
+        return 0;
+    return bytes_read;
+#else
+    const ssize_t bytes_read = pread(fileno(m_file), data, length, offset);
+    return bytes_read < 0 ? 0 : static_cast<std::size_t>(bytes_read);
+#endif
+}
+
 u64 IOFile::Tell() const {
     if (IsOpen())
         return ftello(m_file);
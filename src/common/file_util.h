@@ -31,6 +31,7 @@ enum class UserPath {
     SDMCDir,
     LoadDir,
     DumpDir,
+    ShaderDir,
     SysDataDir,
     UserDir,
 };
@@ -59,6 +60,13 @@ u64 GetSize(const int fd);
 // Overloaded GetSize, accepts FILE*
 u64 GetSize(FILE* f);
 
+// Maps an existing file into memory for read-only access. size must be the current size of the
+// file. Returns nullptr on failure.
+u8* MapReadOnlyFile(const std::string& filename, std::size_t size);
+
+// Releases a mapping previously returned by MapReadOnlyFile.
+void UnmapFile(u8* data, std::size_t size);
+
 // Returns true if successful, or path already exists.
 bool CreateDir(const std::string& filename);
 
@@ -103,6 +111,29 @@ using DirectoryEntryCallable = std::function<bool(
 bool ForeachDirectoryEntry(u64* num_entries_out, const std::string& directory,
                            DirectoryEntryCallable callback);
 
+/// A directory entry as reported by the platform enumeration, carrying the metadata the
+/// enumeration records already provide so that callers do not have to stat each entry again.
+struct DirectoryEntryInfo {
+    std::string virtual_name;
+    bool is_directory;
+    u64 size; ///< File size in bytes; 0 for directories
+};
+
+/**
+ * Callback which is called for each found entry of ForeachDirectoryEntryInfo
+ */
+using DirectoryEntryInfoCallable =
+    std::function<bool(u64* num_entries_out, const std::string& directory,
+                       const DirectoryEntryInfo& entry)>;
+
+/**
+ * Variant of ForeachDirectoryEntry that hands the callback the entry type and size taken from the
+ * enumeration records, avoiding the per-entry stat round-trips of IsDirectory/GetSize. Prefer
+ * this whenever the callback needs anything beyond the name.
+ */
+bool ForeachDirectoryEntryInfo(u64* num_entries_out, const std::string& directory,
+                               DirectoryEntryInfoCallable callback);
+
 /**
  * Scans the directory tree, storing the results.
  * @param directory the parent directory to start scanning from
@@ -266,6 +297,14 @@ public:
 
     bool Seek(s64 off, int origin) const;
     u64 Tell() const;
+
+    /**
+     * Reads up to length bytes starting at the given absolute file offset, bypassing both the
+     * stdio buffer and the shared file position. Several threads may therefore read the same
+     * IOFile concurrently without a seek+read pair racing on the position, but the call must not
+     * be mixed with buffered writes to the same file.
+     */
+    std::size_t ReadBytesAt(void* data, std::size_t length, u64 offset) const;
     u64 GetSize() const;
     bool Resize(u64 size);
     bool Flush();
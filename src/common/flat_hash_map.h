@@ -0,0 +1,174 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <utility>
+#include <vector>
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Open-addressing hash map with robin-hood probing and backward-shift deletion. Entries live in
+ * one flat array, so a lookup walks contiguous memory instead of chasing nodes through cold
+ * cache lines like std::unordered_map. The hash is scrambled with a Fibonacci multiplier, so the
+ * identity std::hash of integer keys is fine even for aligned addresses.
+ *
+ * Intended for hot maps with cheap keys, e.g. caches keyed by VAddr that are probed several
+ * times per draw. Only the operations those caches need are provided.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class FlatHashMap {
+public:
+    FlatHashMap() : slots(std::size_t(1) << capacity_log2) {}
+
+    /// Ensures capacity for the given number of entries up front, avoiding rehashes on the way.
+    void Reserve(std::size_t entry_count) {
+        std::size_t new_log2 = capacity_log2;
+        while (((std::size_t(1) << new_log2) * MAX_LOAD_PERCENT) / 100 < entry_count) {
+            ++new_log2;
+        }
+        if (new_log2 != capacity_log2) {
+            Rehash(new_log2);
+        }
+    }
+
+    /// Returns a pointer to the value mapped to the key, or nullptr if it is not present. The
+    /// pointer is invalidated by any insertion or erasure.
+    Value* Find(const Key& key) {
+        std::size_t index = IndexFor(key);
+        for (u32 distance = 1;; ++distance) {
+            Slot& slot = slots[index];
+            if (slot.distance < distance) {
+                // An empty slot, or one whose entry sits closer to its ideal position than ours
+                // would: the robin-hood invariant guarantees the key is absent.
+                return nullptr;
+            }
+            if (slot.distance == distance && slot.key == key) {
+                return &slot.value;
+            }
+            index = (index + 1) & IndexMask();
+        }
+    }
+
+    const Value* Find(const Key& key) const {
+        return const_cast<FlatHashMap*>(this)->Find(key);
+    }
+
+    /// Inserts an entry, replacing the value of an already present key.
+    void Insert(const Key& key, Value value) {
+        if ((count + 1) * 100 > slots.size() * MAX_LOAD_PERCENT) {
+            Rehash(capacity_log2 + 1);
+        }
+        InsertSlot(Slot{key, std::move(value), 1});
+    }
+
+    /// Removes the entry for the key. Returns false if it was not present.
+    bool Erase(const Key& key) {
+        std::size_t index = IndexFor(key);
+        for (u32 distance = 1;; ++distance) {
+            const Slot& slot = slots[index];
+            if (slot.distance < distance) {
+                return false;
+            }
+            if (slot.distance == distance && slot.key == key) {
+                break;
+            }
+            index = (index + 1) & IndexMask();
+        }
+        // Shift the displaced entries that follow back into their preferred slots.
+        while (true) {
+            const std::size_t next = (index + 1) & IndexMask();
+            Slot& next_slot = slots[next];
+            if (next_slot.distance <= 1) {
+                break;
+            }
+            slots[index] = std::move(next_slot);
+            --slots[index].distance;
+            index = next;
+        }
+        slots[index] = Slot{};
+        --count;
+        return true;
+    }
+
+    std::size_t Size() const {
+        return count;
+    }
+
+    bool Empty() const {
+        return count == 0;
+    }
+
+    void Clear() {
+        slots.assign(slots.size(), Slot{});
+        count = 0;
+    }
+
+private:
+    struct Slot {
+        Key key{};
+        Value value{};
+        u32 distance = 0; ///< Probe distance from the ideal slot plus one, zero when empty.
+    };
+
+    static constexpr std::size_t INITIAL_CAPACITY_LOG2 = 6;
+    static constexpr std::size_t MAX_LOAD_PERCENT = 75;
+
+    std::size_t IndexMask() const {
+        return slots.size() - 1;
+    }
+
+    std::size_t IndexFor(const Key& key) const {
+        // Fibonacci hashing: the high product bits are well distributed even when the hash is
+        // the identity function over aligned addresses.
+        const u64 hash = static_cast<u64>(Hash{}(key)) * 0x9E3779B97F4A7C15ULL;
+        return static_cast<std::size_t>(hash >> (64 - capacity_log2));
+    }
+
+    void InsertSlot(Slot incoming) {
+        std::size_t index = IndexFor(incoming.key);
+        while (true) {
+            Slot& slot = slots[index];
+            if (slot.distance == 0) {
+                slot = std::move(incoming);
+                ++count;
+                return;
+            }
+            if (slot.key == incoming.key) {
+                slot.value = std::move(incoming.value);
+                return;
+            }
+            if (slot.distance < incoming.distance) {
+                // Rob the richer entry: take its slot and keep probing with the displaced one.
+                std::swap(slot, incoming);
+            }
+            index = (index + 1) & IndexMask();
+            ++incoming.distance;
+        }
+    }
+
+    void Rehash(std::size_t new_log2) {
+        std::vector<Slot> old_slots(std::size_t(1) << new_log2);
+        old_slots.swap(slots);
+        capacity_log2 = new_log2;
+        count = 0;
+        for (Slot& slot : old_slots) {
+            if (slot.distance != 0) {
+                slot.distance = 1;
+                InsertSlot(std::move(slot));
+            }
+        }
+    }
+
+    // capacity_log2 has to be initialized before the slot array.
+    std::size_t capacity_log2 = INITIAL_CAPACITY_LOG2;
+    std::size_t count = 0;
+    std::vector<Slot> slots;
+};
+
+} // namespace Common
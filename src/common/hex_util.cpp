@@ -7,33 +7,56 @@
 
 namespace Common {
 
+namespace {
+constexpr char UPPER_DIGITS[] = "0123456789ABCDEF";
+constexpr char LOWER_DIGITS[] = "0123456789abcdef";
+} // Anonymous namespace
+
 u8 ToHexNibble(char c1) {
-    if (c1 >= 65 && c1 <= 70)
-        return c1 - 55;
-    if (c1 >= 97 && c1 <= 102)
-        return c1 - 87;
-    if (c1 >= 48 && c1 <= 57)
-        return c1 - 48;
-    LOG_ERROR(Common, "Invalid hex digit: 0x{:02X}", c1);
-    return 0;
+    const u8 nibble = HEX_NIBBLE_TABLE[static_cast<u8>(c1)];
+    if (nibble == 0xFF) {
+        LOG_ERROR(Common, "Invalid hex digit: 0x{:02X}", c1);
+        return 0;
+    }
+    return nibble;
+}
+
+void BytesToHexString(char* out, const u8* data, std::size_t size, bool upper) {
+    const char* const digits = upper ? UPPER_DIGITS : LOWER_DIGITS;
+    for (std::size_t i = 0; i < size; ++i) {
+        out[2 * i] = digits[data[i] >> 4];
+        out[2 * i + 1] = digits[data[i] & 0xF];
+    }
 }
 
 std::vector<u8> HexStringToVector(std::string_view str, bool little_endian) {
     std::vector<u8> out(str.size() / 2);
+
+    // See HexStringToArray: take the branch-free table conversion unless an invalid character
+    // forces the logging path.
+    u8 validity = 0;
+    for (const char c : str) {
+        validity |= HEX_NIBBLE_TABLE[static_cast<u8>(c)];
+    }
+    const bool valid = (validity & 0xF0) == 0;
+
     if (little_endian) {
         for (std::size_t i = str.size() - 2; i <= str.size(); i -= 2)
-            out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+            out[i / 2] = valid ? HexPairToByte(str[i], str[i + 1])
+                               : static_cast<u8>((ToHexNibble(str[i]) << 4) |
+                                                 ToHexNibble(str[i + 1]));
     } else {
         for (std::size_t i = 0; i < str.size(); i += 2)
-            out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+            out[i / 2] = valid ? HexPairToByte(str[i], str[i + 1])
+                               : static_cast<u8>((ToHexNibble(str[i]) << 4) |
+                                                 ToHexNibble(str[i + 1]));
     }
     return out;
 }
 
 std::string HexVectorToString(const std::vector<u8>& vector, bool upper) {
-    std::string out;
-    for (u8 c : vector)
-        out += fmt::format(upper ? "{:02X}" : "{:02x}", c);
+    std::string out(2 * vector.size(), '0');
+    BytesToHexString(out.data(), vector.data(), vector.size(), upper);
     return out;
 }
 
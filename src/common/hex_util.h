@@ -7,25 +7,73 @@
 #include <array>
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <fmt/format.h>
 #include "common/common_types.h"
 
 namespace Common {
 
+/// Maps each ASCII character to its hex nibble value, with 0xFF marking non-hex characters.
+/// Table-driven conversion keeps the per-character work to one load, which matters when the
+/// key manager parses hundreds of lines of key material at every boot.
+constexpr std::array<u8, 256> HEX_NIBBLE_TABLE = [] {
+    std::array<u8, 256> table{};
+    for (std::size_t i = 0; i < table.size(); ++i) {
+        table[i] = 0xFF;
+    }
+    for (char c = '0'; c <= '9'; ++c) {
+        table[static_cast<u8>(c)] = static_cast<u8>(c - '0');
+    }
+    for (char c = 'A'; c <= 'F'; ++c) {
+        table[static_cast<u8>(c)] = static_cast<u8>(c - 'A' + 10);
+    }
+    for (char c = 'a'; c <= 'f'; ++c) {
+        table[static_cast<u8>(c)] = static_cast<u8>(c - 'a' + 10);
+    }
+    return table;
+}();
+
+/// Converts a single hex digit, logging and returning 0 for non-hex input.
 u8 ToHexNibble(char c1);
 
+/// Converts one byte from a pair of hex digits, assuming valid input (see HEX_NIBBLE_TABLE).
+constexpr u8 HexPairToByte(char high, char low) {
+    return static_cast<u8>((HEX_NIBBLE_TABLE[static_cast<u8>(high)] << 4) |
+                           HEX_NIBBLE_TABLE[static_cast<u8>(low)]);
+}
+
+/// Formats a byte range as hex digits. The out pointer must have room for 2 * size characters.
+void BytesToHexString(char* out, const u8* data, std::size_t size, bool upper);
+
 std::vector<u8> HexStringToVector(std::string_view str, bool little_endian);
 
 template <std::size_t Size, bool le = false>
 std::array<u8, Size> HexStringToArray(std::string_view str) {
     std::array<u8, Size> out{};
+
+    // Validated fast path: valid nibbles are <= 0x0F, so any invalid character shows up in the
+    // accumulated high bits, and only then do we pay for the slow, logging conversion.
+    u8 validity = 0;
+    for (std::size_t i = 0; i < 2 * Size && i < str.size(); ++i) {
+        validity |= HEX_NIBBLE_TABLE[static_cast<u8>(str[i])];
+    }
+    if ((validity & 0xF0) != 0) {
+        if constexpr (le) {
+            for (std::size_t i = 2 * Size - 2; i <= 2 * Size; i -= 2)
+                out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+        } else {
+            for (std::size_t i = 0; i < 2 * Size; i += 2)
+                out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+        }
+        return out;
+    }
+
     if constexpr (le) {
         for (std::size_t i = 2 * Size - 2; i <= 2 * Size; i -= 2)
-            out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+            out[i / 2] = HexPairToByte(str[i], str[i + 1]);
     } else {
         for (std::size_t i = 0; i < 2 * Size; i += 2)
-            out[i / 2] = (ToHexNibble(str[i]) << 4) | ToHexNibble(str[i + 1]);
+            out[i / 2] = HexPairToByte(str[i], str[i + 1]);
     }
     return out;
 }
@@ -34,9 +82,8 @@ std::string HexVectorToString(const std::vector<u8>& vector, bool upper = true);
 
 template <std::size_t Size>
 std::string HexArrayToString(std::array<u8, Size> array, bool upper = true) {
-    std::string out;
-    for (u8 c : array)
-        out += fmt::format(upper ? "{:02X}" : "{:02x}", c);
+    std::string out(2 * Size, '0');
+    BytesToHexString(out.data(), array.data(), Size, upper);
     return out;
 }
 
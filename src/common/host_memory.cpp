@@ -0,0 +1,142 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "common/host_memory.h"
+#include "common/logging/log.h"
+
+#ifndef _WIN32
+#include <cstdlib>
+#include <unistd.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace Common {
+
+#ifdef _WIN32
+
+// Placing file mapping views inside a reserved region is not reliably possible with the
+// pre-VirtualAlloc2 API, so fastmem is not available on Windows yet. Callers detect this
+// through IsValid() and stay on the software page table.
+HostMemory::HostMemory(std::size_t backing_size, std::size_t virtual_size)
+    : backing_size{backing_size}, virtual_size{virtual_size} {
+    LOG_WARNING(Common_Memory, "Host memory aliasing is not implemented on this platform");
+}
+
+HostMemory::~HostMemory() = default;
+
+void HostMemory::Map(std::size_t virtual_offset, std::size_t host_offset, std::size_t length) {
+    UNREACHABLE_MSG("Mapping on an invalid HostMemory");
+}
+
+void HostMemory::Unmap(std::size_t virtual_offset, std::size_t length) {
+    UNREACHABLE_MSG("Unmapping on an invalid HostMemory");
+}
+
+void HostMemory::Release() {}
+
+#else
+
+/// Creates an anonymous file descriptor usable as a shared memory backing store.
+static int CreateBackingFile(std::size_t size) {
+    int fd = -1;
+#ifdef __linux__
+    // memfd_create is called through syscall() to avoid requiring glibc 2.27 at build time.
+    fd = static_cast<int>(syscall(SYS_memfd_create, "HostMemory", 0));
+#endif
+    if (fd < 0) {
+        // Fall back to an unlinked temporary file for other POSIX systems.
+        char path[] = "/tmp/yuzu_hostmem_XXXXXX";
+        fd = mkstemp(path);
+        if (fd >= 0) {
+            unlink(path);
+        }
+    }
+    if (fd < 0) {
+        return -1;
+    }
+    if (ftruncate(fd, static_cast<off_t>(size)) < 0) {
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+HostMemory::HostMemory(std::size_t backing_size, std::size_t virtual_size)
+    : backing_size{backing_size}, virtual_size{virtual_size} {
+    fd = CreateBackingFile(backing_size);
+    if (fd < 0) {
+        LOG_ERROR(Common_Memory, "Failed to allocate {} bytes of backing memory", backing_size);
+        return;
+    }
+
+    void* backing =
+        mmap(nullptr, backing_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (backing == MAP_FAILED) {
+        LOG_ERROR(Common_Memory, "Failed to map backing memory");
+        Release();
+        return;
+    }
+    backing_base = static_cast<u8*>(backing);
+
+    // Reserve the virtual address space without committing any memory; aliases are placed on top
+    // of this reservation with MAP_FIXED.
+    void* virt = mmap(nullptr, virtual_size, PROT_NONE,
+                      MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (virt == MAP_FAILED) {
+        LOG_ERROR(Common_Memory, "Failed to reserve {} bytes of address space", virtual_size);
+        Release();
+        return;
+    }
+    virtual_base = static_cast<u8*>(virt);
+}
+
+HostMemory::~HostMemory() {
+    Release();
+}
+
+void HostMemory::Map(std::size_t virtual_offset, std::size_t host_offset, std::size_t length) {
+    ASSERT(IsValid());
+    ASSERT(virtual_offset + length <= virtual_size);
+    ASSERT(host_offset + length <= backing_size);
+
+    void* ret = mmap(virtual_base + virtual_offset, length, PROT_READ | PROT_WRITE,
+                     MAP_SHARED | MAP_FIXED, fd, static_cast<off_t>(host_offset));
+    ASSERT_MSG(ret != MAP_FAILED, "Failed to map alias at offset {:X}", virtual_offset);
+}
+
+void HostMemory::Unmap(std::size_t virtual_offset, std::size_t length) {
+    ASSERT(IsValid());
+    ASSERT(virtual_offset + length <= virtual_size);
+
+    // Replace the alias with a fresh faulting reservation instead of leaving a hole.
+    void* ret = mmap(virtual_base + virtual_offset, length, PROT_NONE,
+                     MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE | MAP_FIXED, -1, 0);
+    ASSERT_MSG(ret != MAP_FAILED, "Failed to unmap alias at offset {:X}", virtual_offset);
+}
+
+void HostMemory::Release() {
+    if (virtual_base != nullptr) {
+        munmap(virtual_base, virtual_size);
+        virtual_base = nullptr;
+    }
+    if (backing_base != nullptr) {
+        munmap(backing_base, backing_size);
+        backing_base = nullptr;
+    }
+    if (fd >= 0) {
+        close(fd);
+        fd = -1;
+    }
+}
+
+#endif
+
+} // namespace Common
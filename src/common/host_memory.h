@@ -0,0 +1,72 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * Backing block of host memory together with a contiguous reservation of host address space
+ * sized to the guest's address space. Pages of the backing block can be aliased anywhere inside
+ * the reservation with Map, which lets guest memory mapped this way be accessed with a single
+ * host load or store off the reservation's base pointer (fastmem). Unmapped parts of the
+ * reservation stay inaccessible, so stray guest accesses fault instead of corrupting host state.
+ *
+ * When the host lacks the required primitives the object reports !IsValid() and callers must
+ * keep going through the software page table.
+ */
+class HostMemory {
+public:
+    explicit HostMemory(std::size_t backing_size, std::size_t virtual_size);
+    ~HostMemory();
+
+    HostMemory(const HostMemory&) = delete;
+    HostMemory& operator=(const HostMemory&) = delete;
+
+    /// Aliases `length` bytes at `host_offset` of the backing block into the reservation at
+    /// `virtual_offset`. All arguments must be host-page aligned.
+    void Map(std::size_t virtual_offset, std::size_t host_offset, std::size_t length);
+
+    /// Removes an alias, returning the range of the reservation to the faulting state.
+    void Unmap(std::size_t virtual_offset, std::size_t length);
+
+    /// Returns true when the backing block and the reservation could be created.
+    bool IsValid() const {
+        return backing_base != nullptr && virtual_base != nullptr;
+    }
+
+    u8* BackingBasePointer() {
+        return backing_base;
+    }
+
+    u8* VirtualBasePointer() {
+        return virtual_base;
+    }
+
+    std::size_t BackingSize() const {
+        return backing_size;
+    }
+
+    std::size_t VirtualSize() const {
+        return virtual_size;
+    }
+
+private:
+    void Release();
+
+    std::size_t backing_size{};
+    std::size_t virtual_size{};
+
+    u8* backing_base{};
+    u8* virtual_base{};
+
+#ifndef _WIN32
+    int fd{-1};
+#endif
+};
+
+} // namespace Common
@@ -0,0 +1,133 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/host_trace.h"
+
+#ifdef _WIN32
+
+#include <windows.h>
+
+#include <TraceLoggingProvider.h>
+
+namespace Common::HostTrace {
+
+// {9a7f3c40-6f0e-4d0b-8a31-c25c1e84b2ad}
+TRACELOGGING_DEFINE_PROVIDER(host_trace_provider, "yuzu",
+                             (0x9a7f3c40, 0x6f0e, 0x4d0b, 0x8a, 0x31, 0xc2, 0x5c, 0x1e, 0x84,
+                              0xb2, 0xad));
+
+namespace {
+
+struct ProviderRegistration {
+    ProviderRegistration() {
+        TraceLoggingRegister(host_trace_provider);
+    }
+    ~ProviderRegistration() {
+        TraceLoggingUnregister(host_trace_provider);
+    }
+};
+
+ProviderRegistration registration;
+
+} // Anonymous namespace
+
+bool IsEnabled() {
+    return TraceLoggingProviderEnabled(host_trace_provider, 0, 0);
+}
+
+void BeginSpan(const char* name) {
+    TraceLoggingWrite(host_trace_provider, "SpanBegin", TraceLoggingOpcode(EVENT_TRACE_TYPE_START),
+                      TraceLoggingString(name, "name"));
+}
+
+void EndSpan() {
+    TraceLoggingWrite(host_trace_provider, "SpanEnd", TraceLoggingOpcode(EVENT_TRACE_TYPE_END));
+}
+
+void InstantMarker(const char* name) {
+    TraceLoggingWrite(host_trace_provider, "Marker", TraceLoggingString(name, "name"));
+}
+
+} // namespace Common::HostTrace
+
+#elif defined(__linux__)
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace Common::HostTrace {
+
+namespace {
+
+/// Opens the ftrace marker file once; -1 when tracefs is unavailable to this process
+int GetMarkerFd() {
+    static const int fd = [] {
+        int marker_fd = open("/sys/kernel/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+        if (marker_fd < 0) {
+            marker_fd = open("/sys/kernel/debug/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+        }
+        return marker_fd;
+    }();
+    return fd;
+}
+
+void WriteMarker(const char* prefix, const char* name) {
+    const int fd = GetMarkerFd();
+    if (fd < 0) {
+        return;
+    }
+
+    // atrace format: "B|pid|name", "E", "I|pid|name". One write keeps the record atomic.
+    char buffer[256];
+    const int length =
+        name != nullptr
+            ? std::snprintf(buffer, sizeof(buffer), "%s|%d|%s", prefix, getpid(), name)
+            : std::snprintf(buffer, sizeof(buffer), "%s", prefix);
+    if (length > 0) {
+        [[maybe_unused]] const ssize_t written =
+            write(fd, buffer, std::min<std::size_t>(static_cast<std::size_t>(length),
+                                                    sizeof(buffer) - 1));
+    }
+}
+
+} // Anonymous namespace
+
+bool IsEnabled() {
+    return GetMarkerFd() >= 0;
+}
+
+void BeginSpan(const char* name) {
+    WriteMarker("B", name);
+}
+
+void EndSpan() {
+    WriteMarker("E", nullptr);
+}
+
+void InstantMarker(const char* name) {
+    WriteMarker("I", name);
+}
+
+} // namespace Common::HostTrace
+
+#else
+
+namespace Common::HostTrace {
+
+bool IsEnabled() {
+    return false;
+}
+
+void BeginSpan(const char* name) {}
+
+void EndSpan() {}
+
+void InstantMarker(const char* name) {}
+
+} // namespace Common::HostTrace
+
+#endif
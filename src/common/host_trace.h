@@ -0,0 +1,62 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace Common::HostTrace {
+
+/**
+ * Emits named spans and instant markers to the host system tracer, so emulator internals can be
+ * correlated with host-level scheduling and I/O in one timeline. On Linux the events are written
+ * to the ftrace trace_marker in the atrace begin/end format understood by perf and the Catapult
+ * viewers; on Windows they are emitted through a TraceLogging (ETW) provider. The whole facility
+ * compiles to no-ops unless YUZU_ENABLE_HOST_TRACE is defined, and at runtime it quietly does
+ * nothing when no tracer is available (tracefs not mounted, provider not enabled).
+ */
+
+/// Whether a host tracer was found at runtime. Span emission already checks this internally.
+bool IsEnabled();
+
+/// Opens a named span on the current thread; spans nest and must be closed in LIFO order.
+void BeginSpan(const char* name);
+
+/// Closes the innermost open span on the current thread.
+void EndSpan();
+
+/// Emits a single point-in-time marker.
+void InstantMarker(const char* name);
+
+/// RAII wrapper for a span; prefer the HOST_TRACE_SCOPE macro over using this directly.
+struct Scope {
+    explicit Scope(const char* name) {
+        BeginSpan(name);
+    }
+    ~Scope() {
+        EndSpan();
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+} // namespace Common::HostTrace
+
+#ifdef YUZU_ENABLE_HOST_TRACE
+
+#define HOST_TRACE_CONCAT2(x, y) x##y
+#define HOST_TRACE_CONCAT(x, y) HOST_TRACE_CONCAT2(x, y)
+
+/// Emits a span covering the rest of the enclosing scope. The name must be a string literal.
+#define HOST_TRACE_SCOPE(name)                                                                     \
+    ::Common::HostTrace::Scope HOST_TRACE_CONCAT(host_trace_scope_, __LINE__) { name }
+
+/// Emits a point-in-time marker. The name must be a string literal.
+#define HOST_TRACE_MARK(name) ::Common::HostTrace::InstantMarker(name)
+
+#else
+
+#define HOST_TRACE_SCOPE(name)
+#define HOST_TRACE_MARK(name)
+
+#endif
@@ -40,9 +40,14 @@ public:
     const Impl& operator=(Impl const&) = delete;
 
     void PushEntry(Entry e) {
-        std::lock_guard<std::mutex> lock(message_mutex);
+        // Bound the queue so a runaway TRACE-level caller drops messages instead of ballooning
+        // memory; errors always get through. The drops are reported by the backend thread.
+        constexpr u32 MAX_QUEUE_SIZE = 4096;
+        if (message_queue.Size() >= MAX_QUEUE_SIZE && e.log_level < Level::Error) {
+            dropped_entries.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
         message_queue.Push(std::move(e));
-        message_cv.notify_one();
     }
 
     void AddBackend(std::unique_ptr<Backend> backend) {
@@ -86,14 +91,19 @@ private:
                 }
             };
             while (true) {
-                {
-                    std::unique_lock<std::mutex> lock(message_mutex);
-                    message_cv.wait(lock, [&] { return !running || message_queue.Pop(entry); });
-                }
-                if (!running) {
+                entry = message_queue.PopWait();
+                if (entry.final_entry) {
                     break;
                 }
                 write_logs(entry);
+
+                const u32 dropped = dropped_entries.exchange(0, std::memory_order_relaxed);
+                if (dropped != 0) {
+                    Entry notice = CreateEntry(
+                        Class::Log, Level::Warning, __FILE__, __LINE__, __func__,
+                        fmt::format("Dropped {} log messages while the queue was full", dropped));
+                    write_logs(notice);
+                }
             }
             // Drain the logging queue. Only writes out up to MAX_LOGS_TO_WRITE to prevent a case
             // where a system is repeatedly spamming logs even on close.
@@ -106,17 +116,17 @@ private:
     }
 
     ~Impl() {
-        running = false;
-        message_cv.notify_one();
+        Entry entry;
+        entry.final_entry = true;
+        message_queue.Push(std::move(entry));
         backend_thread.join();
     }
 
-    std::atomic_bool running{true};
-    std::mutex message_mutex, writing_mutex;
-    std::condition_variable message_cv;
+    std::mutex writing_mutex;
     std::thread backend_thread;
     std::vector<std::unique_ptr<Backend>> backends;
     Common::MPSCQueue<Log::Entry> message_queue;
+    std::atomic<u32> dropped_entries{0};
     Filter filter;
 };
 
@@ -294,8 +304,22 @@ Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsign
     return entry;
 }
 
+namespace detail {
+std::array<std::atomic<Level>, static_cast<std::size_t>(Class::Count)> enabled_levels;
+} // namespace detail
+
 void SetGlobalFilter(const Filter& filter) {
     Impl::Instance().SetGlobalFilter(filter);
+    // Mirror the per-class levels into the atomic array the logging macros consult, so disabled
+    // classes are rejected before their arguments are even evaluated.
+    for (std::size_t i = 0; i < static_cast<std::size_t>(Class::Count); ++i) {
+        detail::enabled_levels[i].store(filter.GetClassLevel(static_cast<Class>(i)),
+                                        std::memory_order_relaxed);
+    }
+}
+
+const Filter& GetGlobalFilter() {
+    return Impl::Instance().GetGlobalFilter();
 }
 
 void AddBackend(std::unique_ptr<Backend> backend) {
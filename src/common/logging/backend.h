@@ -23,10 +23,13 @@ struct Entry {
     std::chrono::microseconds timestamp;
     Class log_class;
     Level log_level;
-    std::string filename;
-    unsigned int line_num;
-    std::string function;
+    // Points into the string literals emitted by the logging macros, so no allocation or copy
+    // is needed per entry.
+    const char* filename = nullptr;
+    unsigned int line_num = 0;
+    const char* function = nullptr;
     std::string message;
+    bool final_entry = false;
 
     Entry() = default;
     Entry(Entry&& o) = default;
@@ -144,4 +147,8 @@ Entry CreateEntry(Class log_class, Level log_level, const char* filename, unsign
  * never get the message
  */
 void SetGlobalFilter(const Filter& filter);
+
+/// Returns the global filter, so hot paths can skip building expensive log messages that the
+/// filter would drop anyway.
+const Filter& GetGlobalFilter();
 } // namespace Log
\ No newline at end of file
@@ -42,6 +42,9 @@ public:
      */
     void ParseFilterString(std::string_view filter_view);
 
+    /// Returns the minimum level of `log_class`.
+    Level GetClassLevel(Class log_class) const;
+
     /// Matches class/level combination against the filter, returning true if it passed.
     bool CheckMessage(Class log_class, Level level) const;
 
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <fmt/format.h>
 #include "common/common_types.h"
 
@@ -123,6 +125,20 @@ enum class Class : ClassType {
     Count              ///< Total number of logging classes
 };
 
+namespace detail {
+/// Minimum enabled level per log class, mirrored from the global filter so the logging macros can
+/// short-circuit before evaluating their arguments. Zero-initialized to Trace (everything enabled)
+/// until a global filter is set.
+extern std::array<std::atomic<Level>, static_cast<std::size_t>(Class::Count)> enabled_levels;
+} // namespace detail
+
+/// Returns true if a message of the given class and level would pass the global filter. This is a
+/// single relaxed atomic load, cheap enough for the logging macros to consult on every call.
+inline bool IsEnabled(Class log_class, Level level) {
+    return level >= detail::enabled_levels[static_cast<std::size_t>(log_class)].load(
+                        std::memory_order_relaxed);
+}
+
 /// Logs a message to the global logger, using fmt
 void FmtLogMessageImpl(Class log_class, Level log_level, const char* filename,
                        unsigned int line_num, const char* function, const char* format,
@@ -137,26 +153,56 @@ void FmtLogMessage(Class log_class, Level log_level, const char* filename, unsig
 
 } // namespace Log
 
+// Numeric counterparts of ::Log::Level, usable in preprocessor conditionals.
+#define YUZU_LOG_LEVEL_TRACE 0
+#define YUZU_LOG_LEVEL_DEBUG 1
+#define YUZU_LOG_LEVEL_INFO 2
+#define YUZU_LOG_LEVEL_WARNING 3
+#define YUZU_LOG_LEVEL_ERROR 4
+#define YUZU_LOG_LEVEL_CRITICAL 5
+
+// Messages below this level are compiled out entirely; the disabled macros evaluate neither the
+// format string nor the arguments. Defaults preserve the historical behavior of TRACE only being
+// available in debug builds.
+#ifndef YUZU_MIN_LOG_LEVEL
 #ifdef _DEBUG
-#define LOG_TRACE(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Trace, __FILE__, __LINE__,         \
-                         __func__, __VA_ARGS__)
+#define YUZU_MIN_LOG_LEVEL YUZU_LOG_LEVEL_TRACE
+#else
+#define YUZU_MIN_LOG_LEVEL YUZU_LOG_LEVEL_DEBUG
+#endif
+#endif
+
+// The enabled macros check the per-class level mirror before evaluating their arguments, so a
+// filtered-out message costs one predictable branch rather than the construction of its arguments.
+#define LOG_MESSAGE_IMPL(level, log_class, ...)                                                    \
+    (::Log::IsEnabled(::Log::Class::log_class, ::Log::Level::level)                                \
+         ? ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::level, __FILE__, __LINE__,  \
+                                __func__, __VA_ARGS__)                                             \
+         : void(0))
+
+#if YUZU_MIN_LOG_LEVEL <= YUZU_LOG_LEVEL_TRACE
+#define LOG_TRACE(log_class, ...) LOG_MESSAGE_IMPL(Trace, log_class, __VA_ARGS__)
 #else
 #define LOG_TRACE(log_class, fmt, ...) (void(0))
 #endif
 
-#define LOG_DEBUG(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Debug, __FILE__, __LINE__,         \
-                         __func__, __VA_ARGS__)
-#define LOG_INFO(log_class, ...)                                                                   \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Info, __FILE__, __LINE__,          \
-                         __func__, __VA_ARGS__)
-#define LOG_WARNING(log_class, ...)                                                                \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Warning, __FILE__, __LINE__,       \
-                         __func__, __VA_ARGS__)
-#define LOG_ERROR(log_class, ...)                                                                  \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Error, __FILE__, __LINE__,         \
-                         __func__, __VA_ARGS__)
-#define LOG_CRITICAL(log_class, ...)                                                               \
-    ::Log::FmtLogMessage(::Log::Class::log_class, ::Log::Level::Critical, __FILE__, __LINE__,      \
-                         __func__, __VA_ARGS__)
+#if YUZU_MIN_LOG_LEVEL <= YUZU_LOG_LEVEL_DEBUG
+#define LOG_DEBUG(log_class, ...) LOG_MESSAGE_IMPL(Debug, log_class, __VA_ARGS__)
+#else
+#define LOG_DEBUG(log_class, fmt, ...) (void(0))
+#endif
+
+#if YUZU_MIN_LOG_LEVEL <= YUZU_LOG_LEVEL_INFO
+#define LOG_INFO(log_class, ...) LOG_MESSAGE_IMPL(Info, log_class, __VA_ARGS__)
+#else
+#define LOG_INFO(log_class, fmt, ...) (void(0))
+#endif
+
+#if YUZU_MIN_LOG_LEVEL <= YUZU_LOG_LEVEL_WARNING
+#define LOG_WARNING(log_class, ...) LOG_MESSAGE_IMPL(Warning, log_class, __VA_ARGS__)
+#else
+#define LOG_WARNING(log_class, fmt, ...) (void(0))
+#endif
+
+#define LOG_ERROR(log_class, ...) LOG_MESSAGE_IMPL(Error, log_class, __VA_ARGS__)
+#define LOG_CRITICAL(log_class, ...) LOG_MESSAGE_IMPL(Critical, log_class, __VA_ARGS__)
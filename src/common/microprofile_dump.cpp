@@ -0,0 +1,50 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <fmt/format.h>
+#include "common/file_util.h"
+#include "common/microprofile.h"
+#include "common/microprofile_dump.h"
+
+namespace Common {
+
+bool DumpMicroProfileTimers(const std::string& path) {
+#if MICROPROFILE_ENABLED
+    FileUtil::IOFile file(path, "w");
+    if (!file.IsOpen()) {
+        return false;
+    }
+
+    MicroProfile* const profile = MicroProfileGet();
+    const float to_ms = MicroProfileTickToMsMultiplier(MicroProfileTicksPerSecondCpu());
+    const u32 frames = std::max<u32>(profile->nAggregateFrames, 1);
+
+    const std::string header{"group,timer,calls,total_ms,average_ms,max_call_ms,per_frame_ms\n"};
+    file.WriteBytes(header.data(), header.size());
+
+    for (u32 i = 0; i < profile->nTotalTimers; ++i) {
+        const auto& timer_info = profile->TimerInfo[i];
+        const auto& group_info = profile->GroupInfo[timer_info.nGroupIndex];
+        const auto& aggregate = profile->Aggregate[i];
+        if (aggregate.nCount == 0) {
+            continue;
+        }
+
+        const float total_ms = aggregate.nTicks * to_ms;
+        const float max_ms = profile->AggregateMax[i] * to_ms;
+        const std::string line{
+            fmt::format("{},{},{},{:.4f},{:.6f},{:.4f},{:.6f}\n", group_info.pName,
+                        timer_info.pName, aggregate.nCount, total_ms,
+                        total_ms / aggregate.nCount, max_ms, total_ms / frames)};
+        file.WriteBytes(line.data(), line.size());
+    }
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+} // namespace Common
@@ -0,0 +1,19 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+
+namespace Common {
+
+/**
+ * Writes the aggregated MicroProfile timers (total/average/max walltime and call counts per
+ * scope, grouped by group name) to a CSV file. This is the profiling output for headless
+ * machines, where the web UI is unavailable because the embedded server is compiled out.
+ * Returns false if the file could not be written.
+ */
+bool DumpMicroProfileTimers(const std::string& path);
+
+} // namespace Common
@@ -0,0 +1,136 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <fmt/format.h>
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "common/microprofile.h"
+#include "common/microprofile_trace.h"
+
+namespace Common {
+
+#if MICROPROFILE_ENABLED
+
+namespace {
+
+std::mutex trace_mutex;
+FileUtil::IOFile trace_file;
+bool trace_enabled = false;
+
+/// Ring positions up to which each thread log has already been exported
+std::array<u32, MICROPROFILE_MAX_THREADS> read_cursors;
+/// Whether the thread_name metadata event has been emitted for each thread log
+std::array<bool, MICROPROFILE_MAX_THREADS> thread_announced;
+/// Tick of the first exported event; timestamps are written relative to it
+s64 first_tick = -1;
+
+} // Anonymous namespace
+
+void SetMicroProfileTraceEnabled(bool enabled) {
+    std::lock_guard<std::mutex> lock{trace_mutex};
+    if (enabled == trace_enabled) {
+        return;
+    }
+
+    if (enabled) {
+        const std::string path =
+            FileUtil::GetUserPath(FileUtil::UserPath::LogDir) + "microprofile_trace.json";
+        if (!trace_file.Open(path, "w")) {
+            LOG_ERROR(Common, "Failed to open MicroProfile trace file {}", path);
+            return;
+        }
+        trace_file.WriteString("[\n");
+
+        // Skip whatever is still sitting in the rings from before the capture started
+        MicroProfile* const profile = MicroProfileGet();
+        for (u32 i = 0; i < profile->nNumLogs; ++i) {
+            read_cursors[i] = profile->Pool[i] ? profile->Pool[i]->nPut.load() : 0;
+        }
+        thread_announced.fill(false);
+        first_tick = -1;
+
+        // Timers only record events for enabled groups; force them all on for the capture
+        MicroProfileSetEnableAllGroups(true);
+    } else {
+        MicroProfileSetEnableAllGroups(false);
+
+        // The Trace Event JSON array format tolerates a trailing comma before the terminator
+        trace_file.WriteString("{\"name\":\"trace_end\",\"ph\":\"M\",\"pid\":0,\"tid\":0}\n]\n");
+        trace_file.Close();
+    }
+    trace_enabled = enabled;
+}
+
+void FlushMicroProfileTrace() {
+    std::lock_guard<std::mutex> lock{trace_mutex};
+    if (!trace_enabled) {
+        return;
+    }
+
+    MicroProfile* const profile = MicroProfileGet();
+    const double us_per_tick = 1e6 / static_cast<double>(MicroProfileTicksPerSecondCpu());
+
+    std::string buffer;
+    for (u32 i = 0; i < profile->nNumLogs; ++i) {
+        MicroProfileThreadLog* const log = profile->Pool[i];
+        if (log == nullptr || log->nGpu) {
+            continue;
+        }
+
+        if (!thread_announced[i]) {
+            buffer += fmt::format("{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":{},"
+                                  "\"args\":{{\"name\":\"{}\"}}}},\n",
+                                  i, log->ThreadName);
+            thread_announced[i] = true;
+        }
+
+        // The producer publishes entries with a release store on nPut, so everything below the
+        // acquired position is safe to read. One frame's worth of events is far smaller than
+        // the ring, so the producer lapping this cursor is not a practical concern.
+        const u32 put = log->nPut.load(std::memory_order_acquire);
+        u32 get = read_cursors[i];
+        while (get != put) {
+            const MicroProfileLogEntry entry = log->Log[get];
+            get = (get + 1) % MICROPROFILE_BUFFER_SIZE;
+
+            const int type = MicroProfileLogType(entry);
+            if (type != MP_LOG_ENTER && type != MP_LOG_LEAVE) {
+                continue;
+            }
+
+            const u64 timer = MicroProfileLogTimerIndex(entry);
+            const s64 tick = MicroProfileLogGetTick(entry);
+            if (first_tick < 0) {
+                first_tick = tick;
+            }
+            const double timestamp =
+                static_cast<double>((tick - first_tick) & MP_LOG_TICK_MASK) * us_per_tick;
+
+            buffer += fmt::format(
+                "{{\"name\":\"{}\",\"cat\":\"{}\",\"ph\":\"{}\",\"pid\":0,\"tid\":{},"
+                "\"ts\":{:.3f}}},\n",
+                profile->TimerInfo[timer].pName,
+                profile->GroupInfo[profile->TimerToGroup[timer]].pName,
+                type == MP_LOG_ENTER ? 'B' : 'E', i, timestamp);
+        }
+        read_cursors[i] = get;
+    }
+
+    if (!buffer.empty()) {
+        trace_file.WriteString(buffer);
+        trace_file.Flush();
+    }
+}
+
+#else
+
+void SetMicroProfileTraceEnabled(bool) {}
+void FlushMicroProfileTrace() {}
+
+#endif
+
+} // namespace Common
@@ -0,0 +1,25 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace Common {
+
+/**
+ * Streams MicroProfile scope events to a chrome://tracing (Trace Event Format) JSON file, as a
+ * capture path for headless machines where the interactive UI is unavailable. Capturing is
+ * toggled at runtime; while enabled, events are drained from the per-thread ring buffers once
+ * per presented frame and appended to the file, so memory use stays bounded by the rings
+ * MicroProfile already allocates.
+ */
+
+/// Starts or stops trace capturing. Starting opens microprofile_trace.json in the log directory
+/// and enables all timer groups; stopping finalizes and closes the file.
+void SetMicroProfileTraceEnabled(bool enabled);
+
+/// Drains newly recorded events to the capture file. Call once per presented frame, after
+/// MicroProfileFlip(); does nothing while capturing is disabled.
+void FlushMicroProfileTrace();
+
+} // namespace Common
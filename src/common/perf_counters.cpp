@@ -0,0 +1,67 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include "common/perf_counters.h"
+
+namespace Common {
+
+namespace {
+// Counters are heap-allocated individually so registered counters keep stable addresses and
+// call sites can cache references while later registrations grow the container.
+std::mutex registry_mutex;
+std::vector<std::unique_ptr<PerfCounter>>& GetCounterStorage() {
+    static std::vector<std::unique_ptr<PerfCounter>> counters;
+    return counters;
+}
+} // Anonymous namespace
+
+std::size_t PerfCounter::ThreadShardIndex() {
+    static std::atomic<std::size_t> next_thread_index{0};
+    static thread_local std::size_t shard_index =
+        next_thread_index.fetch_add(1, std::memory_order_relaxed) % NUM_SHARDS;
+    return shard_index;
+}
+
+PerfCounterRegistry& PerfCounterRegistry::Instance() {
+    static PerfCounterRegistry registry;
+    return registry;
+}
+
+PerfCounter& PerfCounterRegistry::GetCounter(std::string_view name) {
+    std::lock_guard<std::mutex> lock{registry_mutex};
+    auto& counters = GetCounterStorage();
+
+    const auto iter = std::find_if(
+        counters.begin(), counters.end(),
+        [name](const std::unique_ptr<PerfCounter>& c) { return c->GetName() == name; });
+    if (iter != counters.end()) {
+        return **iter;
+    }
+
+    counters.emplace_back(new PerfCounter{std::string(name)});
+    return *counters.back();
+}
+
+std::vector<PerfCounterRegistry::Snapshot> PerfCounterRegistry::GetSnapshot() const {
+    std::lock_guard<std::mutex> lock{registry_mutex};
+    auto& counters = GetCounterStorage();
+
+    std::vector<Snapshot> snapshot;
+    snapshot.reserve(counters.size());
+    for (const auto& counter : counters) {
+        snapshot.push_back({counter->GetName(), counter->Total()});
+    }
+    std::sort(snapshot.begin(), snapshot.end(),
+              [](const Snapshot& lhs, const Snapshot& rhs) { return lhs.name < rhs.name; });
+    return snapshot;
+}
+
+PerfCounter& GetPerfCounter(std::string_view name) {
+    return PerfCounterRegistry::Instance().GetCounter(name);
+}
+
+} // namespace Common
@@ -0,0 +1,110 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "common/common_types.h"
+
+namespace Common {
+
+/**
+ * A single named runtime counter. Writes are relaxed atomic adds spread over a small number of
+ * cache-line-sized shards indexed by the calling thread, so hot paths on different threads never
+ * contend on one cache line. Counters are monotonic when used through Add; Set gives gauge
+ * semantics (last written value wins) for single-writer values like queue depths.
+ *
+ * Subsystems should look their counter up once and keep the reference:
+ *
+ *     static auto& draw_counter = Common::GetPerfCounter("gpu_draws");
+ *     draw_counter.Add();
+ */
+class PerfCounter : NonCopyable {
+public:
+    /// Adds a value to the calling thread's shard of the counter.
+    void Add(u64 value = 1) {
+        shards[ThreadShardIndex()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /// Overwrites the counter with a gauge value. Only meaningful with a single writer.
+    void Set(u64 value) {
+        for (std::size_t i = 1; i < NUM_SHARDS; ++i) {
+            shards[i].value.store(0, std::memory_order_relaxed);
+        }
+        shards[0].value.store(value, std::memory_order_relaxed);
+    }
+
+    /// Returns the summed value across all shards.
+    u64 Total() const {
+        u64 total = 0;
+        for (const auto& shard : shards) {
+            total += shard.value.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /// Resets all shards to zero.
+    void Reset() {
+        for (auto& shard : shards) {
+            shard.value.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    std::string_view GetName() const {
+        return name;
+    }
+
+private:
+    friend class PerfCounterRegistry;
+
+    explicit PerfCounter(std::string name) : name{std::move(name)} {}
+
+    /// Returns the shard the calling thread writes to. Threads are assigned round-robin on first
+    /// use, so the handful of emulator threads end up on distinct cache lines.
+    static std::size_t ThreadShardIndex();
+
+    static constexpr std::size_t NUM_SHARDS = 8;
+
+    struct alignas(64) Shard {
+        std::atomic<u64> value{0};
+    };
+    std::array<Shard, NUM_SHARDS> shards{};
+
+    std::string name;
+};
+
+/**
+ * Process-wide registry of runtime performance counters. Lookup by name is mutex-protected and
+ * intended to happen once per call site (cache the returned reference); returned references stay
+ * valid for the lifetime of the process.
+ */
+class PerfCounterRegistry : NonCopyable {
+public:
+    static PerfCounterRegistry& Instance();
+
+    /// Returns the counter registered under the given name, creating it on first use.
+    PerfCounter& GetCounter(std::string_view name);
+
+    /// One counter's name and summed value as of a snapshot.
+    struct Snapshot {
+        std::string_view name;
+        u64 value;
+    };
+
+    /// Returns the current value of every registered counter, sorted by name. Safe to call from
+    /// any thread; values are sampled with relaxed loads and may lag in-flight increments.
+    std::vector<Snapshot> GetSnapshot() const;
+
+private:
+    PerfCounterRegistry() = default;
+};
+
+/// Convenience wrapper for PerfCounterRegistry::Instance().GetCounter(name).
+PerfCounter& GetPerfCounter(std::string_view name);
+
+} // namespace Common
@@ -0,0 +1,21 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <boost/container/small_vector.hpp>
+
+namespace Common {
+
+/**
+ * Vector with inline storage for InlineSize elements, only spilling to the heap when it grows
+ * beyond that. Use this for hot-path temporaries with a known typical size so that building them
+ * does not hit the allocator. Alias of boost's implementation so call sites don't have to depend
+ * on the container library directly.
+ */
+template <typename T, std::size_t InlineSize>
+using SmallVector = boost::container::small_vector<T, InlineSize>;
+
+} // namespace Common
@@ -4,7 +4,6 @@
 
 #include <algorithm>
 #include <cctype>
-#include <codecvt>
 #include <cstdlib>
 #include <locale>
 #include <sstream>
@@ -140,27 +139,97 @@ std::string ReplaceAll(std::string result, const std::string& src, const std::st
 }
 
 std::string UTF16ToUTF8(const std::u16string& input) {
-#ifdef _MSC_VER
-    // Workaround for missing char16_t/char32_t instantiations in MSVC2017
-    std::wstring_convert<std::codecvt_utf8_utf16<__int16>, __int16> convert;
-    std::basic_string<__int16> tmp_buffer(input.cbegin(), input.cend());
-    return convert.to_bytes(tmp_buffer);
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.to_bytes(input);
-#endif
+    std::string output;
+    output.reserve(input.size());
+
+    for (std::size_t i = 0; i < input.size(); ++i) {
+        const char16_t c = input[i];
+
+        // Control metadata and filesystem names are overwhelmingly ASCII; consume whole runs
+        // without the multi-byte branches below.
+        if (c < 0x80) {
+            output.push_back(static_cast<char>(c));
+            continue;
+        }
+
+        if (c < 0x800) {
+            output.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            output.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+            continue;
+        }
+
+        if (c >= 0xD800 && c < 0xDC00) {
+            // High surrogate; combine with the following low surrogate when present, otherwise
+            // emit U+FFFD for the unpaired half.
+            if (i + 1 < input.size() && input[i + 1] >= 0xDC00 && input[i + 1] < 0xE000) {
+                const u32 code_point =
+                    0x10000 + ((static_cast<u32>(c) - 0xD800) << 10) + (input[i + 1] - 0xDC00);
+                output.push_back(static_cast<char>(0xF0 | (code_point >> 18)));
+                output.push_back(static_cast<char>(0x80 | ((code_point >> 12) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | ((code_point >> 6) & 0x3F)));
+                output.push_back(static_cast<char>(0x80 | (code_point & 0x3F)));
+                ++i;
+            } else {
+                output += "\xEF\xBF\xBD";
+            }
+            continue;
+        }
+        if (c >= 0xDC00 && c < 0xE000) {
+            // Unpaired low surrogate
+            output += "\xEF\xBF\xBD";
+            continue;
+        }
+
+        output.push_back(static_cast<char>(0xE0 | (c >> 12)));
+        output.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+        output.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+    }
+
+    return output;
 }
 
 std::u16string UTF8ToUTF16(const std::string& input) {
-#ifdef _MSC_VER
-    // Workaround for missing char16_t/char32_t instantiations in MSVC2017
-    std::wstring_convert<std::codecvt_utf8_utf16<__int16>, __int16> convert;
-    auto tmp_buffer = convert.from_bytes(input);
-    return std::u16string(tmp_buffer.cbegin(), tmp_buffer.cend());
-#else
-    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convert;
-    return convert.from_bytes(input);
-#endif
+    std::u16string output;
+    output.reserve(input.size());
+
+    for (std::size_t i = 0; i < input.size();) {
+        const u8 c = static_cast<u8>(input[i]);
+
+        if (c < 0x80) {
+            output.push_back(static_cast<char16_t>(c));
+            ++i;
+            continue;
+        }
+
+        // Decode the continuation bytes that are actually present; truncated or malformed
+        // sequences decode to U+FFFD and resynchronize at the next lead byte.
+        u32 code_point = 0xFFFD;
+        std::size_t length = 1;
+        if ((c & 0xE0) == 0xC0 && i + 1 < input.size()) {
+            code_point = ((c & 0x1F) << 6) | (static_cast<u8>(input[i + 1]) & 0x3F);
+            length = 2;
+        } else if ((c & 0xF0) == 0xE0 && i + 2 < input.size()) {
+            code_point = ((c & 0x0F) << 12) | ((static_cast<u8>(input[i + 1]) & 0x3F) << 6) |
+                         (static_cast<u8>(input[i + 2]) & 0x3F);
+            length = 3;
+        } else if ((c & 0xF8) == 0xF0 && i + 3 < input.size()) {
+            code_point = ((c & 0x07) << 18) | ((static_cast<u8>(input[i + 1]) & 0x3F) << 12) |
+                         ((static_cast<u8>(input[i + 2]) & 0x3F) << 6) |
+                         (static_cast<u8>(input[i + 3]) & 0x3F);
+            length = 4;
+        }
+        i += length;
+
+        if (code_point >= 0x10000) {
+            code_point -= 0x10000;
+            output.push_back(static_cast<char16_t>(0xD800 + (code_point >> 10)));
+            output.push_back(static_cast<char16_t>(0xDC00 + (code_point & 0x3FF)));
+        } else {
+            output.push_back(static_cast<char16_t>(code_point));
+        }
+    }
+
+    return output;
 }
 
 #ifdef _WIN32
@@ -0,0 +1,110 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/swap.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include <tmmintrin.h>
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace Common {
+
+namespace {
+
+void SwapArrayGeneric16(u16* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        data[i] = swap16(data[i]);
+    }
+}
+
+void SwapArrayGeneric32(u32* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        data[i] = swap32(data[i]);
+    }
+}
+
+void SwapArrayGeneric64(u64* data, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+        data[i] = swap64(data[i]);
+    }
+}
+
+#ifdef ARCHITECTURE_x86_64
+
+// MSVC emits SSSE3 intrinsics without special flags; GCC and Clang need the target attribute
+// since the build baseline is plain x86-64.
+#ifdef _MSC_VER
+#define SSSE3_FUNC
+#else
+#define SSSE3_FUNC __attribute__((target("ssse3")))
+#endif
+
+SSSE3_FUNC void SwapArray16Ssse3(u16* data, std::size_t count) {
+    const __m128i shuffle = _mm_set_epi8(14, 15, 12, 13, 10, 11, 8, 9, 6, 7, 4, 5, 2, 3, 0, 1);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapArrayGeneric16(data + i, count - i);
+}
+
+SSSE3_FUNC void SwapArray32Ssse3(u32* data, std::size_t count) {
+    const __m128i shuffle = _mm_set_epi8(12, 13, 14, 15, 8, 9, 10, 11, 4, 5, 6, 7, 0, 1, 2, 3);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapArrayGeneric32(data + i, count - i);
+}
+
+SSSE3_FUNC void SwapArray64Ssse3(u64* data, std::size_t count) {
+    const __m128i shuffle = _mm_set_epi8(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+    std::size_t i = 0;
+    for (; i + 2 <= count; i += 2) {
+        const __m128i value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + i), _mm_shuffle_epi8(value, shuffle));
+    }
+    SwapArrayGeneric64(data + i, count - i);
+}
+
+#undef SSSE3_FUNC
+
+#endif // ARCHITECTURE_x86_64
+
+} // Anonymous namespace
+
+void SwapArray16(u16* data, std::size_t count) {
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapArray16Ssse3(data, count);
+        return;
+    }
+#endif
+    SwapArrayGeneric16(data, count);
+}
+
+void SwapArray32(u32* data, std::size_t count) {
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapArray32Ssse3(data, count);
+        return;
+    }
+#endif
+    SwapArrayGeneric32(data, count);
+}
+
+void SwapArray64(u64* data, std::size_t count) {
+#ifdef ARCHITECTURE_x86_64
+    if (GetCPUCaps().ssse3) {
+        SwapArray64Ssse3(data, count);
+        return;
+    }
+#endif
+    SwapArrayGeneric64(data, count);
+}
+
+} // namespace Common
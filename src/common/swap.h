@@ -17,14 +17,7 @@
 
 #pragma once
 
-#if defined(_MSC_VER)
-#include <cstdlib>
-#elif defined(__linux__)
-#include <byteswap.h>
-#elif defined(__Bitrig__) || defined(__DragonFly__) || defined(__FreeBSD__) ||                     \
-    defined(__NetBSD__) || defined(__OpenBSD__)
-#include <sys/endian.h>
-#endif
+#include <cstddef>
 #include <cstring>
 #include "common/common_types.h"
 
@@ -59,85 +52,43 @@
 
 namespace Common {
 
-#ifdef _MSC_VER
-inline u16 swap16(u16 _data) {
-    return _byteswap_ushort(_data);
-}
-inline u32 swap32(u32 _data) {
-    return _byteswap_ulong(_data);
-}
-inline u64 swap64(u64 _data) {
-    return _byteswap_uint64(_data);
-}
-#elif defined(ARCHITECTURE_ARM) && (__ARM_ARCH >= 6)
-inline u16 swap16(u16 _data) {
-    u32 data = _data;
-    __asm__("rev16 %0, %1\n" : "=l"(data) : "l"(data));
-    return (u16)data;
-}
-inline u32 swap32(u32 _data) {
-    __asm__("rev %0, %1\n" : "=l"(_data) : "l"(_data));
-    return _data;
-}
-inline u64 swap64(u64 _data) {
-    return ((u64)swap32(_data) << 32) | swap32(_data >> 32);
-}
-#elif __linux__
-inline u16 swap16(u16 _data) {
-    return bswap_16(_data);
-}
-inline u32 swap32(u32 _data) {
-    return bswap_32(_data);
-}
-inline u64 swap64(u64 _data) {
-    return bswap_64(_data);
-}
-#elif __APPLE__
-inline __attribute__((always_inline)) u16 swap16(u16 _data) {
-    return (_data >> 8) | (_data << 8);
-}
-inline __attribute__((always_inline)) u32 swap32(u32 _data) {
-    return __builtin_bswap32(_data);
-}
-inline __attribute__((always_inline)) u64 swap64(u64 _data) {
-    return __builtin_bswap64(_data);
-}
-#elif defined(__Bitrig__) || defined(__OpenBSD__)
-// redefine swap16, swap32, swap64 as inline functions
-#undef swap16
-#undef swap32
-#undef swap64
-inline u16 swap16(u16 _data) {
-    return __swap16(_data);
-}
-inline u32 swap32(u32 _data) {
-    return __swap32(_data);
-}
-inline u64 swap64(u64 _data) {
-    return __swap64(_data);
-}
-#elif defined(__DragonFly__) || defined(__FreeBSD__) || defined(__NetBSD__)
-inline u16 swap16(u16 _data) {
-    return bswap16(_data);
-}
-inline u32 swap32(u32 _data) {
-    return bswap32(_data);
-}
-inline u64 swap64(u64 _data) {
-    return bswap64(_data);
-}
+// The byte swaps stay constexpr so they remain usable for building compile-time tables. GCC and
+// Clang fold the builtins; MSVC pattern-matches the plain shift/mask expressions into a single
+// bswap instruction, so no platform headers or inline assembly are needed anymore.
+constexpr u16 swap16(u16 data) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(data);
 #else
-// Slow generic implementation.
-inline u16 swap16(u16 data) {
-    return (data >> 8) | (data << 8);
-}
-inline u32 swap32(u32 data) {
-    return (swap16(data) << 16) | swap16(data >> 16);
+    return static_cast<u16>((data >> 8) | (data << 8));
+#endif
 }
-inline u64 swap64(u64 data) {
-    return ((u64)swap32(data) << 32) | swap32(data >> 32);
+constexpr u32 swap32(u32 data) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(data);
+#else
+    return ((data & 0xFF000000) >> 24) | ((data & 0x00FF0000) >> 8) |
+           ((data & 0x0000FF00) << 8) | ((data & 0x000000FF) << 24);
+#endif
 }
+constexpr u64 swap64(u64 data) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(data);
+#else
+    return (static_cast<u64>(swap32(static_cast<u32>(data))) << 32) |
+           swap32(static_cast<u32>(data >> 32));
 #endif
+}
+
+static_assert(swap16(0x1234) == 0x3412, "swap16 is broken");
+static_assert(swap32(0x12345678) == 0x78563412, "swap32 is broken");
+static_assert(swap64(0x0123456789ABCDEFULL) == 0xEFCDAB8967452301ULL, "swap64 is broken");
+
+/// Byte-swaps count elements in place. On x64 these dispatch at runtime to an SSSE3 pshufb
+/// kernel, which is considerably faster than the element-wise helpers for the big-endian tables
+/// the loader and crypto code reads.
+void SwapArray16(u16* data, std::size_t count);
+void SwapArray32(u32* data, std::size_t count);
+void SwapArray64(u64* data, std::size_t count);
 
 inline float swapf(float f) {
     static_assert(sizeof(u32) == sizeof(float), "float must be the same size as uint32_t.");
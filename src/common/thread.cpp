@@ -16,6 +16,7 @@
 #include <sched.h>
 #endif
 #ifndef _WIN32
+#include <sys/resource.h>
 #include <unistd.h>
 #endif
 
@@ -35,6 +36,26 @@ void SetCurrentThreadAffinity(u32 mask) {
     SetThreadAffinityMask(GetCurrentThread(), mask);
 }
 
+void SetCurrentThreadPriority(ThreadPriority priority) {
+    int windows_priority;
+    switch (priority) {
+    case ThreadPriority::Low:
+        windows_priority = THREAD_PRIORITY_BELOW_NORMAL;
+        break;
+    case ThreadPriority::AboveNormal:
+        windows_priority = THREAD_PRIORITY_ABOVE_NORMAL;
+        break;
+    case ThreadPriority::High:
+        windows_priority = THREAD_PRIORITY_HIGHEST;
+        break;
+    case ThreadPriority::Normal:
+    default:
+        windows_priority = THREAD_PRIORITY_NORMAL;
+        break;
+    }
+    SetThreadPriority(GetCurrentThread(), windows_priority);
+}
+
 void SwitchCurrentThread() {
     SwitchToThread();
 }
@@ -89,6 +110,53 @@ void SetCurrentThreadAffinity(u32 mask) {
     SetThreadAffinity(pthread_self(), mask);
 }
 
+void SetCurrentThreadPriority(ThreadPriority priority) {
+#ifdef __linux__
+    // On Linux, setpriority() affects only the calling thread rather than the whole process.
+    // Raising a thread above the default niceness needs elevated privileges, so this is
+    // best-effort and silently keeps the old priority when the request is denied.
+    int nice_value;
+    switch (priority) {
+    case ThreadPriority::Low:
+        nice_value = 5;
+        break;
+    case ThreadPriority::AboveNormal:
+        nice_value = -5;
+        break;
+    case ThreadPriority::High:
+        nice_value = -10;
+        break;
+    case ThreadPriority::Normal:
+    default:
+        nice_value = 0;
+        break;
+    }
+    setpriority(PRIO_PROCESS, 0, nice_value);
+#else
+    const int min_priority = sched_get_priority_min(SCHED_OTHER);
+    const int max_priority = sched_get_priority_max(SCHED_OTHER);
+    const int range = max_priority - min_priority;
+
+    sched_param params{};
+    switch (priority) {
+    case ThreadPriority::Low:
+        params.sched_priority = min_priority + range / 4;
+        break;
+    case ThreadPriority::AboveNormal:
+        params.sched_priority = min_priority + range * 3 / 4;
+        break;
+    case ThreadPriority::High:
+        params.sched_priority = max_priority;
+        break;
+    case ThreadPriority::Normal:
+    default:
+        params.sched_priority = min_priority + range / 2;
+        break;
+    }
+    pthread_setschedparam(pthread_self(), SCHED_OTHER, &params);
+#endif
+}
+
 #ifndef _WIN32
 void SwitchCurrentThread() {
     usleep(1000 * 1);
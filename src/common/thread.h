@@ -78,8 +78,16 @@ private:
     std::size_t generation = 0; // Incremented once each time the barrier is used
 };
 
+enum class ThreadPriority {
+    Low,
+    Normal,
+    AboveNormal,
+    High,
+};
+
 void SetThreadAffinity(std::thread::native_handle_type thread, u32 mask);
 void SetCurrentThreadAffinity(u32 mask);
+void SetCurrentThreadPriority(ThreadPriority priority);
 void SwitchCurrentThread(); // On Linux, this is equal to sleep 1ms
 void SetCurrentThreadName(const char* name);
 
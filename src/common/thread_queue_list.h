@@ -7,6 +7,8 @@
 #include <array>
 #include <deque>
 #include <boost/range/algorithm_ext/erase.hpp>
+#include "common/bit_util.h"
+#include "common/common_types.h"
 
 namespace Common {
 
@@ -20,16 +22,13 @@ struct ThreadQueueList {
 
     // Number of priority levels. (Valid levels are [0..NUM_QUEUES).)
     static const Priority NUM_QUEUES = N;
-
-    ThreadQueueList() {
-        first = nullptr;
-    }
+    static_assert(N <= BitSize<u64>(), "Number of priority levels must fit in the occupancy mask");
 
     // Only for debugging, returns priority level.
     Priority contains(const T& uid) const {
         for (Priority i = 0; i < NUM_QUEUES; ++i) {
-            const Queue& cur = queues[i];
-            if (std::find(cur.data.cbegin(), cur.data.cend(), uid) != cur.data.cend()) {
+            const auto& data = queues[i];
+            if (std::find(data.cbegin(), data.cend(), uid) != data.cend()) {
                 return i;
             }
         }
@@ -38,140 +37,109 @@ struct ThreadQueueList {
     }
 
     T get_first() const {
-        const Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                return cur->data.front();
-            }
-            cur = cur->next_nonempty;
+        if (nonempty_mask == 0) {
+            return T();
         }
-
-        return T();
+        return queues[HighestSetPriority(nonempty_mask)].front();
     }
 
     template <typename UnaryPredicate>
     T get_first_filter(UnaryPredicate filter) const {
-        const Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                for (const auto& item : cur->data) {
-                    if (filter(item))
-                        return item;
-                }
+        for (u64 mask = nonempty_mask; mask != 0; mask &= mask - 1) {
+            for (const auto& item : queues[HighestSetPriority(mask)]) {
+                if (filter(item))
+                    return item;
             }
-            cur = cur->next_nonempty;
         }
 
         return T();
     }
 
     T pop_first() {
-        Queue* cur = first;
-        while (cur != nullptr) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                return tmp;
-            }
-            cur = cur->next_nonempty;
+        if (nonempty_mask == 0) {
+            return T();
         }
 
-        return T();
+        const Priority priority = HighestSetPriority(nonempty_mask);
+        auto& data = queues[priority];
+        auto tmp = std::move(data.front());
+        data.pop_front();
+        if (data.empty()) {
+            nonempty_mask &= ~(u64(1) << priority);
+        }
+        return tmp;
     }
 
     T pop_first_better(Priority priority) {
-        Queue* cur = first;
-        Queue* stop = &queues[priority];
-        while (cur < stop) {
-            if (!cur->data.empty()) {
-                auto tmp = std::move(cur->data.front());
-                cur->data.pop_front();
-                return tmp;
-            }
-            cur = cur->next_nonempty;
+        const u64 mask = nonempty_mask & ((u64(1) << priority) - 1);
+        if (mask == 0) {
+            return T();
         }
 
-        return T();
+        const Priority best = HighestSetPriority(mask);
+        auto& data = queues[best];
+        auto tmp = std::move(data.front());
+        data.pop_front();
+        if (data.empty()) {
+            nonempty_mask &= ~(u64(1) << best);
+        }
+        return tmp;
     }
 
     void push_front(Priority priority, const T& thread_id) {
-        Queue* cur = &queues[priority];
-        cur->data.push_front(thread_id);
+        queues[priority].push_front(thread_id);
+        nonempty_mask |= u64(1) << priority;
     }
 
     void push_back(Priority priority, const T& thread_id) {
-        Queue* cur = &queues[priority];
-        cur->data.push_back(thread_id);
+        queues[priority].push_back(thread_id);
+        nonempty_mask |= u64(1) << priority;
     }
 
     void move(const T& thread_id, Priority old_priority, Priority new_priority) {
         remove(old_priority, thread_id);
-        prepare(new_priority);
         push_back(new_priority, thread_id);
     }
 
     void remove(Priority priority, const T& thread_id) {
-        Queue* cur = &queues[priority];
-        boost::remove_erase(cur->data, thread_id);
+        auto& data = queues[priority];
+        boost::remove_erase(data, thread_id);
+        if (data.empty()) {
+            nonempty_mask &= ~(u64(1) << priority);
+        }
     }
 
     void rotate(Priority priority) {
-        Queue* cur = &queues[priority];
+        auto& data = queues[priority];
 
-        if (cur->data.size() > 1) {
-            cur->data.push_back(std::move(cur->data.front()));
-            cur->data.pop_front();
+        if (data.size() > 1) {
+            data.push_back(std::move(data.front()));
+            data.pop_front();
         }
     }
 
     void clear() {
-        queues.fill(Queue());
-        first = nullptr;
+        for (auto& data : queues) {
+            data.clear();
+        }
+        nonempty_mask = 0;
     }
 
     bool empty(Priority priority) const {
-        const Queue* cur = &queues[priority];
-        return cur->data.empty();
-    }
-
-    void prepare(Priority priority) {
-        Queue* cur = &queues[priority];
-        if (cur->next_nonempty == UnlinkedTag())
-            link(priority);
+        return queues[priority].empty();
     }
 
 private:
-    struct Queue {
-        // Points to the next active priority, skipping over ones that have never been used.
-        Queue* next_nonempty = UnlinkedTag();
-        // Double-ended queue of threads in this priority level
-        std::deque<T> data;
-    };
-
-    /// Special tag used to mark priority levels that have never been used.
-    static Queue* UnlinkedTag() {
-        return reinterpret_cast<Queue*>(1);
-    }
-
-    void link(Priority priority) {
-        Queue* cur = &queues[priority];
-
-        for (int i = priority - 1; i >= 0; --i) {
-            if (queues[i].next_nonempty != UnlinkedTag()) {
-                cur->next_nonempty = queues[i].next_nonempty;
-                queues[i].next_nonempty = cur;
-                return;
-            }
-        }
-
-        cur->next_nonempty = first;
-        first = cur;
+    /// Returns the lowest set bit index, which is the highest (numerically lowest) priority with
+    /// at least one ready thread. The mask must be non-zero.
+    static Priority HighestSetPriority(u64 mask) {
+        return static_cast<Priority>(CountTrailingZeroes64(mask));
     }
 
-    // The first queue that's ever been used.
-    Queue* first;
+    /// One bit per priority level, set when the corresponding queue is non-empty.
+    u64 nonempty_mask = 0;
     // The priority level queues of thread ids.
-    std::array<Queue, NUM_QUEUES> queues;
+    std::array<std::deque<T>, NUM_QUEUES> queues;
 };
 
 } // namespace Common
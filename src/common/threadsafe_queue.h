@@ -9,6 +9,7 @@
 
 #include <algorithm>
 #include <atomic>
+#include <condition_variable>
 #include <cstddef>
 #include <mutex>
 #include "common/common_types.h"
@@ -43,12 +44,21 @@ public:
         // create the element, add it to the queue
         write_ptr->current = std::forward<Arg>(t);
         // set the next pointer to a new element ptr
-        // then advance the write pointer
+        // then advance the write pointer; the default seq_cst ordering is
+        // required so this publication cannot be reordered past the
+        // consumer_waiting check below
         ElementPtr* new_ptr = new ElementPtr();
-        write_ptr->next.store(new_ptr, std::memory_order_release);
+        write_ptr->next.store(new_ptr);
         write_ptr = new_ptr;
         if (NeedSize)
             size++;
+
+        // cross-thread signaling, only paid for when a consumer actually went
+        // to sleep in PopWait
+        if (consumer_waiting.load()) {
+            std::lock_guard<std::mutex> lock(cv_mutex);
+            cv.notify_one();
+        }
     }
 
     void Pop() {
@@ -77,6 +87,19 @@ public:
         return true;
     }
 
+    /// Pops an element, blocking until one is available
+    T PopWait() {
+        if (Empty()) {
+            std::unique_lock<std::mutex> lock(cv_mutex);
+            consumer_waiting.store(true);
+            cv.wait(lock, [this]() { return !Empty(); });
+            consumer_waiting.store(false);
+        }
+        T t;
+        Pop(t);
+        return t;
+    }
+
     // not thread-safe
     void Clear() {
         size.store(0);
@@ -104,47 +127,140 @@ private:
     ElementPtr* write_ptr;
     ElementPtr* read_ptr;
     std::atomic<u32> size;
+    std::atomic<bool> consumer_waiting{false};
+    std::mutex cv_mutex;
+    std::condition_variable cv;
 };
 
-// a simple thread-safe,
-// single reader, multiple writer queue
-
+// a lock-free thread-safe,
+// single reader, multiple writer queue.
+// Producers claim the tail with an atomic exchange and never block, so
+// threads may push concurrently without contending on a mutex.
 template <typename T, bool NeedSize = true>
 class MPSCQueue {
 public:
+    MPSCQueue() : size(0) {
+        ElementPtr* stub = new ElementPtr();
+        write_ptr.store(stub, std::memory_order_relaxed);
+        read_ptr = stub;
+    }
+
+    ~MPSCQueue() {
+        // this will empty out the whole queue
+        delete read_ptr;
+    }
+
     u32 Size() const {
-        return spsc_queue.Size();
+        static_assert(NeedSize, "using Size() on MPSCQueue without NeedSize");
+        return size.load();
     }
 
     bool Empty() const {
-        return spsc_queue.Empty();
+        return !read_ptr->next.load();
     }
 
     T& Front() const {
-        return spsc_queue.Front();
+        return read_ptr->next.load()->current;
     }
 
     template <typename Arg>
     void Push(Arg&& t) {
-        std::lock_guard<std::mutex> lock(write_lock);
-        spsc_queue.Push(t);
+        // create the element holding the data
+        ElementPtr* new_ptr = new ElementPtr();
+        new_ptr->current = std::forward<Arg>(t);
+        // atomically claim the tail slot; only this producer may link the
+        // previous tail to the new element
+        ElementPtr* prev_ptr = write_ptr.exchange(new_ptr, std::memory_order_acq_rel);
+        prev_ptr->next.store(new_ptr);
+        if (NeedSize)
+            size++;
+
+        // only pay for cross-thread signaling when a consumer actually went to
+        // sleep in PopWait; the default seq_cst ordering against the link store
+        // above keeps the wakeup from being lost
+        if (consumer_waiting.load()) {
+            std::lock_guard<std::mutex> lock(cv_mutex);
+            cv.notify_one();
+        }
     }
 
     void Pop() {
-        return spsc_queue.Pop();
+        ElementPtr* next_ptr = read_ptr->next.load(std::memory_order_acquire);
+        if (!next_ptr)
+            return;
+
+        if (NeedSize)
+            size--;
+
+        ElementPtr* tmpptr = read_ptr;
+        // advance the read pointer
+        read_ptr = next_ptr;
+        // set the next element to nullptr to stop the recursive deletion
+        tmpptr->next.store(nullptr);
+        delete tmpptr;
     }
 
     bool Pop(T& t) {
-        return spsc_queue.Pop(t);
+        ElementPtr* next_ptr = read_ptr->next.load(std::memory_order_acquire);
+        if (!next_ptr)
+            return false;
+
+        if (NeedSize)
+            size--;
+
+        t = std::move(next_ptr->current);
+        ElementPtr* tmpptr = read_ptr;
+        read_ptr = next_ptr;
+        tmpptr->next.store(nullptr);
+        delete tmpptr;
+        return true;
+    }
+
+    /// Pops an element, blocking until one is available
+    T PopWait() {
+        if (Empty()) {
+            std::unique_lock<std::mutex> lock(cv_mutex);
+            consumer_waiting.store(true);
+            cv.wait(lock, [this]() { return !Empty(); });
+            consumer_waiting.store(false);
+        }
+        T t;
+        Pop(t);
+        return t;
     }
 
     // not thread-safe
     void Clear() {
-        spsc_queue.Clear();
+        size.store(0);
+        delete read_ptr;
+        ElementPtr* stub = new ElementPtr();
+        write_ptr.store(stub, std::memory_order_relaxed);
+        read_ptr = stub;
     }
 
 private:
-    SPSCQueue<T, NeedSize> spsc_queue;
-    std::mutex write_lock;
+    // same node layout as SPSCQueue, but the element lives in the node that
+    // carries it rather than in the one before it, since multiple producers
+    // cannot safely write into a shared tail stub
+    class ElementPtr {
+    public:
+        ElementPtr() : next(nullptr) {}
+        ~ElementPtr() {
+            ElementPtr* next_ptr = next.load();
+
+            if (next_ptr)
+                delete next_ptr;
+        }
+
+        T current;
+        std::atomic<ElementPtr*> next;
+    };
+
+    std::atomic<ElementPtr*> write_ptr;
+    ElementPtr* read_ptr;
+    std::atomic<u32> size;
+    std::atomic<bool> consumer_waiting{false};
+    std::mutex cv_mutex;
+    std::condition_variable cv;
 };
 } // namespace Common
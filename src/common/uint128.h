@@ -0,0 +1,24 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#pragma intrinsic(__umulh)
+#endif
+#include "common/common_types.h"
+
+namespace Common {
+
+/// Returns the upper 64 bits of the 128-bit product of a and b.
+inline u64 MultiplyHigh64(u64 a, u64 b) {
+#ifdef _MSC_VER
+    return __umulh(a, b);
+#else
+    return static_cast<u64>((static_cast<unsigned __int128>(a) * b) >> 64);
+#endif
+}
+
+} // namespace Common
@@ -49,6 +49,15 @@ public:
     /// Clear all instruction cache
     virtual void ClearInstructionCache() = 0;
 
+    /**
+     * Clear instruction cache for a range of guest addresses. Prefer this over a full
+     * ClearInstructionCache whenever the modified range is known; a full clear forces the JIT
+     * to retranslate the entire title.
+     * @param addr Start of the modified range.
+     * @param size Size of the modified range in bytes.
+     */
+    virtual void ClearInstructionCacheRange(VAddr addr, u64 size) = 0;
+
     /// Notify CPU emulation that page tables have changed
     virtual void PageTableChanged() = 0;
 
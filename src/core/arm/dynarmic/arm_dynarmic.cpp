@@ -2,13 +2,16 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
+#include <map>
 #include <memory>
 #include <dynarmic/A64/a64.h>
 #include <dynarmic/A64/config.h>
 #include "common/logging/log.h"
 #include "common/microprofile.h"
 #include "core/arm/dynarmic/arm_dynarmic.h"
+#include "core/arm/jit_warmup.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
 #include "core/core_timing.h"
@@ -42,6 +45,17 @@ public:
     Vector MemoryRead128(u64 vaddr) override {
         return {Memory::Read64(vaddr), Memory::Read64(vaddr + 8)};
     }
+    u32 MemoryReadCode(u64 vaddr) override {
+        // Only called while dynarmic translates a block. Translation walks code sequentially,
+        // so reporting each page once per burst keeps the warmup profile update off the
+        // per-instruction path.
+        const u64 page = vaddr & ~Memory::PAGE_MASK;
+        if (page != last_translated_page) {
+            last_translated_page = page;
+            JitWarmup::Instance().RecordCodePage(vaddr);
+        }
+        return Memory::Read32(vaddr);
+    }
 
     void MemoryWrite8(u64 vaddr, u8 value) override {
         Memory::Write8(vaddr, value);
@@ -64,13 +78,18 @@ public:
         LOG_INFO(Core_ARM, "Unicorn fallback @ 0x{:X} for {} instructions (instr = {:08X})", pc,
                  num_instructions, MemoryReadCode(pc));
 
+        parent.EnsureFallbackInterpreter();
+
         ARM_Interface::ThreadContext ctx;
         parent.SaveContext(ctx);
-        parent.inner_unicorn.LoadContext(ctx);
-        parent.inner_unicorn.ExecuteInstructions(static_cast<int>(num_instructions));
-        parent.inner_unicorn.SaveContext(ctx);
+        parent.inner_unicorn->LoadContext(ctx);
+        parent.inner_unicorn->ExecuteInstructions(static_cast<int>(num_instructions));
+        parent.inner_unicorn->SaveContext(ctx);
         parent.LoadContext(ctx);
+        // ctx is a temporary; never let the lazy save path associate the jit state with it.
+        parent.jit_state_dirty = true;
         num_interpreted_instructions += num_instructions;
+        fallback_instructions_per_pc[pc] += num_instructions;
     }
 
     void ExceptionRaised(u64 pc, Dynarmic::A64::Exception exception) override {
@@ -124,6 +143,11 @@ public:
 
     ARM_Dynarmic& parent;
     std::size_t num_interpreted_instructions = 0;
+    /// Instructions executed by the fallback interpreter, keyed by the pc that left the jit.
+    /// Stays empty for the common case of a title that never falls back.
+    std::map<u64, u64> fallback_instructions_per_pc;
+    /// Last code page reported to the JIT warmup profile, see MemoryReadCode
+    u64 last_translated_page = ~u64(0);
     u64 tpidrro_el0 = 0;
     u64 tpidr_el0 = 0;
 };
@@ -155,6 +179,14 @@ std::unique_ptr<Dynarmic::A64::Jit> ARM_Dynarmic::MakeJit() const {
     // Unpredictable instructions
     config.define_unpredictable_behaviour = true;
 
+    // Optimizations
+    // Block linking and return-stack prediction keep execution inside the JIT instead of
+    // round-tripping through the dispatcher on every block exit.
+    config.enable_fast_dispatch = true;
+    // Hint instructions (WFI/WFE/YIELD) were only hooked to be ignored in ExceptionRaised;
+    // treating them as no-ops directly avoids leaving the JIT for emulated busy-waits.
+    config.hook_hint_instructions = false;
+
     return std::make_unique<Dynarmic::A64::Jit>(config);
 }
 
@@ -164,34 +196,78 @@ void ARM_Dynarmic::Run() {
     MICROPROFILE_SCOPE(ARM_Jit_Dynarmic);
     ASSERT(Memory::GetCurrentPageTable() == current_page_table);
 
+    // Mark the state dirty before entering the jit so that context saves triggered from within
+    // the run (e.g. by the GDB stub) never take the lazy skip path.
+    jit_state_dirty = true;
     jit->Run();
 }
 
 void ARM_Dynarmic::Step() {
+    jit_state_dirty = true;
     cb->InterpreterFallback(jit->GetPC(), 1);
 }
 
 ARM_Dynarmic::ARM_Dynarmic(ExclusiveMonitor& exclusive_monitor, std::size_t core_index)
     : cb(std::make_unique<ARM_Dynarmic_Callbacks>(*this)), core_index{core_index},
       exclusive_monitor{dynamic_cast<DynarmicExclusiveMonitor&>(exclusive_monitor)} {
-    ThreadContext ctx{};
-    inner_unicorn.SaveContext(ctx);
+    // A freshly created guest thread starts with an all-zero register file, so the initial
+    // context doesn't need to come from anywhere.
+    const ThreadContext ctx{};
     PageTableChanged();
     LoadContext(ctx);
+    // ctx is a temporary; never let the lazy save path associate the jit state with it.
+    jit_state_dirty = true;
+}
+
+ARM_Dynarmic::~ARM_Dynarmic() {
+    if (cb->fallback_instructions_per_pc.empty()) {
+        return;
+    }
+
+    u64 total = 0;
+    for (const auto& [pc, instructions] : cb->fallback_instructions_per_pc) {
+        LOG_DEBUG(Core_ARM, "Fallback block @ 0x{:X} interpreted {} instructions", pc,
+                  instructions);
+        total += instructions;
+    }
+    LOG_INFO(Core_ARM, "Interpreted {} instructions across {} fallback sites this session", total,
+             cb->fallback_instructions_per_pc.size());
 }
 
-ARM_Dynarmic::~ARM_Dynarmic() = default;
+void ARM_Dynarmic::EnsureFallbackInterpreter() {
+    if (inner_unicorn) {
+        return;
+    }
+
+    inner_unicorn = std::make_unique<ARM_Unicorn>();
+    for (const auto& mapping : backing_mappings) {
+        inner_unicorn->MapBackingMemory(mapping.address, mapping.size, mapping.memory,
+                                        mapping.perms);
+    }
+}
 
 void ARM_Dynarmic::MapBackingMemory(u64 address, std::size_t size, u8* memory,
                                     Kernel::VMAPermission perms) {
-    inner_unicorn.MapBackingMemory(address, size, memory, perms);
+    backing_mappings.push_back({address, size, memory, perms});
+    if (inner_unicorn) {
+        inner_unicorn->MapBackingMemory(address, size, memory, perms);
+    }
 }
 
 void ARM_Dynarmic::UnmapMemory(u64 address, std::size_t size) {
-    inner_unicorn.UnmapMemory(address, size);
+    const auto iter = std::find_if(
+        backing_mappings.begin(), backing_mappings.end(),
+        [&](const BackingMapping& mapping) { return mapping.address == address; });
+    if (iter != backing_mappings.end()) {
+        backing_mappings.erase(iter);
+    }
+    if (inner_unicorn) {
+        inner_unicorn->UnmapMemory(address, size);
+    }
 }
 
 void ARM_Dynarmic::SetPC(u64 pc) {
+    jit_state_dirty = true;
     jit->SetPC(pc);
 }
 
@@ -204,6 +280,7 @@ u64 ARM_Dynarmic::GetReg(int index) const {
 }
 
 void ARM_Dynarmic::SetReg(int index, u64 value) {
+    jit_state_dirty = true;
     jit->SetRegister(index, value);
 }
 
@@ -212,6 +289,7 @@ u128 ARM_Dynarmic::GetVectorReg(int index) const {
 }
 
 void ARM_Dynarmic::SetVectorReg(int index, u128 value) {
+    jit_state_dirty = true;
     jit->SetVector(index, value);
 }
 
@@ -220,6 +298,7 @@ u32 ARM_Dynarmic::GetPSTATE() const {
 }
 
 void ARM_Dynarmic::SetPSTATE(u32 pstate) {
+    jit_state_dirty = true;
     jit->SetPstate(pstate);
 }
 
@@ -240,6 +319,13 @@ void ARM_Dynarmic::SetTPIDR_EL0(u64 value) {
 }
 
 void ARM_Dynarmic::SaveContext(ThreadContext& ctx) {
+    if (&ctx == last_loaded_context && !jit_state_dirty) {
+        // The jit neither executed nor had its state poked since this context was loaded, so the
+        // context already holds the current state and the full register file copy can be skipped.
+        // This is a common case for reschedules that switch away from a thread before it runs.
+        return;
+    }
+
     ctx.cpu_registers = jit->GetRegisters();
     ctx.sp = jit->GetSP();
     ctx.pc = jit->GetPC();
@@ -248,6 +334,10 @@ void ARM_Dynarmic::SaveContext(ThreadContext& ctx) {
     ctx.fpcr = jit->GetFpcr();
     ctx.fpsr = jit->GetFpsr();
     ctx.tpidr = cb->tpidr_el0;
+
+    // The context now mirrors the jit state, so a reload of it can be elided as well.
+    last_loaded_context = &ctx;
+    jit_state_dirty = false;
 }
 
 void ARM_Dynarmic::LoadContext(const ThreadContext& ctx) {
@@ -259,6 +349,9 @@ void ARM_Dynarmic::LoadContext(const ThreadContext& ctx) {
     jit->SetFpcr(ctx.fpcr);
     jit->SetFpsr(ctx.fpsr);
     SetTPIDR_EL0(ctx.tpidr);
+
+    last_loaded_context = &ctx;
+    jit_state_dirty = false;
 }
 
 void ARM_Dynarmic::PrepareReschedule() {
@@ -269,6 +362,10 @@ void ARM_Dynarmic::ClearInstructionCache() {
     jit->ClearCache();
 }
 
+void ARM_Dynarmic::ClearInstructionCacheRange(VAddr addr, u64 size) {
+    jit->InvalidateCacheRange(addr, size);
+}
+
 void ARM_Dynarmic::ClearExclusiveState() {
     jit->ClearExclusiveState();
 }
@@ -276,6 +373,9 @@ void ARM_Dynarmic::ClearExclusiveState() {
 void ARM_Dynarmic::PageTableChanged() {
     jit = MakeJit();
     current_page_table = Memory::GetCurrentPageTable();
+    // The fresh jit starts with a clean register file that matches no thread context.
+    last_loaded_context = nullptr;
+    jit_state_dirty = false;
 }
 
 DynarmicExclusiveMonitor::DynarmicExclusiveMonitor(std::size_t core_count) : monitor(core_count) {}
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <dynarmic/A64/a64.h>
 #include <dynarmic/A64/exclusive_monitor.h>
 #include "common/common_types.h"
@@ -51,20 +52,47 @@ public:
     void ClearExclusiveState() override;
 
     void ClearInstructionCache() override;
+    void ClearInstructionCacheRange(VAddr addr, u64 size) override;
     void PageTableChanged() override;
 
 private:
     std::unique_ptr<Dynarmic::A64::Jit> MakeJit() const;
 
+    /// Creates the fallback interpreter and replays the current backing memory mappings into it.
+    /// Does nothing when it already exists.
+    void EnsureFallbackInterpreter();
+
     friend class ARM_Dynarmic_Callbacks;
     std::unique_ptr<ARM_Dynarmic_Callbacks> cb;
     std::unique_ptr<Dynarmic::A64::Jit> jit;
-    ARM_Unicorn inner_unicorn;
+
+    /// Fallback interpreter for the rare instructions the JIT does not implement. Created on
+    /// first use, so titles that never hit a fallback do not pay for a Unicorn instance at all.
+    std::unique_ptr<ARM_Unicorn> inner_unicorn;
+
+    /// Backing memory mappings recorded so a lazily created fallback interpreter can be brought
+    /// up to date with the current address space.
+    struct BackingMapping {
+        u64 address;
+        std::size_t size;
+        u8* memory;
+        Kernel::VMAPermission perms;
+    };
+    std::vector<BackingMapping> backing_mappings;
 
     std::size_t core_index;
     DynarmicExclusiveMonitor& exclusive_monitor;
 
     Memory::PageTable* current_page_table = nullptr;
+
+    /// Context that was most recently handed to LoadContext (or filled by SaveContext), compared
+    /// by address only. While the jit state is not dirty, the jit still mirrors this context and
+    /// saving into it again can be skipped entirely.
+    const ThreadContext* last_loaded_context = nullptr;
+
+    /// Set whenever the jit executes or its register state is poked from the outside, meaning the
+    /// jit state has (potentially) diverged from last_loaded_context.
+    bool jit_state_dirty = false;
 };
 
 class DynarmicExclusiveMonitor final : public ExclusiveMonitor {
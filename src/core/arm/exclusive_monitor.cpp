@@ -3,9 +3,81 @@
 // Refer to the license.txt file included.
 
 #include "core/arm/exclusive_monitor.h"
+#include "core/memory.h"
 
 namespace Core {
 
 ExclusiveMonitor::~ExclusiveMonitor() = default;
 
+ShardedExclusiveMonitor::ShardedExclusiveMonitor(std::size_t core_count)
+    : reservations{std::make_unique<Reservation[]>(core_count)}, core_count{core_count} {}
+
+ShardedExclusiveMonitor::~ShardedExclusiveMonitor() = default;
+
+void ShardedExclusiveMonitor::SetExclusive(std::size_t core_index, VAddr addr) {
+    const VAddr line = LineOf(addr);
+    // Placing the reservation under the line's shard lock orders it against the write+scan
+    // critical section in DoExclusiveOperation: a concurrent writer on this line either sees
+    // this reservation during its scan (and breaks it), or its write happened-before the lock
+    // hand-off and is visible to the guest reads this core performs after reserving. Without
+    // the lock the store-buffer pattern lets both sides miss each other, and a subsequent
+    // exclusive write would succeed against a stale value.
+    std::lock_guard<std::mutex> lock(shards[line & (SHARD_COUNT - 1)].lock);
+    reservations[core_index].line.store(line, std::memory_order_release);
+}
+
+void ShardedExclusiveMonitor::ClearExclusive() {
+    for (std::size_t core = 0; core < core_count; ++core) {
+        reservations[core].line.store(INVALID_LINE, std::memory_order_release);
+    }
+}
+
+template <typename WriteOp>
+bool ShardedExclusiveMonitor::DoExclusiveOperation(std::size_t core_index, VAddr vaddr,
+                                                   WriteOp&& write_op) {
+    const VAddr line = LineOf(vaddr);
+    Shard& shard = shards[line & (SHARD_COUNT - 1)];
+
+    std::lock_guard<std::mutex> lock(shard.lock);
+    if (reservations[core_index].line.load(std::memory_order_acquire) != line) {
+        return false;
+    }
+
+    write_op();
+
+    // The store consumes this core's reservation and breaks everyone else's on the same line, so
+    // their pending exclusive writes fail and retry against the new value. Same-line placements
+    // serialize with this scan through the shard lock, so none can be missed; a racing placement
+    // for a different line that still shows its previous value here only gets broken spuriously.
+    for (std::size_t core = 0; core < core_count; ++core) {
+        if (reservations[core].line.load(std::memory_order_relaxed) == line) {
+            reservations[core].line.store(INVALID_LINE, std::memory_order_release);
+        }
+    }
+    return true;
+}
+
+bool ShardedExclusiveMonitor::ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) {
+    return DoExclusiveOperation(core_index, vaddr, [&] { Memory::Write8(vaddr, value); });
+}
+
+bool ShardedExclusiveMonitor::ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) {
+    return DoExclusiveOperation(core_index, vaddr, [&] { Memory::Write16(vaddr, value); });
+}
+
+bool ShardedExclusiveMonitor::ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) {
+    return DoExclusiveOperation(core_index, vaddr, [&] { Memory::Write32(vaddr, value); });
+}
+
+bool ShardedExclusiveMonitor::ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) {
+    return DoExclusiveOperation(core_index, vaddr, [&] { Memory::Write64(vaddr, value); });
+}
+
+bool ShardedExclusiveMonitor::ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) {
+    return DoExclusiveOperation(core_index, vaddr, [&] {
+        Memory::Write64(vaddr + 0, value[0]);
+        Memory::Write64(vaddr + 8, value[1]);
+    });
+}
+
 } // namespace Core
@@ -4,6 +4,11 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 #include "common/common_types.h"
 
 namespace Core {
@@ -22,4 +27,54 @@ public:
     virtual bool ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) = 0;
 };
 
+/**
+ * Exclusive monitor sharded by address, so exclusive operations on unrelated addresses proceed in
+ * parallel across cores instead of serializing on one shared lock. Each core holds at most one
+ * reservation, tracked at cache-line granularity; an exclusive write locks only the shard its
+ * line hashes to, performs the store, and invalidates every reservation on that line. A
+ * reservation made between another core's check and store is allowed to fail spuriously, which
+ * the architecture permits and all callers already retry.
+ */
+class ShardedExclusiveMonitor final : public ExclusiveMonitor {
+public:
+    explicit ShardedExclusiveMonitor(std::size_t core_count);
+    ~ShardedExclusiveMonitor() override;
+
+    void SetExclusive(std::size_t core_index, VAddr addr) override;
+    void ClearExclusive() override;
+
+    bool ExclusiveWrite8(std::size_t core_index, VAddr vaddr, u8 value) override;
+    bool ExclusiveWrite16(std::size_t core_index, VAddr vaddr, u16 value) override;
+    bool ExclusiveWrite32(std::size_t core_index, VAddr vaddr, u32 value) override;
+    bool ExclusiveWrite64(std::size_t core_index, VAddr vaddr, u64 value) override;
+    bool ExclusiveWrite128(std::size_t core_index, VAddr vaddr, u128 value) override;
+
+private:
+    /// Reservations cover aligned spans of this many bytes
+    static constexpr u64 RESERVATION_GRANULE_BITS = 6;
+    static constexpr std::size_t SHARD_COUNT = 64; // Must be a power of two
+    static constexpr VAddr INVALID_LINE = ~static_cast<VAddr>(0);
+
+    static VAddr LineOf(VAddr addr) {
+        return addr >> RESERVATION_GRANULE_BITS;
+    }
+
+    template <typename WriteOp>
+    bool DoExclusiveOperation(std::size_t core_index, VAddr vaddr, WriteOp&& write_op);
+
+    /// One lock per address shard; padded so shards don't false-share
+    struct alignas(64) Shard {
+        std::mutex lock;
+    };
+
+    /// One outstanding reservation per core; padded so cores don't false-share
+    struct alignas(64) Reservation {
+        std::atomic<VAddr> line{INVALID_LINE};
+    };
+
+    std::array<Shard, SHARD_COUNT> shards;
+    std::unique_ptr<Reservation[]> reservations;
+    std::size_t core_count;
+};
+
 } // namespace Core
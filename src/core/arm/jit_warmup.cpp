@@ -0,0 +1,147 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+#include <fmt/format.h>
+
+#include "common/cityhash.h"
+#include "common/detached_tasks.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "core/arm/jit_warmup.h"
+#include "core/memory.h"
+
+namespace Core {
+
+namespace {
+
+constexpr u32 ProfileMagic = 0x31574A59; // 'YJW1'
+
+/// Touches every recorded code page that is still mapped, so the title's hot code is resident
+/// before execution first reaches it. Runs on a background worker while the title boots.
+void PrimePages(const std::vector<VAddr>& pages) {
+    std::size_t primed = 0;
+    for (const VAddr page : pages) {
+        if (!Memory::IsValidVirtualAddress(page)) {
+            continue;
+        }
+        Memory::Read8(page);
+        ++primed;
+    }
+    LOG_INFO(Core_ARM, "Primed {} of {} recorded hot code pages", primed, pages.size());
+}
+
+} // Anonymous namespace
+
+JitWarmup& JitWarmup::Instance() {
+    static JitWarmup instance;
+    return instance;
+}
+
+void JitWarmup::RegisterModule(const std::array<u8, 0x20>& build_id) {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (session_active) {
+        return;
+    }
+    std::size_t seed = static_cast<std::size_t>(build_key);
+    boost::hash_combine(seed, Common::CityHash64(reinterpret_cast<const char*>(build_id.data()),
+                                                 build_id.size()));
+    build_key = static_cast<u64>(seed);
+}
+
+void JitWarmup::BeginSession(u64 new_title_id) {
+    std::vector<VAddr> pages;
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        title_id = new_title_id;
+        hot_pages.clear();
+        session_active = true;
+
+        const std::string path = GetProfilePath();
+        FileUtil::IOFile file{path, "rb"};
+        if (file.IsOpen()) {
+            u32 magic{};
+            u32 count{};
+            // The count is untrusted input; a profile truncated or corrupted on disk must not
+            // drive the allocation below. Anything inconsistent with the actual file size is
+            // treated as a corrupt profile and discarded, like the shader disk cache does.
+            const u64 max_count =
+                (file.GetSize() - sizeof(magic) - sizeof(count)) / sizeof(VAddr);
+            if (file.ReadBytes(&magic, sizeof(magic)) == sizeof(magic) && magic == ProfileMagic &&
+                file.ReadBytes(&count, sizeof(count)) == sizeof(count) && count <= max_count) {
+                pages.resize(count);
+                pages.resize(file.ReadBytes(pages.data(), count * sizeof(VAddr)) / sizeof(VAddr));
+                hot_pages.insert(pages.begin(), pages.end());
+            } else {
+                LOG_WARNING(Core_ARM, "Discarding corrupt JIT warmup profile {}", path);
+                file.Close();
+                FileUtil::Delete(path);
+            }
+        }
+    }
+
+    if (pages.empty()) {
+        return;
+    }
+    LOG_INFO(Core_ARM, "Priming {} hot code pages from previous session", pages.size());
+    Common::DetachedTasks::AddTask(Common::DetachedTasks::Priority::Background,
+                                   [pages = std::move(pages)] { PrimePages(pages); });
+}
+
+void JitWarmup::RecordCodePage(VAddr code_addr) {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!session_active) {
+        return;
+    }
+    hot_pages.insert(code_addr & ~Memory::PAGE_MASK);
+}
+
+void JitWarmup::EndSession() {
+    std::lock_guard<std::mutex> lock{mutex};
+    if (!session_active) {
+        return;
+    }
+    session_active = false;
+
+    if (hot_pages.empty()) {
+        build_key = 0;
+        return;
+    }
+
+    const std::string path = GetProfilePath();
+
+    // Sorted output keeps the profile deterministic and lets priming walk the address space in
+    // order.
+    std::vector<VAddr> pages(hot_pages.begin(), hot_pages.end());
+    std::sort(pages.begin(), pages.end());
+    hot_pages.clear();
+    build_key = 0;
+
+    if (!FileUtil::CreateFullPath(path)) {
+        LOG_ERROR(Core_ARM, "Failed to create JIT warmup profile directory for {}", path);
+        return;
+    }
+
+    FileUtil::IOFile file{path, "wb"};
+    if (!file.IsOpen()) {
+        LOG_ERROR(Core_ARM, "Failed to write JIT warmup profile {}", path);
+        return;
+    }
+    const u32 count = static_cast<u32>(pages.size());
+    file.WriteBytes(&ProfileMagic, sizeof(ProfileMagic));
+    file.WriteBytes(&count, sizeof(count));
+    file.WriteBytes(pages.data(), pages.size() * sizeof(VAddr));
+    LOG_INFO(Core_ARM, "Saved JIT warmup profile with {} hot code pages to {}", pages.size(),
+             path);
+}
+
+std::string JitWarmup::GetProfilePath() const {
+    return fmt::format("{}jit_profiles/{:016X}-{:016x}.bin",
+                       FileUtil::GetUserPath(FileUtil::UserPath::CacheDir), title_id, build_key);
+}
+
+} // namespace Core
@@ -0,0 +1,58 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "common/common_types.h"
+
+namespace Core {
+
+/**
+ * Persistent JIT warmup profiles. While a title runs, the dynarmic cores report every guest code
+ * page they translate from; the accumulated hot set is written out at shutdown, keyed by title
+ * ID and the build IDs of the loaded modules. On the next boot of the same build the recorded
+ * pages are walked on a background thread while the title is still starting up, so the code the
+ * title is about to run is resident before execution reaches it.
+ *
+ * Dynarmic has no entry point for translating a block ahead of execution, so priming currently
+ * stops at pre-faulting the recorded code; the profile carries everything needed to move to real
+ * pre-translation once the JIT grows such an interface.
+ */
+class JitWarmup {
+public:
+    static JitWarmup& Instance();
+
+    /// Folds a loaded module's build ID into the session key. Modules are loaded before the
+    /// session starts, so every call must happen before BeginSession.
+    void RegisterModule(const std::array<u8, 0x20>& build_id);
+
+    /// Starts a profiling session for the given title: loads the profile recorded for this
+    /// title/build combination (if any), primes it in the background and starts recording.
+    void BeginSession(u64 title_id);
+
+    /// Records the guest page containing a translated instruction. The JIT cores call this
+    /// whenever dynarmic reads code to translate, i.e. only while a block is first compiled.
+    void RecordCodePage(VAddr code_addr);
+
+    /// Writes the merged hot set back to disk and ends the session.
+    void EndSession();
+
+private:
+    std::string GetProfilePath() const;
+
+    std::mutex mutex;
+    /// Page-aligned addresses of every guest page code was translated from this session,
+    /// merged with the set loaded from the previous session's profile
+    std::unordered_set<VAddr> hot_pages;
+    u64 title_id = 0;
+    u64 build_key = 0;
+    bool session_active = false;
+};
+
+} // namespace Core
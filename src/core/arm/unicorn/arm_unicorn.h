@@ -38,6 +38,7 @@ public:
     void Run() override;
     void Step() override;
     void ClearInstructionCache() override;
+    void ClearInstructionCacheRange(VAddr addr, u64 size) override {}
     void PageTableChanged() override{};
     void RecordBreak(GDBStub::BreakpointAddress bkpt);
 
@@ -12,11 +12,14 @@
 #include "common/logging/log.h"
 #include "common/string_util.h"
 #include "core/arm/exclusive_monitor.h"
+#include "core/arm/jit_warmup.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
 #include "core/core_timing.h"
 #include "core/cpu_core_manager.h"
+#include "core/dynamic_resolution.h"
 #include "core/file_sys/mode.h"
+#include "core/frontend/emu_window.h"
 #include "core/file_sys/vfs_concat.h"
 #include "core/file_sys/vfs_real.h"
 #include "core/gdbstub/gdbstub.h"
@@ -26,11 +29,15 @@
 #include "core/hle/kernel/scheduler.h"
 #include "core/hle/kernel/thread.h"
 #include "core/hle/service/am/applets/software_keyboard.h"
+#include "core/hle/service/ipc_event_log.h"
 #include "core/hle/service/service.h"
 #include "core/hle/service/sm/sm.h"
 #include "core/loader/loader.h"
 #include "core/perf_stats.h"
+#include "core/savestate.h"
+#include "core/settings.h"
 #include "core/telemetry_session.h"
+#include "core/title_profiles.h"
 #include "frontend/applets/software_keyboard.h"
 #include "video_core/debug_utils/debug_utils.h"
 #include "video_core/gpu.h"
@@ -83,7 +90,9 @@ struct System::Impl {
     ResultStatus RunLoop(bool tight_loop) {
         status = ResultStatus::Success;
 
+        perf_stats.BeginPhase(PerfStats::Phase::CpuSlice);
         cpu_core_manager.RunLoop(tight_loop);
+        perf_stats.EndPhase(PerfStats::Phase::CpuSlice);
 
         return status;
     }
@@ -116,7 +125,11 @@ struct System::Impl {
             return ResultStatus::ErrorVideoCore;
         }
 
-        gpu_core = std::make_unique<Tegra::GPU>(renderer->Rasterizer());
+        if (Settings::values.use_asynchronous_gpu_emulation) {
+            // Hand the graphics context off to the GPU thread that is about to be created
+            emu_window.DoneCurrent();
+        }
+        gpu_core = std::make_unique<Tegra::GPU>(*renderer);
 
         cpu_core_manager.Initialize(system);
         is_powered_on = true;
@@ -163,6 +176,18 @@ struct System::Impl {
             return static_cast<ResultStatus>(static_cast<u32>(ResultStatus::ErrorLoader) +
                                              static_cast<u32>(load_result));
         }
+
+        // Now that the loader has identified the program, layer its performance profile (if
+        // any) over the base config. Components pick the changes up via the settings snapshot.
+        u64 title_id{};
+        if (app_loader->ReadProgramId(title_id) == Loader::ResultStatus::Success) {
+            Settings::ApplyTitleProfile(title_id);
+        }
+
+        // Start the JIT warmup session; the modules the loader just brought in have already
+        // keyed it, and any profile from a previous run primes in the background from here.
+        JitWarmup::Instance().BeginSession(title_id);
+
         status = ResultStatus::Success;
         return status;
     }
@@ -179,6 +204,18 @@ struct System::Impl {
 
         is_powered_on = false;
 
+        JitWarmup::Instance().EndSession();
+
+        if (Settings::values.record_ipc_events) {
+            // Render the recorded IPC events to text now that emulation has stopped.
+            const std::string text = Service::IPCEventLog::Instance().DumpToText();
+            FileUtil::IOFile file(FileUtil::GetUserPath(FileUtil::UserPath::DumpDir) +
+                                      "ipc_events.txt",
+                                  "w");
+            file.WriteBytes(text.data(), text.size());
+            Service::IPCEventLog::Instance().Clear();
+        }
+
         // Shutdown emulation session
         renderer.reset();
         GDBStub::Shutdown();
@@ -241,6 +278,8 @@ struct System::Impl {
     std::string status_details = "";
 
     Core::PerfStats perf_stats;
+    Core::DynamicResolutionController dynamic_resolution{perf_stats};
+    Core::SavestateManager savestate;
     Core::FrameLimiter frame_limiter;
 };
 
@@ -267,6 +306,10 @@ void System::InvalidateCpuInstructionCaches() {
     impl->cpu_core_manager.InvalidateAllInstructionCaches();
 }
 
+void System::InvalidateCpuInstructionCacheRange(VAddr addr, u64 size) {
+    impl->cpu_core_manager.InvalidateInstructionCacheRange(addr, size);
+}
+
 System::ResultStatus System::Load(Frontend::EmuWindow& emu_window, const std::string& filepath) {
     return impl->Load(*this, emu_window, filepath);
 }
@@ -376,6 +419,14 @@ const Kernel::KernelCore& System::Kernel() const {
     return impl->kernel;
 }
 
+Core::DynamicResolutionController& System::GetDynamicResolution() {
+    return impl->dynamic_resolution;
+}
+
+const Core::DynamicResolutionController& System::GetDynamicResolution() const {
+    return impl->dynamic_resolution;
+}
+
 Core::PerfStats& System::GetPerfStats() {
     return impl->perf_stats;
 }
@@ -384,6 +435,14 @@ const Core::PerfStats& System::GetPerfStats() const {
     return impl->perf_stats;
 }
 
+Core::SavestateManager& System::Savestate() {
+    return impl->savestate;
+}
+
+const Core::SavestateManager& System::Savestate() const {
+    return impl->savestate;
+}
+
 Core::FrameLimiter& System::FrameLimiter() {
     return impl->frame_limiter;
 }
@@ -51,7 +51,9 @@ class ARM_Interface;
 class Cpu;
 class ExclusiveMonitor;
 class FrameLimiter;
+class DynamicResolutionController;
 class PerfStats;
+class SavestateManager;
 class TelemetrySession;
 
 struct PerfStatsResults;
@@ -115,6 +117,9 @@ public:
      */
     void InvalidateCpuInstructionCaches();
 
+    /// Invalidates the CPU instruction caches for a modified range of guest memory only
+    void InvalidateCpuInstructionCacheRange(VAddr addr, u64 size);
+
     /// Shutdown the emulated system.
     void Shutdown();
 
@@ -209,12 +214,24 @@ public:
     /// Provides a constant reference to the kernel instance.
     const Kernel::KernelCore& Kernel() const;
 
+    /// Provides a reference to the dynamic resolution controller.
+    Core::DynamicResolutionController& GetDynamicResolution();
+
+    /// Provides a constant reference to the dynamic resolution controller.
+    const Core::DynamicResolutionController& GetDynamicResolution() const;
+
     /// Provides a reference to the internal PerfStats instance.
     Core::PerfStats& GetPerfStats();
 
     /// Provides a constant reference to the internal PerfStats instance.
     const Core::PerfStats& GetPerfStats() const;
 
+    /// Provides a reference to the savestate manager.
+    Core::SavestateManager& Savestate();
+
+    /// Provides a constant reference to the savestate manager.
+    const Core::SavestateManager& Savestate() const;
+
     /// Provides a reference to the frame limiter;
     Core::FrameLimiter& FrameLimiter();
 
@@ -68,15 +68,13 @@ Cpu::Cpu(ExclusiveMonitor& exclusive_monitor, CpuBarrier& cpu_barrier, std::size
 Cpu::~Cpu() = default;
 
 std::unique_ptr<ExclusiveMonitor> Cpu::MakeExclusiveMonitor(std::size_t num_cores) {
-    if (Settings::values.use_cpu_jit) {
 #ifdef ARCHITECTURE_x86_64
+    if (Settings::values.use_cpu_jit) {
         return std::make_unique<DynarmicExclusiveMonitor>(num_cores);
-#else
-        return nullptr; // TODO(merry): Passthrough exclusive monitor
-#endif
-    } else {
-        return nullptr; // TODO(merry): Passthrough exclusive monitor
     }
+#endif
+    // Backends without a monitor of their own share the address-sharded one
+    return std::make_unique<ShardedExclusiveMonitor>(num_cores);
 }
 
 void Cpu::RunLoop(bool tight_loop) {
@@ -90,15 +88,21 @@ void Cpu::RunLoop(bool tight_loop) {
     // instead advance to the next event and try to yield to the next thread
     if (Kernel::GetCurrentThread() == nullptr) {
         LOG_TRACE(Core, "Core-{} idling", core_index);
+        cpu_barrier.SetCoreIdling(core_index, true);
 
         if (IsMainCore()) {
-            // TODO(Subv): Only let CoreTiming idle if all 4 cores are idling.
-            CoreTiming::Idle();
+            // Only fast-forward the clock when no core has a runnable thread; otherwise threads
+            // on the other cores would observe large jumps in their timeslices.
+            if (!Settings::values.use_multi_core || cpu_barrier.AllCoresIdling()) {
+                CoreTiming::Idle();
+            }
             CoreTiming::Advance();
         }
 
         PrepareReschedule();
     } else {
+        cpu_barrier.SetCoreIdling(core_index, false);
+
         if (IsMainCore()) {
             CoreTiming::Advance();
         }
@@ -32,8 +32,23 @@ public:
 
     bool Rendezvous();
 
+    /// Marks whether the given core currently has no thread to run.
+    void SetCoreIdling(std::size_t core_index, bool is_idling) {
+        if (is_idling) {
+            idling_cores |= 1u << core_index;
+        } else {
+            idling_cores &= ~(1u << core_index);
+        }
+    }
+
+    /// Returns true when every core is waiting for a thread to become ready.
+    bool AllCoresIdling() const {
+        return idling_cores == (1u << NUM_CPU_CORES) - 1;
+    }
+
 private:
     unsigned cores_waiting{NUM_CPU_CORES};
+    std::atomic<u32> idling_cores{};
     std::mutex mutex;
     std::condition_variable condition;
     std::atomic<bool> end{};
@@ -5,21 +5,32 @@
 #include "core/core_timing.h"
 
 #include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <string>
 #include <tuple>
 #include <unordered_map>
 #include <vector>
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "common/thread.h"
 #include "common/threadsafe_queue.h"
 #include "core/core_timing_util.h"
+#include "core/settings.h"
 
 namespace CoreTiming {
 
+namespace detail {
+s64 ticks_base;
+std::atomic<int> downcount;
+} // namespace detail
+
+using detail::downcount;
+using detail::ticks_base;
+
+// Everything below may only be touched from the main CPU thread.
 static s64 global_timer;
 static int slice_length;
-static int downcount;
 
 struct EventType {
     TimedCallback callback;
@@ -59,8 +70,61 @@ static Common::MPSCQueue<Event, false> ts_queue;
 // the queue for unscheduling the events from other threads threadsafe
 static Common::MPSCQueue<std::pair<const EventType*, u64>, false> unschedule_queue;
 
+// Lazy cancellation marks for UnscheduleEvent. Eagerly erasing from the middle of the heap
+// costs a linear scan plus a full make_heap, and thread wakeup cancellation does exactly that
+// on every synchronization wakeup. Instead the fifo id current at cancellation time is
+// remembered per (event type, userdata) key, and events older than it are dropped when they
+// reach the front of the queue.
+struct CancelKey {
+    const EventType* type;
+    u64 userdata;
+
+    bool operator==(const CancelKey& other) const {
+        return type == other.type && userdata == other.userdata;
+    }
+};
+
+struct CancelKeyHash {
+    std::size_t operator()(const CancelKey& key) const {
+        return std::hash<const void*>()(key.type) ^ (std::hash<u64>()(key.userdata) << 1);
+    }
+};
+
+static std::unordered_map<CancelKey, u64, CancelKeyHash> cancellations;
+
+// Returns whether the event was cancelled after it was scheduled. The callers of
+// UnscheduleEvent (kernel timers, thread wakeups) keep at most one live event per key, so a
+// surviving event means the cancellation mark has been fully consumed and can be dropped.
+static bool ConsumeCancellation(const Event& event) {
+    if (cancellations.empty()) {
+        return false;
+    }
+    const auto itr = cancellations.find(CancelKey{event.type, event.userdata});
+    if (itr == cancellations.end()) {
+        return false;
+    }
+    if (event.fifo_order < itr->second) {
+        return true;
+    }
+    cancellations.erase(itr);
+    return false;
+}
+
 constexpr int MAX_SLICE_LENGTH = 20000;
 
+// In single-core mode every event producer runs on the CPU thread: events scheduled mid-slice
+// shrink the downcount through ForceExceptionCheck, and anything pushed onto the threadsafe
+// queue is accompanied by a reschedule that halts the JIT and ends the slice early. A slice
+// therefore only has to stop at the next queued deadline, and the cap can be several
+// milliseconds of uninterrupted execution without delaying anything. The short cap stays in
+// place for multi-core, where other host threads rely on slice boundaries to get their events
+// merged into the queue.
+constexpr int MAX_SLICE_LENGTH_SINGLE_CORE = 4 * static_cast<int>(CYCLES_PER_MS_INT);
+
+static int MaxSliceLength() {
+    return Settings::values.use_multi_core ? MAX_SLICE_LENGTH : MAX_SLICE_LENGTH_SINGLE_CORE;
+}
+
 static s64 idled_cycles;
 
 // Are we in a function that has been called from Advance()
@@ -93,6 +157,7 @@ void UnregisterAllEvents() {
 
 void Init() {
     downcount = MAX_SLICE_LENGTH;
+    ticks_base = MAX_SLICE_LENGTH; // GetTicks() == 0 until the first slice ends
     slice_length = MAX_SLICE_LENGTH;
     global_timer = 0;
     idled_cycles = 0;
@@ -113,26 +178,13 @@ void Shutdown() {
     UnregisterAllEvents();
 }
 
-// This should only be called from the CPU thread. If you are calling
-// it from any other thread, you are doing something evil
-u64 GetTicks() {
-    u64 ticks = static_cast<u64>(global_timer);
-    if (!is_global_timer_sane) {
-        ticks += slice_length - downcount;
-    }
-    return ticks;
-}
-
-void AddTicks(u64 ticks) {
-    downcount -= static_cast<int>(ticks);
-}
-
 u64 GetIdleTicks() {
     return static_cast<u64>(idled_cycles);
 }
 
 void ClearPendingEvents() {
     event_queue.clear();
+    cancellations.clear();
 }
 
 void ScheduleEvent(s64 cycles_into_future, const EventType* event_type, u64 userdata) {
@@ -150,15 +202,8 @@ void ScheduleEventThreadsafe(s64 cycles_into_future, const EventType* event_type
 }
 
 void UnscheduleEvent(const EventType* event_type, u64 userdata) {
-    auto itr = std::remove_if(event_queue.begin(), event_queue.end(), [&](const Event& e) {
-        return e.type == event_type && e.userdata == userdata;
-    });
-
-    // Removing random items breaks the invariant so we have to re-establish it.
-    if (itr != event_queue.end()) {
-        event_queue.erase(itr, event_queue.end());
-        std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
-    }
+    // O(1): everything with this key scheduled so far is skipped when popped (see CancelKey)
+    cancellations[CancelKey{event_type, userdata}] = event_fifo_id;
 }
 
 void UnscheduleEventThreadsafe(const EventType* event_type, u64 userdata) {
@@ -181,12 +226,59 @@ void RemoveNormalAndThreadsafeEvent(const EventType* event_type) {
     RemoveEvent(event_type);
 }
 
+std::vector<SnapshotEvent> SaveEventQueue(s64& global_timer_out) {
+    MoveEvents();
+    global_timer_out = static_cast<s64>(GetTicks());
+
+    std::vector<SnapshotEvent> events;
+    events.reserve(event_queue.size());
+    for (const Event& event : event_queue) {
+        // Lazily cancelled events are still sitting in the queue; they must not be restored
+        const auto itr = cancellations.find(CancelKey{event.type, event.userdata});
+        if (itr != cancellations.end() && event.fifo_order < itr->second) {
+            continue;
+        }
+        events.push_back(SnapshotEvent{*event.type->name, event.time, event.userdata});
+    }
+    std::sort(events.begin(), events.end(),
+              [](const SnapshotEvent& left, const SnapshotEvent& right) {
+                  return left.time < right.time;
+              });
+    return events;
+}
+
+void LoadEventQueue(s64 new_global_timer, const std::vector<SnapshotEvent>& events) {
+    // Drop anything scheduled in the meantime; the snapshot replaces the entire queue.
+    MoveEvents();
+    event_queue.clear();
+    cancellations.clear();
+
+    global_timer = new_global_timer;
+    for (const SnapshotEvent& event : events) {
+        const auto itr = event_types.find(event.name);
+        if (itr == event_types.end()) {
+            LOG_WARNING(Core, "Dropping event \"{}\" not registered in this session", event.name);
+            continue;
+        }
+        event_queue.emplace_back(Event{event.time, event_fifo_id++, event.userdata, &itr->second});
+    }
+    std::make_heap(event_queue.begin(), event_queue.end(), std::greater<>());
+
+    // End the current slice so the next Advance() recomputes the downcount from the new queue.
+    slice_length = MAX_SLICE_LENGTH;
+    ticks_base = new_global_timer;
+    downcount = 0;
+}
+
 void ForceExceptionCheck(s64 cycles) {
     cycles = std::max<s64>(0, cycles);
-    if (downcount > cycles) {
+    const int current_downcount = downcount;
+    if (current_downcount > cycles) {
         // downcount is always (much) smaller than MAX_INT so we can safely cast cycles to an int
         // here. Account for cycles already executed by adjusting the g.slice_length
-        slice_length -= downcount - static_cast<int>(cycles);
+        slice_length -= current_downcount - static_cast<int>(cycles);
+        // The base moves down by the same amount as the downcount, so GetTicks() is unchanged.
+        ticks_base -= current_downcount - static_cast<int>(cycles);
         downcount = static_cast<int>(cycles);
     }
 }
@@ -207,14 +299,20 @@ void Advance() {
 
     int cycles_executed = slice_length - downcount;
     global_timer += cycles_executed;
-    slice_length = MAX_SLICE_LENGTH;
+    slice_length = MaxSliceLength();
 
     is_global_timer_sane = true;
+    // GetTicks() reports exactly global_timer while the callbacks run.
+    ticks_base = global_timer;
+    downcount = 0;
 
     while (!event_queue.empty() && event_queue.front().time <= global_timer) {
         Event evt = std::move(event_queue.front());
         std::pop_heap(event_queue.begin(), event_queue.end(), std::greater<>());
         event_queue.pop_back();
+        if (ConsumeCancellation(evt)) {
+            continue;
+        }
         evt.type->callback(evt.userdata, static_cast<int>(global_timer - evt.time));
     }
 
@@ -223,19 +321,19 @@ void Advance() {
     // Still events left (scheduled in the future)
     if (!event_queue.empty()) {
         slice_length = static_cast<int>(
-            std::min<s64>(event_queue.front().time - global_timer, MAX_SLICE_LENGTH));
+            std::min<s64>(event_queue.front().time - global_timer, MaxSliceLength()));
     }
 
+    ticks_base = global_timer + slice_length;
     downcount = slice_length;
 }
 
 void Idle() {
-    idled_cycles += downcount;
-    downcount = 0;
+    idled_cycles += downcount.exchange(0);
 }
 
 std::chrono::microseconds GetGlobalTimeUs() {
-    return std::chrono::microseconds{GetTicks() * 1000000 / BASE_CLOCK_RATE};
+    return std::chrono::microseconds{cyclesToUs(static_cast<s64>(GetTicks()))};
 }
 
 int GetDowncount() {
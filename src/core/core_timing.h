@@ -17,9 +17,11 @@
  *   ScheduleEvent(periodInCycles - cyclesLate, callback, "whatever")
  */
 
+#include <atomic>
 #include <chrono>
 #include <functional>
 #include <string>
+#include <vector>
 #include "common/common_types.h"
 
 namespace CoreTiming {
@@ -35,13 +37,29 @@ using TimedCallback = std::function<void(u64 userdata, int cycles_late)>;
 void Init();
 void Shutdown();
 
+namespace detail {
+// Backing state for the inline tick accessors below. ticks_base holds the tick count the global
+// timer will have reached when the current slice's downcount hits zero, so a tick query is a
+// single subtraction. Only core_timing.cpp may write either of these.
+extern s64 ticks_base;
+// The downcount is decremented from every CPU core's host thread in multicore mode, so it has to
+// be atomic.
+extern std::atomic<int> downcount;
+} // namespace detail
+
 /**
  * This should only be called from the emu thread, if you are calling it any other thread, you are
  * doing something evil
  */
-u64 GetTicks();
+inline u64 GetTicks() {
+    return static_cast<u64>(detail::ticks_base - detail::downcount.load(std::memory_order_relaxed));
+}
+
 u64 GetIdleTicks();
-void AddTicks(u64 ticks);
+
+inline void AddTicks(u64 ticks) {
+    detail::downcount.fetch_sub(static_cast<int>(ticks), std::memory_order_relaxed);
+}
 
 /**
  * Returns the event_type identifier. if name is not unique, it will assert.
@@ -60,7 +78,8 @@ void ScheduleEvent(s64 cycles_into_future, const EventType* event_type, u64 user
  * This is to be called when outside of hle threads, such as the graphics thread, wants to
  * schedule things to be executed on the main thread.
  * Not that this doesn't change slice_length and thus events scheduled by this might be called
- * with a delay of up to MAX_SLICE_LENGTH
+ * with a delay of up to the maximum slice length (MAX_SLICE_LENGTH in multi-core mode, several
+ * milliseconds in single-core mode where the slice usually ends early at the next reschedule)
  */
 void ScheduleEventThreadsafe(s64 cycles_into_future, const EventType* event_type, u64 userdata);
 
@@ -86,6 +105,26 @@ void Idle();
 /// Clear all pending events. This should ONLY be done on exit.
 void ClearPendingEvents();
 
+/// A pending event as captured for a savestate, identified by its registered name.
+struct SnapshotEvent {
+    std::string name;
+    s64 time;
+    u64 userdata;
+};
+
+/**
+ * Captures the global timer and the pending event queue for a savestate. Threadsafe-scheduled
+ * events are drained into the queue first. Returns the events sorted by trigger time.
+ */
+std::vector<SnapshotEvent> SaveEventQueue(s64& global_timer_out);
+
+/**
+ * Replaces the global timer and the pending event queue with a previously captured snapshot.
+ * Events whose type name is no longer registered are dropped with a warning. The current slice
+ * ends immediately so the next Advance() recomputes the downcount against the restored queue.
+ */
+void LoadEventQueue(s64 new_global_timer, const std::vector<SnapshotEvent>& events);
+
 void ForceExceptionCheck(s64 cycles);
 
 std::chrono::microseconds GetGlobalTimeUs();
@@ -12,52 +12,40 @@ namespace CoreTiming {
 
 constexpr u64 MAX_VALUE_TO_MULTIPLY = std::numeric_limits<s64>::max() / BASE_CLOCK_RATE;
 
+// Largest inputs whose converted cycle count still fits in an s64.
+constexpr u64 MAX_US_TO_CONVERT = MAX_VALUE_TO_MULTIPLY * 1000000;
+constexpr u64 MAX_NS_TO_CONVERT = MAX_VALUE_TO_MULTIPLY * 1000000000;
+
 s64 usToCycles(s64 us) {
-    if (us / 1000000 > MAX_VALUE_TO_MULTIPLY) {
-        LOG_ERROR(Core_Timing, "Integer overflow, use max value");
-        return std::numeric_limits<s64>::max();
+    if (us < 0) {
+        // The fixed-point path is unsigned; negative offsets are rare and always small.
+        return -usToCycles(0 - static_cast<u64>(us));
     }
-    if (us > MAX_VALUE_TO_MULTIPLY) {
-        LOG_DEBUG(Core_Timing, "Time very big, do rounding");
-        return BASE_CLOCK_RATE * (us / 1000000);
-    }
-    return (BASE_CLOCK_RATE * us) / 1000000;
+    return usToCycles(static_cast<u64>(us));
 }
 
 s64 usToCycles(u64 us) {
-    if (us / 1000000 > MAX_VALUE_TO_MULTIPLY) {
+    if (us > MAX_US_TO_CONVERT) {
         LOG_ERROR(Core_Timing, "Integer overflow, use max value");
         return std::numeric_limits<s64>::max();
     }
-    if (us > MAX_VALUE_TO_MULTIPLY) {
-        LOG_DEBUG(Core_Timing, "Time very big, do rounding");
-        return BASE_CLOCK_RATE * static_cast<s64>(us / 1000000);
-    }
-    return (BASE_CLOCK_RATE * static_cast<s64>(us)) / 1000000;
+    return static_cast<s64>(ScaleFixedPoint(us, CYCLES_PER_US_INT, CYCLES_PER_US_FRAC));
 }
 
 s64 nsToCycles(s64 ns) {
-    if (ns / 1000000000 > MAX_VALUE_TO_MULTIPLY) {
-        LOG_ERROR(Core_Timing, "Integer overflow, use max value");
-        return std::numeric_limits<s64>::max();
+    if (ns < 0) {
+        // The fixed-point path is unsigned; negative offsets are rare and always small.
+        return -nsToCycles(0 - static_cast<u64>(ns));
     }
-    if (ns > MAX_VALUE_TO_MULTIPLY) {
-        LOG_DEBUG(Core_Timing, "Time very big, do rounding");
-        return BASE_CLOCK_RATE * (ns / 1000000000);
-    }
-    return (BASE_CLOCK_RATE * ns) / 1000000000;
+    return nsToCycles(static_cast<u64>(ns));
 }
 
 s64 nsToCycles(u64 ns) {
-    if (ns / 1000000000 > MAX_VALUE_TO_MULTIPLY) {
+    if (ns > MAX_NS_TO_CONVERT) {
         LOG_ERROR(Core_Timing, "Integer overflow, use max value");
         return std::numeric_limits<s64>::max();
     }
-    if (ns > MAX_VALUE_TO_MULTIPLY) {
-        LOG_DEBUG(Core_Timing, "Time very big, do rounding");
-        return BASE_CLOCK_RATE * (static_cast<s64>(ns) / 1000000000);
-    }
-    return (BASE_CLOCK_RATE * static_cast<s64>(ns)) / 1000000000;
+    return static_cast<s64>(ScaleFixedPoint(ns, CYCLES_PER_NS_INT, CYCLES_PER_NS_FRAC));
 }
 
 } // namespace CoreTiming
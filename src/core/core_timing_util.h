@@ -5,6 +5,7 @@
 #pragma once
 
 #include "common/common_types.h"
+#include "common/uint128.h"
 
 namespace CoreTiming {
 
@@ -12,6 +13,39 @@ namespace CoreTiming {
 // The exact value used is of course unverified.
 constexpr u64 BASE_CLOCK_RATE = 1019215872; // Switch clock speed is 1020MHz un/docked
 
+namespace detail {
+
+/// Returns floor(2^64 * numerator / denominator) without requiring 128-bit arithmetic, so it
+/// stays constexpr on every supported compiler. Requires numerator < denominator and a
+/// denominator that is not a power of two.
+constexpr u64 Fraction64(u64 numerator, u64 denominator) {
+    // 2^64 = quotient * denominator + remainder
+    const u64 quotient = ~u64{0} / denominator;
+    const u64 remainder = 0 - quotient * denominator;
+    return numerator * quotient + numerator * remainder / denominator;
+}
+
+} // namespace detail
+
+// 64.64 fixed-point ratios between the guest clock and the common time units, stored as a
+// separate integer part and 2^-64-scaled fractional part. A conversion is then one multiply plus
+// one high-half multiply, with a truncation error of less than one output unit over the entire
+// u64 input range; the old divide-based conversions also overflowed for large cycle counts.
+constexpr u64 CYCLES_PER_MS_INT = BASE_CLOCK_RATE / 1000;
+constexpr u64 CYCLES_PER_MS_FRAC = detail::Fraction64(BASE_CLOCK_RATE % 1000, 1000);
+constexpr u64 CYCLES_PER_US_INT = BASE_CLOCK_RATE / 1000000;
+constexpr u64 CYCLES_PER_US_FRAC = detail::Fraction64(BASE_CLOCK_RATE % 1000000, 1000000);
+constexpr u64 CYCLES_PER_NS_INT = BASE_CLOCK_RATE / 1000000000;
+constexpr u64 CYCLES_PER_NS_FRAC = detail::Fraction64(BASE_CLOCK_RATE % 1000000000, 1000000000);
+constexpr u64 NS_PER_CYCLE_FRAC = detail::Fraction64(1000000000, BASE_CLOCK_RATE);
+constexpr u64 US_PER_CYCLE_FRAC = detail::Fraction64(1000000, BASE_CLOCK_RATE);
+constexpr u64 MS_PER_CYCLE_FRAC = detail::Fraction64(1000, BASE_CLOCK_RATE);
+
+/// Scales an unsigned value by a 64.64 fixed-point ratio.
+inline u64 ScaleFixedPoint(u64 value, u64 ratio_int, u64 ratio_frac) {
+    return value * ratio_int + Common::MultiplyHigh64(value, ratio_frac);
+}
+
 inline s64 msToCycles(int ms) {
     // since ms is int there is no way to overflow
     return BASE_CLOCK_RATE * static_cast<s64>(ms) / 1000;
@@ -50,15 +84,15 @@ s64 nsToCycles(s64 ns);
 s64 nsToCycles(u64 ns);
 
 inline u64 cyclesToNs(s64 cycles) {
-    return cycles * 1000000000 / BASE_CLOCK_RATE;
+    return ScaleFixedPoint(static_cast<u64>(cycles), 0, NS_PER_CYCLE_FRAC);
 }
 
 inline s64 cyclesToUs(s64 cycles) {
-    return cycles * 1000000 / BASE_CLOCK_RATE;
+    return static_cast<s64>(ScaleFixedPoint(static_cast<u64>(cycles), 0, US_PER_CYCLE_FRAC));
 }
 
 inline u64 cyclesToMs(s64 cycles) {
-    return cycles * 1000 / BASE_CLOCK_RATE;
+    return ScaleFixedPoint(static_cast<u64>(cycles), 0, MS_PER_CYCLE_FRAC);
 }
 
 } // namespace CoreTiming
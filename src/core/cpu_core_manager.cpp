@@ -3,16 +3,19 @@
 // Refer to the license.txt file included.
 
 #include "common/assert.h"
+#include "common/logging/log.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
 #include "core/cpu_core_manager.h"
 #include "core/gdbstub/gdbstub.h"
+#include "core/host_scheduling.h"
 #include "core/settings.h"
 
 namespace Core {
 namespace {
 void RunCpuCore(const System& system, Cpu& cpu_state) {
+    HostScheduling::ApplyPolicy(HostScheduling::HostThread::Cpu);
     while (system.IsPoweredOn()) {
         cpu_state.RunLoop(true);
     }
@@ -106,6 +109,11 @@ void CpuCoreManager::RunLoop(bool tight_loop) {
     // Update thread_to_cpu in case Core 0 is run from a different host thread
     thread_to_cpu[std::this_thread::get_id()] = cores[0].get();
 
+    if (scheduled_core0_thread != std::this_thread::get_id()) {
+        scheduled_core0_thread = std::this_thread::get_id();
+        HostScheduling::ApplyPolicy(HostScheduling::HostThread::Cpu);
+    }
+
     if (GDBStub::IsServerEnabled()) {
         GDBStub::HandlePacket();
 
@@ -134,9 +142,17 @@ void CpuCoreManager::RunLoop(bool tight_loop) {
 }
 
 void CpuCoreManager::InvalidateAllInstructionCaches() {
+    ++full_cache_flush_count;
+    LOG_DEBUG(Core, "Full instruction cache flush (count={})", full_cache_flush_count);
     for (auto& cpu : cores) {
         cpu->ArmInterface().ClearInstructionCache();
     }
 }
 
+void CpuCoreManager::InvalidateInstructionCacheRange(VAddr addr, u64 size) {
+    for (auto& cpu : cores) {
+        cpu->ArmInterface().ClearInstructionCacheRange(addr, size);
+    }
+}
+
 } // namespace Core
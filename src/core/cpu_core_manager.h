@@ -8,6 +8,7 @@
 #include <map>
 #include <memory>
 #include <thread>
+#include "common/common_types.h"
 
 namespace Core {
 
@@ -42,6 +43,13 @@ public:
     void RunLoop(bool tight_loop);
 
     void InvalidateAllInstructionCaches();
+    void InvalidateInstructionCacheRange(VAddr addr, u64 size);
+
+    /// Number of full instruction cache flushes since boot. Range invalidation should cover all
+    /// code-modification paths; this exists to spot the ones that still flush everything.
+    u64 GetFullCacheFlushCount() const {
+        return full_cache_flush_count;
+    }
 
 private:
     static constexpr std::size_t NUM_CPU_CORES = 4;
@@ -51,6 +59,10 @@ private:
     std::array<std::unique_ptr<Cpu>, NUM_CPU_CORES> cores;
     std::array<std::unique_ptr<std::thread>, NUM_CPU_CORES - 1> core_threads;
     std::size_t active_core{}; ///< Active core, only used in single thread mode
+    u64 full_cache_flush_count{};
+
+    /// Host thread the scheduling policy was last applied to for core 0
+    std::thread::id scheduled_core0_thread{};
 
     /// Map of guest threads to CPU cores
     std::map<std::thread::id, Cpu*> thread_to_cpu;
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
 #include <mbedtls/cipher.h>
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -10,8 +11,8 @@
 
 namespace Core::Crypto {
 namespace {
-std::vector<u8> CalculateNintendoTweak(std::size_t sector_id) {
-    std::vector<u8> out(0x10);
+std::array<u8, 0x10> CalculateNintendoTweak(std::size_t sector_id) {
+    std::array<u8, 0x10> out{};
     for (std::size_t i = 0xF; i <= 0xF; --i) {
         out[i] = sector_id & 0xFF;
         sector_id >>= 8;
@@ -64,9 +65,14 @@ AESCipher<Key, KeySize>::~AESCipher() {
 }
 
 template <typename Key, std::size_t KeySize>
-void AESCipher<Key, KeySize>::SetIV(std::vector<u8> iv) {
-    ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, iv.data(), iv.size()) ||
-                mbedtls_cipher_set_iv(&ctx->decryption_context, iv.data(), iv.size())) == 0,
+void AESCipher<Key, KeySize>::SetIV(const std::vector<u8>& iv) {
+    SetIVImpl(iv.data(), iv.size());
+}
+
+template <typename Key, std::size_t KeySize>
+void AESCipher<Key, KeySize>::SetIVImpl(const u8* data, std::size_t size) {
+    ASSERT_MSG((mbedtls_cipher_set_iv(&ctx->encryption_context, data, size) ||
+                mbedtls_cipher_set_iv(&ctx->decryption_context, data, size)) == 0,
                "Failed to set IV on mbedtls ciphers.");
 }
 
@@ -77,7 +83,11 @@ void AESCipher<Key, KeySize>::Transcode(const u8* src, std::size_t size, u8* des
     mbedtls_cipher_reset(context);
 
     std::size_t written = 0;
-    if (mbedtls_cipher_get_cipher_mode(context) == MBEDTLS_MODE_XTS) {
+    const auto cipher_mode = mbedtls_cipher_get_cipher_mode(context);
+    if (cipher_mode == MBEDTLS_MODE_XTS || cipher_mode == MBEDTLS_MODE_CTR) {
+        // Stream-type modes accept arbitrarily sized updates, so hand the whole request to
+        // mbedtls in a single call. Its AES implementation (AES-NI where available) then runs
+        // over the full buffer instead of paying the call overhead per 16-byte block.
         mbedtls_cipher_update(context, src, size, dest, &written);
         if (written != size) {
             LOG_WARNING(Crypto, "Not all data was decrypted requested={:016X}, actual={:016X}.",
@@ -119,7 +129,8 @@ void AESCipher<Key, KeySize>::XTSTranscode(const u8* src, std::size_t size, u8*
     ASSERT_MSG(size % sector_size == 0, "XTS decryption size must be a multiple of sector size.");
 
     for (std::size_t i = 0; i < size; i += sector_size) {
-        SetIV(CalculateNintendoTweak(sector_id++));
+        const auto tweak = CalculateNintendoTweak(sector_id++);
+        SetIVImpl(tweak.data(), tweak.size());
         Transcode<u8, u8>(src + i, sector_size, dest + i, op);
     }
 }
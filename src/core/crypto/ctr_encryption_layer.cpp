@@ -20,9 +20,10 @@ std::size_t CTREncryptionLayer::Read(u8* data, std::size_t length, std::size_t o
     const auto sector_offset = offset & 0xF;
     if (sector_offset == 0) {
         UpdateIV(base_offset + offset);
-        std::vector<u8> raw = base->ReadBytes(length, offset);
-        cipher.Transcode(raw.data(), raw.size(), data, Op::Decrypt);
-        return length;
+        // Read into the caller's buffer and decrypt it in place, avoiding a staging copy.
+        const auto read = base->Read(data, length, offset);
+        cipher.Transcode(data, read, data, Op::Decrypt);
+        return read;
     }
 
     // offset does not fall on block boundary (0x10)
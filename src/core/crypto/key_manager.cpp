@@ -16,7 +16,6 @@
 #include <mbedtls/bignum.h>
 #include <mbedtls/cipher.h>
 #include <mbedtls/cmac.h>
-#include <mbedtls/sha256.h>
 #include "common/common_funcs.h"
 #include "common/common_paths.h"
 #include "common/file_util.h"
@@ -25,6 +24,7 @@
 #include "core/crypto/aes_util.h"
 #include "core/crypto/key_manager.h"
 #include "core/crypto/partition_data_manager.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_metadata.h"
 #include "core/file_sys/partition_filesystem.h"
@@ -280,7 +280,8 @@ static std::array<u8, target_size> MGF1(const std::array<u8, in_size>& seed) {
     while (out.size() < target_size) {
         out.resize(out.size() + 0x20);
         seed_exp[in_size + 3] = static_cast<u8>(i);
-        mbedtls_sha256(seed_exp.data(), seed_exp.size(), out.data() + out.size() - 0x20, 0);
+        const SHA256Hash hash = CalculateSHA256(seed_exp.data(), seed_exp.size());
+        std::memcpy(out.data() + out.size() - 0x20, hash.data(), hash.size());
         ++i;
     }
 
@@ -11,7 +11,9 @@
 #include <array>
 #include <cctype>
 #include <cstring>
-#include <mbedtls/sha256.h>
+#include <map>
+#include <set>
+#include <thread>
 #include "common/assert.h"
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -21,6 +23,7 @@
 #include "common/swap.h"
 #include "core/crypto/key_manager.h"
 #include "core/crypto/partition_data_manager.h"
+#include "core/crypto/sha_util.h"
 #include "core/crypto/xts_encryption_layer.h"
 #include "core/file_sys/vfs.h"
 #include "core/file_sys/vfs_offset.h"
@@ -246,9 +249,8 @@ std::array<u8, key_size> FindKeyFromHex(const std::vector<u8>& binary,
     if (binary.size() < key_size)
         return {};
 
-    std::array<u8, 0x20> temp{};
     for (size_t i = 0; i < binary.size() - key_size; ++i) {
-        mbedtls_sha256(binary.data() + i, key_size, temp.data(), 0);
+        const SHA256Hash temp = CalculateSHA256(binary.data() + i, key_size);
 
         if (temp != hash)
             continue;
@@ -265,18 +267,88 @@ std::array<u8, 16> FindKeyFromHex16(const std::vector<u8>& binary, std::array<u8
     return FindKeyFromHex<0x10>(binary, hash);
 }
 
+using SourceKeyMap = std::map<SHA256Hash, std::vector<u8>>;
+
+// Hashes both candidate window sizes at every offset in [begin, end), collecting the windows
+// whose hashes appear in wanted. A single pass therefore answers lookups for every source hash
+// at once instead of rescanning the binary once per key.
+static void ScanForSourceKeys(const std::vector<u8>& binary, std::size_t begin, std::size_t end,
+                              const std::set<SHA256Hash>& wanted, SourceKeyMap& out) {
+    for (std::size_t i = begin; i < end; ++i) {
+        for (const std::size_t key_size : {std::size_t{0x10}, std::size_t{0x20}}) {
+            if (i + key_size > binary.size())
+                continue;
+            const SHA256Hash hash = CalculateSHA256(binary.data() + i, key_size);
+            if (wanted.find(hash) == wanted.end())
+                continue;
+            out.emplace(hash, std::vector<u8>(binary.begin() + i, binary.begin() + i + key_size));
+        }
+    }
+}
+
+// Minimum amount of data a scan worker thread gets; smaller binaries are not worth splitting.
+constexpr std::size_t SCAN_BYTES_PER_THREAD = 0x20000;
+
+static SourceKeyMap ScanBinaryForSourceKeys(const std::vector<u8>& binary) {
+    std::set<SHA256Hash> wanted;
+    for (const auto& hash : source_hashes)
+        wanted.insert(hash);
+    for (const auto& hash : keyblob_source_hashes) {
+        if (hash != SHA256Hash{})
+            wanted.insert(hash);
+    }
+
+    const std::size_t hw_threads = std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    const std::size_t num_threads =
+        std::min<std::size_t>(hw_threads, binary.size() / SCAN_BYTES_PER_THREAD + 1);
+
+    if (num_threads <= 1) {
+        SourceKeyMap out;
+        ScanForSourceKeys(binary, 0, binary.size(), wanted, out);
+        return out;
+    }
+
+    // Workers split the scan by starting offset; windows may extend into the next worker's range,
+    // so no overlap between the chunks is necessary.
+    std::vector<SourceKeyMap> results(num_threads);
+    std::vector<std::thread> workers;
+    workers.reserve(num_threads);
+    const std::size_t chunk_size = (binary.size() + num_threads - 1) / num_threads;
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        const std::size_t begin = i * chunk_size;
+        const std::size_t end = std::min(begin + chunk_size, binary.size());
+        workers.emplace_back(ScanForSourceKeys, std::cref(binary), begin, end, std::cref(wanted),
+                             std::ref(results[i]));
+    }
+
+    SourceKeyMap out;
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        workers[i].join();
+        out.insert(results[i].begin(), results[i].end());
+    }
+
+    return out;
+}
+
+template <std::size_t key_size = 0x10>
+static std::array<u8, key_size> KeyFromBytes(const std::vector<u8>& bytes) {
+    std::array<u8, key_size> out{};
+    if (bytes.size() == key_size)
+        std::memcpy(out.data(), bytes.data(), key_size);
+    return out;
+}
+
 static std::array<Key128, 0x20> FindEncryptedMasterKeyFromHex(const std::vector<u8>& binary,
                                                               const Key128& key) {
     if (binary.size() < 0x10)
         return {};
 
-    SHA256Hash temp{};
     Key128 dec_temp{};
     std::array<Key128, 0x20> out{};
     AESCipher<Key128> cipher(key, Mode::ECB);
     for (size_t i = 0; i < binary.size() - 0x10; ++i) {
         cipher.Transcode(binary.data() + i, dec_temp.size(), dec_temp.data(), Op::Decrypt);
-        mbedtls_sha256(dec_temp.data(), dec_temp.size(), temp.data(), 0);
+        const SHA256Hash temp = CalculateSHA256(dec_temp.data(), dec_temp.size());
 
         for (size_t k = 0; k < out.size(); ++k) {
             if (temp == master_key_hashes[k]) {
@@ -324,6 +396,18 @@ PartitionDataManager::PartitionDataManager(const FileSys::VirtualDir& sysdata_di
 
 PartitionDataManager::~PartitionDataManager() = default;
 
+std::vector<u8> PartitionDataManager::FindSourceKey(const std::vector<u8>& binary,
+                                                    const std::array<u8, 0x20>& hash) const {
+    auto iter = source_key_cache.find(&binary);
+    if (iter == source_key_cache.end())
+        iter = source_key_cache.emplace(&binary, ScanBinaryForSourceKeys(binary)).first;
+
+    const auto key = iter->second.find(hash);
+    if (key == iter->second.end())
+        return {};
+    return key->second;
+}
+
 bool PartitionDataManager::HasBoot0() const {
     return boot0 != nullptr;
 }
@@ -354,15 +438,15 @@ std::vector<u8> PartitionDataManager::GetSecureMonitor() const {
 }
 
 std::array<u8, 16> PartitionDataManager::GetPackage2KeySource() const {
-    return FindKeyFromHex(secure_monitor_bytes, source_hashes[2]);
+    return KeyFromBytes(FindSourceKey(secure_monitor_bytes, source_hashes[2]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetAESKekGenerationSource() const {
-    return FindKeyFromHex(secure_monitor_bytes, source_hashes[3]);
+    return KeyFromBytes(FindSourceKey(secure_monitor_bytes, source_hashes[3]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetTitlekekSource() const {
-    return FindKeyFromHex(secure_monitor_bytes, source_hashes[5]);
+    return KeyFromBytes(FindSourceKey(secure_monitor_bytes, source_hashes[5]));
 }
 
 std::array<std::array<u8, 16>, 32> PartitionDataManager::GetTZMasterKeys(
@@ -371,11 +455,11 @@ std::array<std::array<u8, 16>, 32> PartitionDataManager::GetTZMasterKeys(
 }
 
 std::array<u8, 16> PartitionDataManager::GetRSAKekSeed3() const {
-    return FindKeyFromHex(secure_monitor_bytes, source_hashes[14]);
+    return KeyFromBytes(FindSourceKey(secure_monitor_bytes, source_hashes[14]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetRSAKekMask0() const {
-    return FindKeyFromHex(secure_monitor_bytes, source_hashes[15]);
+    return KeyFromBytes(FindSourceKey(secure_monitor_bytes, source_hashes[15]));
 }
 
 std::vector<u8> PartitionDataManager::GetPackage1Decrypted() const {
@@ -383,11 +467,11 @@ std::vector<u8> PartitionDataManager::GetPackage1Decrypted() const {
 }
 
 std::array<u8, 16> PartitionDataManager::GetMasterKeySource() const {
-    return FindKeyFromHex(package1_decrypted_bytes, source_hashes[1]);
+    return KeyFromBytes(FindSourceKey(package1_decrypted_bytes, source_hashes[1]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetKeyblobMACKeySource() const {
-    return FindKeyFromHex(package1_decrypted_bytes, source_hashes[0]);
+    return KeyFromBytes(FindSourceKey(package1_decrypted_bytes, source_hashes[0]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetKeyblobKeySource(std::size_t revision) const {
@@ -396,7 +480,7 @@ std::array<u8, 16> PartitionDataManager::GetKeyblobKeySource(std::size_t revisio
                     "No keyblob source hash for crypto revision {:02X}! Cannot derive keys...",
                     revision);
     }
-    return FindKeyFromHex(package1_decrypted_bytes, keyblob_source_hashes[revision]);
+    return KeyFromBytes(FindSourceKey(package1_decrypted_bytes, keyblob_source_hashes[revision]));
 }
 
 bool PartitionDataManager::HasFuses() const {
@@ -519,10 +603,14 @@ void PartitionDataManager::DecryptPackage2(const std::array<Key128, 0x20>& packa
         offset += sizeof(KIPHeader) + kip.sections[0].size_compressed +
                   kip.sections[1].size_compressed + kip.sections[2].size_compressed;
 
-        if (name == "FS")
+        // The decompressed KIPs are about to be replaced, so any memoized scan of them is stale.
+        if (name == "FS") {
+            source_key_cache.erase(&package2_fs[static_cast<size_t>(type)]);
             package2_fs[static_cast<size_t>(type)] = std::move(out);
-        else if (name == "spl")
+        } else if (name == "spl") {
+            source_key_cache.erase(&package2_spl[static_cast<size_t>(type)]);
             package2_spl[static_cast<size_t>(type)] = std::move(out);
+        }
     }
 }
 
@@ -531,35 +619,39 @@ const std::vector<u8>& PartitionDataManager::GetPackage2FSDecompressed(Package2T
 }
 
 std::array<u8, 16> PartitionDataManager::GetKeyAreaKeyApplicationSource(Package2Type type) const {
-    return FindKeyFromHex(package2_fs.at(static_cast<size_t>(type)), source_hashes[6]);
+    return KeyFromBytes(FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[6]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetKeyAreaKeyOceanSource(Package2Type type) const {
-    return FindKeyFromHex(package2_fs.at(static_cast<size_t>(type)), source_hashes[7]);
+    return KeyFromBytes(FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[7]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetKeyAreaKeySystemSource(Package2Type type) const {
-    return FindKeyFromHex(package2_fs.at(static_cast<size_t>(type)), source_hashes[8]);
+    return KeyFromBytes(FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[8]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetSDKekSource(Package2Type type) const {
-    return FindKeyFromHex(package2_fs.at(static_cast<size_t>(type)), source_hashes[9]);
+    return KeyFromBytes(FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[9]));
 }
 
 std::array<u8, 32> PartitionDataManager::GetSDSaveKeySource(Package2Type type) const {
-    return FindKeyFromHex<0x20>(package2_fs.at(static_cast<size_t>(type)), source_hashes[10]);
+    return KeyFromBytes<0x20>(
+        FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[10]));
 }
 
 std::array<u8, 32> PartitionDataManager::GetSDNCAKeySource(Package2Type type) const {
-    return FindKeyFromHex<0x20>(package2_fs.at(static_cast<size_t>(type)), source_hashes[11]);
+    return KeyFromBytes<0x20>(
+        FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[11]));
 }
 
 std::array<u8, 16> PartitionDataManager::GetHeaderKekSource(Package2Type type) const {
-    return FindKeyFromHex(package2_fs.at(static_cast<size_t>(type)), source_hashes[12]);
+    return KeyFromBytes(
+        FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[12]));
 }
 
 std::array<u8, 32> PartitionDataManager::GetHeaderKeySource(Package2Type type) const {
-    return FindKeyFromHex<0x20>(package2_fs.at(static_cast<size_t>(type)), source_hashes[13]);
+    return KeyFromBytes<0x20>(
+        FindSourceKey(package2_fs.at(static_cast<size_t>(type)), source_hashes[13]));
 }
 
 const std::vector<u8>& PartitionDataManager::GetPackage2SPLDecompressed(Package2Type type) const {
@@ -567,7 +659,8 @@ const std::vector<u8>& PartitionDataManager::GetPackage2SPLDecompressed(Package2
 }
 
 std::array<u8, 16> PartitionDataManager::GetAESKeyGenerationSource(Package2Type type) const {
-    return FindKeyFromHex(package2_spl.at(static_cast<size_t>(type)), source_hashes[4]);
+    return KeyFromBytes(
+        FindSourceKey(package2_spl.at(static_cast<size_t>(type)), source_hashes[4]));
 }
 
 bool PartitionDataManager::HasProdInfo() const {
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <map>
 #include <vector>
 #include "common/common_types.h"
 #include "core/file_sys/vfs_types.h"
@@ -87,6 +88,12 @@ public:
     std::array<u8, 0x240> GetETicketExtendedKek() const;
 
 private:
+    // Looks up the key with the given SHA-256 hash in the binary. The first lookup scans the
+    // binary once for every known source hash and memoizes the matches, so subsequent lookups on
+    // the same binary do not rescan a multi-megabyte image per key.
+    std::vector<u8> FindSourceKey(const std::vector<u8>& binary,
+                                  const std::array<u8, 0x20>& hash) const;
+
     FileSys::VirtualFile boot0;
     FileSys::VirtualFile fuses;
     FileSys::VirtualFile kfuses;
@@ -102,6 +109,9 @@ private:
     std::vector<u8> package1_decrypted_bytes;
     std::array<std::vector<u8>, 6> package2_fs;
     std::array<std::vector<u8>, 6> package2_spl;
+
+    mutable std::map<const std::vector<u8>*, std::map<std::array<u8, 0x20>, std::vector<u8>>>
+        source_key_cache;
 };
 
 std::array<u8, 0x10> FindKeyFromHex16(const std::vector<u8>& binary, std::array<u8, 0x20> hash);
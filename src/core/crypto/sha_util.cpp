@@ -2,4 +2,147 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
-namespace Crypto {} // namespace Crypto
+#include <cstring>
+#include <mbedtls/sha256.h>
+#include "core/crypto/sha_util.h"
+
+#ifdef ARCHITECTURE_x86_64
+#include <immintrin.h>
+#include "common/x64/cpu_detect.h"
+#endif
+
+namespace Core::Crypto {
+namespace {
+
+#ifdef ARCHITECTURE_x86_64
+
+#ifdef _MSC_VER
+#define SHA256_NI_TARGET
+#else
+#define SHA256_NI_TARGET __attribute__((target("sha,sse4.1")))
+#endif
+
+/// FIPS 180-4 round constants (first 32 bits of the fractional parts of the cube roots of the
+/// first 64 primes), grouped four per message schedule vector.
+alignas(16) constexpr std::array<u32, 64> sha256_round_constants{
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4,
+    0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe,
+    0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f,
+    0x4a7484aa, 0x5cb0a9dc, 0x76f988da, 0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc,
+    0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070, 0x19a4c116,
+    0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7,
+    0xc67178f2,
+};
+
+/// Absorbs num_blocks 64-byte blocks into the hash state using the SHA-NI instructions. The
+/// state layout is the FIPS 180-4 word order (a..h); the ABEF/CDGH register packing the
+/// instructions operate on is confined to this function.
+SHA256_NI_TARGET
+void ProcessBlocksShaNi(std::array<u32, 8>& state, const u8* data, std::size_t num_blocks) {
+    const __m128i swap_mask = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+
+    // Repack the state words from a..h into the ABEF/CDGH form sha256rnds2 expects
+    __m128i tmp = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[0]));
+    __m128i state1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(&state[4]));
+    tmp = _mm_shuffle_epi32(tmp, 0xB1);
+    state1 = _mm_shuffle_epi32(state1, 0x1B);
+    __m128i state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    for (std::size_t block = 0; block < num_blocks; ++block, data += 64) {
+        const __m128i abef_save = state0;
+        const __m128i cdgh_save = state1;
+
+        // Message schedule vectors for the next four round groups; msg[i % 4] always holds the
+        // words for group i when group i executes.
+        __m128i msg[4];
+        for (std::size_t i = 0; i < 4; ++i) {
+            msg[i] = _mm_shuffle_epi8(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 16 * i)), swap_mask);
+        }
+
+        for (std::size_t i = 0; i < 16; ++i) {
+            const __m128i constants =
+                _mm_load_si128(reinterpret_cast<const __m128i*>(&sha256_round_constants[4 * i]));
+            __m128i round_input = _mm_add_epi32(msg[i % 4], constants);
+            state1 = _mm_sha256rnds2_epu32(state1, state0, round_input);
+            round_input = _mm_shuffle_epi32(round_input, 0x0E);
+            state0 = _mm_sha256rnds2_epu32(state0, state1, round_input);
+
+            if (i < 12) {
+                // Derive the schedule vector for group i + 4 from groups i..i+3
+                const __m128i shifted = _mm_alignr_epi8(msg[(i + 3) % 4], msg[(i + 2) % 4], 4);
+                msg[i % 4] = _mm_sha256msg2_epu32(
+                    _mm_add_epi32(_mm_sha256msg1_epu32(msg[i % 4], msg[(i + 1) % 4]), shifted),
+                    msg[(i + 3) % 4]);
+            }
+        }
+
+        state0 = _mm_add_epi32(state0, abef_save);
+        state1 = _mm_add_epi32(state1, cdgh_save);
+    }
+
+    // Unpack back into a..h word order
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[0]), state0);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&state[4]), state1);
+}
+
+SHA256_NI_TARGET
+SHA256Hash CalculateSHA256ShaNi(const u8* data, std::size_t size) {
+    std::array<u32, 8> state{
+        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19,
+    };
+
+    const std::size_t num_blocks = size / 64;
+    ProcessBlocksShaNi(state, data, num_blocks);
+
+    // Build the padded tail: the remaining bytes, a single 0x80 marker and the bit length,
+    // spilling into a second block when the remainder leaves no room for the length field.
+    const std::size_t remainder = size % 64;
+    std::array<u8, 128> tail{};
+    std::memcpy(tail.data(), data + num_blocks * 64, remainder);
+    tail[remainder] = 0x80;
+    const std::size_t tail_blocks = remainder >= 56 ? 2 : 1;
+    const u64 bit_length = static_cast<u64>(size) * 8;
+    for (std::size_t i = 0; i < sizeof(bit_length); ++i) {
+        tail[tail_blocks * 64 - 1 - i] = static_cast<u8>(bit_length >> (8 * i));
+    }
+    ProcessBlocksShaNi(state, tail.data(), tail_blocks);
+
+    SHA256Hash out;
+    for (std::size_t i = 0; i < state.size(); ++i) {
+        out[4 * i + 0] = static_cast<u8>(state[i] >> 24);
+        out[4 * i + 1] = static_cast<u8>(state[i] >> 16);
+        out[4 * i + 2] = static_cast<u8>(state[i] >> 8);
+        out[4 * i + 3] = static_cast<u8>(state[i]);
+    }
+    return out;
+}
+
+#undef SHA256_NI_TARGET
+
+#endif // ARCHITECTURE_x86_64
+
+} // Anonymous namespace
+
+SHA256Hash CalculateSHA256(const u8* data, std::size_t size) {
+#ifdef ARCHITECTURE_x86_64
+    static const bool use_sha_ni = Common::GetCPUCaps().sha;
+    if (use_sha_ni) {
+        return CalculateSHA256ShaNi(data, size);
+    }
+#endif
+    SHA256Hash out;
+    mbedtls_sha256(data, size, out.data(), 0);
+    return out;
+}
+
+} // namespace Core::Crypto
@@ -4,17 +4,17 @@
 
 #pragma once
 
-#include "common/assert.h"
-#include "core/file_sys/vfs.h"
-#include "key_manager.h"
-#include "mbedtls/cipher.h"
+#include <array>
+#include <cstddef>
+#include "common/common_types.h"
 
-namespace Crypto {
-typedef std::array<u8, 0x20> SHA256Hash;
+namespace Core::Crypto {
 
-inline SHA256Hash operator"" _HASH(const char* data, size_t len) {
-    if (len != 0x40)
-        return {};
-}
+using SHA256Hash = std::array<u8, 0x20>;
 
-} // namespace Crypto
+/// Computes the SHA-256 digest of the given buffer. Dispatches to a SHA-NI accelerated
+/// implementation when the host CPU supports the extension and falls back to mbedTLS otherwise,
+/// so callers never need to care about the host instruction set.
+SHA256Hash CalculateSHA256(const u8* data, std::size_t size);
+
+} // namespace Core::Crypto
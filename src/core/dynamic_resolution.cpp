@@ -0,0 +1,100 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+
+#include "common/logging/log.h"
+#include "core/dynamic_resolution.h"
+#include "core/perf_stats.h"
+#include "core/settings.h"
+
+namespace Core {
+
+namespace {
+
+/// Vsync periods between controller evaluations (~1 second at 60 Hz)
+constexpr u32 EVALUATION_INTERVAL = 60;
+
+/// p95 frame times above this are treated as GPU overload (the 60 FPS budget plus margin)
+constexpr double SCALE_DOWN_THRESHOLD_MS = 19.0;
+
+/// p95 frame times below this are treated as headroom to scale back up
+constexpr double SCALE_UP_THRESHOLD_MS = 14.5;
+
+/// Amount the factor moves per adjustment
+constexpr float FACTOR_STEP = 0.25f;
+
+/// Consecutive overloaded evaluations required before scaling down
+constexpr u32 OVERLOAD_STREAK = 2;
+
+/// Consecutive idle evaluations required before scaling up; recovery is deliberately slower than
+/// reduction so a marginal load does not flip the factor back and forth
+constexpr u32 HEADROOM_STREAK = 5;
+
+} // Anonymous namespace
+
+DynamicResolutionController::DynamicResolutionController(PerfStats& perf_stats)
+    : perf_stats{perf_stats} {}
+
+void DynamicResolutionController::OnVSync() {
+    if (!Settings::values.use_dynamic_resolution) {
+        return;
+    }
+
+    if (++vsyncs_since_evaluation < EVALUATION_INTERVAL) {
+        return;
+    }
+    vsyncs_since_evaluation = 0;
+
+    Evaluate();
+}
+
+float DynamicResolutionController::GetResolutionFactor() const {
+    const float factor = current_factor.load(std::memory_order_relaxed);
+    if (!Settings::values.use_dynamic_resolution || factor == 0.0f) {
+        return Settings::values.resolution_factor;
+    }
+    return factor;
+}
+
+void DynamicResolutionController::Evaluate() {
+    const float max_factor = Settings::values.resolution_factor;
+    const float min_factor = std::min(Settings::values.dynamic_resolution_min, max_factor);
+
+    float factor = current_factor.load(std::memory_order_relaxed);
+    if (factor == 0.0f) {
+        // First evaluation: start at full quality and let the feedback pull it down if needed
+        current_factor.store(max_factor, std::memory_order_relaxed);
+        return;
+    }
+    factor = std::clamp(factor, min_factor, max_factor);
+
+    const double p95 = perf_stats.GetFrameTimePercentileMs(0.95);
+    float new_factor = factor;
+    if (p95 > SCALE_DOWN_THRESHOLD_MS) {
+        headroom_streak = 0;
+        if (++overload_streak >= OVERLOAD_STREAK) {
+            overload_streak = 0;
+            new_factor = std::max(factor - FACTOR_STEP, min_factor);
+        }
+    } else if (p95 > 0.0 && p95 < SCALE_UP_THRESHOLD_MS) {
+        overload_streak = 0;
+        if (++headroom_streak >= HEADROOM_STREAK) {
+            headroom_streak = 0;
+            new_factor = std::min(factor + FACTOR_STEP, max_factor);
+        }
+    } else {
+        // In the hysteresis band (or no frame data yet); hold the current factor
+        overload_streak = 0;
+        headroom_streak = 0;
+    }
+
+    if (new_factor != factor) {
+        LOG_INFO(Core, "Dynamic resolution factor {} -> {} (p95 frame time {:.2f} ms)", factor,
+                 new_factor, p95);
+    }
+    current_factor.store(new_factor, std::memory_order_relaxed);
+}
+
+} // namespace Core
@@ -0,0 +1,48 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include "common/common_types.h"
+
+namespace Core {
+
+class PerfStats;
+
+/**
+ * Adjusts the resolution factor reported to the guest between a configured minimum and the
+ * configured resolution_factor based on frame-time feedback. The controller samples the rolling
+ * p95 frame time from PerfStats about once a second: sustained overload steps the factor down,
+ * sustained headroom steps it back up, with asymmetric streak requirements as hysteresis so the
+ * factor does not oscillate around a threshold.
+ *
+ * The factor is consumed where the vi service reports display and layer dimensions, so a changed
+ * factor takes effect when the title (re)queries the display or recreates its layers; titles that
+ * size their framebuffers once at boot keep the factor that was active at that point.
+ */
+class DynamicResolutionController {
+public:
+    explicit DynamicResolutionController(PerfStats& perf_stats);
+
+    /// Advances the controller by one vsync period; evaluates the frame-time feedback about once
+    /// a second. Called from the compositor, so it ticks at display rate regardless of game rate.
+    void OnVSync();
+
+    /// Returns the resolution factor that should currently be applied. Safe to call from any
+    /// thread; falls through to the static setting when the controller is disabled.
+    float GetResolutionFactor() const;
+
+private:
+    void Evaluate();
+
+    PerfStats& perf_stats;
+
+    std::atomic<float> current_factor{0.0f}; ///< 0 means not initialized from the settings yet
+    u32 vsyncs_since_evaluation = 0;
+    u32 overload_streak = 0;
+    u32 headroom_streak = 0;
+};
+
+} // namespace Core
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <array>
+#include <future>
 #include <string>
 
 #include <fmt/ostream.h>
@@ -41,17 +42,28 @@ XCI::XCI(VirtualFile file_)
         return;
     }
 
+    // The four partition filesystems are independent of each other, so parse them in parallel
+    // while this thread builds the secure partition NSP below.
+    std::array<std::future<std::shared_ptr<PartitionFilesystem>>, 0x4> partition_futures;
     for (XCIPartition partition :
          {XCIPartition::Update, XCIPartition::Normal, XCIPartition::Secure, XCIPartition::Logo}) {
         auto raw = main_hfs.GetFile(partition_names[static_cast<std::size_t>(partition)]);
-        if (raw != nullptr)
-            partitions[static_cast<std::size_t>(partition)] =
-                std::make_shared<PartitionFilesystem>(raw);
+        if (raw != nullptr) {
+            partition_futures[static_cast<std::size_t>(partition)] =
+                std::async(std::launch::async, [raw = std::move(raw)] {
+                    return std::make_shared<PartitionFilesystem>(raw);
+                });
+        }
     }
 
     secure_partition = std::make_shared<NSP>(
         main_hfs.GetFile(partition_names[static_cast<std::size_t>(XCIPartition::Secure)]));
 
+    for (std::size_t i = 0; i < partitions.size(); ++i) {
+        if (partition_futures[i].valid())
+            partitions[i] = partition_futures[i].get();
+    }
+
     const auto secure_ncas = secure_partition->GetNCAsCollapsed();
     std::copy(secure_ncas.begin(), secure_ncas.end(), std::back_inserter(ncas));
 
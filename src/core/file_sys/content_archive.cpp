@@ -4,7 +4,10 @@
 
 #include <algorithm>
 #include <cstring>
+#include <map>
+#include <mutex>
 #include <optional>
+#include <unordered_map>
 #include <utility>
 
 #include "common/logging/log.h"
@@ -96,6 +99,31 @@ union NCASectionHeader {
 };
 static_assert(sizeof(NCASectionHeader) == 0x200, "NCASectionHeader has incorrect size.");
 
+// Opening an NCA decrypts its header and section headers with XTS and derives its key area with
+// ECB, and the same archives are reopened several times during a single boot (update check,
+// control data, romfs). NCA contents are immutable, so the decrypted results are cached
+// process-wide, keyed by file identity for headers and by the key area inputs for derived keys.
+struct NCAHeaderCacheEntry {
+    NCAHeader header{};
+    std::vector<NCASectionHeader> sections;
+};
+
+static std::mutex nca_cache_mutex;
+static std::unordered_map<std::string, NCAHeaderCacheEntry> nca_header_cache;
+
+using KeyAreaCacheKey = std::pair<std::array<u8, 0x40>, u16>;
+static std::map<KeyAreaCacheKey, std::array<u8, 0x40>> key_area_cache;
+
+/// Returns the key identifying a file in the header cache, or an empty string when the file has
+/// no stable identity to key a cache on.
+static std::string HeaderCacheKey(const VirtualFile& file) {
+    std::string path = file->GetFullPath();
+    if (path.empty()) {
+        return {};
+    }
+    return path + ':' + std::to_string(file->GetSize());
+}
+
 static bool IsValidNCA(const NCAHeader& header) {
     // TODO(DarkLordZach): Add NCA2/NCA0 support.
     return header.magic == Common::MakeMagic('N', 'C', 'A', '3');
@@ -159,6 +187,17 @@ bool NCA::HandlePotentialHeaderDecryption() {
         return false;
     }
 
+    const std::string cache_key = HeaderCacheKey(file);
+    if (!cache_key.empty()) {
+        std::lock_guard lock{nca_cache_mutex};
+        const auto iter = nca_header_cache.find(cache_key);
+        if (iter != nca_header_cache.end()) {
+            header = iter->second.header;
+            encrypted = true;
+            return true;
+        }
+    }
+
     NCAHeader dec_header{};
     Core::Crypto::AESCipher<Core::Crypto::Key256> cipher(
         keys.GetKey(Core::Crypto::S256KeyType::Header), Core::Crypto::Mode::XTS);
@@ -167,6 +206,11 @@ bool NCA::HandlePotentialHeaderDecryption() {
     if (IsValidNCA(dec_header)) {
         header = dec_header;
         encrypted = true;
+
+        if (!cache_key.empty()) {
+            std::lock_guard lock{nca_cache_mutex};
+            nca_header_cache[cache_key].header = header;
+        }
     } else {
         if (!CheckSupportedNCA(dec_header)) {
             return false;
@@ -192,11 +236,28 @@ std::vector<NCASectionHeader> NCA::ReadSectionHeaders() const {
     const auto length_sections = SECTION_HEADER_SIZE * number_sections;
 
     if (encrypted) {
+        const std::string cache_key = HeaderCacheKey(file);
+        if (!cache_key.empty()) {
+            std::lock_guard lock{nca_cache_mutex};
+            const auto iter = nca_header_cache.find(cache_key);
+            if (iter != nca_header_cache.end() && iter->second.sections.size() == sections.size()) {
+                return iter->second.sections;
+            }
+        }
+
         auto raw = file->ReadBytes(length_sections, SECTION_HEADER_OFFSET);
         Core::Crypto::AESCipher<Core::Crypto::Key256> cipher(
             keys.GetKey(Core::Crypto::S256KeyType::Header), Core::Crypto::Mode::XTS);
         cipher.XTSTranscode(raw.data(), length_sections, sections.data(), 2, SECTION_HEADER_SIZE,
                             Core::Crypto::Op::Decrypt);
+
+        if (!cache_key.empty()) {
+            std::lock_guard lock{nca_cache_mutex};
+            const auto iter = nca_header_cache.find(cache_key);
+            if (iter != nca_header_cache.end()) {
+                iter->second.sections = sections;
+            }
+        }
     } else {
         file->ReadBytes(sections.data(), length_sections, SECTION_HEADER_OFFSET);
     }
@@ -394,11 +455,24 @@ std::optional<Core::Crypto::Key128> NCA::GetKeyAreaKey(NCASectionCryptoType type
     if (!keys.HasKey(Core::Crypto::S128KeyType::KeyArea, master_key_id, header.key_index))
         return {};
 
-    std::vector<u8> key_area(header.key_area.begin(), header.key_area.end());
-    Core::Crypto::AESCipher<Core::Crypto::Key128> cipher(
-        keys.GetKey(Core::Crypto::S128KeyType::KeyArea, master_key_id, header.key_index),
-        Core::Crypto::Mode::ECB);
-    cipher.Transcode(key_area.data(), key_area.size(), key_area.data(), Core::Crypto::Op::Decrypt);
+    const KeyAreaCacheKey cache_key{header.key_area,
+                                    static_cast<u16>((master_key_id << 8) | header.key_index)};
+    std::array<u8, 0x40> key_area;
+    {
+        std::lock_guard lock{nca_cache_mutex};
+        const auto iter = key_area_cache.find(cache_key);
+        if (iter != key_area_cache.end()) {
+            key_area = iter->second;
+        } else {
+            key_area = header.key_area;
+            Core::Crypto::AESCipher<Core::Crypto::Key128> cipher(
+                keys.GetKey(Core::Crypto::S128KeyType::KeyArea, master_key_id, header.key_index),
+                Core::Crypto::Mode::ECB);
+            cipher.Transcode(key_area.data(), key_area.size(), key_area.data(),
+                             Core::Crypto::Op::Decrypt);
+            key_area_cache.emplace(cache_key, key_area);
+        }
+    }
 
     Core::Crypto::Key128 out;
     if (type == NCASectionCryptoType::XTS)
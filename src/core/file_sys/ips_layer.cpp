@@ -13,7 +13,7 @@
 #include "common/logging/log.h"
 #include "common/swap.h"
 #include "core/file_sys/ips_layer.h"
-#include "core/file_sys/vfs_vector.h"
+#include "core/file_sys/vfs_overlay.h"
 
 namespace FileSys {
 
@@ -73,7 +73,8 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
     if (type == IPSFileType::Error)
         return nullptr;
 
-    auto in_data = in->ReadAllBytes();
+    const auto in_size = in->GetSize();
+    std::map<u64, std::vector<u8>> extents;
 
     std::vector<u8> temp(type == IPSFileType::IPS ? 3 : 4);
     u64 offset = 5; // After header
@@ -106,16 +107,23 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
             if (!data)
                 return nullptr;
 
-            if (real_offset + rle_size > in_data.size())
-                rle_size = static_cast<u16>(in_data.size() - real_offset);
-            std::memset(in_data.data() + real_offset, *data, rle_size);
+            if (real_offset < in_size) {
+                const auto write_size =
+                    std::min<std::size_t>(rle_size, in_size - real_offset);
+                const std::vector<u8> run(write_size, *data);
+                OverlayVfsFile::AddExtent(extents, real_offset, run.data(), run.size());
+            }
         } else { // Standard Patch
-            auto read = data_size;
-            if (real_offset + read > in_data.size())
-                read = static_cast<u16>(in_data.size() - real_offset);
-            if (ips->Read(in_data.data() + real_offset, read, offset) != data_size)
+            std::vector<u8> replace(data_size);
+            if (ips->Read(replace.data(), replace.size(), offset) != data_size)
                 return nullptr;
             offset += data_size;
+
+            if (real_offset < in_size) {
+                const auto write_size =
+                    std::min<std::size_t>(data_size, in_size - real_offset);
+                OverlayVfsFile::AddExtent(extents, real_offset, replace.data(), write_size);
+            }
         }
     }
 
@@ -123,8 +131,8 @@ VirtualFile PatchIPS(const VirtualFile& in, const VirtualFile& ips) {
         return nullptr;
     }
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    return std::make_shared<OverlayVfsFile>(in, std::move(extents), in->GetName(),
+                                            in->GetContainingDirectory());
 }
 
 struct IPSwitchCompiler::IPSwitchPatch {
@@ -314,25 +322,24 @@ VirtualFile IPSwitchCompiler::Apply(const VirtualFile& in) const {
     if (in == nullptr || !valid)
         return nullptr;
 
-    auto in_data = in->ReadAllBytes();
+    const auto in_size = in->GetSize();
+    std::map<u64, std::vector<u8>> extents;
 
     for (const auto& patch : patches) {
         if (!patch.enabled)
             continue;
 
         for (const auto& record : patch.records) {
-            if (record.first >= in_data.size())
+            if (record.first >= in_size)
                 continue;
-            auto replace_size = record.second.size();
-            if (record.first + replace_size > in_data.size())
-                replace_size = in_data.size() - record.first;
-            for (std::size_t i = 0; i < replace_size; ++i)
-                in_data[i + record.first] = record.second[i];
+            const auto replace_size = std::min<std::size_t>(record.second.size(),
+                                                            in_size - record.first);
+            OverlayVfsFile::AddExtent(extents, record.first, record.second.data(), replace_size);
         }
     }
 
-    return std::make_shared<VectorVfsFile>(std::move(in_data), in->GetName(),
-                                           in->GetContainingDirectory());
+    return std::make_shared<OverlayVfsFile>(in, std::move(extents), in->GetName(),
+                                            in->GetContainingDirectory());
 }
 
 } // namespace FileSys
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <cstring>
+#include <mutex>
 
 #include "common/hex_util.h"
 #include "common/logging/log.h"
@@ -239,11 +240,6 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
         return;
     }
 
-    auto extracted = ExtractRomFS(romfs);
-    if (extracted == nullptr) {
-        return;
-    }
-
     const auto& disabled = Settings::values.disabled_addons[title_id];
     auto patch_dirs = load_dir->GetSubdirectories();
     std::sort(patch_dirs.begin(), patch_dirs.end(),
@@ -265,6 +261,17 @@ static void ApplyLayeredFS(VirtualFile& romfs, u64 title_id, ContentRecordType t
         if (ext_dir != nullptr)
             layers_ext.push_back(std::move(ext_dir));
     }
+
+    // No mod actually touches the RomFS; don't pay for extracting and repacking it.
+    if (layers.empty() && layers_ext.empty()) {
+        return;
+    }
+
+    auto extracted = ExtractRomFS(romfs);
+    if (extracted == nullptr) {
+        return;
+    }
+
     layers.push_back(std::move(extracted));
 
     auto layered = LayeredVfsDirectory::MakeLayeredDirectory(std::move(layers));
@@ -440,17 +447,51 @@ std::map<std::string, std::string, std::less<>> PatchManager::GetPatchVersionNam
     return out;
 }
 
+// Control data is looked up repeatedly during a single boot (game list, loader, applets), and
+// every miss costs an NCA open plus a RomFS extraction. Memoize the extracted control files per
+// title ID; the NACP parse itself is cheap enough to redo on every hit.
+static std::mutex control_metadata_mutex;
+static std::map<u64, std::pair<VirtualFile, VirtualFile>> control_metadata_cache;
+
+void PatchManager::ClearControlMetadataCache() {
+    std::lock_guard lock{control_metadata_mutex};
+    control_metadata_cache.clear();
+}
+
 std::pair<std::unique_ptr<NACP>, VirtualFile> PatchManager::GetControlMetadata() const {
+    {
+        std::lock_guard lock{control_metadata_mutex};
+        const auto iter = control_metadata_cache.find(title_id);
+        if (iter != control_metadata_cache.end()) {
+            const auto& [nacp_file, icon_file] = iter->second;
+            auto nacp = nacp_file == nullptr ? nullptr : std::make_unique<NACP>(nacp_file);
+            return {std::move(nacp), icon_file};
+        }
+    }
+
     const auto installed{Service::FileSystem::GetUnionContents()};
 
     const auto base_control_nca = installed.GetEntry(title_id, ContentRecordType::Control);
     if (base_control_nca == nullptr)
         return {};
 
-    return ParseControlNCA(*base_control_nca);
+    const auto [nacp_file, icon_file] = ParseControlNCAFiles(*base_control_nca);
+    {
+        std::lock_guard lock{control_metadata_mutex};
+        control_metadata_cache.insert_or_assign(title_id, std::make_pair(nacp_file, icon_file));
+    }
+
+    auto nacp = nacp_file == nullptr ? nullptr : std::make_unique<NACP>(nacp_file);
+    return {std::move(nacp), icon_file};
 }
 
 std::pair<std::unique_ptr<NACP>, VirtualFile> PatchManager::ParseControlNCA(const NCA& nca) const {
+    const auto [nacp_file, icon_file] = ParseControlNCAFiles(nca);
+    auto nacp = nacp_file == nullptr ? nullptr : std::make_unique<NACP>(nacp_file);
+    return {std::move(nacp), icon_file};
+}
+
+std::pair<VirtualFile, VirtualFile> PatchManager::ParseControlNCAFiles(const NCA& nca) const {
     const auto base_romfs = nca.GetRomFS();
     if (base_romfs == nullptr)
         return {};
@@ -467,8 +508,6 @@ std::pair<std::unique_ptr<NACP>, VirtualFile> PatchManager::ParseControlNCA(cons
     if (nacp_file == nullptr)
         nacp_file = extracted->GetFile("Control.nacp");
 
-    auto nacp = nacp_file == nullptr ? nullptr : std::make_unique<NACP>(nacp_file);
-
     VirtualFile icon_file;
     for (const auto& language : FileSys::LANGUAGE_NAMES) {
         icon_file = extracted->GetFile("icon_" + std::string(language) + ".dat");
@@ -476,6 +515,6 @@ std::pair<std::unique_ptr<NACP>, VirtualFile> PatchManager::ParseControlNCA(cons
             break;
     }
 
-    return {std::move(nacp), icon_file};
+    return {nacp_file, icon_file};
 }
 } // namespace FileSys
@@ -64,10 +64,17 @@ public:
     // Version of GetControlMetadata that takes an arbitrary NCA
     std::pair<std::unique_ptr<NACP>, VirtualFile> ParseControlNCA(const NCA& nca) const;
 
+    // Drops all memoized control metadata. Called when the installed contents change, since
+    // cached results may no longer reflect them.
+    static void ClearControlMetadataCache();
+
 private:
     std::vector<VirtualFile> CollectPatches(const std::vector<VirtualDir>& patch_dirs,
                                             const std::string& build_id) const;
 
+    // Returns the control.nacp and icon files of the control NCA after patching.
+    std::pair<VirtualFile, VirtualFile> ParseControlNCAFiles(const NCA& nca) const;
+
     u64 title_id;
 };
 
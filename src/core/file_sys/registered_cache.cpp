@@ -4,18 +4,21 @@
 
 #include <algorithm>
 #include <regex>
-#include <mbedtls/sha256.h>
 #include "common/assert.h"
+#include "common/common_funcs.h"
 #include "common/file_util.h"
 #include "common/hex_util.h"
 #include "common/logging/log.h"
 #include "core/crypto/key_manager.h"
+#include "core/crypto/sha_util.h"
 #include "core/file_sys/card_image.h"
 #include "core/file_sys/content_archive.h"
 #include "core/file_sys/nca_metadata.h"
+#include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/submission_package.h"
 #include "core/file_sys/vfs_concat.h"
+#include "core/file_sys/vfs_vector.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
@@ -23,6 +26,11 @@ namespace FileSys {
 // The size of blocks to use when vfs raw copying into nand.
 constexpr size_t VFS_RC_LARGE_COPY_BLOCK = 0x400000;
 
+// On-disk metadata index, stored next to the yuzu_meta CNMTs.
+constexpr const char* META_INDEX_PATH = "/yuzu_meta/registered.idx";
+constexpr u32 META_INDEX_MAGIC = Common::MakeMagic('Y', 'R', 'C', 'I');
+constexpr u32 META_INDEX_VERSION = 1;
+
 std::string RegisteredCacheEntry::DebugInfo() const {
     return fmt::format("title_id={:016X}, content_type={:02X}", title_id, static_cast<u8>(type));
 }
@@ -56,8 +64,7 @@ static std::string GetRelativePathFromNcaID(const std::array<u8, 16>& nca_id, bo
     if (!within_two_digit)
         return fmt::format("/{}.nca", Common::HexArrayToString(nca_id, second_hex_upper));
 
-    Core::Crypto::SHA256Hash hash{};
-    mbedtls_sha256(nca_id.data(), nca_id.size(), hash.data(), 0);
+    const auto hash = Core::Crypto::CalculateSHA256(nca_id.data(), nca_id.size());
     return fmt::format("/000000{:02X}/{}.nca", hash[0],
                        Common::HexArrayToString(nca_id, second_hex_upper));
 }
@@ -230,19 +237,27 @@ void RegisteredCache::ProcessFiles(const std::vector<NcaID>& ids) {
         const auto nca = std::make_shared<NCA>(parser(file, id), nullptr, 0, keys);
         if (nca->GetStatus() != Loader::ResultStatus::Success ||
             nca->GetType() != NCAContentType::Meta) {
+            meta_index.insert_or_assign(id, MetaIndexEntry{});
             continue;
         }
 
         const auto section0 = nca->GetSubdirectories()[0];
 
+        bool found_cnmt = false;
         for (const auto& section0_file : section0->GetFiles()) {
             if (section0_file->GetExtension() != "cnmt")
                 continue;
 
             meta.insert_or_assign(nca->GetTitleId(), CNMT(section0_file));
             meta_id.insert_or_assign(nca->GetTitleId(), id);
+            meta_index.insert_or_assign(
+                id, MetaIndexEntry{nca->GetTitleId(), section0_file->ReadAllBytes()});
+            found_cnmt = true;
             break;
         }
+
+        if (!found_cnmt)
+            meta_index.insert_or_assign(id, MetaIndexEntry{});
     }
 }
 
@@ -260,12 +275,117 @@ void RegisteredCache::AccumulateYuzuMeta() {
     }
 }
 
+void RegisteredCache::LoadMetaIndex() {
+    const auto index_file = dir->GetFileRelative(META_INDEX_PATH);
+    if (index_file == nullptr)
+        return;
+
+    const auto data = index_file->ReadAllBytes();
+    std::size_t offset = 0;
+    const auto read = [&data, &offset](void* out, std::size_t size) {
+        if (offset + size > data.size())
+            return false;
+        std::memcpy(out, data.data() + offset, size);
+        offset += size;
+        return true;
+    };
+
+    u32 magic{};
+    u32 version{};
+    u32 count{};
+    if (!read(&magic, sizeof(magic)) || magic != META_INDEX_MAGIC ||
+        !read(&version, sizeof(version)) || version != META_INDEX_VERSION ||
+        !read(&count, sizeof(count))) {
+        return;
+    }
+
+    for (u32 i = 0; i < count; ++i) {
+        NcaID id{};
+        u64 title_id{};
+        u32 cnmt_size{};
+        if (!read(id.data(), id.size()) || !read(&title_id, sizeof(title_id)) ||
+            !read(&cnmt_size, sizeof(cnmt_size)) || offset + cnmt_size > data.size()) {
+            // Truncated or corrupt index; throw it away and rescan everything.
+            meta_index.clear();
+            return;
+        }
+        std::vector<u8> cnmt_bytes(data.begin() + offset, data.begin() + offset + cnmt_size);
+        offset += cnmt_size;
+        meta_index.insert_or_assign(id, MetaIndexEntry{title_id, std::move(cnmt_bytes)});
+    }
+}
+
+void RegisteredCache::SaveMetaIndex() const {
+    // The backing directory may be read-only; in that case simply don't persist the index.
+    const auto meta_dir = dir->CreateDirectoryRelative("yuzu_meta");
+    if (meta_dir == nullptr)
+        return;
+    auto out = meta_dir->GetFile("registered.idx");
+    if (out == nullptr)
+        out = meta_dir->CreateFile("registered.idx");
+    if (out == nullptr)
+        return;
+
+    std::vector<u8> buffer;
+    const auto append = [&buffer](const void* data, std::size_t size) {
+        const auto* const bytes = static_cast<const u8*>(data);
+        buffer.insert(buffer.end(), bytes, bytes + size);
+    };
+
+    append(&META_INDEX_MAGIC, sizeof(META_INDEX_MAGIC));
+    append(&META_INDEX_VERSION, sizeof(META_INDEX_VERSION));
+    const auto count = static_cast<u32>(meta_index.size());
+    append(&count, sizeof(count));
+    for (const auto& kv : meta_index) {
+        append(kv.first.data(), kv.first.size());
+        append(&kv.second.title_id, sizeof(kv.second.title_id));
+        const auto cnmt_size = static_cast<u32>(kv.second.cnmt_bytes.size());
+        append(&cnmt_size, sizeof(cnmt_size));
+        append(kv.second.cnmt_bytes.data(), kv.second.cnmt_bytes.size());
+    }
+
+    out->Resize(buffer.size());
+    out->WriteBytes(buffer);
+}
+
 void RegisteredCache::Refresh() {
     if (dir == nullptr)
         return;
     const auto ids = AccumulateFiles();
-    ProcessFiles(ids);
+
+    if (!meta_index_loaded) {
+        LoadMetaIndex();
+        meta_index_loaded = true;
+    }
+
+    // Restore the metadata of every NCA the index already knows about in one pass, dropping
+    // entries whose NCA no longer exists, and only open files that are new since the last scan.
+    auto old_index = std::move(meta_index);
+    meta_index.clear();
+    meta.clear();
+    meta_id.clear();
+    std::vector<NcaID> new_ids;
+    for (const auto& id : ids) {
+        const auto iter = old_index.find(id);
+        if (iter == old_index.end()) {
+            new_ids.push_back(id);
+            continue;
+        }
+        if (!iter->second.cnmt_bytes.empty()) {
+            const CNMT cnmt(std::make_shared<VectorVfsFile>(iter->second.cnmt_bytes));
+            meta.insert_or_assign(iter->second.title_id, cnmt);
+            meta_id.insert_or_assign(iter->second.title_id, id);
+        }
+        meta_index.insert_or_assign(id, std::move(iter->second));
+    }
+
+    ProcessFiles(new_ids);
+    if (!new_ids.empty() || meta_index.size() != old_index.size())
+        SaveMetaIndex();
     AccumulateYuzuMeta();
+
+    // The available contents may have changed; memoized control metadata could be stale now.
+    PatchManager::ClearControlMetadataCache();
 }
 
 RegisteredCache::RegisteredCache(VirtualDir dir_, RegisteredCacheParsingFunction parsing_function)
@@ -445,7 +565,7 @@ InstallResult RegisteredCache::InstallEntry(const NCA& nca, TitleType type,
     OptionalHeader opt_header{0, 0};
     ContentRecord c_rec{{}, {}, {}, GetCRTypeFromNCAType(nca.GetType()), {}};
     const auto& data = nca.GetBaseFile()->ReadBytes(0x100000);
-    mbedtls_sha256(data.data(), data.size(), c_rec.hash.data(), 0);
+    c_rec.hash = Core::Crypto::CalculateSHA256(data.data(), data.size());
     memcpy(&c_rec.nca_id, &c_rec.hash, 16);
     const CNMT new_cnmt(header, opt_header, {c_rec}, {});
     if (!RawInstallYuzuMeta(new_cnmt))
@@ -457,7 +577,6 @@ InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFuncti
                                              bool overwrite_if_exists,
                                              std::optional<NcaID> override_id) {
     const auto in = nca.GetBaseFile();
-    Core::Crypto::SHA256Hash hash{};
 
     // Calculate NcaID
     // NOTE: Because computing the SHA256 of an entire NCA is quite expensive (especially if the
@@ -468,7 +587,7 @@ InstallResult RegisteredCache::RawInstallNCA(const NCA& nca, const VfsCopyFuncti
         id = *override_id;
     } else {
         const auto& data = in->ReadBytes(0x100000);
-        mbedtls_sha256(data.data(), data.size(), hash.data(), 0);
+        const auto hash = Core::Crypto::CalculateSHA256(data.data(), data.size());
         memcpy(id.data(), hash.data(), 16);
     }
 
@@ -104,18 +104,25 @@ public:
     // Raw copies all the ncas from the xci/nsp to the csache. Does some quick checks to make sure
     // there is a meta NCA and all of them are accessible.
     InstallResult InstallEntry(const XCI& xci, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = &VfsPipelinedCopy);
     InstallResult InstallEntry(const NSP& nsp, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = &VfsPipelinedCopy);
 
     // Due to the fact that we must use Meta-type NCAs to determine the existance of files, this
     // poses quite a challenge. Instead of creating a new meta NCA for this file, yuzu will create a
     // dir inside the NAND called 'yuzu_meta' and store the raw CNMT there.
     // TODO(DarkLordZach): Author real meta-type NCAs and install those.
     InstallResult InstallEntry(const NCA& nca, TitleType type, bool overwrite_if_exists = false,
-                               const VfsCopyFunction& copy = &VfsRawCopy);
+                               const VfsCopyFunction& copy = &VfsPipelinedCopy);
 
 private:
+    // One record of the persistent metadata index: what the NCA with a given id parsed to on a
+    // previous scan. cnmt_bytes is empty for NCAs that turned out not to be Meta-type.
+    struct MetaIndexEntry {
+        u64 title_id;
+        std::vector<u8> cnmt_bytes;
+    };
+
     template <typename T>
     void IterateAllMetadata(std::vector<T>& out,
                             std::function<T(const CNMT&, const ContentRecord&)> proc,
@@ -123,6 +130,8 @@ private:
     std::vector<NcaID> AccumulateFiles() const;
     void ProcessFiles(const std::vector<NcaID>& ids);
     void AccumulateYuzuMeta();
+    void LoadMetaIndex();
+    void SaveMetaIndex() const;
     std::optional<NcaID> GetNcaIDFromMetadata(u64 title_id, ContentRecordType type) const;
     VirtualFile GetFileAtID(NcaID id) const;
     VirtualFile OpenFileOrDirectoryConcat(const VirtualDir& dir, std::string_view path) const;
@@ -140,6 +149,10 @@ private:
     boost::container::flat_map<u64, CNMT> meta;
     // maps tid -> meta for CNMT in yuzu_meta
     boost::container::flat_map<u64, CNMT> yuzu_meta;
+    // maps NcaID -> parse result of every NCA seen so far; mirrored to disk so subsequent
+    // refreshes only need to open NCAs that appeared since the index was written
+    boost::container::flat_map<NcaID, MetaIndexEntry> meta_index;
+    bool meta_index_loaded = false;
 };
 
 // Combines multiple RegisteredCaches (i.e. SysNAND, UserNAND, SDMC) into one interface.
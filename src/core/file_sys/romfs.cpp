@@ -9,7 +9,6 @@
 #include "core/file_sys/vfs.h"
 #include "core/file_sys/vfs_concat.h"
 #include "core/file_sys/vfs_offset.h"
-#include "core/file_sys/vfs_vector.h"
 
 namespace FileSys {
 
@@ -61,44 +60,73 @@ static std::pair<Entry, std::string> GetEntry(const VirtualFile& file, std::size
     return {entry, string};
 }
 
-void ProcessFile(VirtualFile file, std::size_t file_offset, std::size_t data_offset,
-                 u32 this_file_offset, std::shared_ptr<VectorVfsDirectory> parent) {
-    while (true) {
-        auto entry = GetEntry<FileEntry>(file, file_offset + this_file_offset);
+// A directory within a RomFS image whose entries are only parsed out of the metadata tables on
+// first traversal. Untouched subtrees never materialize any VFS objects, which keeps extraction
+// of large images (and the layered mod setups built on top of them) cheap.
+class RomFSVfsDirectory : public ReadOnlyVfsDirectory {
+public:
+    RomFSVfsDirectory(VirtualFile file_, std::size_t dir_offset_, std::size_t file_offset_,
+                      std::size_t data_offset_, u32 this_dir_offset_, std::string name_,
+                      VirtualDir parent_ = nullptr)
+        : file(std::move(file_)), dir_offset(dir_offset_), file_offset(file_offset_),
+          data_offset(data_offset_), this_dir_offset(this_dir_offset_), name(std::move(name_)),
+          parent(std::move(parent_)) {}
+
+    std::vector<VirtualFile> GetFiles() const override {
+        Populate();
+        return files;
+    }
 
-        parent->AddFile(std::make_shared<OffsetVfsFile>(
-            file, entry.first.size, entry.first.offset + data_offset, entry.second));
+    std::vector<VirtualDir> GetSubdirectories() const override {
+        Populate();
+        return dirs;
+    }
 
-        if (entry.first.sibling == ROMFS_ENTRY_EMPTY)
-            break;
+    std::string GetName() const override {
+        return name;
+    }
 
-        this_file_offset = entry.first.sibling;
+    VirtualDir GetParentDirectory() const override {
+        return parent;
     }
-}
 
-void ProcessDirectory(VirtualFile file, std::size_t dir_offset, std::size_t file_offset,
-                      std::size_t data_offset, u32 this_dir_offset,
-                      std::shared_ptr<VectorVfsDirectory> parent) {
-    while (true) {
-        auto entry = GetEntry<DirectoryEntry>(file, dir_offset + this_dir_offset);
-        auto current = std::make_shared<VectorVfsDirectory>(
-            std::vector<VirtualFile>{}, std::vector<VirtualDir>{}, entry.second);
+private:
+    void Populate() const {
+        if (populated)
+            return;
+        populated = true;
 
-        if (entry.first.child_file != ROMFS_ENTRY_EMPTY) {
-            ProcessFile(file, file_offset, data_offset, entry.first.child_file, current);
-        }
+        const auto this_entry = GetEntry<DirectoryEntry>(file, dir_offset + this_dir_offset);
 
-        if (entry.first.child_dir != ROMFS_ENTRY_EMPTY) {
-            ProcessDirectory(file, dir_offset, file_offset, data_offset, entry.first.child_dir,
-                             current);
+        u32 child_file_offset = this_entry.first.child_file;
+        while (child_file_offset != ROMFS_ENTRY_EMPTY) {
+            const auto entry = GetEntry<FileEntry>(file, file_offset + child_file_offset);
+            files.push_back(std::make_shared<OffsetVfsFile>(
+                file, entry.first.size, entry.first.offset + data_offset, entry.second));
+            child_file_offset = entry.first.sibling;
         }
 
-        parent->AddDirectory(current);
-        if (entry.first.sibling == ROMFS_ENTRY_EMPTY)
-            break;
-        this_dir_offset = entry.first.sibling;
+        u32 child_dir_offset = this_entry.first.child_dir;
+        while (child_dir_offset != ROMFS_ENTRY_EMPTY) {
+            const auto entry = GetEntry<DirectoryEntry>(file, dir_offset + child_dir_offset);
+            dirs.push_back(std::make_shared<RomFSVfsDirectory>(
+                file, dir_offset, file_offset, data_offset, child_dir_offset, entry.second));
+            child_dir_offset = entry.first.sibling;
+        }
     }
-}
+
+    VirtualFile file;
+    std::size_t dir_offset;
+    std::size_t file_offset;
+    std::size_t data_offset;
+    u32 this_dir_offset;
+    std::string name;
+    VirtualDir parent;
+
+    mutable std::vector<VirtualFile> files;
+    mutable std::vector<VirtualDir> dirs;
+    mutable bool populated = false;
+};
 
 VirtualDir ExtractRomFS(VirtualFile file, RomFSExtractionType type) {
     RomFSHeader header{};
@@ -111,13 +139,9 @@ VirtualDir ExtractRomFS(VirtualFile file, RomFSExtractionType type) {
     const u64 file_offset = header.file_meta.offset;
     const u64 dir_offset = header.directory_meta.offset + 4;
 
-    auto root =
-        std::make_shared<VectorVfsDirectory>(std::vector<VirtualFile>{}, std::vector<VirtualDir>{},
-                                             file->GetName(), file->GetContainingDirectory());
-
-    ProcessDirectory(file, dir_offset, file_offset, header.data_offset, 0, root);
-
-    VirtualDir out = std::move(root);
+    VirtualDir out = std::make_shared<RomFSVfsDirectory>(file, dir_offset, file_offset,
+                                                         header.data_offset, 0, file->GetName(),
+                                                         file->GetContainingDirectory());
 
     while (out->GetSubdirectories().size() == 1 && out->GetFiles().empty()) {
         if (out->GetSubdirectories().front()->GetName() == "data" &&
@@ -12,13 +12,15 @@
 #include "core/file_sys/patch_manager.h"
 #include "core/file_sys/registered_cache.h"
 #include "core/file_sys/romfs_factory.h"
+#include "core/file_sys/vfs_prefetch.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
 
 namespace FileSys {
 
-RomFSFactory::RomFSFactory(Loader::AppLoader& app_loader) {
+RomFSFactory::RomFSFactory(Loader::AppLoader& app_loader)
+    : prefetch_cache(std::make_shared<VfsPrefetchCache>()) {
     // Load the RomFS from the app
     if (app_loader.ReadRomFS(file) != Loader::ResultStatus::Success) {
         LOG_ERROR(Service_FS, "Unable to read RomFS!");
@@ -34,13 +36,19 @@ void RomFSFactory::SetPackedUpdate(VirtualFile update_raw) {
     this->update_raw = std::move(update_raw);
 }
 
+VirtualFile RomFSFactory::WrapWithPrefetch(VirtualFile romfs) const {
+    if (romfs == nullptr)
+        return nullptr;
+    return std::make_shared<PrefetchVfsFile>(std::move(romfs), prefetch_cache);
+}
+
 ResultVal<VirtualFile> RomFSFactory::OpenCurrentProcess() {
     if (!updatable)
-        return MakeResult<VirtualFile>(file);
+        return MakeResult<VirtualFile>(WrapWithPrefetch(file));
 
     const PatchManager patch_manager(Core::CurrentProcess()->GetTitleID());
-    return MakeResult<VirtualFile>(
-        patch_manager.PatchRomFS(file, ivfc_offset, ContentRecordType::Program, update_raw));
+    return MakeResult<VirtualFile>(WrapWithPrefetch(
+        patch_manager.PatchRomFS(file, ivfc_offset, ContentRecordType::Program, update_raw)));
 }
 
 ResultVal<VirtualFile> RomFSFactory::Open(u64 title_id, StorageId storage, ContentRecordType type) {
@@ -72,7 +80,7 @@ ResultVal<VirtualFile> RomFSFactory::Open(u64 title_id, StorageId storage, Conte
         // TODO(DarkLordZach): Find the right error code to use here
         return ResultCode(-1);
     }
-    return MakeResult<VirtualFile>(romfs);
+    return MakeResult<VirtualFile>(WrapWithPrefetch(romfs));
 }
 
 } // namespace FileSys
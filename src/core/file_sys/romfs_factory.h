@@ -15,6 +15,8 @@ class AppLoader;
 
 namespace FileSys {
 
+class VfsPrefetchCache;
+
 enum class ContentRecordType : u8;
 
 enum class StorageId : u8 {
@@ -37,10 +39,15 @@ public:
     ResultVal<VirtualFile> Open(u64 title_id, StorageId storage, ContentRecordType type);
 
 private:
+    // Wraps the RomFS in the readahead layer, so sequential asset streams are served out of the
+    // shared page cache instead of hitting backing storage per read.
+    VirtualFile WrapWithPrefetch(VirtualFile romfs) const;
+
     VirtualFile file;
     VirtualFile update_raw;
     bool updatable;
     u64 ivfc_offset;
+    std::shared_ptr<VfsPrefetchCache> prefetch_cache;
 };
 
 } // namespace FileSys
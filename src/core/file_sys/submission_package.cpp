@@ -4,7 +4,9 @@
 
 #include <algorithm>
 #include <cstring>
+#include <future>
 #include <string_view>
+#include <utility>
 
 #include <fmt/ostream.h>
 
@@ -241,9 +243,14 @@ void NSP::ReadNCAs(const std::vector<VirtualFile>& files) {
             auto& ncas_title = ncas[cnmt.GetTitleID()];
 
             ncas_title[ContentRecordType::Meta] = nca;
+
+            // Each record's NCA (and in particular its header decryption) is independent of the
+            // others, so construct them in parallel and collect the results afterwards.
+            std::vector<std::pair<ContentRecordType, std::future<std::shared_ptr<NCA>>>>
+                nca_futures;
             for (const auto& rec : cnmt.GetContentRecords()) {
                 const auto id_string = Common::HexArrayToString(rec.nca_id, false);
-                const auto next_file = pfs->GetFile(fmt::format("{}.nca", id_string));
+                auto next_file = pfs->GetFile(fmt::format("{}.nca", id_string));
                 if (next_file == nullptr) {
                     LOG_WARNING(Service_FS,
                                 "NCA with ID {}.nca is listed in content metadata, but cannot "
@@ -252,13 +259,21 @@ void NSP::ReadNCAs(const std::vector<VirtualFile>& files) {
                     continue;
                 }
 
-                auto next_nca = std::make_shared<NCA>(next_file, nullptr, 0, keys);
+                nca_futures.emplace_back(
+                    rec.type,
+                    std::async(std::launch::async, [next_file = std::move(next_file), this] {
+                        return std::make_shared<NCA>(next_file, nullptr, 0, keys);
+                    }));
+            }
+
+            for (auto& [rec_type, future] : nca_futures) {
+                auto next_nca = future.get();
                 if (next_nca->GetType() == NCAContentType::Program)
                     program_status[cnmt.GetTitleID()] = next_nca->GetStatus();
                 if (next_nca->GetStatus() == Loader::ResultStatus::Success ||
                     (next_nca->GetStatus() == Loader::ResultStatus::ErrorMissingBKTRBaseRomFS &&
                      (cnmt.GetTitleID() & 0x800) != 0)) {
-                    ncas_title[rec.type] = std::move(next_nca);
+                    ncas_title[rec_type] = std::move(next_nca);
                 }
             }
 
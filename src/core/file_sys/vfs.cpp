@@ -3,11 +3,15 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <atomic>
 #include <numeric>
 #include <string>
+#include <thread>
 #include "common/common_paths.h"
 #include "common/file_util.h"
 #include "common/logging/backend.h"
+#include "common/perf_counters.h"
+#include "common/threadsafe_queue.h"
 #include "core/file_sys/mode.h"
 #include "core/file_sys/vfs.h"
 
@@ -531,6 +535,76 @@ bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t blo
     return true;
 }
 
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size) {
+    if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
+        return false;
+
+    const std::size_t file_size = src->GetSize();
+    if (file_size <= block_size)
+        return VfsRawCopy(src, dest, block_size);
+
+    if (!dest->Resize(file_size))
+        return false;
+
+    static auto& read_counter = Common::GetPerfCounter("vfs_pipelined_copy_read_bytes");
+    static auto& write_counter = Common::GetPerfCounter("vfs_pipelined_copy_write_bytes");
+
+    struct Block {
+        std::vector<u8> buffer;
+        std::size_t offset = 0;
+        std::size_t size = 0; ///< Zero marks the reader's end-of-stream sentinel
+    };
+
+    // A shallow queue bounds the copy to a few blocks of memory while still letting the read of
+    // block N+1 overlap the write of block N. Blocks cycle between the two queues, so every
+    // buffer is allocated exactly once up front.
+    constexpr std::size_t QUEUE_DEPTH = 4;
+
+    Common::SPSCQueue<Block> filled_blocks;
+    Common::SPSCQueue<Block> free_blocks;
+    for (std::size_t i = 0; i < QUEUE_DEPTH; ++i) {
+        free_blocks.Push(Block{std::vector<u8>(block_size), 0, 0});
+    }
+
+    std::atomic_bool read_failed{false};
+    std::atomic_bool write_failed{false};
+
+    std::thread reader([&] {
+        for (std::size_t offset = 0; offset < file_size && !write_failed; offset += block_size) {
+            Block block = free_blocks.PopWait();
+            const auto read_size = std::min(block_size, file_size - offset);
+            if (src->Read(block.buffer.data(), read_size, offset) != read_size) {
+                read_failed = true;
+                break;
+            }
+            read_counter.Add(read_size);
+            block.offset = offset;
+            block.size = read_size;
+            filled_blocks.Push(std::move(block));
+        }
+        filled_blocks.Push(Block{});
+    });
+
+    while (true) {
+        Block block = filled_blocks.PopWait();
+        if (block.size == 0)
+            break;
+        // Keep draining filled blocks after a failed write so the reader never blocks forever
+        // waiting for a free block.
+        if (!write_failed) {
+            if (dest->Write(block.buffer.data(), block.size, block.offset) != block.size) {
+                write_failed = true;
+            } else {
+                write_counter.Add(block.size);
+            }
+        }
+        free_blocks.Push(std::move(block));
+    }
+
+    reader.join();
+    return !read_failed && !write_failed;
+}
+
 bool VfsRawCopyD(const VirtualDir& src, const VirtualDir& dest, std::size_t block_size) {
     if (src == nullptr || dest == nullptr || !src->IsReadable() || !dest->IsWritable())
         return false;
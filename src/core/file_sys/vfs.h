@@ -302,6 +302,13 @@ bool DeepEquals(const VirtualFile& file1, const VirtualFile& file2,
 // directory of src/dest.
 bool VfsRawCopy(const VirtualFile& src, const VirtualFile& dest, std::size_t block_size = 0x1000);
 
+// Copies the raw data between two VirtualFiles like VfsRawCopy, but reads on a worker thread
+// while writing from the calling thread, with a small bounded queue of recycled blocks between
+// the two. For large files on real storage this overlaps the source reads with the destination
+// writes; files no larger than one block fall back to the plain loop.
+bool VfsPipelinedCopy(const VirtualFile& src, const VirtualFile& dest,
+                      std::size_t block_size = 0x1000);
+
 // A method that performs a similar function to VfsRawCopy above, but instead copies entire
 // directories. It suffers the same performance penalties as above and an implementation-specific
 // Copy should always be preferred.
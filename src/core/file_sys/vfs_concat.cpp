@@ -25,16 +25,22 @@ static bool VerifyConcatenationMapContinuity(const std::map<u64, VirtualFile>& m
 
 ConcatenatedVfsFile::ConcatenatedVfsFile(std::vector<VirtualFile> files_, std::string name)
     : name(std::move(name)) {
-    std::size_t next_offset = 0;
-    for (const auto& file : files_) {
-        files[next_offset] = file;
-        next_offset += file->GetSize();
+    files.reserve(files_.size());
+    u64 next_offset = 0;
+    for (auto& file : files_) {
+        const auto size = file->GetSize();
+        files.push_back({next_offset, next_offset + size, std::move(file)});
+        next_offset += size;
     }
 }
 
 ConcatenatedVfsFile::ConcatenatedVfsFile(std::map<u64, VirtualFile> files_, std::string name)
-    : files(std::move(files_)), name(std::move(name)) {
-    ASSERT(VerifyConcatenationMapContinuity(files));
+    : name(std::move(name)) {
+    ASSERT(VerifyConcatenationMapContinuity(files_));
+    files.reserve(files_.size());
+    for (auto& kv : files_) {
+        files.push_back({kv.first, kv.first + kv.second->GetSize(), std::move(kv.second)});
+    }
 }
 
 ConcatenatedVfsFile::~ConcatenatedVfsFile() = default;
@@ -79,13 +85,13 @@ std::string ConcatenatedVfsFile::GetName() const {
         return "";
     if (!name.empty())
         return name;
-    return files.begin()->second->GetName();
+    return files.front().file->GetName();
 }
 
 std::size_t ConcatenatedVfsFile::GetSize() const {
     if (files.empty())
         return 0;
-    return files.rbegin()->first + files.rbegin()->second->GetSize();
+    return files.back().end_offset;
 }
 
 bool ConcatenatedVfsFile::Resize(std::size_t new_size) {
@@ -95,7 +101,7 @@ bool ConcatenatedVfsFile::Resize(std::size_t new_size) {
 std::shared_ptr<VfsDirectory> ConcatenatedVfsFile::GetContainingDirectory() const {
     if (files.empty())
         return nullptr;
-    return files.begin()->second->GetContainingDirectory();
+    return files.front().file->GetContainingDirectory();
 }
 
 bool ConcatenatedVfsFile::IsWritable() const {
@@ -107,25 +113,42 @@ bool ConcatenatedVfsFile::IsReadable() const {
 }
 
 std::size_t ConcatenatedVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
-    auto entry = --files.end();
-    for (auto iter = files.begin(); iter != files.end(); ++iter) {
-        if (iter->first > offset) {
-            entry = --iter;
-            break;
-        }
+    if (files.empty())
+        return 0;
+
+    // Sequential readers resume in (or right after) the segment the previous read ended in, so
+    // try the hinted segment before falling back to a binary search over the sorted entries.
+    std::size_t index = last_read_segment.load(std::memory_order_relaxed);
+    if (index >= files.size() || offset < files[index].offset ||
+        offset >= files[index].end_offset) {
+        const auto it =
+            std::upper_bound(files.begin(), files.end(), offset,
+                             [](u64 off, const ConcatenationEntry& entry) {
+                                 return off < entry.offset;
+                             });
+        if (it == files.begin())
+            return 0;
+        index = static_cast<std::size_t>(std::distance(files.begin(), it)) - 1;
     }
 
-    if (entry->first + entry->second->GetSize() <= offset)
-        return 0;
+    // Fill the caller's buffer across all covered segments in one forward pass.
+    std::size_t total = 0;
+    while (total < length && index < files.size()) {
+        const auto& entry = files[index];
+        const u64 read_offset = offset + total;
+        if (read_offset >= entry.end_offset)
+            break;
 
-    const auto read_in =
-        std::min<u64>(entry->first + entry->second->GetSize() - offset, entry->second->GetSize());
-    if (length > read_in) {
-        return entry->second->Read(data, read_in, offset - entry->first) +
-               Read(data + read_in, length - read_in, offset + read_in);
+        const auto to_read = std::min<u64>(length - total, entry.end_offset - read_offset);
+        const auto read = entry.file->Read(data + total, to_read, read_offset - entry.offset);
+        total += read;
+        if (read < to_read)
+            break;
+        ++index;
     }
 
-    return entry->second->Read(data, std::min<u64>(read_in, length), offset - entry->first);
+    last_read_segment.store(std::min(index, files.size() - 1), std::memory_order_relaxed);
+    return total;
 }
 
 std::size_t ConcatenatedVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <string_view>
+#include <vector>
 #include "core/file_sys/vfs.h"
 
 namespace FileSys {
@@ -39,9 +41,20 @@ public:
     bool Rename(std::string_view name) override;
 
 private:
-    // Maps starting offset to file -- more efficient.
-    std::map<u64, VirtualFile> files;
+    // One backing file and the range of the concatenation it covers. Entries are sorted by
+    // offset and contiguous, so the segment containing an offset can be found by binary search.
+    struct ConcatenationEntry {
+        u64 offset;
+        u64 end_offset;
+        VirtualFile file;
+    };
+
+    std::vector<ConcatenationEntry> files;
     std::string name;
+
+    // Index of the segment the last read ended in. Sequential readers almost always hit this
+    // segment (or the next one) directly, skipping the binary search.
+    mutable std::atomic<std::size_t> last_read_segment{0};
 };
 
 } // namespace FileSys
@@ -0,0 +1,265 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include "core/file_sys/vfs_journal.h"
+
+namespace FileSys {
+
+VfsJournal::VfsJournal() = default;
+
+VfsJournal::~VfsJournal() {
+    // Anything the guest never got around to committing is still flushed, so that save data is not
+    // lost when the filesystem goes away (remount, emulator shutdown).
+    Commit();
+}
+
+std::shared_ptr<JournaledVfsFile> VfsJournal::Open(VirtualFile backing) {
+    const auto path = backing->GetFullPath();
+    const auto iter = files.find(path);
+    if (iter != files.end())
+        return iter->second;
+
+    auto file = std::make_shared<JournaledVfsFile>(std::move(backing));
+    files.emplace(path, file);
+    return file;
+}
+
+void VfsJournal::Drop(const std::string& path) {
+    files.erase(path);
+}
+
+void VfsJournal::DropTree(const std::string& path) {
+    for (auto iter = files.begin(); iter != files.end();) {
+        if (iter->first.rfind(path, 0) == 0)
+            iter = files.erase(iter);
+        else
+            ++iter;
+    }
+}
+
+bool VfsJournal::Commit() {
+    bool success = true;
+    for (auto& file : files)
+        success &= file.second->Flush();
+    return success;
+}
+
+JournaledVfsFile::JournaledVfsFile(VirtualFile backing_) : backing(std::move(backing_)) {}
+
+JournaledVfsFile::~JournaledVfsFile() = default;
+
+std::string JournaledVfsFile::GetName() const {
+    return backing->GetName();
+}
+
+std::size_t JournaledVfsFile::GetSize() const {
+    return staged_size.value_or(backing->GetSize());
+}
+
+bool JournaledVfsFile::Resize(std::size_t new_size) {
+    // Trim staged extents that now lie partially or entirely beyond the end of the file.
+    auto iter = extents.lower_bound(new_size);
+    if (iter != extents.begin()) {
+        const auto prev = std::prev(iter);
+        if (prev->first + prev->second.size() > new_size)
+            prev->second.resize(new_size - prev->first);
+    }
+    extents.erase(iter, extents.end());
+
+    staged_size = new_size;
+    return true;
+}
+
+std::shared_ptr<VfsDirectory> JournaledVfsFile::GetContainingDirectory() const {
+    return backing->GetContainingDirectory();
+}
+
+bool JournaledVfsFile::IsWritable() const {
+    return backing->IsWritable();
+}
+
+bool JournaledVfsFile::IsReadable() const {
+    return backing->IsReadable();
+}
+
+std::size_t JournaledVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const std::size_t size = GetSize();
+    if (offset >= size)
+        return 0;
+    length = std::min(length, size - offset);
+
+    // Backing data first; anything past the end of the backing file is zero until written.
+    const std::size_t backing_size = backing->GetSize();
+    std::memset(data, 0, length);
+    if (offset < backing_size)
+        backing->Read(data, std::min(length, backing_size - offset), offset);
+
+    // Then overlay the staged extents.
+    auto iter = extents.lower_bound(offset);
+    if (iter != extents.begin()) {
+        const auto prev = std::prev(iter);
+        if (prev->first + prev->second.size() > offset)
+            iter = prev;
+    }
+    for (; iter != extents.end() && iter->first < offset + length; ++iter) {
+        const std::size_t copy_begin = std::max(iter->first, offset);
+        const std::size_t copy_end = std::min(iter->first + iter->second.size(), offset + length);
+        std::memcpy(data + (copy_begin - offset), iter->second.data() + (copy_begin - iter->first),
+                    copy_end - copy_begin);
+    }
+
+    return length;
+}
+
+std::size_t JournaledVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    if (length == 0)
+        return 0;
+
+    // Absorb every staged extent that overlaps or touches the new write. Each absorbed extent
+    // touches the accumulated range, so the union is contiguous.
+    std::size_t begin = offset;
+    std::size_t end = offset + length;
+
+    auto first = extents.lower_bound(begin);
+    if (first != extents.begin()) {
+        const auto prev = std::prev(first);
+        if (prev->first + prev->second.size() >= begin)
+            first = prev;
+    }
+
+    auto last = first;
+    while (last != extents.end() && last->first <= end) {
+        begin = std::min(begin, last->first);
+        end = std::max(end, last->first + last->second.size());
+        ++last;
+    }
+
+    std::vector<u8> merged(end - begin);
+    for (auto iter = first; iter != last; ++iter)
+        std::memcpy(merged.data() + (iter->first - begin), iter->second.data(),
+                    iter->second.size());
+    std::memcpy(merged.data() + (offset - begin), data, length);
+
+    extents.erase(first, last);
+    extents.emplace(begin, std::move(merged));
+
+    staged_size = std::max(GetSize(), offset + length);
+    return length;
+}
+
+bool JournaledVfsFile::Rename(std::string_view name) {
+    return backing->Rename(name);
+}
+
+bool JournaledVfsFile::Flush() {
+    if (!staged_size && extents.empty())
+        return true;
+
+    bool success = true;
+    if (staged_size && *staged_size != backing->GetSize())
+        success &= backing->Resize(*staged_size);
+
+    // Only the dirty ranges hit the backing file; clean data in between is never rewritten.
+    for (const auto& extent : extents)
+        success &= backing->Write(extent.second.data(), extent.second.size(), extent.first) ==
+                   extent.second.size();
+
+    extents.clear();
+    staged_size.reset();
+    return success;
+}
+
+JournaledVfsDirectory::JournaledVfsDirectory(VirtualDir backing_,
+                                             std::shared_ptr<VfsJournal> journal_)
+    : backing(std::move(backing_)), journal(std::move(journal_)) {}
+
+JournaledVfsDirectory::~JournaledVfsDirectory() = default;
+
+std::shared_ptr<VfsFile> JournaledVfsDirectory::GetFile(std::string_view name) const {
+    auto file = backing->GetFile(name);
+    if (file == nullptr)
+        return nullptr;
+    return journal->Open(std::move(file));
+}
+
+std::shared_ptr<VfsDirectory> JournaledVfsDirectory::GetSubdirectory(std::string_view name) const {
+    auto dir = backing->GetSubdirectory(name);
+    if (dir == nullptr)
+        return nullptr;
+    return std::make_shared<JournaledVfsDirectory>(std::move(dir), journal);
+}
+
+std::vector<std::shared_ptr<VfsFile>> JournaledVfsDirectory::GetFiles() const {
+    std::vector<std::shared_ptr<VfsFile>> out;
+    for (auto& file : backing->GetFiles())
+        out.emplace_back(journal->Open(std::move(file)));
+    return out;
+}
+
+std::vector<std::shared_ptr<VfsDirectory>> JournaledVfsDirectory::GetSubdirectories() const {
+    std::vector<std::shared_ptr<VfsDirectory>> out;
+    for (auto& dir : backing->GetSubdirectories())
+        out.emplace_back(std::make_shared<JournaledVfsDirectory>(std::move(dir), journal));
+    return out;
+}
+
+bool JournaledVfsDirectory::IsWritable() const {
+    return backing->IsWritable();
+}
+
+bool JournaledVfsDirectory::IsReadable() const {
+    return backing->IsReadable();
+}
+
+std::string JournaledVfsDirectory::GetName() const {
+    return backing->GetName();
+}
+
+std::shared_ptr<VfsDirectory> JournaledVfsDirectory::GetParentDirectory() const {
+    auto parent = backing->GetParentDirectory();
+    if (parent == nullptr)
+        return nullptr;
+    return std::make_shared<JournaledVfsDirectory>(std::move(parent), journal);
+}
+
+std::shared_ptr<VfsDirectory> JournaledVfsDirectory::CreateSubdirectory(std::string_view name) {
+    auto dir = backing->CreateSubdirectory(name);
+    if (dir == nullptr)
+        return nullptr;
+    return std::make_shared<JournaledVfsDirectory>(std::move(dir), journal);
+}
+
+std::shared_ptr<VfsFile> JournaledVfsDirectory::CreateFile(std::string_view name) {
+    auto file = backing->CreateFile(name);
+    if (file == nullptr)
+        return nullptr;
+    return journal->Open(std::move(file));
+}
+
+bool JournaledVfsDirectory::DeleteSubdirectory(std::string_view name) {
+    journal->DropTree(backing->GetFullPath() + '/' + std::string(name));
+    return backing->DeleteSubdirectory(name);
+}
+
+bool JournaledVfsDirectory::DeleteFile(std::string_view name) {
+    journal->Drop(backing->GetFullPath() + '/' + std::string(name));
+    return backing->DeleteFile(name);
+}
+
+bool JournaledVfsDirectory::Rename(std::string_view name) {
+    return backing->Rename(name);
+}
+
+std::string JournaledVfsDirectory::GetFullPath() const {
+    return backing->GetFullPath();
+}
+
+std::map<std::string, VfsEntryType, std::less<>> JournaledVfsDirectory::GetEntries() const {
+    return backing->GetEntries();
+}
+
+} // namespace FileSys
@@ -0,0 +1,101 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+class JournaledVfsFile;
+
+// Tracks every file opened through a journaled directory tree, so that all staged writes can be
+// flushed together when the guest commits the filesystem. Files are shared by path, meaning two
+// opens of the same file observe each other's uncommitted writes.
+class VfsJournal {
+public:
+    VfsJournal();
+    ~VfsJournal();
+
+    // Returns the journaled file for the backing file, creating and registering it on first open.
+    std::shared_ptr<JournaledVfsFile> Open(VirtualFile backing);
+
+    // Discards the staged state of the file or directory tree at the given path, used when the
+    // guest deletes it before committing.
+    void Drop(const std::string& path);
+    void DropTree(const std::string& path);
+
+    // Flushes the staged writes of every open file. Returns true if all flushes succeeded.
+    bool Commit();
+
+private:
+    std::map<std::string, std::shared_ptr<JournaledVfsFile>> files;
+};
+
+// Stages all writes to the backing file in memory as extents. Nothing touches the host filesystem
+// until Flush() - driven by a filesystem commit - writes out only the dirty ranges, so a commit
+// costs one write per modified extent rather than a rewrite of every touched file.
+class JournaledVfsFile : public VfsFile {
+public:
+    explicit JournaledVfsFile(VirtualFile backing);
+    ~JournaledVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+
+    // Applies the staged extents and size change to the backing file and clears the journal.
+    bool Flush();
+
+private:
+    VirtualFile backing;
+
+    // Dirty ranges keyed by offset. Overlapping and adjacent writes are merged when staged, so the
+    // extents are always disjoint with clean data in between.
+    std::map<std::size_t, std::vector<u8>> extents;
+
+    // Size after the staged writes have been applied; empty while the file is clean.
+    std::optional<std::size_t> staged_size;
+};
+
+// Forwards to a backing directory, wrapping every file it hands out in a JournaledVfsFile from the
+// shared journal. Subdirectories share the same journal, so one commit flushes the whole tree.
+class JournaledVfsDirectory : public VfsDirectory {
+public:
+    JournaledVfsDirectory(VirtualDir backing, std::shared_ptr<VfsJournal> journal);
+    ~JournaledVfsDirectory() override;
+
+    std::shared_ptr<VfsFile> GetFile(std::string_view name) const override;
+    std::shared_ptr<VfsDirectory> GetSubdirectory(std::string_view name) const override;
+    std::vector<std::shared_ptr<VfsFile>> GetFiles() const override;
+    std::vector<std::shared_ptr<VfsDirectory>> GetSubdirectories() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::string GetName() const override;
+    std::shared_ptr<VfsDirectory> GetParentDirectory() const override;
+    std::shared_ptr<VfsDirectory> CreateSubdirectory(std::string_view name) override;
+    std::shared_ptr<VfsFile> CreateFile(std::string_view name) override;
+    bool DeleteSubdirectory(std::string_view name) override;
+    bool DeleteFile(std::string_view name) override;
+    bool Rename(std::string_view name) override;
+    std::string GetFullPath() const override;
+    std::map<std::string, VfsEntryType, std::less<>> GetEntries() const override;
+
+private:
+    VirtualDir backing;
+    std::shared_ptr<VfsJournal> journal;
+};
+
+} // namespace FileSys
@@ -0,0 +1,134 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "core/file_sys/vfs_overlay.h"
+
+namespace FileSys {
+
+OverlayVfsFile::OverlayVfsFile(VirtualFile base_, std::map<u64, std::vector<u8>> extents_,
+                               std::string name_, VirtualDir parent_)
+    : base(std::move(base_)), extents(std::move(extents_)), name(std::move(name_)),
+      parent(std::move(parent_)) {}
+
+OverlayVfsFile::~OverlayVfsFile() = default;
+
+void OverlayVfsFile::AddExtent(std::map<u64, std::vector<u8>>& extents, u64 offset, const u8* data,
+                               std::size_t size) {
+    if (size == 0)
+        return;
+
+    const u64 end = offset + size;
+
+    // An earlier extent reaching into the painted range is trimmed; if it extends past the range
+    // it is split and its tail is reinserted behind the new bytes.
+    auto it = extents.lower_bound(offset);
+    if (it != extents.begin()) {
+        auto prev = std::prev(it);
+        const u64 prev_end = prev->first + prev->second.size();
+        if (prev_end > offset) {
+            if (prev_end > end) {
+                extents.emplace(end, std::vector<u8>(prev->second.begin() + (end - prev->first),
+                                                     prev->second.end()));
+            }
+            prev->second.resize(static_cast<std::size_t>(offset - prev->first));
+        }
+    }
+
+    // Extents starting inside the painted range are either swallowed whole or have their
+    // overlapped head cut off.
+    while (it != extents.end() && it->first < end) {
+        const u64 it_end = it->first + it->second.size();
+        if (it_end > end) {
+            extents.emplace(end,
+                            std::vector<u8>(it->second.begin() + (end - it->first),
+                                            it->second.end()));
+        }
+        it = extents.erase(it);
+    }
+
+    // Grow a directly adjacent predecessor instead of inserting, so runs of touching records
+    // coalesce into one extent; otherwise insert and pull in a directly adjacent successor.
+    auto inserted = extents.end();
+    if (!extents.empty()) {
+        auto prev = extents.lower_bound(offset);
+        if (prev != extents.begin() && std::prev(prev)->first + std::prev(prev)->second.size() ==
+                                           offset) {
+            inserted = std::prev(prev);
+            inserted->second.insert(inserted->second.end(), data, data + size);
+        }
+    }
+    if (inserted == extents.end()) {
+        inserted = extents.emplace(offset, std::vector<u8>(data, data + size)).first;
+    }
+
+    const auto next = std::next(inserted);
+    if (next != extents.end() && inserted->first + inserted->second.size() == next->first) {
+        inserted->second.insert(inserted->second.end(), next->second.begin(), next->second.end());
+        extents.erase(next);
+    }
+}
+
+std::string OverlayVfsFile::GetName() const {
+    return name;
+}
+
+std::size_t OverlayVfsFile::GetSize() const {
+    return base->GetSize();
+}
+
+bool OverlayVfsFile::Resize(std::size_t new_size) {
+    return false;
+}
+
+std::shared_ptr<VfsDirectory> OverlayVfsFile::GetContainingDirectory() const {
+    return parent;
+}
+
+bool OverlayVfsFile::IsWritable() const {
+    return false;
+}
+
+bool OverlayVfsFile::IsReadable() const {
+    return true;
+}
+
+std::size_t OverlayVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const auto read = base->Read(data, length, offset);
+    if (read == 0 || extents.empty())
+        return read;
+
+    const u64 read_end = offset + read;
+
+    // Find the first extent that may reach into [offset, read_end) and copy the overlapping
+    // portion of every extent over the base bytes.
+    auto it = extents.lower_bound(offset);
+    if (it != extents.begin() &&
+        std::prev(it)->first + std::prev(it)->second.size() > offset) {
+        --it;
+    }
+
+    for (; it != extents.end() && it->first < read_end; ++it) {
+        const u64 copy_begin = std::max<u64>(it->first, offset);
+        const u64 copy_end = std::min<u64>(it->first + it->second.size(), read_end);
+        std::memcpy(data + (copy_begin - offset), it->second.data() + (copy_begin - it->first),
+                    static_cast<std::size_t>(copy_end - copy_begin));
+    }
+
+    return read;
+}
+
+std::size_t OverlayVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    return 0;
+}
+
+bool OverlayVfsFile::Rename(std::string_view name_) {
+    name = name_;
+    return true;
+}
+
+} // namespace FileSys
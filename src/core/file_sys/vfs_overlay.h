@@ -0,0 +1,47 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <map>
+#include <vector>
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+// An implementation of VfsFile that serves a backing file with a sorted set of small replacement
+// extents overlaid on top. Reads fall through to the backing file and only the patched ranges are
+// copied over, so constructing a patched view of a file costs memory proportional to the patch
+// data rather than to the file.
+class OverlayVfsFile : public VfsFile {
+public:
+    /// The extent map must be sorted and non-overlapping; build it with AddExtent.
+    OverlayVfsFile(VirtualFile base, std::map<u64, std::vector<u8>> extents, std::string name,
+                   VirtualDir parent);
+    ~OverlayVfsFile() override;
+
+    /// Paints [offset, offset + size) with the given bytes, trimming, splitting and coalescing
+    /// the existing extents so the map stays sorted and non-overlapping. Later additions
+    /// overwrite earlier ones, matching sequential patch record application.
+    static void AddExtent(std::map<u64, std::vector<u8>>& extents, u64 offset, const u8* data,
+                          std::size_t size);
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+
+private:
+    VirtualFile base;
+    std::map<u64, std::vector<u8>> extents;
+    std::string name;
+    VirtualDir parent;
+};
+
+} // namespace FileSys
@@ -0,0 +1,213 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <cstring>
+#include "common/logging/log.h"
+#include "core/file_sys/vfs_prefetch.h"
+
+namespace FileSys {
+
+VfsPrefetchCache::VfsPrefetchCache(std::size_t max_pages_) : max_pages(max_pages_) {
+    worker = std::thread(&VfsPrefetchCache::RunWorker, this);
+}
+
+VfsPrefetchCache::~VfsPrefetchCache() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        shutdown = true;
+    }
+    request_cv.notify_all();
+    worker.join();
+}
+
+u64 VfsPrefetchCache::RegisterFile() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return next_file_id++;
+}
+
+std::size_t VfsPrefetchCache::ReadPage(u64 file_id, const VirtualFile& backing, u64 page, u8* out,
+                                       std::size_t out_length, std::size_t page_offset) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const PageKey key{file_id, page};
+    auto iter = pages.find(key);
+    if (iter != pages.end()) {
+        // Keep the LRU order current on every hit.
+        lru.splice(lru.begin(), lru, iter->second.lru_iter);
+        ++stats[file_id].hits;
+    } else {
+        ++stats[file_id].misses;
+    }
+
+    const Page& entry = iter != pages.end() ? iter->second : InsertPage(key, backing);
+    if (page_offset >= entry.data.size())
+        return 0;
+
+    const std::size_t copy = std::min(out_length, entry.data.size() - page_offset);
+    std::memcpy(out, entry.data.data() + page_offset, copy);
+    return copy;
+}
+
+void VfsPrefetchCache::QueueReadahead(u64 file_id, VirtualFile backing, u64 first_page,
+                                      u64 count) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (shutdown)
+            return;
+        requests.push_back({file_id, std::move(backing), first_page, count});
+    }
+    request_cv.notify_one();
+}
+
+VfsPrefetchCache::Stats VfsPrefetchCache::GetStats(u64 file_id) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto iter = stats.find(file_id);
+    return iter != stats.end() ? iter->second : Stats{};
+}
+
+VfsPrefetchCache::Page& VfsPrefetchCache::InsertPage(const PageKey& key,
+                                                     const VirtualFile& backing) {
+    std::vector<u8> data(PageSize);
+    data.resize(backing->Read(data.data(), PageSize, key.second * PageSize));
+    return EmplacePage(key, std::move(data));
+}
+
+VfsPrefetchCache::Page& VfsPrefetchCache::EmplacePage(const PageKey& key, std::vector<u8> data) {
+    while (pages.size() >= max_pages) {
+        pages.erase(lru.back());
+        lru.pop_back();
+    }
+
+    Page page{};
+    page.data = std::move(data);
+    lru.push_front(key);
+    page.lru_iter = lru.begin();
+    return pages.emplace(key, std::move(page)).first->second;
+}
+
+void VfsPrefetchCache::RunWorker() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        request_cv.wait(lock, [this] { return shutdown || !requests.empty(); });
+        if (shutdown)
+            return;
+
+        const ReadaheadRequest request = std::move(requests.front());
+        requests.pop_front();
+
+        for (u64 page = request.first_page; page < request.first_page + request.count; ++page) {
+            const PageKey key{request.file_id, page};
+            if (pages.find(key) != pages.end())
+                continue;
+            if (page * PageSize >= request.backing->GetSize())
+                break;
+
+            // The backing read happens without the lock held, so cache hits on the foreground
+            // threads are not stalled behind slow storage.
+            lock.unlock();
+            std::vector<u8> data(PageSize);
+            data.resize(request.backing->Read(data.data(), PageSize, page * PageSize));
+            lock.lock();
+
+            if (shutdown)
+                return;
+            if (pages.find(key) == pages.end())
+                EmplacePage(key, std::move(data));
+        }
+    }
+}
+
+PrefetchVfsFile::PrefetchVfsFile(VirtualFile backing_, std::shared_ptr<VfsPrefetchCache> cache_)
+    : backing(std::move(backing_)), cache(std::move(cache_)), file_id(cache->RegisterFile()) {}
+
+PrefetchVfsFile::~PrefetchVfsFile() {
+    const auto stats = cache->GetStats(file_id);
+    if (stats.hits + stats.misses > 0) {
+        LOG_DEBUG(Service_FS, "Prefetch stats for {}: {} hits, {} misses ({}% hit rate)",
+                  GetName(), stats.hits, stats.misses,
+                  stats.hits * 100 / (stats.hits + stats.misses));
+    }
+}
+
+std::string PrefetchVfsFile::GetName() const {
+    return backing->GetName();
+}
+
+std::size_t PrefetchVfsFile::GetSize() const {
+    return backing->GetSize();
+}
+
+bool PrefetchVfsFile::Resize(std::size_t new_size) {
+    return backing->Resize(new_size);
+}
+
+std::shared_ptr<VfsDirectory> PrefetchVfsFile::GetContainingDirectory() const {
+    return backing->GetContainingDirectory();
+}
+
+bool PrefetchVfsFile::IsWritable() const {
+    return backing->IsWritable();
+}
+
+bool PrefetchVfsFile::IsReadable() const {
+    return backing->IsReadable();
+}
+
+std::size_t PrefetchVfsFile::Read(u8* data, std::size_t length, std::size_t offset) const {
+    const std::size_t size = backing->GetSize();
+    if (offset >= size)
+        return 0;
+    length = std::min(length, size - offset);
+
+    std::size_t read = 0;
+    while (read < length) {
+        constexpr std::size_t page_size = VfsPrefetchCache::PageSize;
+        const u64 page = (offset + read) / page_size;
+        const std::size_t page_offset = (offset + read) % page_size;
+        const std::size_t copy = std::min(length - read, page_size - page_offset);
+        if (cache->ReadPage(file_id, backing, page, data + read, copy, page_offset) != copy)
+            break;
+        read += copy;
+    }
+
+    UpdatePattern(offset, length);
+    return read;
+}
+
+std::size_t PrefetchVfsFile::Write(const u8* data, std::size_t length, std::size_t offset) {
+    // RomFS mounts are read-only in practice; a write would make cached pages stale, so it is
+    // passed through untouched and the affected pages are simply not served again.
+    return backing->Write(data, length, offset);
+}
+
+bool PrefetchVfsFile::Rename(std::string_view name) {
+    return backing->Rename(name);
+}
+
+void PrefetchVfsFile::UpdatePattern(std::size_t offset, std::size_t length) const {
+    const s64 stride = static_cast<s64>(offset) - static_cast<s64>(last_offset);
+    const bool sequential = offset == last_offset + last_length;
+
+    if (sequential || (stride != 0 && stride == last_stride)) {
+        if (++stream_length >= StreamThreshold) {
+            // Predict where the stream touches next and pull those pages in ahead of it.
+            const s64 next = sequential ? static_cast<s64>(offset + length)
+                                        : static_cast<s64>(offset) + stride;
+            if (next >= 0) {
+                cache->QueueReadahead(file_id, backing,
+                                      static_cast<u64>(next) / VfsPrefetchCache::PageSize,
+                                      ReadaheadPages);
+            }
+        }
+    } else {
+        stream_length = 0;
+    }
+
+    last_stride = stride;
+    last_offset = offset;
+    last_length = length;
+}
+
+} // namespace FileSys
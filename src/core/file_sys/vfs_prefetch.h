@@ -0,0 +1,122 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include "core/file_sys/vfs.h"
+
+namespace FileSys {
+
+// Page cache shared by all files mounted through the same factory, filled synchronously on cache
+// misses and asynchronously by the readahead worker. Pages are evicted least-recently-used once
+// the cache is full.
+class VfsPrefetchCache {
+public:
+    static constexpr std::size_t PageSize = 0x10000;
+
+    struct Stats {
+        u64 hits = 0;
+        u64 misses = 0;
+    };
+
+    explicit VfsPrefetchCache(std::size_t max_pages = 0x400);
+    ~VfsPrefetchCache();
+
+    // Assigns an id under which a file's pages and stats are tracked.
+    u64 RegisterFile();
+
+    // Copies out_length bytes starting at page_offset within the given page, reading the page
+    // from the backing file on a miss. Returns the number of bytes copied.
+    std::size_t ReadPage(u64 file_id, const VirtualFile& backing, u64 page, u8* out,
+                         std::size_t out_length, std::size_t page_offset);
+
+    // Asks the background worker to pull the given page range into the cache.
+    void QueueReadahead(u64 file_id, VirtualFile backing, u64 first_page, u64 count);
+
+    Stats GetStats(u64 file_id) const;
+
+private:
+    using PageKey = std::pair<u64, u64>;
+
+    struct Page {
+        std::vector<u8> data;
+        std::list<PageKey>::iterator lru_iter;
+    };
+
+    struct ReadaheadRequest {
+        u64 file_id;
+        VirtualFile backing;
+        u64 first_page;
+        u64 count;
+    };
+
+    // Reads the page from the backing file and inserts it. Must be called with the lock held.
+    Page& InsertPage(const PageKey& key, const VirtualFile& backing);
+
+    // Inserts already-read page data, evicting the least-recently-used page when the cache is
+    // full. Must be called with the lock held.
+    Page& EmplacePage(const PageKey& key, std::vector<u8> data);
+
+    void RunWorker();
+
+    std::size_t max_pages;
+    u64 next_file_id = 0;
+
+    mutable std::mutex mutex;
+    std::map<PageKey, Page> pages;
+    std::list<PageKey> lru;
+    std::map<u64, Stats> stats;
+
+    std::deque<ReadaheadRequest> requests;
+    std::condition_variable request_cv;
+    bool shutdown = false;
+    std::thread worker;
+};
+
+// Wraps a backing file and watches the offsets a handle reads at. Once a sequential or constant-
+// stride stream is recognized, the pages the stream is about to touch are read ahead on the cache
+// worker, so large on-demand streams no longer pay backing storage latency per read.
+class PrefetchVfsFile : public VfsFile {
+public:
+    PrefetchVfsFile(VirtualFile backing, std::shared_ptr<VfsPrefetchCache> cache);
+    ~PrefetchVfsFile() override;
+
+    std::string GetName() const override;
+    std::size_t GetSize() const override;
+    bool Resize(std::size_t new_size) override;
+    std::shared_ptr<VfsDirectory> GetContainingDirectory() const override;
+    bool IsWritable() const override;
+    bool IsReadable() const override;
+    std::size_t Read(u8* data, std::size_t length, std::size_t offset) const override;
+    std::size_t Write(const u8* data, std::size_t length, std::size_t offset) override;
+    bool Rename(std::string_view name) override;
+
+private:
+    // Number of consecutive reads that must follow a pattern before readahead kicks in.
+    static constexpr int StreamThreshold = 2;
+    // Number of pages pulled in ahead of a recognized stream.
+    static constexpr u64 ReadaheadPages = 4;
+
+    void UpdatePattern(std::size_t offset, std::size_t length) const;
+
+    VirtualFile backing;
+    std::shared_ptr<VfsPrefetchCache> cache;
+    u64 file_id;
+
+    // Per-handle access pattern state.
+    mutable std::size_t last_offset = 0;
+    mutable std::size_t last_length = 0;
+    mutable s64 last_stride = 0;
+    mutable int stream_length = 0;
+};
+
+} // namespace FileSys
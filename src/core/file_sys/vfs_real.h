@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <string_view>
 #include <boost/container/flat_map.hpp>
 #include "core/file_sys/mode.h"
@@ -63,6 +64,10 @@ private:
 
     bool Close();
 
+    // Lazily maps the file into memory. Returns nullptr when the file is writable, empty or the
+    // platform refused the mapping; Read() then falls back to the backing IOFile.
+    const u8* GetMappedData() const;
+
     RealVfsFilesystem& base;
     std::shared_ptr<FileUtil::IOFile> backing;
     std::string path;
@@ -70,6 +75,12 @@ private:
     std::vector<std::string> path_components;
     std::vector<std::string> parent_components;
     Mode perms;
+    mutable u8* mapped_data = nullptr;
+    mutable std::size_t mapped_size = 0;
+    mutable bool mapping_failed = false;
+    /// Serializes the lazy mapping setup and the seek+read fallback so that multiple threads can
+    /// read the same file concurrently. Mapped reads do not take this lock.
+    mutable std::mutex backing_mutex;
 };
 
 // An implementation of VfsDirectory that represents a directory on the user's computer.
@@ -0,0 +1,34 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <mutex>
+#include <unordered_map>
+#include "core/frontend/input.h"
+
+namespace Input::Impl {
+
+namespace {
+std::mutex binding_cache_mutex;
+
+// Keyed by the serialized form the settings store. Config strings are few and reused heavily
+// (one per mapped button/analog), so the cache stays small and never needs eviction; node-based
+// storage keeps references valid across later insertions.
+std::unordered_map<std::string, ResolvedBinding> binding_cache;
+} // Anonymous namespace
+
+const ResolvedBinding& ResolveBinding(const std::string& params) {
+    std::lock_guard<std::mutex> lock{binding_cache_mutex};
+
+    const auto iter = binding_cache.find(params);
+    if (iter != binding_cache.end()) {
+        return iter->second;
+    }
+
+    ResolvedBinding binding;
+    binding.package = Common::ParamPackage(params);
+    binding.engine = binding.package.Get("engine", "null");
+    return binding_cache.emplace(params, std::move(binding)).first->second;
+}
+
+} // namespace Input::Impl
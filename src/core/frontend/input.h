@@ -46,6 +46,20 @@ struct FactoryList {
 template <typename InputDeviceType>
 FactoryListType<InputDeviceType> FactoryList<InputDeviceType>::list;
 
+/// A binding resolved once from its serialized form and reused for every device created from it.
+struct ResolvedBinding {
+    Common::ParamPackage package;
+    std::string engine;
+};
+
+/**
+ * Returns the cached parse of a serialized param package, parsing it only on first sight.
+ * Device creation happens at config apply and on controller hotplug, for every button of every
+ * player at once; resolving each distinct binding string once keeps those paths from re-splitting
+ * and unescaping the same strings over and over.
+ */
+const ResolvedBinding& ResolveBinding(const std::string& params);
+
 } // namespace Impl
 
 /**
@@ -82,17 +96,16 @@ void UnregisterFactory(const std::string& name) {
  */
 template <typename InputDeviceType>
 std::unique_ptr<InputDeviceType> CreateDevice(const std::string& params) {
-    const Common::ParamPackage package(params);
-    const std::string engine = package.Get("engine", "null");
+    const auto& binding = Impl::ResolveBinding(params);
     const auto& factory_list = Impl::FactoryList<InputDeviceType>::list;
-    const auto pair = factory_list.find(engine);
+    const auto pair = factory_list.find(binding.engine);
     if (pair == factory_list.end()) {
-        if (engine != "null") {
-            LOG_ERROR(Input, "Unknown engine name: {}", engine);
+        if (binding.engine != "null") {
+            LOG_ERROR(Input, "Unknown engine name: {}", binding.engine);
         }
         return std::make_unique<InputDeviceType>();
     }
-    return pair->second->Create(package);
+    return pair->second->Create(binding.package);
 }
 
 /**
@@ -72,10 +72,10 @@ constexpr u32 UC_ARM64_REG_Q0 = 34;
 constexpr u32 FPCR_REGISTER = 66;
 
 // For sample XML files see the GDB source /gdb/features
-// GDB also wants the l character at the start
-// This XML defines what the registers are for this specific ARM device
+// This XML defines what the registers are for this specific ARM device.
+// It is sent in qXfer-sized windows; SendXferReply adds the 'm'/'l' framing.
 constexpr char target_xml[] =
-    R"(l<?xml version="1.0"?>
+    R"(<?xml version="1.0"?>
 <!DOCTYPE target SYSTEM "gdb-target.dtd">
 <target version="1.0">
   <feature name="org.gnu.gdb.aarch64.core">
@@ -145,6 +145,14 @@ int gdbserver_socket = -1;
 u8 command_buffer[GDB_BUFFER_SIZE];
 u32 command_length;
 
+// Receive buffer so the byte-oriented packet parser doesn't cost one recv() syscall per byte.
+u8 read_buffer[GDB_BUFFER_SIZE];
+std::size_t read_buffer_pos;
+std::size_t read_buffer_len;
+
+// Set once the client negotiates QStartNoAckMode; suppresses the per-packet '+'/'-' traffic.
+bool no_ack_mode = false;
+
 u32 latest_signal = 0;
 bool memory_break = false;
 
@@ -456,16 +464,21 @@ static u128 GdbHexToU128(const u8* src) {
     return output;
 }
 
-/// Read a byte from the gdb client.
+/// Read a byte from the gdb client, refilling the receive buffer with a bulk recv() when empty.
 static u8 ReadByte() {
-    u8 c;
-    std::size_t received_size = recv(gdbserver_socket, reinterpret_cast<char*>(&c), 1, MSG_WAITALL);
-    if (received_size != 1) {
-        LOG_ERROR(Debug_GDBStub, "recv failed: {}", received_size);
-        Shutdown();
+    if (read_buffer_pos == read_buffer_len) {
+        const int received_size =
+            recv(gdbserver_socket, reinterpret_cast<char*>(read_buffer), sizeof(read_buffer), 0);
+        if (received_size <= 0) {
+            LOG_ERROR(Debug_GDBStub, "recv failed: {}", received_size);
+            Shutdown();
+            return 0;
+        }
+        read_buffer_pos = 0;
+        read_buffer_len = static_cast<std::size_t>(received_size);
     }
 
-    return c;
+    return read_buffer[read_buffer_pos++];
 }
 
 /// Calculate the checksum of the current command buffer.
@@ -619,6 +632,35 @@ static void SendReply(const char* reply) {
     }
 }
 
+/**
+ * Reply to a qXfer object read with the requested window of the object, using the
+ * 'm' (more data follows) / 'l' (last chunk) framing from the remote protocol.
+ *
+ * @param object      Full contents of the object being transferred.
+ * @param offset_spec Pointer into command_buffer at the "<offset>,<length>" suffix.
+ */
+static void SendXferReply(const std::string& object, const u8* offset_spec) {
+    const u8* const end = command_buffer + command_length;
+    const auto comma = std::find(offset_spec, end, ',');
+    if (comma == end) {
+        return SendReply("E01");
+    }
+
+    const u64 offset = HexToLong(offset_spec, static_cast<u64>(comma - offset_spec));
+    const u64 length = HexToLong(comma + 1, static_cast<u64>(end - (comma + 1)));
+
+    if (offset >= object.size()) {
+        return SendReply("l");
+    }
+
+    const u64 remaining = object.size() - offset;
+    if (length >= remaining) {
+        SendReply(('l' + object.substr(offset)).c_str());
+    } else {
+        SendReply(('m' + object.substr(offset, length)).c_str());
+    }
+}
+
 /// Handle query command from gdb client.
 static void HandleQuery() {
     LOG_DEBUG(Debug_GDBStub, "gdb: query '{}'", command_buffer + 1);
@@ -628,15 +670,16 @@ static void HandleQuery() {
     if (strcmp(query, "TStatus") == 0) {
         SendReply("T0");
     } else if (strncmp(query, "Supported", strlen("Supported")) == 0) {
-        // PacketSize needs to be large enough for target xml
-        std::string buffer = "PacketSize=2000;qXfer:features:read+;qXfer:threads:read+";
+        std::string buffer = "PacketSize=2000;qXfer:features:read+;qXfer:threads:read+;"
+                             "QStartNoAckMode+";
         if (!modules.empty()) {
             buffer += ";qXfer:libraries:read+";
         }
         SendReply(buffer.c_str());
     } else if (strncmp(query, "Xfer:features:read:target.xml:",
                        strlen("Xfer:features:read:target.xml:")) == 0) {
-        SendReply(target_xml);
+        SendXferReply(target_xml,
+                      command_buffer + 1 + strlen("Xfer:features:read:target.xml:"));
     } else if (strncmp(query, "Offsets", strlen("Offsets")) == 0) {
         const VAddr base_address = Core::CurrentProcess()->VMManager().GetCodeRegionBaseAddress();
         std::string buffer = fmt::format("TextSeg={:0x}", base_address);
@@ -653,9 +696,9 @@ static void HandleQuery() {
         SendReply(val.c_str());
     } else if (strncmp(query, "sThreadInfo", strlen("sThreadInfo")) == 0) {
         SendReply("l");
-    } else if (strncmp(query, "Xfer:threads:read", strlen("Xfer:threads:read")) == 0) {
+    } else if (strncmp(query, "Xfer:threads:read::", strlen("Xfer:threads:read::")) == 0) {
         std::string buffer;
-        buffer += "l<?xml version=\"1.0\"?>";
+        buffer += "<?xml version=\"1.0\"?>";
         buffer += "<threads>";
         for (u32 core = 0; core < Core::NUM_CPU_CORES; core++) {
             const auto& threads = Core::System::GetInstance().Scheduler(core).GetThreadList();
@@ -666,10 +709,10 @@ static void HandleQuery() {
             }
         }
         buffer += "</threads>";
-        SendReply(buffer.c_str());
-    } else if (strncmp(query, "Xfer:libraries:read", strlen("Xfer:libraries:read")) == 0) {
+        SendXferReply(buffer, command_buffer + 1 + strlen("Xfer:threads:read::"));
+    } else if (strncmp(query, "Xfer:libraries:read::", strlen("Xfer:libraries:read::")) == 0) {
         std::string buffer;
-        buffer += "l<?xml version=\"1.0\"?>";
+        buffer += "<?xml version=\"1.0\"?>";
         buffer += "<library-list>";
         for (const auto& module : modules) {
             buffer +=
@@ -677,7 +720,21 @@ static void HandleQuery() {
                             module.name, module.beg);
         }
         buffer += "</library-list>";
-        SendReply(buffer.c_str());
+        SendXferReply(buffer, command_buffer + 1 + strlen("Xfer:libraries:read::"));
+    } else {
+        SendReply("");
+    }
+}
+
+/// Handle set command ('Q' packet) from gdb client.
+static void HandleSetCommand() {
+    const char* query = reinterpret_cast<const char*>(command_buffer + 1);
+
+    if (strcmp(query, "StartNoAckMode") == 0) {
+        // This reply is still acknowledged by the client; only subsequent packets aren't.
+        SendReply("OK");
+        no_ack_mode = true;
+        LOG_DEBUG(Debug_GDBStub, "gdb: no-ack mode enabled");
     } else {
         SendReply("");
     }
@@ -789,11 +846,17 @@ static void ReadCommand() {
 
         command_length = 0;
 
-        SendPacket(GDB_STUB_NACK);
+        // In no-ack mode the transport is assumed reliable and retransmission is not available,
+        // so a corrupt packet can only be dropped.
+        if (!no_ack_mode) {
+            SendPacket(GDB_STUB_NACK);
+        }
         return;
     }
 
-    SendPacket(GDB_STUB_ACK);
+    if (!no_ack_mode) {
+        SendPacket(GDB_STUB_ACK);
+    }
 }
 
 /// Check if there is data to be read from the gdb client.
@@ -802,6 +865,11 @@ static bool IsDataAvailable() {
         return false;
     }
 
+    // The client may have pipelined several packets into one recv
+    if (read_buffer_pos < read_buffer_len) {
+        return true;
+    }
+
     fd_set fd_socket;
 
     FD_ZERO(&fd_socket);
@@ -955,6 +1023,8 @@ static void WriteRegisters() {
 /// Read location in memory specified by gdb client.
 static void ReadMemory() {
     static u8 reply[GDB_BUFFER_SIZE - 4];
+    // Reused across requests so single-stepping doesn't reallocate on every memory read
+    static std::vector<u8> data;
 
     auto start_offset = command_buffer + 1;
     const auto addr_pos = std::find(start_offset, command_buffer + command_length, ',');
@@ -966,15 +1036,15 @@ static void ReadMemory() {
 
     LOG_DEBUG(Debug_GDBStub, "gdb: addr: {:016X} len: {:016X}", addr, len);
 
-    if (len * 2 > sizeof(reply)) {
-        SendReply("E01");
+    if (len * 2 + 1 > sizeof(reply)) {
+        return SendReply("E01");
     }
 
     if (!Memory::IsValidVirtualAddress(addr)) {
         return SendReply("E00");
     }
 
-    std::vector<u8> data(len);
+    data.resize(len);
     Memory::ReadBlock(addr, data.data(), len);
 
     MemToGdbHex(reply, data.data(), len);
@@ -1176,6 +1246,9 @@ void HandlePacket() {
     case 'q':
         HandleQuery();
         break;
+    case 'Q':
+        HandleSetCommand();
+        break;
     case 'H':
         HandleSetThread();
         break;
@@ -1261,6 +1334,10 @@ static void Init(u16 port) {
     halt_loop = true;
     step_loop = false;
 
+    read_buffer_pos = 0;
+    read_buffer_len = 0;
+    no_ack_mode = false;
+
     breakpoints_execute.clear();
     breakpoints_read.clear();
     breakpoints_write.clear();
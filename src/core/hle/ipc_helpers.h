@@ -229,6 +229,9 @@ void ResponseBuilder::PushRaw(const T& value) {
 
 template <>
 inline void ResponseBuilder::Push(ResultCode value) {
+    if (context != nullptr) {
+        context->SetLastResultRaw(value.raw);
+    }
     // Result codes are actually 64-bit in the IPC buffer, but only the high part is discarded.
     Push(value.raw);
     Push<u32>(0);
@@ -326,8 +329,10 @@ public:
     template <typename T>
     Kernel::SharedPtr<T> GetCopyObject(std::size_t index);
 
+    /// Reads a domain object id and returns the object borrowed from the session's domain
+    /// handler table; it remains owned by the session and is only valid during the request.
     template <class T>
-    std::shared_ptr<T> PopIpcInterface() {
+    T* PopIpcInterface() {
         ASSERT(context->Session()->IsDomain());
         ASSERT(context->GetDomainMessageHeader()->input_object_count > 0);
         return context->GetDomainRequestHandler<T>(Pop<u32>() - 1);
@@ -3,12 +3,14 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <unordered_map>
 #include <vector>
 
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/core.h"
 #include "core/core_cpu.h"
+#include "core/hle/kernel/address_arbiter.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/object.h"
 #include "core/hle/kernel/process.h"
@@ -20,6 +22,28 @@
 namespace Kernel {
 namespace AddressArbiter {
 
+// Threads parked on each address, futex-style, so wake operations only touch the bucket for the
+// signaled address instead of scanning every thread in the system. Maintained exclusively through
+// Thread::SetArbiterWaitAddress.
+static std::unordered_map<VAddr, std::vector<SharedPtr<Thread>>> wait_buckets;
+
+void AddWaitingThread(SharedPtr<Thread> thread) {
+    wait_buckets[thread->GetArbiterWaitAddress()].push_back(std::move(thread));
+}
+
+void RemoveWaitingThread(Thread* thread) {
+    const auto bucket = wait_buckets.find(thread->GetArbiterWaitAddress());
+    if (bucket == wait_buckets.end()) {
+        return;
+    }
+
+    auto& waiters = bucket->second;
+    waiters.erase(std::remove(waiters.begin(), waiters.end(), thread), waiters.end());
+    if (waiters.empty()) {
+        wait_buckets.erase(bucket);
+    }
+}
+
 // Performs actual address waiting logic.
 static ResultCode WaitForAddress(VAddr address, s64 timeout) {
     SharedPtr<Thread> current_thread = GetCurrentThread();
@@ -35,30 +59,19 @@ static ResultCode WaitForAddress(VAddr address, s64 timeout) {
 
 // Gets the threads waiting on an address.
 static std::vector<SharedPtr<Thread>> GetThreadsWaitingOnAddress(VAddr address) {
-    const auto RetrieveWaitingThreads = [](std::size_t core_index,
-                                           std::vector<SharedPtr<Thread>>& waiting_threads,
-                                           VAddr arb_addr) {
-        const auto& scheduler = Core::System::GetInstance().Scheduler(core_index);
-        const auto& thread_list = scheduler.GetThreadList();
-
-        for (const auto& thread : thread_list) {
-            if (thread->GetArbiterWaitAddress() == arb_addr)
-                waiting_threads.push_back(thread);
-        }
-    };
+    const auto bucket = wait_buckets.find(address);
+    if (bucket == wait_buckets.end()) {
+        return {};
+    }
 
-    // Retrieve all threads that are waiting for this address.
-    std::vector<SharedPtr<Thread>> threads;
-    RetrieveWaitingThreads(0, threads, address);
-    RetrieveWaitingThreads(1, threads, address);
-    RetrieveWaitingThreads(2, threads, address);
-    RetrieveWaitingThreads(3, threads, address);
+    // Copy the bucket, as waking the threads below removes them from it.
+    std::vector<SharedPtr<Thread>> threads = bucket->second;
 
     // Sort them by priority, such that the highest priority ones come first.
-    std::sort(threads.begin(), threads.end(),
-              [](const SharedPtr<Thread>& lhs, const SharedPtr<Thread>& rhs) {
-                  return lhs->GetPriority() < rhs->GetPriority();
-              });
+    std::stable_sort(threads.begin(), threads.end(),
+                     [](const SharedPtr<Thread>& lhs, const SharedPtr<Thread>& rhs) {
+                         return lhs->GetPriority() < rhs->GetPriority();
+                     });
 
     return threads;
 }
@@ -69,7 +82,7 @@ static void WakeThreads(std::vector<SharedPtr<Thread>>& waiting_threads, s32 num
     // them all.
     std::size_t last = waiting_threads.size();
     if (num_to_wake > 0)
-        last = num_to_wake;
+        last = std::min(last, static_cast<std::size_t>(num_to_wake));
 
     // Signal the waiting threads.
     for (std::size_t i = 0; i < last; i++) {
@@ -5,11 +5,14 @@
 #pragma once
 
 #include "common/common_types.h"
+#include "core/hle/kernel/object.h"
 
 union ResultCode;
 
 namespace Kernel {
 
+class Thread;
+
 namespace AddressArbiter {
 enum class ArbitrationType {
     WaitIfLessThan = 0,
@@ -29,6 +32,13 @@ ResultCode ModifyByWaitingCountAndSignalToAddressIfEqual(VAddr address, s32 valu
 
 ResultCode WaitForAddressIfLessThan(VAddr address, s32 value, s64 timeout, bool should_decrement);
 ResultCode WaitForAddressIfEqual(VAddr address, s32 value, s64 timeout);
+
+/// Tracks the thread as a waiter on its current arbiter wait address. Only called by
+/// Thread::SetArbiterWaitAddress, which keeps the buckets in sync with the thread state.
+void AddWaitingThread(SharedPtr<Thread> thread);
+
+/// Removes the thread from the bucket of its current arbiter wait address.
+void RemoveWaitingThread(Thread* thread);
 } // namespace AddressArbiter
 
 } // namespace Kernel
@@ -18,12 +18,9 @@ class ServerPort;
 class ClientPort final : public Object {
 public:
     friend class ServerPort;
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "ClientPort";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::ClientPort;
     HandleType GetHandleType() const override {
@@ -53,7 +50,6 @@ private:
     SharedPtr<ServerPort> server_port; ///< ServerPort associated with this client port.
     u32 max_sessions = 0;    ///< Maximum number of simultaneous sessions the port can have
     u32 active_sessions = 0; ///< Number of currently open sessions to this port
-    std::string name;        ///< Name of client port (optional)
 };
 
 } // namespace Kernel
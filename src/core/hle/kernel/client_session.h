@@ -21,14 +21,10 @@ class ClientSession final : public Object {
 public:
     friend class ServerSession;
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "ClientSession";
     }
 
-    std::string GetName() const override {
-        return name;
-    }
-
     static const HandleType HANDLE_TYPE = HandleType::ClientSession;
     HandleType GetHandleType() const override {
         return HANDLE_TYPE;
@@ -36,8 +32,6 @@ public:
 
     ResultCode SendSyncRequest(SharedPtr<Thread> thread);
 
-    std::string name; ///< Name of client port (optional)
-
     /// The parent session, which links to the server endpoint.
     std::shared_ptr<Session> parent;
 
@@ -84,6 +84,10 @@ bool HandleTable::IsValid(Handle handle) const {
 }
 
 SharedPtr<Object> HandleTable::GetGeneric(Handle handle) const {
+    return GetGenericRaw(handle);
+}
+
+Object* HandleTable::GetGenericRaw(Handle handle) const {
     if (handle == CurrentThread) {
         return GetCurrentThread();
     } else if (handle == CurrentProcess) {
@@ -93,7 +97,7 @@ SharedPtr<Object> HandleTable::GetGeneric(Handle handle) const {
     if (!IsValid(handle)) {
         return nullptr;
     }
-    return objects[GetSlot(handle)];
+    return objects[GetSlot(handle)].get();
 }
 
 void HandleTable::Clear() {
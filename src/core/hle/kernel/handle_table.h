@@ -87,6 +87,30 @@ public:
         return DynamicObjectCast<T>(GetGeneric(handle));
     }
 
+    /**
+     * Looks up a handle without touching the object's reference count. The returned pointer is
+     * non-owning and only remains valid while the table entry (or another owner) keeps the
+     * object alive, i.e. for the duration of the current SVC. Use Get() when the object must
+     * outlive the table entry.
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid.
+     */
+    Object* GetGenericRaw(Handle handle) const;
+
+    /**
+     * Looks up a handle while verifying its type, without touching the object's reference
+     * count. Same lifetime caveats as GetGenericRaw().
+     * @return Pointer to the looked-up object, or `nullptr` if the handle is not valid or its
+     *         type differs from the requested one.
+     */
+    template <class T>
+    T* GetRaw(Handle handle) const {
+        Object* const object = GetGenericRaw(handle);
+        if (object == nullptr || object->GetHandleType() != T::HANDLE_TYPE) {
+            return nullptr;
+        }
+        return static_cast<T*>(object);
+    }
+
     /// Closes all handles held in this table.
     void Clear();
 
@@ -81,7 +81,7 @@ HLERequestContext::~HLERequestContext() = default;
 void HLERequestContext::ParseCommandBuffer(const HandleTable& handle_table, u32_le* src_cmdbuf,
                                            bool incoming) {
     IPC::RequestParser rp(src_cmdbuf);
-    command_header = std::make_shared<IPC::CommandHeader>(rp.PopRaw<IPC::CommandHeader>());
+    command_header.emplace(rp.PopRaw<IPC::CommandHeader>());
 
     if (command_header->type == IPC::CommandType::Close) {
         // Close does not populate the rest of the IPC header
@@ -90,8 +90,7 @@ void HLERequestContext::ParseCommandBuffer(const HandleTable& handle_table, u32_
 
     // If handle descriptor is present, add size of it
     if (command_header->enable_handle_descriptor) {
-        handle_descriptor_header =
-            std::make_shared<IPC::HandleDescriptorHeader>(rp.PopRaw<IPC::HandleDescriptorHeader>());
+        handle_descriptor_header.emplace(rp.PopRaw<IPC::HandleDescriptorHeader>());
         if (handle_descriptor_header->send_current_pid) {
             rp.Skip(2, false);
         }
@@ -135,16 +134,14 @@ void HLERequestContext::ParseCommandBuffer(const HandleTable& handle_table, u32_
         // If this is an incoming message, only CommandType "Request" has a domain header
         // All outgoing domain messages have the domain header, if only incoming has it
         if (incoming || domain_message_header) {
-            domain_message_header =
-                std::make_shared<IPC::DomainMessageHeader>(rp.PopRaw<IPC::DomainMessageHeader>());
+            domain_message_header.emplace(rp.PopRaw<IPC::DomainMessageHeader>());
         } else {
             if (Session()->IsDomain())
                 LOG_WARNING(IPC, "Domain request has no DomainMessageHeader!");
         }
     }
 
-    data_payload_header =
-        std::make_shared<IPC::DataPayloadHeader>(rp.PopRaw<IPC::DataPayloadHeader>());
+    data_payload_header.emplace(rp.PopRaw<IPC::DataPayloadHeader>());
 
     data_payload_offset = rp.GetCurrentOffset();
 
@@ -274,6 +271,36 @@ ResultCode HLERequestContext::WriteToOutgoingCommandBuffer(Thread& thread) {
     return RESULT_SUCCESS;
 }
 
+const u8* HLERequestContext::GetReadBufferPointer(int buffer_index) const {
+    const bool is_buffer_a{BufferDescriptorA().size() && BufferDescriptorA()[buffer_index].Size()};
+    const VAddr addr{is_buffer_a ? BufferDescriptorA()[buffer_index].Address()
+                                 : BufferDescriptorX()[buffer_index].Address()};
+    const std::size_t size{GetReadBufferSize(buffer_index)};
+
+    u8* const pointer{Memory::TryGetContiguousSpan(addr, size)};
+    if (pointer != nullptr) {
+        // ReadBlock would have flushed pending GPU writes covering the region; direct access
+        // has to do the same before the caller consumes the data.
+        Memory::RasterizerFlushVirtualRegion(addr, size, Memory::FlushMode::Flush);
+    }
+    return pointer;
+}
+
+u8* HLERequestContext::GetWriteBufferPointer(int buffer_index) const {
+    const bool is_buffer_b{BufferDescriptorB().size() && BufferDescriptorB()[buffer_index].Size()};
+    const VAddr addr{is_buffer_b ? BufferDescriptorB()[buffer_index].Address()
+                                 : BufferDescriptorC()[buffer_index].Address()};
+    const std::size_t size{GetWriteBufferSize(buffer_index)};
+
+    u8* const pointer{Memory::TryGetContiguousSpan(addr, size)};
+    if (pointer != nullptr) {
+        // WriteBlock would have invalidated GPU caches covering the region; direct access has
+        // to do the same since the caller is about to overwrite the data.
+        Memory::RasterizerFlushVirtualRegion(addr, size, Memory::FlushMode::Invalidate);
+    }
+    return pointer;
+}
+
 std::vector<u8> HLERequestContext::ReadBuffer(int buffer_index) const {
     std::vector<u8> buffer;
     const bool is_buffer_a{BufferDescriptorA().size() && BufferDescriptorA()[buffer_index].Size()};
@@ -6,11 +6,12 @@
 
 #include <array>
 #include <memory>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <vector>
-#include <boost/container/small_vector.hpp>
 #include "common/common_types.h"
+#include "common/small_vector.h"
 #include "common/swap.h"
 #include "core/hle/ipc.h"
 #include "core/hle/kernel/object.h"
@@ -143,32 +144,41 @@ public:
         return command_header->type;
     }
 
+    /// Raw value of the last result code pushed into the response, recorded for IPC event logging.
+    u32 GetLastResultRaw() const {
+        return last_result_raw;
+    }
+
+    void SetLastResultRaw(u32 value) {
+        last_result_raw = value;
+    }
+
     unsigned GetDataPayloadOffset() const {
         return data_payload_offset;
     }
 
-    const std::vector<IPC::BufferDescriptorX>& BufferDescriptorX() const {
+    const auto& BufferDescriptorX() const {
         return buffer_x_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorA() const {
+    const auto& BufferDescriptorA() const {
         return buffer_a_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorABW>& BufferDescriptorB() const {
+    const auto& BufferDescriptorB() const {
         return buffer_b_desciptors;
     }
 
-    const std::vector<IPC::BufferDescriptorC>& BufferDescriptorC() const {
+    const auto& BufferDescriptorC() const {
         return buffer_c_desciptors;
     }
 
     const IPC::DomainMessageHeader* GetDomainMessageHeader() const {
-        return domain_message_header.get();
+        return domain_message_header ? &*domain_message_header : nullptr;
     }
 
     bool HasDomainMessageHeader() const {
-        return domain_message_header != nullptr;
+        return domain_message_header.has_value();
     }
 
     /// Helper function to read a buffer using the appropriate buffer descriptor
@@ -203,6 +213,16 @@ public:
     /// Helper function to get the size of the output buffer
     std::size_t GetWriteBufferSize(int buffer_index = 0) const;
 
+    /// Returns a host pointer backing the entire input buffer when the guest buffer is mapped
+    /// contiguously in host memory, or nullptr when it is fragmented and ReadBuffer must be used.
+    /// Lets services consume large transfers in place instead of staging through a vector.
+    const u8* GetReadBufferPointer(int buffer_index = 0) const;
+
+    /// Returns a host pointer backing the entire output buffer when the guest buffer is mapped
+    /// contiguously in host memory, or nullptr when it is fragmented and WriteBuffer must be used.
+    /// Lets services produce large transfers directly into guest memory.
+    u8* GetWriteBufferPointer(int buffer_index = 0) const;
+
     template <typename T>
     SharedPtr<T> GetCopyObject(std::size_t index) {
         ASSERT(index < copy_objects.size());
@@ -227,14 +247,22 @@ public:
         domain_objects.emplace_back(std::move(object));
     }
 
+    /**
+     * Returns a borrowed reference to the domain object with the given index. The object is
+     * owned by the server session's domain handler table, which outlives the request, so no
+     * ownership is transferred; the pointer must not be retained past the request.
+     */
     template <typename T>
-    std::shared_ptr<T> GetDomainRequestHandler(std::size_t index) const {
-        return std::static_pointer_cast<T>(domain_request_handlers[index]);
+    T* GetDomainRequestHandler(std::size_t index) const {
+        ASSERT(domain_request_handlers != nullptr);
+        ASSERT(index < domain_request_handlers->size());
+        ASSERT((*domain_request_handlers)[index] != nullptr);
+        return static_cast<T*>((*domain_request_handlers)[index].get());
     }
 
     void SetDomainRequestHandlers(
         const std::vector<std::shared_ptr<SessionRequestHandler>>& handlers) {
-        domain_request_handlers = handlers;
+        domain_request_handlers = &handlers;
     }
 
     /// Clears the list of objects so that no lingering objects are written accidentally to the
@@ -265,25 +293,30 @@ private:
     std::array<u32, IPC::COMMAND_BUFFER_LENGTH> cmd_buf;
     SharedPtr<Kernel::ServerSession> server_session;
     // TODO(yuriks): Check common usage of this and optimize size accordingly
-    boost::container::small_vector<SharedPtr<Object>, 8> move_objects;
-    boost::container::small_vector<SharedPtr<Object>, 8> copy_objects;
-    boost::container::small_vector<std::shared_ptr<SessionRequestHandler>, 8> domain_objects;
-
-    std::shared_ptr<IPC::CommandHeader> command_header;
-    std::shared_ptr<IPC::HandleDescriptorHeader> handle_descriptor_header;
-    std::shared_ptr<IPC::DataPayloadHeader> data_payload_header;
-    std::shared_ptr<IPC::DomainMessageHeader> domain_message_header;
-    std::vector<IPC::BufferDescriptorX> buffer_x_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_a_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_b_desciptors;
-    std::vector<IPC::BufferDescriptorABW> buffer_w_desciptors;
-    std::vector<IPC::BufferDescriptorC> buffer_c_desciptors;
+    Common::SmallVector<SharedPtr<Object>, 8> move_objects;
+    Common::SmallVector<SharedPtr<Object>, 8> copy_objects;
+    Common::SmallVector<std::shared_ptr<SessionRequestHandler>, 8> domain_objects;
+
+    // The headers and descriptor lists are parsed on every service call, so they live inline in
+    // the context instead of behind per-request heap allocations.
+    std::optional<IPC::CommandHeader> command_header;
+    std::optional<IPC::HandleDescriptorHeader> handle_descriptor_header;
+    std::optional<IPC::DataPayloadHeader> data_payload_header;
+    std::optional<IPC::DomainMessageHeader> domain_message_header;
+    Common::SmallVector<IPC::BufferDescriptorX, 2> buffer_x_desciptors;
+    Common::SmallVector<IPC::BufferDescriptorABW, 2> buffer_a_desciptors;
+    Common::SmallVector<IPC::BufferDescriptorABW, 2> buffer_b_desciptors;
+    Common::SmallVector<IPC::BufferDescriptorABW, 2> buffer_w_desciptors;
+    Common::SmallVector<IPC::BufferDescriptorC, 2> buffer_c_desciptors;
 
     unsigned data_payload_offset{};
     unsigned buffer_c_offset{};
     u32_le command{};
+    u32 last_result_raw{};
 
-    std::vector<std::shared_ptr<SessionRequestHandler>> domain_request_handlers;
+    /// Borrowed from the server session's domain handler table for the duration of the request,
+    /// so that domain dispatch doesn't copy the handler list (and bump every refcount) per call.
+    const std::vector<std::shared_ptr<SessionRequestHandler>>* domain_request_handlers = nullptr;
 };
 
 } // namespace Kernel
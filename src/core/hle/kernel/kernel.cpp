@@ -17,9 +17,11 @@
 #include "core/hle/kernel/handle_table.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/process.h"
+#include "core/hle/kernel/readable_event.h"
 #include "core/hle/kernel/resource_limit.h"
 #include "core/hle/kernel/thread.h"
 #include "core/hle/kernel/timer.h"
+#include "core/hle/kernel/writable_event.h"
 #include "core/hle/lock.h"
 #include "core/hle/result.h"
 
@@ -190,6 +192,18 @@ void KernelCore::Initialize() {
 }
 
 void KernelCore::Shutdown() {
+    // Report object churn for the pooled kernel types before tearing everything down. Events are
+    // created per IPC session, so these numbers are the first thing to look at when allocation
+    // traffic shows up in profiles.
+    const auto readable_stats = ReadableEvent::GetSlabStats();
+    const auto writable_stats = WritableEvent::GetSlabStats();
+    const auto timer_stats = Timer::GetSlabStats();
+    LOG_DEBUG(Kernel, "Event churn: {} readable / {} writable created, {} / {} destroyed",
+              readable_stats.allocations, writable_stats.allocations, readable_stats.frees,
+              writable_stats.frees);
+    LOG_DEBUG(Kernel, "Timer churn: {} created, {} destroyed", timer_stats.allocations,
+              timer_stats.frees);
+
     impl->Shutdown();
 }
 
@@ -32,9 +32,10 @@ static std::pair<SharedPtr<Thread>, u32> GetHighestPriorityMutexWaitingThread(
 
         ASSERT(thread->GetStatus() == ThreadStatus::WaitMutex);
 
+        // The waiting threads are sorted by priority, so the first one waiting on this
+        // address is the highest priority one.
         ++num_waiters;
-        if (highest_priority_thread == nullptr ||
-            thread->GetPriority() < highest_priority_thread->GetPriority()) {
+        if (highest_priority_thread == nullptr) {
             highest_priority_thread = thread;
         }
     }
@@ -2,14 +2,53 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "common/assert.h"
 #include "core/hle/kernel/kernel.h"
 #include "core/hle/kernel/object.h"
 
 namespace Kernel {
 
+#ifdef KERNEL_OBJECT_NAMES
+namespace {
+// Names repeat heavily ("Unknown", event pair suffixes, service names), so they are interned
+// once and the side-table stores only views into the intern set. Set nodes are never erased,
+// which is what keeps the views handed out by GetName valid for the emulator's lifetime.
+std::mutex object_names_mutex;
+std::unordered_set<std::string> interned_object_names;
+std::unordered_map<const Object*, std::string_view> object_names;
+} // Anonymous namespace
+#endif
+
 Object::Object(KernelCore& kernel) : kernel{kernel}, object_id{kernel.CreateNewObjectID()} {}
-Object::~Object() = default;
+
+Object::~Object() {
+#ifdef KERNEL_OBJECT_NAMES
+    std::lock_guard<std::mutex> lock{object_names_mutex};
+    object_names.erase(this);
+#endif
+}
+
+std::string_view Object::GetName() const {
+#ifdef KERNEL_OBJECT_NAMES
+    std::lock_guard<std::mutex> lock{object_names_mutex};
+    const auto iter = object_names.find(this);
+    if (iter != object_names.end()) {
+        return iter->second;
+    }
+#endif
+    return GetTypeName();
+}
+
+#ifdef KERNEL_OBJECT_NAMES
+void Object::SetName(std::string name) {
+    std::lock_guard<std::mutex> lock{object_names_mutex};
+    object_names[this] = *interned_object_names.insert(std::move(name)).first;
+}
+#endif
 
 bool Object::IsWaitable() const {
     switch (GetHandleType()) {
@@ -6,11 +6,20 @@
 
 #include <atomic>
 #include <string>
+#include <string_view>
 
 #include <boost/smart_ptr/intrusive_ptr.hpp>
 
 #include "common/common_types.h"
 
+// Kernel object names exist purely for debugging. Storing a std::string in every object costs
+// its full capacity even when nothing ever reads the name, which adds up when titles create tens
+// of thousands of sessions, so the names live in an interned side-table (see object.cpp) that is
+// compiled out of release builds entirely.
+#ifndef NDEBUG
+#define KERNEL_OBJECT_NAMES
+#endif
+
 namespace Kernel {
 
 class KernelCore;
@@ -49,12 +58,22 @@ public:
         return object_id.load(std::memory_order_relaxed);
     }
 
-    virtual std::string GetTypeName() const {
+    virtual std::string_view GetTypeName() const {
         return "[BAD KERNEL OBJECT TYPE]";
     }
-    virtual std::string GetName() const {
-        return "[UNKNOWN KERNEL OBJECT]";
-    }
+
+    /// Returns the debugging name attached to this object, or its type name if it has none (or
+    /// name storage is compiled out). The view stays valid for the lifetime of the emulator.
+    std::string_view GetName() const;
+
+#ifdef KERNEL_OBJECT_NAMES
+    /// Attaches a debugging name to this object. Names are interned, so repeated names share
+    /// storage.
+    void SetName(std::string name);
+#else
+    void SetName(std::string) {}
+#endif
+
     virtual HandleType GetHandleType() const = 0;
 
     /**
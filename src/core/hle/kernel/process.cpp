@@ -27,7 +27,7 @@ CodeSet::~CodeSet() = default;
 SharedPtr<Process> Process::Create(KernelCore& kernel, std::string&& name) {
     SharedPtr<Process> process(new Process(kernel));
 
-    process->name = std::move(name);
+    process->SetName(std::move(name));
     process->flags.raw = 0;
     process->flags.memory_region.Assign(MemoryRegion::APPLICATION);
     process->resource_limit = kernel.GetSystemResourceLimit();
@@ -261,11 +261,11 @@ void Process::LoadModule(CodeSet module_, VAddr base_addr) {
     MapSegment(module_.RODataSegment(), VMAPermission::Read, MemoryState::CodeMutable);
     MapSegment(module_.DataSegment(), VMAPermission::ReadWrite, MemoryState::CodeMutable);
 
-    // Clear instruction cache in CPU JIT
-    Core::System::GetInstance().ArmInterface(0).ClearInstructionCache();
-    Core::System::GetInstance().ArmInterface(1).ClearInstructionCache();
-    Core::System::GetInstance().ArmInterface(2).ClearInstructionCache();
-    Core::System::GetInstance().ArmInterface(3).ClearInstructionCache();
+    // Clear any stale translations for the mapped range in the CPU JIT. Only the module's
+    // own range needs to be invalidated; a full cache clear would force the JIT to
+    // retranslate every other loaded module as well.
+    Core::System::GetInstance().InvalidateCpuInstructionCacheRange(base_addr,
+                                                                   module_.memory->size());
 }
 
 ResultVal<VAddr> Process::HeapAllocate(VAddr target, u64 size, VMAPermission perms) {
@@ -124,12 +124,9 @@ public:
 
     static SharedPtr<Process> Create(KernelCore& kernel, std::string&& name);
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "Process";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::Process;
     HandleType GetHandleType() const override {
@@ -338,8 +335,6 @@ private:
 
     /// Random values for svcGetInfo RandomEntropy
     std::array<u64, RANDOM_ENTROPY_SIZE> random_entropy;
-
-    std::string name;
 };
 
 } // namespace Kernel
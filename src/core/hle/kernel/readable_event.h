@@ -5,6 +5,7 @@
 #pragma once
 
 #include "core/hle/kernel/object.h"
+#include "core/hle/kernel/slab_heap.h"
 #include "core/hle/kernel/wait_object.h"
 
 union ResultCode;
@@ -14,18 +15,15 @@ namespace Kernel {
 class KernelCore;
 class WritableEvent;
 
-class ReadableEvent final : public WaitObject {
+class ReadableEvent final : public WaitObject, public SlabAllocated<ReadableEvent> {
     friend class WritableEvent;
 
 public:
     ~ReadableEvent() override;
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "ReadableEvent";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     ResetType GetResetType() const {
         return reset_type;
@@ -59,8 +57,6 @@ private:
 
     ResetType reset_type;
     bool signaled;
-
-    std::string name; ///< Name of event (optional)
 };
 
 } // namespace Kernel
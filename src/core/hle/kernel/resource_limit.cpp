@@ -19,7 +19,7 @@ ResourceLimit::~ResourceLimit() = default;
 SharedPtr<ResourceLimit> ResourceLimit::Create(KernelCore& kernel, std::string name) {
     SharedPtr<ResourceLimit> resource_limit(new ResourceLimit(kernel));
 
-    resource_limit->name = std::move(name);
+    resource_limit->SetName(std::move(name));
     return resource_limit;
 }
 
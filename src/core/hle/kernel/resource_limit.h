@@ -36,12 +36,9 @@ public:
      */
     static SharedPtr<ResourceLimit> Create(KernelCore& kernel, std::string name = "Unknown");
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "ResourceLimit";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::ResourceLimit;
     HandleType GetHandleType() const override {
@@ -95,9 +92,6 @@ private:
     ResourceArray limits{};
     /// Current resource limit values.
     ResourceArray values{};
-
-    /// Name of resource limit object.
-    std::string name;
 };
 
 } // namespace Kernel
@@ -65,6 +65,13 @@ void Scheduler::SwitchContext(Thread* new_thread) {
 
     UpdateLastContextSwitchTime(previous_thread, previous_process);
 
+    // Rescheduling back into the running thread requires no context or queue work at all. This
+    // happens constantly when events fire without waking a higher priority thread.
+    if (new_thread != nullptr && new_thread == previous_thread &&
+        previous_thread->GetStatus() == ThreadStatus::Running) {
+        return;
+    }
+
     // Save context for previous thread
     if (previous_thread) {
         cpu_core.SaveContext(previous_thread->GetContext());
@@ -142,11 +149,10 @@ void Scheduler::Reschedule() {
     SwitchContext(next);
 }
 
-void Scheduler::AddThread(SharedPtr<Thread> thread, u32 priority) {
+void Scheduler::AddThread(SharedPtr<Thread> thread) {
     std::lock_guard<std::mutex> lock(scheduler_mutex);
 
     thread_list.push_back(std::move(thread));
-    ready_queue.prepare(priority);
 }
 
 void Scheduler::RemoveThread(Thread* thread) {
@@ -176,8 +182,6 @@ void Scheduler::SetThreadPriority(Thread* thread, u32 priority) {
     // If thread was ready, adjust queues
     if (thread->GetStatus() == ThreadStatus::Ready)
         ready_queue.move(thread, thread->GetPriority(), priority);
-    else
-        ready_queue.prepare(priority);
 }
 
 Thread* Scheduler::GetNextSuggestedThread(u32 core, u32 maximum_priority) const {
@@ -197,9 +201,12 @@ void Scheduler::YieldWithoutLoadBalancing(Thread* thread) {
     // Sanity check that the priority is valid
     ASSERT(thread->GetPriority() < THREADPRIO_COUNT);
 
-    // Yield this thread -- sleep for zero time and force reschedule to different thread
-    WaitCurrentThread_Sleep();
-    GetCurrentThread()->WakeAfterDelay(0);
+    // Yield this thread -- rotate it to the back of the ready queue for its priority. The next
+    // Reschedule() then runs the new head of the queue (which may be this same thread when
+    // nothing else is ready). No timing event is involved; the previous implementation slept
+    // for zero time, which scheduled and then immediately serviced a CoreTiming wakeup on
+    // every yield.
+    MoveThreadToBackOfPriorityQueue(thread);
 }
 
 void Scheduler::YieldWithLoadBalancing(Thread* thread) {
@@ -213,9 +220,8 @@ void Scheduler::YieldWithLoadBalancing(Thread* thread) {
     // Sanity check that the priority is valid
     ASSERT(priority < THREADPRIO_COUNT);
 
-    // Sleep for zero time to be able to force reschedule to different thread
-    WaitCurrentThread_Sleep();
-    GetCurrentThread()->WakeAfterDelay(0);
+    // Rotate to the back of the ready queue to be able to force reschedule to different thread
+    MoveThreadToBackOfPriorityQueue(thread);
 
     Thread* suggested_thread = nullptr;
 
@@ -242,7 +248,19 @@ void Scheduler::YieldWithLoadBalancing(Thread* thread) {
 }
 
 void Scheduler::YieldAndWaitForLoadBalancing(Thread* thread) {
-    UNIMPLEMENTED_MSG("Wait for load balancing thread yield type is not implemented!");
+    // The real kernel parks the thread until another core migrates it over. Until the scheduler
+    // can express that, degrade to a load balancing yield; the thread stays runnable on its own
+    // core if no migration candidate is found, which is a superset of the intended behavior.
+    LOG_DEBUG(Kernel, "Treating yield type -2 (wait for load balancing) as a plain "
+                      "load balancing yield");
+    YieldWithLoadBalancing(thread);
+}
+
+void Scheduler::MoveThreadToBackOfPriorityQueue(Thread* thread) {
+    std::lock_guard<std::mutex> lock(scheduler_mutex);
+
+    thread->SetStatus(ThreadStatus::Ready);
+    ready_queue.push_back(thread->GetPriority(), thread);
 }
 
 } // namespace Kernel
@@ -37,7 +37,7 @@ public:
     u64 GetLastContextSwitchTicks() const;
 
     /// Adds a new thread to the scheduler
-    void AddThread(SharedPtr<Thread> thread, u32 priority);
+    void AddThread(SharedPtr<Thread> thread);
 
     /// Removes a thread from the scheduler
     void RemoveThread(Thread* thread);
@@ -117,7 +117,7 @@ public:
      */
     void YieldWithLoadBalancing(Thread* thread);
 
-    /// Currently unknown -- asserts as unimplemented on call
+    /// Proper behavior is unknown -- currently treated as YieldWithLoadBalancing
     void YieldAndWaitForLoadBalancing(Thread* thread);
 
     /// Returns a list of all threads managed by the scheduler
@@ -138,6 +138,13 @@ private:
      */
     void SwitchContext(Thread* new_thread);
 
+    /**
+     * Marks the thread ready and moves it to the back of the ready queue for its priority, so
+     * that the next Reschedule() runs the queue head instead. Used to implement yields without
+     * going through a zero-length sleep and its associated timing event.
+     */
+    void MoveThreadToBackOfPriorityQueue(Thread* thread);
+
     /**
      * Called on every context switch to update the internal timestamp
      * This also updates the running time ticks for the given thread and
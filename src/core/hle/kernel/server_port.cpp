@@ -41,8 +41,8 @@ std::tuple<SharedPtr<ServerPort>, SharedPtr<ClientPort>> ServerPort::CreatePortP
     SharedPtr<ServerPort> server_port(new ServerPort(kernel));
     SharedPtr<ClientPort> client_port(new ClientPort(kernel));
 
-    server_port->name = name + "_Server";
-    client_port->name = name + "_Client";
+    server_port->SetName(name + "_Server");
+    client_port->SetName(name + "_Client");
     client_port->server_port = server_port;
     client_port->max_sessions = max_sessions;
     client_port->active_sessions = 0;
@@ -33,12 +33,9 @@ public:
     static std::tuple<SharedPtr<ServerPort>, SharedPtr<ClientPort>> CreatePortPair(
         KernelCore& kernel, u32 max_sessions, std::string name = "UnknownPort");
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "ServerPort";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::ServerPort;
     HandleType GetHandleType() const override {
@@ -59,8 +56,6 @@ public:
         hle_handler = std::move(hle_handler_);
     }
 
-    std::string name; ///< Name of port (optional)
-
     /// ServerSessions waiting to be accepted by the port
     std::vector<SharedPtr<ServerSession>> pending_sessions;
 
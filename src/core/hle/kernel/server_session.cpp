@@ -39,7 +39,7 @@ ServerSession::~ServerSession() {
 ResultVal<SharedPtr<ServerSession>> ServerSession::Create(KernelCore& kernel, std::string name) {
     SharedPtr<ServerSession> server_session(new ServerSession(kernel));
 
-    server_session->name = std::move(name);
+    server_session->SetName(std::move(name));
     server_session->parent = nullptr;
 
     return MakeResult(std::move(server_session));
@@ -71,20 +71,35 @@ ResultCode ServerSession::HandleDomainSyncRequest(Kernel::HLERequestContext& con
         // If there is a DomainMessageHeader, then this is CommandType "Request"
         const u32 object_id{context.GetDomainMessageHeader()->object_id};
         switch (domain_message_header->command) {
-        case IPC::DomainMessageHeader::CommandType::SendMessage:
-            if (object_id > domain_request_handlers.size()) {
+        case IPC::DomainMessageHeader::CommandType::SendMessage: {
+            if (object_id == 0 || object_id > domain_request_handlers.size()) {
                 LOG_CRITICAL(IPC,
                              "object_id {} is too big! This probably means a recent service call "
                              "to {} needed to return a new interface!",
-                             object_id, name);
+                             object_id, GetName());
                 UNREACHABLE();
                 return RESULT_SUCCESS; // Ignore error if asserts are off
             }
-            return domain_request_handlers[object_id - 1]->HandleSyncRequest(context);
+
+            // Slots of closed virtual handles stay in the table as null entries so that the
+            // remaining ids keep their meaning
+            const auto& handler = domain_request_handlers[object_id - 1];
+            if (handler == nullptr) {
+                LOG_CRITICAL(IPC, "object_id {} refers to a closed virtual handle!", object_id);
+                UNREACHABLE();
+                return RESULT_SUCCESS; // Ignore error if asserts are off
+            }
+            return handler->HandleSyncRequest(context);
+        }
 
         case IPC::DomainMessageHeader::CommandType::CloseVirtualHandle: {
             LOG_DEBUG(IPC, "CloseVirtualHandle, object_id=0x{:08X}", object_id);
 
+            if (object_id == 0 || object_id > domain_request_handlers.size()) {
+                LOG_CRITICAL(IPC, "CloseVirtualHandle with invalid object_id {}", object_id);
+                UNREACHABLE();
+                return RESULT_SUCCESS; // Ignore error if asserts are off
+            }
             domain_request_handlers[object_id - 1] = nullptr;
 
             IPC::ResponseBuilder rb{context, 2};
@@ -164,7 +179,7 @@ ServerSession::SessionPair ServerSession::CreateSessionPair(KernelCore& kernel,
                                                             SharedPtr<ClientPort> port) {
     auto server_session = ServerSession::Create(kernel, name + "_Server").Unwrap();
     SharedPtr<ClientSession> client_session(new ClientSession(kernel));
-    client_session->name = name + "_Client";
+    client_session->SetName(name + "_Client");
 
     std::shared_ptr<Session> parent(new Session);
     parent->client = client_session.get();
@@ -24,20 +24,17 @@ SharedPtr<SharedMemory> SharedMemory::Create(KernelCore& kernel, Process* owner_
     SharedPtr<SharedMemory> shared_memory(new SharedMemory(kernel));
 
     shared_memory->owner_process = owner_process;
-    shared_memory->name = std::move(name);
+    shared_memory->SetName(std::move(name));
     shared_memory->size = size;
     shared_memory->permissions = permissions;
     shared_memory->other_permissions = other_permissions;
 
     if (address == 0) {
+        // A freshly allocated block cannot be referenced by any mapping yet, so no existing
+        // address mappings have to be refreshed here; the block is shared by reference count
+        // once it is mapped into a process.
         shared_memory->backing_block = std::make_shared<std::vector<u8>>(size);
         shared_memory->backing_block_offset = 0;
-
-        // Refresh the address mappings for the current process.
-        if (Core::CurrentProcess() != nullptr) {
-            Core::CurrentProcess()->VMManager().RefreshMemoryBlockMappings(
-                shared_memory->backing_block.get());
-        }
     } else {
         const auto& vm_manager = shared_memory->owner_process->VMManager();
 
@@ -66,7 +63,7 @@ SharedPtr<SharedMemory> SharedMemory::CreateForApplet(
     SharedPtr<SharedMemory> shared_memory(new SharedMemory(kernel));
 
     shared_memory->owner_process = nullptr;
-    shared_memory->name = std::move(name);
+    shared_memory->SetName(std::move(name));
     shared_memory->size = size;
     shared_memory->permissions = permissions;
     shared_memory->other_permissions = other_permissions;
@@ -91,7 +88,7 @@ ResultCode SharedMemory::Map(Process& target_process, VAddr address, MemoryPermi
     // Error out if the requested permissions don't match what the creator process allows.
     if (static_cast<u32>(permissions) & ~static_cast<u32>(own_other_permissions)) {
         LOG_ERROR(Kernel, "cannot map id={}, address=0x{:X} name={}, permissions don't match",
-                  GetObjectId(), address, name);
+                  GetObjectId(), address, GetName());
         return ERR_INVALID_MEMORY_PERMISSIONS;
     }
 
@@ -99,25 +96,28 @@ ResultCode SharedMemory::Map(Process& target_process, VAddr address, MemoryPermi
     if (other_permissions != MemoryPermission::DontCare &&
         static_cast<u32>(this->permissions) & ~static_cast<u32>(other_permissions)) {
         LOG_ERROR(Kernel, "cannot map id={}, address=0x{:X} name={}, permissions don't match",
-                  GetObjectId(), address, name);
+                  GetObjectId(), address, GetName());
         return ERR_INVALID_MEMORY_PERMISSIONS;
     }
 
     VAddr target_address = address;
 
-    // Map the memory block into the target process
-    auto result = target_process.VMManager().MapMemoryBlock(
-        target_address, backing_block, backing_block_offset, size, MemoryState::Shared);
+    // Map the memory block into the target process with the requested permissions applied
+    // directly, so the region does not have to be carved out of the address space a second
+    // time by a separate reprotect pass.
+    const auto result =
+        target_process.VMManager().MapMemoryBlock(target_address, backing_block,
+                                                  backing_block_offset, size, MemoryState::Shared,
+                                                  ConvertPermissions(permissions));
     if (result.Failed()) {
         LOG_ERROR(
             Kernel,
             "cannot map id={}, target_address=0x{:X} name={}, error mapping to virtual memory",
-            GetObjectId(), target_address, name);
+            GetObjectId(), target_address, GetName());
         return result.Code();
     }
 
-    return target_process.VMManager().ReprotectRange(target_address, size,
-                                                     ConvertPermissions(permissions));
+    return RESULT_SUCCESS;
 }
 
 ResultCode SharedMemory::Unmap(Process& target_process, VAddr address) {
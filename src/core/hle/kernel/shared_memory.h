@@ -69,12 +69,9 @@ public:
                                                    MemoryPermission other_permissions,
                                                    std::string name = "Unknown Applet");
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "SharedMemory";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::SharedMemory;
     HandleType GetHandleType() const override {
@@ -142,8 +139,6 @@ private:
     Process* owner_process;
     /// Address of shared memory block in the owner process if specified.
     VAddr base_address = 0;
-    /// Name of shared memory object.
-    std::string name;
 };
 
 } // namespace Kernel
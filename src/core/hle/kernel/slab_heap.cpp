@@ -0,0 +1,62 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <new>
+#include "common/common_types.h"
+#include "core/hle/kernel/slab_heap.h"
+
+namespace Kernel {
+
+SlabHeap::SlabHeap(std::size_t object_size, std::size_t object_align)
+    : slot_align{std::max(object_align, CACHE_LINE_SIZE)} {
+    // A free slot has to be able to hold the freelist node, and whole slots must preserve the
+    // alignment of the ones that follow them in a chunk.
+    slot_size = std::max(object_size, sizeof(FreeNode));
+    slot_size = (slot_size + slot_align - 1) & ~(slot_align - 1);
+}
+
+SlabHeap::~SlabHeap() {
+    for (void* chunk : chunks) {
+        ::operator delete(chunk, std::align_val_t{slot_align});
+    }
+}
+
+void* SlabHeap::Allocate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (free_list == nullptr) {
+        AllocateChunk();
+    }
+    FreeNode* const node = free_list;
+    free_list = node->next;
+    ++stats.allocations;
+    return node;
+}
+
+void SlabHeap::Free(void* ptr) {
+    std::lock_guard<std::mutex> lock(mutex);
+    FreeNode* const node = static_cast<FreeNode*>(ptr);
+    node->next = free_list;
+    free_list = node;
+    ++stats.frees;
+}
+
+SlabHeap::Stats SlabHeap::GetStats() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return stats;
+}
+
+void SlabHeap::AllocateChunk() {
+    u8* const chunk =
+        static_cast<u8*>(::operator new(slot_size * SLOTS_PER_CHUNK, std::align_val_t{slot_align}));
+    chunks.push_back(chunk);
+    // Called with the mutex already held, so the slots are pushed onto the freelist directly.
+    for (std::size_t i = 0; i < SLOTS_PER_CHUNK; ++i) {
+        FreeNode* const node = reinterpret_cast<FreeNode*>(chunk + i * slot_size);
+        node->next = free_list;
+        free_list = node;
+    }
+}
+
+} // namespace Kernel
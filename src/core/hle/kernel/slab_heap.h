@@ -0,0 +1,95 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+#include "common/assert.h"
+#include "common/common_funcs.h"
+
+namespace Kernel {
+
+/**
+ * A pool allocator for objects of one fixed size. Memory is claimed from the host heap in chunks
+ * of many slots and recycled through a freelist, so allocating and freeing an object is
+ * constant-time and touches the host allocator only when a chunk runs out. Slots are aligned to
+ * cache lines so that two hot objects never share one.
+ *
+ * The pool is thread-safe: kernel objects are created and released from any CPU thread.
+ */
+class SlabHeap : NonCopyable {
+public:
+    /// Cumulative allocation counters, used to measure object churn over a session.
+    struct Stats {
+        std::size_t allocations{};
+        std::size_t frees{};
+    };
+
+    SlabHeap(std::size_t object_size, std::size_t object_align);
+    ~SlabHeap();
+
+    /// Takes a slot from the freelist, claiming a new chunk from the host heap if it is empty.
+    void* Allocate();
+
+    /// Returns a slot to the freelist. The pointer must come from Allocate() on this heap.
+    void Free(void* ptr);
+
+    Stats GetStats() const;
+
+private:
+    struct FreeNode {
+        FreeNode* next;
+    };
+
+    /// How many slots are claimed from the host heap at a time.
+    static constexpr std::size_t SLOTS_PER_CHUNK = 64;
+
+    static constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    void AllocateChunk();
+
+    std::size_t slot_size;
+    std::size_t slot_align;
+    FreeNode* free_list = nullptr;
+    std::vector<void*> chunks;
+    Stats stats;
+    mutable std::mutex mutex;
+};
+
+/**
+ * Routes new/delete for one kernel object type through a dedicated SlabHeap, shared by all
+ * instances of that type. Deriving from this is enough to pool a type: `delete` through a base
+ * class pointer selects the most-derived operator delete, so releasing the last SharedPtr
+ * reference returns the slot to the pool.
+ */
+template <typename T>
+class SlabAllocated {
+public:
+    static void* operator new(std::size_t size) {
+        ASSERT(size == sizeof(T));
+        return GetSlabHeap().Allocate();
+    }
+
+    static void operator delete(void* ptr) {
+        GetSlabHeap().Free(ptr);
+    }
+
+    /// Returns how many objects of this type have been created and destroyed so far.
+    static SlabHeap::Stats GetSlabStats() {
+        return GetSlabHeap().GetStats();
+    }
+
+private:
+    static SlabHeap& GetSlabHeap() {
+        // Deliberately leaked: object lifetimes are tied to SharedPtr references that may be
+        // dropped during static destruction, after a function-local heap would have been torn
+        // down.
+        static SlabHeap* const heap = new SlabHeap(sizeof(T), alignof(T));
+        return *heap;
+    }
+};
+
+} // namespace Kernel
@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <cinttypes>
 #include <iterator>
 #include <mutex>
@@ -12,6 +13,7 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/string_util.h"
 #include "core/arm/exclusive_monitor.h"
 #include "core/core.h"
@@ -158,8 +160,8 @@ ResultVal<s64> RetrieveResourceLimitValue(Handle resource_limit, u32 resource_ty
     const auto* const current_process = kernel.CurrentProcess();
     ASSERT(current_process != nullptr);
 
-    const auto resource_limit_object =
-        current_process->GetHandleTable().Get<ResourceLimit>(resource_limit);
+    const auto* const resource_limit_object =
+        current_process->GetHandleTable().GetRaw<ResourceLimit>(resource_limit);
     if (!resource_limit_object) {
         LOG_ERROR(Kernel_SVC, "Handle to non-existent resource limit instance used. Handle={:08X}",
                   resource_limit);
@@ -354,7 +356,7 @@ static ResultCode GetThreadId(u32* thread_id, Handle thread_handle) {
     LOG_TRACE(Kernel_SVC, "called thread=0x{:08X}", thread_handle);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    const auto* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", thread_handle);
         return ERR_INVALID_HANDLE;
@@ -369,7 +371,7 @@ static ResultCode GetProcessId(u32* process_id, Handle process_handle) {
     LOG_TRACE(Kernel_SVC, "called process=0x{:08X}", process_handle);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Process> process = handle_table.Get<Process>(process_handle);
+    const auto* const process = handle_table.GetRaw<Process>(process_handle);
     if (!process) {
         LOG_ERROR(Kernel_SVC, "Process handle does not exist, process_handle=0x{:08X}",
                   process_handle);
@@ -409,7 +411,7 @@ static ResultCode WaitSynchronization(Handle* index, VAddr handles_address, u64
         return ERR_INVALID_POINTER;
     }
 
-    static constexpr u64 MaxHandles = 0x40;
+    static constexpr u64 MaxHandles = Thread::MaxWaitObjects;
 
     if (handle_count > MaxHandles) {
         LOG_ERROR(Kernel_SVC, "Handle count specified is too large, expected {} but got {}",
@@ -419,33 +421,32 @@ static ResultCode WaitSynchronization(Handle* index, VAddr handles_address, u64
 
     auto* const thread = GetCurrentThread();
 
-    using ObjectPtr = Thread::ThreadWaitObjects::value_type;
-    Thread::ThreadWaitObjects objects(handle_count);
+    // Resolve the handles to borrowed references. The handle table keeps the objects alive for
+    // the duration of the SVC, so scanning the list touches no reference counts and the common
+    // already-signaled case completes without any allocation.
+    std::array<WaitObject*, MaxHandles> objects;
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
 
     for (u64 i = 0; i < handle_count; ++i) {
         const Handle handle = Memory::Read32(handles_address + i * sizeof(Handle));
-        const auto object = handle_table.Get<WaitObject>(handle);
+        Object* const object = handle_table.GetGenericRaw(handle);
 
-        if (object == nullptr) {
+        if (object == nullptr || !object->IsWaitable()) {
             LOG_ERROR(Kernel_SVC, "Object is a nullptr");
             return ERR_INVALID_HANDLE;
         }
 
-        objects[i] = object;
+        objects[i] = static_cast<WaitObject*>(object);
     }
 
     // Find the first object that is acquirable in the provided list of objects
-    auto itr = std::find_if(objects.begin(), objects.end(), [thread](const ObjectPtr& object) {
-        return !object->ShouldWait(thread);
-    });
-
-    if (itr != objects.end()) {
-        // We found a ready object, acquire it and set the result value
-        WaitObject* object = itr->get();
-        object->Acquire(thread);
-        *index = static_cast<s32>(std::distance(objects.begin(), itr));
-        return RESULT_SUCCESS;
+    for (u64 i = 0; i < handle_count; ++i) {
+        if (!objects[i]->ShouldWait(thread)) {
+            // We found a ready object, acquire it and set the result value
+            objects[i]->Acquire(thread);
+            *index = static_cast<s32>(i);
+            return RESULT_SUCCESS;
+        }
     }
 
     // No objects were ready to be acquired, prepare to suspend the thread.
@@ -456,11 +457,15 @@ static ResultCode WaitSynchronization(Handle* index, VAddr handles_address, u64
         return RESULT_TIMEOUT;
     }
 
-    for (auto& object : objects) {
-        object->AddWaitingThread(thread);
+    // Only now that the thread actually suspends do the objects have to be retained; the wait
+    // list lives inline in the thread object.
+    Thread::ThreadWaitObjects wait_objects;
+    for (u64 i = 0; i < handle_count; ++i) {
+        objects[i]->AddWaitingThread(thread);
+        wait_objects.emplace_back(objects[i]);
     }
 
-    thread->SetWaitObjects(std::move(objects));
+    thread->SetWaitObjects(std::move(wait_objects));
     thread->SetStatus(ThreadStatus::WaitSynchAny);
 
     // Create an event to wake the thread up after the specified nanosecond delay has passed
@@ -477,7 +482,7 @@ static ResultCode CancelSynchronization(Handle thread_handle) {
     LOG_TRACE(Kernel_SVC, "called thread=0x{:X}", thread_handle);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    auto* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, thread_handle=0x{:08X}",
                   thread_handle);
@@ -707,7 +712,8 @@ static ResultCode GetInfo(u64* result, u64 info_id, u64 handle, u64 info_sub_id)
         }
 
         const auto& current_process_handle_table = Core::CurrentProcess()->GetHandleTable();
-        const auto process = current_process_handle_table.Get<Process>(static_cast<Handle>(handle));
+        const auto* const process =
+            current_process_handle_table.GetRaw<Process>(static_cast<Handle>(handle));
         if (!process) {
             return ERR_INVALID_HANDLE;
         }
@@ -844,8 +850,8 @@ static ResultCode GetInfo(u64* result, u64 info_id, u64 handle, u64 info_sub_id)
             return ERR_INVALID_COMBINATION;
         }
 
-        const auto thread =
-            Core::CurrentProcess()->GetHandleTable().Get<Thread>(static_cast<Handle>(handle));
+        const auto* const thread =
+            Core::CurrentProcess()->GetHandleTable().GetRaw<Thread>(static_cast<Handle>(handle));
         if (!thread) {
             LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}",
                       static_cast<Handle>(handle));
@@ -888,7 +894,7 @@ static ResultCode GetThreadContext(VAddr thread_context, Handle handle) {
     LOG_DEBUG(Kernel_SVC, "called, context=0x{:08X}, thread=0x{:X}", thread_context, handle);
 
     const auto* current_process = Core::CurrentProcess();
-    const SharedPtr<Thread> thread = current_process->GetHandleTable().Get<Thread>(handle);
+    const auto* const thread = current_process->GetHandleTable().GetRaw<Thread>(handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", handle);
         return ERR_INVALID_HANDLE;
@@ -929,7 +935,7 @@ static ResultCode GetThreadPriority(u32* priority, Handle handle) {
     LOG_TRACE(Kernel_SVC, "called");
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(handle);
+    const auto* const thread = handle_table.GetRaw<Thread>(handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", handle);
         return ERR_INVALID_HANDLE;
@@ -953,7 +959,7 @@ static ResultCode SetThreadPriority(Handle handle, u32 priority) {
 
     const auto* const current_process = Core::CurrentProcess();
 
-    SharedPtr<Thread> thread = current_process->GetHandleTable().Get<Thread>(handle);
+    auto* const thread = current_process->GetHandleTable().GetRaw<Thread>(handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, handle=0x{:08X}", handle);
         return ERR_INVALID_HANDLE;
@@ -1071,7 +1077,7 @@ static ResultCode QueryProcessMemory(VAddr memory_info_address, VAddr page_info_
                                      Handle process_handle, VAddr address) {
     LOG_TRACE(Kernel_SVC, "called process=0x{:08X} address={:X}", process_handle, address);
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    SharedPtr<Process> process = handle_table.Get<Process>(process_handle);
+    const auto* const process = handle_table.GetRaw<Process>(process_handle);
     if (!process) {
         LOG_ERROR(Kernel_SVC, "Process handle does not exist, process_handle=0x{:08X}",
                   process_handle);
@@ -1181,7 +1187,7 @@ static ResultCode StartThread(Handle thread_handle) {
     LOG_TRACE(Kernel_SVC, "called thread=0x{:08X}", thread_handle);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    auto* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, thread_handle=0x{:08X}",
                   thread_handle);
@@ -1215,11 +1221,20 @@ static void SleepThread(s64 nanoseconds) {
     };
 
     if (nanoseconds <= 0) {
+        // Some titles busy-yield heavily while waiting on another thread or the GPU
+        static auto& yield_counter = Common::GetPerfCounter("kernel_yields");
+        yield_counter.Add();
+
         auto& scheduler{Core::System::GetInstance().CurrentScheduler()};
         switch (static_cast<SleepType>(nanoseconds)) {
         case SleepType::YieldWithoutLoadBalancing:
             scheduler.YieldWithoutLoadBalancing(GetCurrentThread());
-            break;
+            // A plain yield only rotates this core's ready queue; the other cores are untouched
+            // and don't need to be rescheduled.
+            Core::System::GetInstance()
+                .CpuCore(Core::System::GetInstance().CurrentCoreIndex())
+                .PrepareReschedule();
+            return;
         case SleepType::YieldWithLoadBalancing:
             scheduler.YieldWithLoadBalancing(GetCurrentThread());
             break;
@@ -1467,12 +1482,12 @@ static ResultCode ResetSignal(Handle handle) {
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
 
-    auto event = handle_table.Get<ReadableEvent>(handle);
+    auto* const event = handle_table.GetRaw<ReadableEvent>(handle);
     if (event) {
         return event->Reset();
     }
 
-    auto process = handle_table.Get<Process>(handle);
+    auto* const process = handle_table.GetRaw<Process>(handle);
     if (process) {
         return process->ClearSignalState();
     }
@@ -1523,7 +1538,7 @@ static ResultCode GetThreadCoreMask(Handle thread_handle, u32* core, u64* mask)
     LOG_TRACE(Kernel_SVC, "called, handle=0x{:08X}", thread_handle);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    const auto* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, thread_handle=0x{:08X}",
                   thread_handle);
@@ -1541,7 +1556,7 @@ static ResultCode SetThreadCoreMask(Handle thread_handle, u32 core, u64 mask) {
               mask, core);
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const SharedPtr<Thread> thread = handle_table.Get<Thread>(thread_handle);
+    auto* const thread = handle_table.GetRaw<Thread>(thread_handle);
     if (!thread) {
         LOG_ERROR(Kernel_SVC, "Thread handle does not exist, thread_handle=0x{:08X}",
                   thread_handle);
@@ -1664,13 +1679,13 @@ static ResultCode ClearEvent(Handle handle) {
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
 
-    auto writable_event = handle_table.Get<WritableEvent>(handle);
+    auto* const writable_event = handle_table.GetRaw<WritableEvent>(handle);
     if (writable_event) {
         writable_event->Clear();
         return RESULT_SUCCESS;
     }
 
-    auto readable_event = handle_table.Get<ReadableEvent>(handle);
+    auto* const readable_event = handle_table.GetRaw<ReadableEvent>(handle);
     if (readable_event) {
         readable_event->Clear();
         return RESULT_SUCCESS;
@@ -1683,8 +1698,8 @@ static ResultCode ClearEvent(Handle handle) {
 static ResultCode SignalEvent(Handle handle) {
     LOG_DEBUG(Kernel_SVC, "called. Handle=0x{:08X}", handle);
 
-    HandleTable& handle_table = Core::CurrentProcess()->GetHandleTable();
-    auto writable_event = handle_table.Get<WritableEvent>(handle);
+    const HandleTable& handle_table = Core::CurrentProcess()->GetHandleTable();
+    auto* const writable_event = handle_table.GetRaw<WritableEvent>(handle);
 
     if (!writable_event) {
         LOG_ERROR(Kernel_SVC, "Non-existent writable event handle used (0x{:08X})", handle);
@@ -1704,7 +1719,7 @@ static ResultCode GetProcessInfo(u64* out, Handle process_handle, u32 type) {
     };
 
     const auto& handle_table = Core::CurrentProcess()->GetHandleTable();
-    const auto process = handle_table.Get<Process>(process_handle);
+    const auto* const process = handle_table.GetRaw<Process>(process_handle);
     if (!process) {
         LOG_ERROR(Kernel_SVC, "Process handle does not exist, process_handle=0x{:08X}",
                   process_handle);
@@ -1781,8 +1796,8 @@ static ResultCode SetResourceLimitLimitValue(Handle resource_limit, u32 resource
     auto* const current_process = kernel.CurrentProcess();
     ASSERT(current_process != nullptr);
 
-    auto resource_limit_object =
-        current_process->GetHandleTable().Get<ResourceLimit>(resource_limit);
+    auto* const resource_limit_object =
+        current_process->GetHandleTable().GetRaw<ResourceLimit>(resource_limit);
     if (!resource_limit_object) {
         LOG_ERROR(Kernel_SVC, "Handle to non-existent resource limit instance used. Handle={:08X}",
                   resource_limit);
@@ -1956,6 +1971,17 @@ MICROPROFILE_DEFINE(Kernel_SVC, "Kernel", "SVC", MP_RGB(70, 200, 70));
 void CallSVC(u32 immediate) {
     MICROPROFILE_SCOPE(Kernel_SVC);
 
+    static auto& svc_counter = Common::GetPerfCounter("kernel_svc_calls");
+    svc_counter.Add();
+
+    // svcGetSystemTick only touches the core timer, which the JIT callbacks already query
+    // without holding the HLE lock; dispatch it directly so games that busy-wait on the tick
+    // counter do not serialize every iteration against the kernel mutex.
+    if (immediate == 0x1E) {
+        SvcWrap<GetSystemTick>();
+        return;
+    }
+
     // Lock the global kernel mutex when we enter the kernel HLE.
     std::lock_guard<std::recursive_mutex> lock(HLE::g_hle_lock);
 
@@ -11,16 +11,16 @@
 
 namespace Kernel {
 
-static inline u64 Param(int n) {
-    return Core::CurrentArmInterface().GetReg(n);
+static inline u64 Param(const Core::ARM_Interface& arm, int n) {
+    return arm.GetReg(n);
 }
 
 /**
  * HLE a function return from the current ARM userland process
  * @param res Result to return
  */
-static inline void FuncReturn(u64 res) {
-    Core::CurrentArmInterface().SetReg(0, res);
+static inline void FuncReturn(Core::ARM_Interface& arm, u64 res) {
+    arm.SetReg(0, res);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,201 +28,240 @@ static inline void FuncReturn(u64 res) {
 
 template <ResultCode func(u64)>
 void SvcWrap() {
-    FuncReturn(func(Param(0)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0)).raw);
 }
 
 template <ResultCode func(u32)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0))).raw);
 }
 
 template <ResultCode func(u32, u32)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0)), static_cast<u32>(Param(1))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), static_cast<u32>(Param(arm, 1))).raw);
 }
 
 template <ResultCode func(u32*)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param = 0;
     const u32 retval = func(&param).raw;
-    Core::CurrentArmInterface().SetReg(1, param);
-    FuncReturn(retval);
+    arm.SetReg(1, param);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32*, u32)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    u32 retval = func(&param_1, static_cast<u32>(Param(1))).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, static_cast<u32>(Param(arm, 1))).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32*, u32*)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
     u32 param_2 = 0;
     const u32 retval = func(&param_1, &param_2).raw;
 
-    auto& arm_interface = Core::CurrentArmInterface();
-    arm_interface.SetReg(1, param_1);
-    arm_interface.SetReg(2, param_2);
+    arm.SetReg(1, param_1);
+    arm.SetReg(2, param_2);
 
-    FuncReturn(retval);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32*, u64)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    u32 retval = func(&param_1, Param(1)).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, Param(arm, 1)).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u64, s32)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), static_cast<s32>(Param(1))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), static_cast<s32>(Param(arm, 1))).raw);
 }
 
 template <ResultCode func(u64, u32)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), static_cast<u32>(Param(1))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), static_cast<u32>(Param(arm, 1))).raw);
 }
 
 template <ResultCode func(u64*, u64)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u64 param_1 = 0;
-    u32 retval = func(&param_1, Param(1)).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, Param(arm, 1)).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u64*, u32, u32)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u64 param_1 = 0;
-    u32 retval = func(&param_1, static_cast<u32>(Param(1)), static_cast<u32>(Param(2))).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval =
+        func(&param_1, static_cast<u32>(Param(arm, 1)), static_cast<u32>(Param(arm, 2))).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32, u64)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0)), Param(1)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), Param(arm, 1)).raw);
 }
 
 template <ResultCode func(u32, u32, u64)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0)), static_cast<u32>(Param(1)), Param(2)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), static_cast<u32>(Param(arm, 1)),
+                         Param(arm, 2))
+                        .raw);
 }
 
 template <ResultCode func(u32, u32*, u64*)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
     u64 param_2 = 0;
-    ResultCode retval = func(static_cast<u32>(Param(2)), &param_1, &param_2);
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    Core::CurrentArmInterface().SetReg(2, param_2);
-    FuncReturn(retval.raw);
+    ResultCode retval = func(static_cast<u32>(Param(arm, 2)), &param_1, &param_2);
+    arm.SetReg(1, param_1);
+    arm.SetReg(2, param_2);
+    FuncReturn(arm, retval.raw);
 }
 
 template <ResultCode func(u64, u64, u32, u32)>
 void SvcWrap() {
-    FuncReturn(
-        func(Param(0), Param(1), static_cast<u32>(Param(2)), static_cast<u32>(Param(3))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), Param(arm, 1), static_cast<u32>(Param(arm, 2)),
+                         static_cast<u32>(Param(arm, 3)))
+                        .raw);
 }
 
 template <ResultCode func(u64, u64, u32, u64)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), Param(1), static_cast<u32>(Param(2)), Param(3)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), Param(arm, 1), static_cast<u32>(Param(arm, 2)),
+                         Param(arm, 3))
+                        .raw);
 }
 
 template <ResultCode func(u32, u64, u32)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0)), Param(1), static_cast<u32>(Param(2))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), Param(arm, 1),
+                         static_cast<u32>(Param(arm, 2)))
+                        .raw);
 }
 
 template <ResultCode func(u64, u64, u64)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), Param(1), Param(2)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), Param(arm, 1), Param(arm, 2)).raw);
 }
 
 template <ResultCode func(u64, u64, u32)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), Param(1), static_cast<u32>(Param(2))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), Param(arm, 1), static_cast<u32>(Param(arm, 2))).raw);
 }
 
 template <ResultCode func(u32, u64, u64, u32)>
 void SvcWrap() {
-    FuncReturn(
-        func(static_cast<u32>(Param(0)), Param(1), Param(2), static_cast<u32>(Param(3))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), Param(arm, 1), Param(arm, 2),
+                         static_cast<u32>(Param(arm, 3)))
+                        .raw);
 }
 
 template <ResultCode func(u32, u64, u64)>
 void SvcWrap() {
-    FuncReturn(func(static_cast<u32>(Param(0)), Param(1), Param(2)).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(static_cast<u32>(Param(arm, 0)), Param(arm, 1), Param(arm, 2)).raw);
 }
 
 template <ResultCode func(u32*, u64, u64, s64)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    ResultCode retval =
-        func(&param_1, Param(1), static_cast<u32>(Param(2)), static_cast<s64>(Param(3)));
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval.raw);
+    ResultCode retval = func(&param_1, Param(arm, 1), static_cast<u32>(Param(arm, 2)),
+                             static_cast<s64>(Param(arm, 3)));
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval.raw);
 }
 
 template <ResultCode func(u64, u64, u32, s64)>
 void SvcWrap() {
-    FuncReturn(
-        func(Param(0), Param(1), static_cast<u32>(Param(2)), static_cast<s64>(Param(3))).raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), Param(arm, 1), static_cast<u32>(Param(arm, 2)),
+                         static_cast<s64>(Param(arm, 3)))
+                        .raw);
 }
 
 template <ResultCode func(u64*, u64, u64, u64)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u64 param_1 = 0;
-    u32 retval = func(&param_1, Param(1), Param(2), Param(3)).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, Param(arm, 1), Param(arm, 2), Param(arm, 3)).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32*, u64, u64, u64, u32, s32)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    u32 retval = func(&param_1, Param(1), Param(2), Param(3), static_cast<u32>(Param(4)),
-                      static_cast<s32>(Param(5)))
+    u32 retval = func(&param_1, Param(arm, 1), Param(arm, 2), Param(arm, 3),
+                      static_cast<u32>(Param(arm, 4)), static_cast<s32>(Param(arm, 5)))
                      .raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u32*, u64, u64, u32)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    u32 retval = func(&param_1, Param(1), Param(2), static_cast<u32>(Param(3))).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, Param(arm, 1), Param(arm, 2), static_cast<u32>(Param(arm, 3))).raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(Handle*, u64, u32, u32)>
 void SvcWrap() {
+    auto& arm = Core::CurrentArmInterface();
     u32 param_1 = 0;
-    u32 retval =
-        func(&param_1, Param(1), static_cast<u32>(Param(2)), static_cast<u32>(Param(3))).raw;
-    Core::CurrentArmInterface().SetReg(1, param_1);
-    FuncReturn(retval);
+    u32 retval = func(&param_1, Param(arm, 1), static_cast<u32>(Param(arm, 2)),
+                      static_cast<u32>(Param(arm, 3)))
+                     .raw;
+    arm.SetReg(1, param_1);
+    FuncReturn(arm, retval);
 }
 
 template <ResultCode func(u64, u32, s32, s64)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), static_cast<u32>(Param(1)), static_cast<s32>(Param(2)),
-                    static_cast<s64>(Param(3)))
-                   .raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), static_cast<u32>(Param(arm, 1)),
+                         static_cast<s32>(Param(arm, 2)), static_cast<s64>(Param(arm, 3)))
+                        .raw);
 }
 
 template <ResultCode func(u64, u32, s32, s32)>
 void SvcWrap() {
-    FuncReturn(func(Param(0), static_cast<u32>(Param(1)), static_cast<s32>(Param(2)),
-                    static_cast<s32>(Param(3)))
-                   .raw);
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func(Param(arm, 0), static_cast<u32>(Param(arm, 1)),
+                         static_cast<s32>(Param(arm, 2)), static_cast<s32>(Param(arm, 3)))
+                        .raw);
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -230,7 +269,8 @@ void SvcWrap() {
 
 template <u32 func()>
 void SvcWrap() {
-    FuncReturn(func());
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -238,7 +278,8 @@ void SvcWrap() {
 
 template <u64 func()>
 void SvcWrap() {
-    FuncReturn(func());
+    auto& arm = Core::CurrentArmInterface();
+    FuncReturn(arm, func());
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,22 +292,26 @@ void SvcWrap() {
 
 template <void func(s64)>
 void SvcWrap() {
-    func(static_cast<s64>(Param(0)));
+    auto& arm = Core::CurrentArmInterface();
+    func(static_cast<s64>(Param(arm, 0)));
 }
 
 template <void func(u64, u64 len)>
 void SvcWrap() {
-    func(Param(0), Param(1));
+    auto& arm = Core::CurrentArmInterface();
+    func(Param(arm, 0), Param(arm, 1));
 }
 
 template <void func(u64, u64, u64)>
 void SvcWrap() {
-    func(Param(0), Param(1), Param(2));
+    auto& arm = Core::CurrentArmInterface();
+    func(Param(arm, 0), Param(arm, 1), Param(arm, 2));
 }
 
 template <void func(u32, u64, u64)>
 void SvcWrap() {
-    func(static_cast<u32>(Param(0)), Param(1), Param(2));
+    auto& arm = Core::CurrentArmInterface();
+    func(static_cast<u32>(Param(arm, 0)), Param(arm, 1), Param(arm, 2));
 }
 
 } // namespace Kernel
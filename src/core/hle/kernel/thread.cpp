@@ -19,6 +19,7 @@
 #include "core/core_cpu.h"
 #include "core/core_timing.h"
 #include "core/core_timing_util.h"
+#include "core/hle/kernel/address_arbiter.h"
 #include "core/hle/kernel/errors.h"
 #include "core/hle/kernel/handle_table.h"
 #include "core/hle/kernel/kernel.h"
@@ -56,6 +57,9 @@ void Thread::Stop() {
 
     status = ThreadStatus::Dead;
 
+    // Remove the thread from the arbiter's waiter buckets if it was terminated mid-wait.
+    SetArbiterWaitAddress(0);
+
     WakeupAllWaitingThreads();
 
     // Clean up any dangling references in objects that this thread was waiting for
@@ -198,11 +202,11 @@ ResultVal<SharedPtr<Thread>> Thread::Create(KernelCore& kernel, std::string name
     thread->mutex_wait_address = 0;
     thread->condvar_wait_address = 0;
     thread->wait_handle = 0;
-    thread->name = std::move(name);
+    thread->SetName(std::move(name));
     thread->callback_handle = kernel.ThreadWakeupCallbackHandleTable().Create(thread).Unwrap();
     thread->owner_process = &owner_process;
     thread->scheduler = &Core::System::GetInstance().Scheduler(processor_id);
-    thread->scheduler->AddThread(thread, priority);
+    thread->scheduler->AddThread(thread);
     thread->tls_address = thread->owner_process->MarkNextAvailableTLSSlotAsUsed(*thread);
 
     // TODO(peachum): move to ScheduleThread() when scheduler is added so selected core is used
@@ -255,6 +259,22 @@ void Thread::SetWaitSynchronizationOutput(s32 output) {
     context.cpu_registers[1] = output;
 }
 
+void Thread::SetArbiterWaitAddress(VAddr address) {
+    if (arb_wait_address == address) {
+        return;
+    }
+
+    if (arb_wait_address != 0) {
+        AddressArbiter::RemoveWaitingThread(this);
+    }
+
+    arb_wait_address = address;
+
+    if (address != 0) {
+        AddressArbiter::AddWaitingThread(this);
+    }
+}
+
 s32 Thread::GetWaitObjectIndex(WaitObject* object) const {
     ASSERT_MSG(!wait_objects.empty(), "Thread is not waiting for anything");
     auto match = std::find(wait_objects.rbegin(), wait_objects.rend(), object);
@@ -295,8 +315,15 @@ void Thread::AddMutexWaiter(SharedPtr<Thread> thread) {
     auto itr = std::find(wait_mutex_threads.begin(), wait_mutex_threads.end(), thread);
     ASSERT(itr == wait_mutex_threads.end());
 
+    // Keep the list sorted by priority, so the highest priority waiter is always at the front
+    // and release/priority propagation don't have to scan it.
+    const auto insertion_point =
+        std::find_if(wait_mutex_threads.begin(), wait_mutex_threads.end(),
+                     [&thread](const auto& entry) {
+                         return entry->GetPriority() > thread->GetPriority();
+                     });
     thread->lock_owner = this;
-    wait_mutex_threads.emplace_back(std::move(thread));
+    wait_mutex_threads.insert(insertion_point, std::move(thread));
     UpdatePriority();
 }
 
@@ -313,11 +340,12 @@ void Thread::RemoveMutexWaiter(SharedPtr<Thread> thread) {
 }
 
 void Thread::UpdatePriority() {
-    // Find the highest priority among all the threads that are waiting for this thread's lock
+    // If any of the threads waiting on this thread's locks has a higher priority, inherit it.
+    // The waiter list is sorted, so the front holds the highest priority waiter.
     u32 new_priority = nominal_priority;
-    for (const auto& thread : wait_mutex_threads) {
-        if (thread->nominal_priority < new_priority)
-            new_priority = thread->nominal_priority;
+    if (!wait_mutex_threads.empty() &&
+        wait_mutex_threads.front()->current_priority < new_priority) {
+        new_priority = wait_mutex_threads.front()->current_priority;
     }
 
     if (new_priority == current_priority)
@@ -327,9 +355,16 @@ void Thread::UpdatePriority() {
 
     current_priority = new_priority;
 
+    if (!lock_owner)
+        return;
+
+    // Reposition this thread within its lock owner's waiter list to keep it sorted.
+    SharedPtr<Thread> old_owner = lock_owner;
+    lock_owner->RemoveMutexWaiter(this);
+    old_owner->AddMutexWaiter(this);
+
     // Recursively update the priority of the thread that depends on the priority of this one.
-    if (lock_owner)
-        lock_owner->UpdatePriority();
+    lock_owner->UpdatePriority();
 }
 
 void Thread::ChangeCore(u32 core, u64 mask) {
@@ -361,7 +396,7 @@ void Thread::ChangeScheduler() {
     if (*new_processor_id != processor_id) {
         // Remove thread from previous core's scheduler
         scheduler->RemoveThread(this);
-        next_scheduler.AddThread(this, current_priority);
+        next_scheduler.AddThread(this);
     }
 
     processor_id = *new_processor_id;
@@ -9,9 +9,12 @@
 #include <string>
 #include <vector>
 
+#include <boost/container/static_vector.hpp>
+
 #include "common/common_types.h"
 #include "core/arm/arm_interface.h"
 #include "core/hle/kernel/object.h"
+#include "core/hle/kernel/slab_heap.h"
 #include "core/hle/kernel/wait_object.h"
 #include "core/hle/result.h"
 
@@ -61,7 +64,7 @@ enum class ThreadWakeupReason {
     Timeout // The thread was woken up due to a wait timeout.
 };
 
-class Thread final : public WaitObject {
+class Thread final : public WaitObject, public SlabAllocated<Thread> {
 public:
     using TLSMemory = std::vector<u8>;
     using TLSMemoryPtr = std::shared_ptr<TLSMemory>;
@@ -70,7 +73,12 @@ public:
 
     using ThreadContext = Core::ARM_Interface::ThreadContext;
 
-    using ThreadWaitObjects = std::vector<SharedPtr<WaitObject>>;
+    /// Maximum number of objects a thread can wait on at once; the Switch kernel caps
+    /// svcWaitSynchronization handle lists at this size.
+    static constexpr std::size_t MaxWaitObjects = 0x40;
+
+    /// Inline fixed-capacity list, so building and storing a wait list never allocates
+    using ThreadWaitObjects = boost::container::static_vector<SharedPtr<WaitObject>, MaxWaitObjects>;
 
     using WakeupCallback = std::function<bool(ThreadWakeupReason reason, SharedPtr<Thread> thread,
                                               SharedPtr<WaitObject> object, std::size_t index)>;
@@ -92,10 +100,7 @@ public:
                                                s32 processor_id, VAddr stack_top,
                                                Process& owner_process);
 
-    std::string GetName() const override {
-        return name;
-    }
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "Thread";
     }
 
@@ -334,9 +339,9 @@ public:
         return arb_wait_address;
     }
 
-    void SetArbiterWaitAddress(VAddr address) {
-        arb_wait_address = address;
-    }
+    /// Sets the address this thread is arbitrating on (0 when not waiting), keeping the
+    /// address arbiter's per-address waiter buckets in sync.
+    void SetArbiterWaitAddress(VAddr address);
 
     void SetGuestHandle(Handle handle) {
         guest_handle = handle;
@@ -437,8 +442,6 @@ private:
     u64 affinity_mask{0x1};
 
     TLSMemoryPtr tls_memory = std::make_shared<TLSMemory>();
-
-    std::string name;
 };
 
 /**
@@ -23,7 +23,7 @@ SharedPtr<Timer> Timer::Create(KernelCore& kernel, ResetType reset_type, std::st
 
     timer->reset_type = reset_type;
     timer->signaled = false;
-    timer->name = std::move(name);
+    timer->SetName(std::move(name));
     timer->initial_delay = 0;
     timer->interval_delay = 0;
     timer->callback_handle = kernel.CreateTimerCallbackHandle(timer).Unwrap();
@@ -6,13 +6,14 @@
 
 #include "common/common_types.h"
 #include "core/hle/kernel/object.h"
+#include "core/hle/kernel/slab_heap.h"
 #include "core/hle/kernel/wait_object.h"
 
 namespace Kernel {
 
 class KernelCore;
 
-class Timer final : public WaitObject {
+class Timer final : public WaitObject, public SlabAllocated<Timer> {
 public:
     /**
      * Creates a timer
@@ -24,12 +25,9 @@ public:
     static SharedPtr<Timer> Create(KernelCore& kernel, ResetType reset_type,
                                    std::string name = "Unknown");
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "Timer";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::Timer;
     HandleType GetHandleType() const override {
@@ -80,8 +78,7 @@ private:
     u64 initial_delay;  ///< The delay until the timer fires for the first time
     u64 interval_delay; ///< The delay until the timer fires after the first time
 
-    bool signaled;    ///< Whether the timer has been signaled or not
-    std::string name; ///< Name of timer (optional)
+    bool signaled; ///< Whether the timer has been signaled or not
 
     /// Handle used as userdata to reference this object when inserting into the CoreTiming queue.
     Handle callback_handle;
@@ -82,9 +82,19 @@ void VMManager::Reset(FileSys::ProgramAddressSpaceType type) {
 VMManager::VMAHandle VMManager::FindVMA(VAddr target) const {
     if (target >= address_space_end) {
         return vma_map.end();
-    } else {
-        return std::prev(vma_map.upper_bound(target));
     }
+
+    // Try the last result first; repeated queries tend to hit the same VMA.
+    if (last_found_vma_valid) {
+        const VirtualMemoryArea& vma = last_found_vma->second;
+        if (target >= vma.base && target - vma.base < vma.size) {
+            return last_found_vma;
+        }
+    }
+
+    last_found_vma = std::prev(vma_map.upper_bound(target));
+    last_found_vma_valid = true;
+    return last_found_vma;
 }
 
 bool VMManager::IsValidHandle(VMAHandle handle) const {
@@ -94,7 +104,7 @@ bool VMManager::IsValidHandle(VMAHandle handle) const {
 ResultVal<VMManager::VMAHandle> VMManager::MapMemoryBlock(VAddr target,
                                                           std::shared_ptr<std::vector<u8>> block,
                                                           std::size_t offset, u64 size,
-                                                          MemoryState state) {
+                                                          MemoryState state, VMAPermission perms) {
     ASSERT(block != nullptr);
     ASSERT(offset + size <= block->size());
 
@@ -114,12 +124,14 @@ ResultVal<VMManager::VMAHandle> VMManager::MapMemoryBlock(VAddr target,
                                             VMAPermission::ReadWriteExecute);
 
     final_vma.type = VMAType::AllocatedMemoryBlock;
-    final_vma.permissions = VMAPermission::ReadWrite;
+    final_vma.permissions = perms;
     final_vma.meminfo_state = state;
     final_vma.backing_block = std::move(block);
     final_vma.offset = offset;
     UpdatePageTableForVMA(final_vma);
 
+    physical_memory_mapped += size;
+
     return MakeResult<VMAHandle>(MergeAdjacent(vma_handle));
 }
 
@@ -144,6 +156,8 @@ ResultVal<VMManager::VMAHandle> VMManager::MapBackingMemory(VAddr target, u8* me
     final_vma.backing_memory = memory;
     UpdatePageTableForVMA(final_vma);
 
+    physical_memory_mapped += size;
+
     return MakeResult<VMAHandle>(MergeAdjacent(vma_handle));
 }
 
@@ -185,33 +199,40 @@ ResultVal<VMManager::VMAHandle> VMManager::MapMMIO(VAddr target, PAddr paddr, u6
     return MakeResult<VMAHandle>(MergeAdjacent(vma_handle));
 }
 
-VMManager::VMAIter VMManager::Unmap(VMAIter vma_handle) {
-    VirtualMemoryArea& vma = vma_handle->second;
-    vma.type = VMAType::Free;
-    vma.permissions = VMAPermission::None;
-    vma.meminfo_state = MemoryState::Unmapped;
-
-    vma.backing_block = nullptr;
-    vma.offset = 0;
-    vma.backing_memory = nullptr;
-    vma.paddr = 0;
-
-    UpdatePageTableForVMA(vma);
-
-    return MergeAdjacent(vma_handle);
-}
-
 ResultCode VMManager::UnmapRange(VAddr target, u64 size) {
     CASCADE_RESULT(VMAIter vma, CarveVMARange(target, size));
     const VAddr target_end = target + size;
 
+    // Mark every VMA in the range as free first, then update the page table and merge in one go
+    // at the end, instead of paying for a page table walk and a merge per VMA.
     const VMAIter end = vma_map.end();
-    // The comparison against the end of the range must be done using addresses since VMAs can be
-    // merged during this process, causing invalidation of the iterators.
-    while (vma != end && vma->second.base < target_end) {
-        vma = std::next(Unmap(vma));
+    for (VMAIter iter = vma; iter != end && iter->second.base < target_end; ++iter) {
+        VirtualMemoryArea& vma_ref = iter->second;
+        if (vma_ref.type == VMAType::AllocatedMemoryBlock ||
+            vma_ref.type == VMAType::BackingMemory) {
+            physical_memory_mapped -= vma_ref.size;
+        }
+        vma_ref.type = VMAType::Free;
+        vma_ref.permissions = VMAPermission::None;
+        vma_ref.meminfo_state = MemoryState::Unmapped;
+
+        vma_ref.backing_block = nullptr;
+        vma_ref.offset = 0;
+        vma_ref.backing_memory = nullptr;
+        vma_ref.paddr = 0;
     }
 
+    Memory::UnmapRegion(page_table, target, size);
+
+    // All VMAs in the range are now free and mutually mergeable; fold them into the first one
+    // before merging with any free neighbors of the range.
+    last_found_vma_valid = false;
+    while (std::next(vma) != end && vma->second.CanBeMergedWith(std::next(vma)->second)) {
+        vma->second.size += std::next(vma)->second.size;
+        vma_map.erase(std::next(vma));
+    }
+    MergeAdjacent(vma);
+
     ASSERT(FindVMA(target)->second.size >= size);
 
     auto& system = Core::System::GetInstance();
@@ -471,6 +492,9 @@ VMManager::VMAIter VMManager::SplitVMA(VMAIter vma_handle, u64 offset_in_vma) {
 }
 
 VMManager::VMAIter VMManager::MergeAdjacent(VMAIter iter) {
+    // The cached lookup result may be one of the VMAs erased below.
+    last_found_vma_valid = false;
+
     const VMAIter next_vma = std::next(iter);
     if (next_vma != vma_map.end() && iter->second.CanBeMergedWith(next_vma->second)) {
         iter->second.size += next_vma->second.size;
@@ -582,6 +606,8 @@ void VMManager::Clear() {
 
 void VMManager::ClearVMAMap() {
     vma_map.clear();
+    last_found_vma_valid = false;
+    physical_memory_mapped = 0;
 }
 
 void VMManager::ClearPageTable() {
@@ -592,8 +618,7 @@ void VMManager::ClearPageTable() {
 }
 
 u64 VMManager::GetTotalMemoryUsage() const {
-    LOG_WARNING(Kernel, "(STUBBED) called");
-    return 0xF8000000;
+    return physical_memory_mapped;
 }
 
 u64 VMManager::GetTotalHeapUsage() const {
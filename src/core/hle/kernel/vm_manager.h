@@ -243,9 +243,12 @@ public:
      * @param offset Offset into `block` to map from.
      * @param size Size of the mapping.
      * @param state MemoryState tag to attach to the VMA.
+     * @param perms Initial permissions of the VMA; passing them here avoids a separate
+     * ReprotectRange pass that would re-carve the freshly merged region.
      */
     ResultVal<VMAHandle> MapMemoryBlock(VAddr target, std::shared_ptr<std::vector<u8>> block,
-                                        std::size_t offset, u64 size, MemoryState state);
+                                        std::size_t offset, u64 size, MemoryState state,
+                                        VMAPermission perms = VMAPermission::ReadWrite);
 
     /**
      * Maps an unmanaged host memory pointer at a given address.
@@ -393,9 +396,6 @@ private:
     /// Converts a VMAHandle to a mutable VMAIter.
     VMAIter StripIterConstness(const VMAHandle& iter);
 
-    /// Unmaps the given VMA.
-    VMAIter Unmap(VMAIter vma);
-
     /**
      * Carves a VMA of a specific size at the specified address by splitting Free VMAs while doing
      * the appropriate error checking.
@@ -444,6 +444,15 @@ private:
      */
     VMAMap vma_map;
 
+    /**
+     * Cached result of the last FindVMA call. svcQueryMemory-heavy titles probe the same
+     * neighborhood thousands of times per second, so checking this before descending the tree
+     * turns most lookups into a single range test. Must be invalidated whenever elements are
+     * erased from the map, since the cached iterator may be among them.
+     */
+    mutable VMAHandle last_found_vma;
+    mutable bool last_found_vma_valid = false;
+
     u32 address_space_width = 0;
     VAddr address_space_base = 0;
     VAddr address_space_end = 0;
@@ -475,5 +484,10 @@ private:
     VAddr heap_start = 0;
     VAddr heap_end = 0;
     u64 heap_used = 0;
+
+    // Running total of memory backed by an allocation or by backing memory, maintained at
+    // map/unmap time so usage queries don't have to walk the VMA map. MMIO mappings consume no
+    // physical memory and are not counted.
+    u64 physical_memory_mapped = 0;
 };
 } // namespace Kernel
@@ -30,40 +30,6 @@ void WaitObject::RemoveWaitingThread(Thread* thread) {
         waiting_threads.erase(itr);
 }
 
-SharedPtr<Thread> WaitObject::GetHighestPriorityReadyThread() {
-    Thread* candidate = nullptr;
-    u32 candidate_priority = THREADPRIO_LOWEST + 1;
-
-    for (const auto& thread : waiting_threads) {
-        const ThreadStatus thread_status = thread->GetStatus();
-
-        // The list of waiting threads must not contain threads that are not waiting to be awakened.
-        ASSERT_MSG(thread_status == ThreadStatus::WaitSynchAny ||
-                       thread_status == ThreadStatus::WaitSynchAll ||
-                       thread_status == ThreadStatus::WaitHLEEvent,
-                   "Inconsistent thread statuses in waiting_threads");
-
-        if (thread->GetPriority() >= candidate_priority)
-            continue;
-
-        if (ShouldWait(thread.get()))
-            continue;
-
-        // A thread is ready to run if it's either in ThreadStatus::WaitSynchAny or
-        // in ThreadStatus::WaitSynchAll and the rest of the objects it is waiting on are ready.
-        bool ready_to_run = true;
-        if (thread_status == ThreadStatus::WaitSynchAll) {
-            ready_to_run = thread->AllWaitObjectsReady();
-        }
-
-        if (ready_to_run) {
-            candidate = thread.get();
-            candidate_priority = thread->GetPriority();
-        }
-    }
-
-    return candidate;
-}
 
 void WaitObject::WakeupWaitingThread(SharedPtr<Thread> thread) {
     ASSERT(!ShouldWait(thread.get()));
@@ -98,7 +64,47 @@ void WaitObject::WakeupWaitingThread(SharedPtr<Thread> thread) {
 }
 
 void WaitObject::WakeupAllWaitingThreads() {
-    while (auto thread = GetHighestPriorityReadyThread()) {
+    // Most signals find nobody waiting (IPC completion events are usually polled before the guest
+    // ever blocks on them), so bail out before building the candidate list - this keeps the common
+    // signal path free of allocations and reference count traffic.
+    if (waiting_threads.empty()) {
+        return;
+    }
+
+    // Sort the waiters by priority once and walk them in that order, instead of rescanning the
+    // entire list for a fresh highest-priority candidate after every single wakeup. Waking a
+    // thread can consume the signal again (one-shot events, session requests), so readiness is
+    // still re-evaluated for every candidate right before it is woken.
+    std::vector<SharedPtr<Thread>> candidates{waiting_threads};
+    std::stable_sort(candidates.begin(), candidates.end(),
+                     [](const SharedPtr<Thread>& lhs, const SharedPtr<Thread>& rhs) {
+                         return lhs->GetPriority() < rhs->GetPriority();
+                     });
+
+    for (const auto& thread : candidates) {
+        // An earlier wakeup (or its wakeup callback) may have already removed this thread from
+        // the waiting list through one of the other objects it was waiting on.
+        if (std::find(waiting_threads.begin(), waiting_threads.end(), thread) ==
+            waiting_threads.end()) {
+            continue;
+        }
+
+        const ThreadStatus thread_status = thread->GetStatus();
+
+        // The list of waiting threads must not contain threads that are not waiting to be awakened.
+        ASSERT_MSG(thread_status == ThreadStatus::WaitSynchAny ||
+                       thread_status == ThreadStatus::WaitSynchAll ||
+                       thread_status == ThreadStatus::WaitHLEEvent,
+                   "Inconsistent thread statuses in waiting_threads");
+
+        if (ShouldWait(thread.get()))
+            continue;
+
+        // A thread is ready to run if it's either in ThreadStatus::WaitSynchAny or
+        // in ThreadStatus::WaitSynchAll and the rest of the objects it is waiting on are ready.
+        if (thread_status == ThreadStatus::WaitSynchAll && !thread->AllWaitObjectsReady())
+            continue;
+
         WakeupWaitingThread(thread);
     }
 }
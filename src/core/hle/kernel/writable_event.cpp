@@ -20,9 +20,9 @@ EventPair WritableEvent::CreateEventPair(KernelCore& kernel, ResetType reset_typ
     SharedPtr<WritableEvent> writable_event(new WritableEvent(kernel));
     SharedPtr<ReadableEvent> readable_event(new ReadableEvent(kernel));
 
-    writable_event->name = name + ":Writable";
+    writable_event->SetName(name + ":Writable");
     writable_event->readable = readable_event;
-    readable_event->name = name + ":Readable";
+    readable_event->SetName(name + ":Readable");
     readable_event->signaled = false;
     readable_event->reset_type = reset_type;
 
@@ -6,6 +6,7 @@
 
 #include "common/common_types.h"
 #include "core/hle/kernel/object.h"
+#include "core/hle/kernel/slab_heap.h"
 #include "core/hle/kernel/wait_object.h"
 
 namespace Kernel {
@@ -19,7 +20,7 @@ struct EventPair {
     SharedPtr<WritableEvent> writable;
 };
 
-class WritableEvent final : public Object {
+class WritableEvent final : public Object, public SlabAllocated<WritableEvent> {
 public:
     ~WritableEvent() override;
 
@@ -32,12 +33,9 @@ public:
     static EventPair CreateEventPair(KernelCore& kernel, ResetType reset_type,
                                      std::string name = "Unknown");
 
-    std::string GetTypeName() const override {
+    std::string_view GetTypeName() const override {
         return "WritableEvent";
     }
-    std::string GetName() const override {
-        return name;
-    }
 
     static const HandleType HANDLE_TYPE = HandleType::WritableEvent;
     HandleType GetHandleType() const override {
@@ -56,8 +54,6 @@ private:
     explicit WritableEvent(KernelCore& kernel);
 
     SharedPtr<ReadableEvent> readable;
-
-    std::string name; ///< Name of event (optional)
 };
 
 } // namespace Kernel
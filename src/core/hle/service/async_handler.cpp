@@ -0,0 +1,89 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include "common/assert.h"
+#include "common/detached_tasks.h"
+#include "core/core_timing.h"
+#include "core/hle/kernel/hle_ipc.h"
+#include "core/hle/kernel/thread.h"
+#include "core/hle/kernel/writable_event.h"
+#include "core/hle/service/async_handler.h"
+
+namespace Service {
+
+namespace {
+
+std::mutex completion_mutex;
+
+/// Wakeup events of in-flight deferred requests, keyed by the completion id passed through
+/// core timing as event userdata
+std::unordered_map<u64, Kernel::SharedPtr<Kernel::WritableEvent>> pending_completions;
+
+u64 next_completion_id;
+
+CoreTiming::EventType* async_completion_event = nullptr;
+
+/// Runs on the emulation thread via the threadsafe core-timing queue once a worker has finished
+void AsyncCompletionCallback(u64 userdata, int cycles_late) {
+    Kernel::SharedPtr<Kernel::WritableEvent> event;
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        const auto iter = pending_completions.find(userdata);
+        if (iter == pending_completions.end()) {
+            // Shutdown dropped the completion while the worker was still running
+            return;
+        }
+        event = std::move(iter->second);
+        pending_completions.erase(iter);
+    }
+    event->Signal();
+}
+
+} // Anonymous namespace
+
+void InitAsyncHandlers() {
+    async_completion_event =
+        CoreTiming::RegisterEvent("AsyncServiceCompletion", AsyncCompletionCallback);
+}
+
+void ShutdownAsyncHandlers() {
+    // Workers may still be running and schedule completions after this point; the callback
+    // treats ids without a pending entry as already dropped.
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        pending_completions.clear();
+    }
+    CoreTiming::RemoveNormalAndThreadsafeEvent(async_completion_event);
+}
+
+void RunAsync(Kernel::HLERequestContext& ctx, const std::string& name, std::function<void()> work,
+              std::function<void(Kernel::HLERequestContext& ctx)> reply) {
+    ASSERT_MSG(async_completion_event != nullptr, "Async handlers have not been initialized");
+
+    auto event = ctx.SleepClientThread(
+        Kernel::GetCurrentThread(), name, -1,
+        [reply](Kernel::SharedPtr<Kernel::Thread> thread, Kernel::HLERequestContext& ctx,
+                Kernel::ThreadWakeupReason reason) { reply(ctx); });
+
+    u64 id;
+    {
+        std::lock_guard<std::mutex> lock(completion_mutex);
+        id = next_completion_id++;
+        pending_completions.emplace(id, std::move(event));
+    }
+
+    // The wait-handle submission path is used so the task cannot be dropped on queue pressure;
+    // the guest thread stays asleep until the completion is posted.
+    Common::DetachedTasks::AddTaskWithHandle(
+        Common::DetachedTasks::Priority::LatencySensitive, [work = std::move(work), id] {
+            work();
+            CoreTiming::ScheduleEventThreadsafe(0, async_completion_event, id);
+        });
+}
+
+} // namespace Service
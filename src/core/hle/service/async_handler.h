@@ -0,0 +1,40 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <functional>
+#include <string>
+
+namespace Kernel {
+class HLERequestContext;
+}
+
+namespace Service {
+
+/// Registers the core-timing event used to post deferred replies. Must be called during service
+/// initialization, after CoreTiming::Init.
+void InitAsyncHandlers();
+
+/// Drops any still-pending deferred replies and unregisters from core timing.
+void ShutdownAsyncHandlers();
+
+/**
+ * Defers the reply to the current IPC request and runs `work` on the shared worker pool, so the
+ * guest keeps executing while the host performs the operation. Once `work` completes, `reply` is
+ * invoked on the emulation thread to write the command response, and the client thread is woken.
+ *
+ * `work` runs off the emulation thread and must only touch state that is safe to access
+ * concurrently with guest execution; everything that builds the IPC response belongs in `reply`.
+ * The handler must not write a response on this path before returning.
+ *
+ * @param ctx Context of the request whose reply is being deferred.
+ * @param name Name of the operation, for debugging purposes.
+ * @param work Operation to run on the worker pool.
+ * @param reply Invoked on the emulation thread after `work` completes to build the response.
+ */
+void RunAsync(Kernel::HLERequestContext& ctx, const std::string& name, std::function<void()> work,
+              std::function<void(Kernel::HLERequestContext& ctx)> reply);
+
+} // namespace Service
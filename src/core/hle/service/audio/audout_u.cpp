@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <array>
 #include <cstring>
 #include <vector>
@@ -155,15 +156,22 @@ private:
 
         IPC::RequestParser rp{ctx};
         const u64 max_count{ctx.GetWriteBufferSize() / sizeof(u64)};
-        const auto released_buffers{audio_core.GetTagsAndReleaseBuffers(stream, max_count)};
 
-        std::vector<u64> tags{released_buffers};
-        tags.resize(max_count);
-        ctx.WriteBuffer(tags);
+        std::size_t released_count{};
+        if (u64* const tags = reinterpret_cast<u64*>(ctx.GetWriteBufferPointer())) {
+            // Drain the released tags directly into the guest buffer instead of staging them in
+            // a temporary vector.
+            released_count = audio_core.GetTagsAndReleaseBuffers(stream, tags, max_count);
+            std::fill(tags + released_count, tags + max_count, u64{});
+        } else {
+            std::vector<u64> staging(max_count);
+            released_count = audio_core.GetTagsAndReleaseBuffers(stream, staging.data(), max_count);
+            ctx.WriteBuffer(staging);
+        }
 
         IPC::ResponseBuilder rb{ctx, 3};
         rb.Push(RESULT_SUCCESS);
-        rb.Push<u32>(static_cast<u32>(released_buffers.size()));
+        rb.Push<u32>(static_cast<u32>(released_count));
     }
 
     void ContainsAudioOutBuffer(Kernel::HLERequestContext& ctx) {
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
 #include <cinttypes>
 #include <cstring>
 #include <iterator>
@@ -22,13 +23,19 @@
 #include "core/file_sys/savedata_factory.h"
 #include "core/file_sys/system_archive/system_archive.h"
 #include "core/file_sys/vfs.h"
+#include "core/file_sys/vfs_journal.h"
 #include "core/hle/ipc_helpers.h"
+#include "core/hle/service/async_handler.h"
 #include "core/hle/kernel/process.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/hle/service/filesystem/fsp_srv.h"
 
 namespace Service::FileSystem {
 
+/// Reads at least this large are deferred to the worker pool so guest execution can overlap the
+/// host I/O; smaller reads reply inline, where the deferral overhead would outweigh the transfer.
+constexpr std::size_t ASYNC_READ_THRESHOLD = 0x10000;
+
 enum class FileSystemType : u8 {
     Invalid0 = 0,
     Invalid1 = 1,
@@ -79,10 +86,26 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        // Read the data from the Storage backend, directly into the guest buffer when it is
+        // contiguous in host memory so large transfers skip the intermediate vector.
+        const auto read_size{
+            std::min(static_cast<std::size_t>(length), ctx.GetWriteBufferSize())};
+        if (u8* const output = ctx.GetWriteBufferPointer()) {
+            if (read_size >= ASYNC_READ_THRESHOLD) {
+                RunAsync(ctx, "IStorage::Read",
+                         [backend = backend, output, read_size, offset] {
+                             backend->Read(output, read_size, offset);
+                         },
+                         [](Kernel::HLERequestContext& ctx) {
+                             IPC::ResponseBuilder rb{ctx, 2};
+                             rb.Push(RESULT_SUCCESS);
+                         });
+                return;
+            }
+            backend->Read(output, read_size, offset);
+        } else {
+            ctx.WriteBuffer(backend->ReadBytes(read_size, offset));
+        }
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(RESULT_SUCCESS);
@@ -135,15 +158,48 @@ private:
             return;
         }
 
-        // Read the data from the Storage backend
-        std::vector<u8> output = backend->ReadBytes(length, offset);
+        // Read the data from the file backend, directly into the guest buffer when it is
+        // contiguous in host memory so large transfers skip the intermediate vector.
+        const auto requested_size{
+            std::min(static_cast<std::size_t>(length), ctx.GetWriteBufferSize())};
+        if (requested_size >= ASYNC_READ_THRESHOLD) {
+            if (u8* const output = ctx.GetWriteBufferPointer()) {
+                auto async_read_size = std::make_shared<std::size_t>();
+                RunAsync(ctx, "IFile::Read",
+                         [backend = backend, output, requested_size, offset, async_read_size] {
+                             *async_read_size = backend->Read(output, requested_size, offset);
+                         },
+                         [async_read_size](Kernel::HLERequestContext& ctx) {
+                             IPC::ResponseBuilder rb{ctx, 4};
+                             rb.Push(RESULT_SUCCESS);
+                             rb.Push(static_cast<u64>(*async_read_size));
+                         });
+            } else {
+                auto staging = std::make_shared<std::vector<u8>>();
+                RunAsync(ctx, "IFile::Read",
+                         [backend = backend, requested_size, offset, staging] {
+                             *staging = backend->ReadBytes(requested_size, offset);
+                         },
+                         [staging](Kernel::HLERequestContext& ctx) {
+                             const auto read_size = ctx.WriteBuffer(*staging);
+                             IPC::ResponseBuilder rb{ctx, 4};
+                             rb.Push(RESULT_SUCCESS);
+                             rb.Push(static_cast<u64>(read_size));
+                         });
+            }
+            return;
+        }
 
-        // Write the data to memory
-        ctx.WriteBuffer(output);
+        std::size_t read_size{};
+        if (u8* const output = ctx.GetWriteBufferPointer()) {
+            read_size = backend->Read(output, requested_size, offset);
+        } else {
+            read_size = ctx.WriteBuffer(backend->ReadBytes(requested_size, offset));
+        }
 
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
-        rb.Push(static_cast<u64>(output.size()));
+        rb.Push(static_cast<u64>(read_size));
     }
 
     void Write(Kernel::HLERequestContext& ctx) {
@@ -168,17 +224,23 @@ private:
             return;
         }
 
-        const std::vector<u8> data = ctx.ReadBuffer();
+        const std::size_t buffer_size = ctx.GetReadBufferSize();
 
         ASSERT_MSG(
-            static_cast<s64>(data.size()) <= length,
+            static_cast<s64>(buffer_size) <= length,
             "Attempting to write more data than requested (requested={:016X}, actual={:016X}).",
-            length, data.size());
-
-        // Write the data to the Storage backend
-        const auto write_size =
-            static_cast<std::size_t>(std::distance(data.begin(), data.begin() + length));
-        const std::size_t written = backend->Write(data.data(), write_size, offset);
+            length, buffer_size);
+
+        // Write the data to the file backend, consuming the guest buffer in place when it is
+        // contiguous in host memory so large transfers skip the intermediate vector.
+        const auto write_size = std::min(static_cast<std::size_t>(length), buffer_size);
+        std::size_t written{};
+        if (const u8* const data = ctx.GetReadBufferPointer()) {
+            written = backend->Write(data, write_size, offset);
+        } else {
+            const std::vector<u8> staging = ctx.ReadBuffer();
+            written = backend->Write(staging.data(), write_size, offset);
+        }
 
         ASSERT_MSG(static_cast<s64>(written) == length,
                    "Could not write all bytes to file (requested={:016X}, actual={:016X}).", length,
@@ -289,8 +351,10 @@ private:
 
 class IFileSystem final : public ServiceFramework<IFileSystem> {
 public:
-    explicit IFileSystem(FileSys::VirtualDir backend)
-        : ServiceFramework("IFileSystem"), backend(std::move(backend)) {
+    explicit IFileSystem(FileSys::VirtualDir backend,
+                         std::shared_ptr<FileSys::VfsJournal> journal = nullptr)
+        : ServiceFramework("IFileSystem"), backend(std::move(backend)),
+          journal(std::move(journal)) {
         static const FunctionInfo functions[] = {
             {0, &IFileSystem::CreateFile, "CreateFile"},
             {1, &IFileSystem::DeleteFile, "DeleteFile"},
@@ -473,7 +537,13 @@ public:
     }
 
     void Commit(Kernel::HLERequestContext& ctx) {
-        LOG_WARNING(Service_FS, "(STUBBED) called");
+        if (journal == nullptr) {
+            LOG_WARNING(Service_FS, "(STUBBED) called");
+        } else {
+            LOG_DEBUG(Service_FS, "called");
+            if (!journal->Commit())
+                LOG_ERROR(Service_FS, "Failed to flush staged writes to the backing filesystem");
+        }
 
         IPC::ResponseBuilder rb{ctx, 2};
         rb.Push(RESULT_SUCCESS);
@@ -481,6 +551,7 @@ public:
 
 private:
     VfsDirectoryServiceWrapper backend;
+    std::shared_ptr<FileSys::VfsJournal> journal;
 };
 
 class ISaveDataInfoReader final : public ServiceFramework<ISaveDataInfoReader> {
@@ -784,7 +855,13 @@ void FSP_SRV::MountSaveData(Kernel::HLERequestContext& ctx) {
         return;
     }
 
-    IFileSystem filesystem(std::move(dir.Unwrap()));
+    // Saves go through a journaled layer: writes are staged in memory and only the dirty extents
+    // are written out when the game commits, batching host filesystem traffic per commit rather
+    // than per write.
+    auto journal = std::make_shared<FileSys::VfsJournal>();
+    IFileSystem filesystem(
+        std::make_shared<FileSys::JournaledVfsDirectory>(std::move(dir.Unwrap()), journal),
+        std::move(journal));
 
     IPC::ResponseBuilder rb{ctx, 2, 0, 1};
     rb.Push(RESULT_SUCCESS);
@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <array>
+#include <cstring>
 #include "common/common_types.h"
 #include "common/swap.h"
 
@@ -41,5 +43,21 @@ protected:
         s64_le entry_count;
     };
     static_assert(sizeof(CommonHeader) == 0x20, "CommonHeader is an invalid size");
+
+    /**
+     * Copies the parts of a sampling ring that changed this update - the common header and the
+     * entry the ring was advanced to - into shared memory at the given offset. The remaining
+     * entries were written on previous updates and already match shared memory, so rewriting the
+     * whole block every tick is wasted bandwidth. The ring layout must be the header immediately
+     * followed by the entry array, which is how all HID shared memory sections are laid out.
+     */
+    template <typename State, std::size_t N>
+    static void WriteRingUpdate(u8* data, std::size_t offset, const CommonHeader& header,
+                                const std::array<State, N>& entries) {
+        std::memcpy(data + offset, &header, sizeof(CommonHeader));
+        const auto entry_index = static_cast<std::size_t>(header.last_entry_index);
+        std::memcpy(data + offset + sizeof(CommonHeader) + entry_index * sizeof(State),
+                    &entries[entry_index], sizeof(State));
+    }
 };
 } // namespace Service::HID
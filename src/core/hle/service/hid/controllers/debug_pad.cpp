@@ -66,7 +66,7 @@ void Controller_DebugPad::OnUpdate(u8* data, std::size_t size) {
     cur_entry.r_stick.x = static_cast<s32>(stick_r_x_f * HID_JOYSTICK_MAX);
     cur_entry.r_stick.y = static_cast<s32>(stick_r_y_f * HID_JOYSTICK_MAX);
 
-    std::memcpy(data, &shared_memory, sizeof(SharedMemory));
+    WriteRingUpdate(data, 0, shared_memory.header, shared_memory.pad_states);
 }
 
 void Controller_DebugPad::OnLoadInputDevices() {
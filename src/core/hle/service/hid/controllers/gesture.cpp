@@ -36,7 +36,8 @@ void Controller_Gesture::OnUpdate(u8* data, std::size_t size) {
     cur_entry.sampling_number2 = cur_entry.sampling_number;
     // TODO(ogniK): Update gesture states
 
-    std::memcpy(data + SHARED_MEMORY_OFFSET, &shared_memory, sizeof(SharedMemory));
+    WriteRingUpdate(data, SHARED_MEMORY_OFFSET, shared_memory.header,
+                    shared_memory.gesture_states);
 }
 
 void Controller_Gesture::OnLoadInputDevices() {}
@@ -47,7 +47,7 @@ void Controller_Keyboard::OnUpdate(u8* data, std::size_t size) {
         cur_entry.modifier |= (keyboard_mods[i]->GetStatus() << i);
     }
 
-    std::memcpy(data + SHARED_MEMORY_OFFSET, &shared_memory, sizeof(SharedMemory));
+    WriteRingUpdate(data, SHARED_MEMORY_OFFSET, shared_memory.header, shared_memory.pad_states);
 }
 
 void Controller_Keyboard::OnLoadInputDevices() {
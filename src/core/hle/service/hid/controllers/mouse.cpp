@@ -51,7 +51,7 @@ void Controller_Mouse::OnUpdate(u8* data, std::size_t size) {
         }
     }
 
-    std::memcpy(data + SHARED_MEMORY_OFFSET, &shared_memory, sizeof(SharedMemory));
+    WriteRingUpdate(data, SHARED_MEMORY_OFFSET, shared_memory.header, shared_memory.mouse_states);
 }
 
 void Controller_Mouse::OnLoadInputDevices() {
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <array>
 #include <cstring>
+#include <utility>
 #include "common/assert.h"
 #include "common/bit_field.h"
 #include "common/common_types.h"
@@ -102,6 +103,9 @@ void Controller_NPad::InitNewlyAddedControler(std::size_t controller_idx) {
     if (controller_type == NPadControllerType::None) {
         return;
     }
+    // The style sets and properties below live outside the sampling rings, so the next update
+    // has to rewrite the whole block instead of just the advanced ring entries.
+    full_update_pending = true;
     controller.joy_styles.raw = 0; // Zero out
     controller.device_type.raw = 0;
     switch (controller_type) {
@@ -457,8 +461,32 @@ void Controller_NPad::OnUpdate(u8* data, std::size_t data_len) {
         libnx_entry.pad.l_stick = pad_state.l_stick;
         libnx_entry.pad.r_stick = pad_state.r_stick;
     }
-    std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
-                shared_memory_entries.size() * sizeof(NPadEntry));
+
+    if (std::exchange(full_update_pending, false)) {
+        std::memcpy(data + NPAD_OFFSET, shared_memory_entries.data(),
+                    shared_memory_entries.size() * sizeof(NPadEntry));
+        return;
+    }
+
+    // Nothing outside the sampling rings changed, so only the headers and the entries the rings
+    // advanced to need to be copied out instead of the full 0x32000 byte block.
+    for (std::size_t i = 0; i < shared_memory_entries.size(); ++i) {
+        const auto& npad = shared_memory_entries[i];
+        const std::array<const NPadGeneric*, 7> controller_npads{&npad.main_controller_states,
+                                                                 &npad.handheld_states,
+                                                                 &npad.dual_states,
+                                                                 &npad.left_joy_states,
+                                                                 &npad.right_joy_states,
+                                                                 &npad.pokeball_states,
+                                                                 &npad.libnx};
+        for (const auto* main_controller : controller_npads) {
+            const std::size_t offset =
+                NPAD_OFFSET + i * sizeof(NPadEntry) +
+                static_cast<std::size_t>(reinterpret_cast<const u8*>(main_controller) -
+                                         reinterpret_cast<const u8*>(&npad));
+            WriteRingUpdate(data, offset, main_controller->common, main_controller->npad);
+        }
+    }
 }
 
 void Controller_NPad::SetSupportedStyleSet(NPadType style_set) {
@@ -523,6 +551,7 @@ void Controller_NPad::SetNpadMode(u32 npad_id, NPadAssignments assignment_mode)
     const std::size_t npad_index = NPadIdToIndex(npad_id);
     ASSERT(npad_index < shared_memory_entries.size());
     shared_memory_entries[npad_index].pad_assignment = assignment_mode;
+    full_update_pending = true;
 }
 
 void Controller_NPad::VibrateController(const std::vector<u32>& controller_ids,
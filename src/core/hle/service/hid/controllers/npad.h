@@ -128,14 +128,6 @@ public:
     static u32 IndexToNPad(std::size_t index);
 
 private:
-    struct CommonHeader {
-        s64_le timestamp;
-        s64_le total_entry_count;
-        s64_le last_entry_index;
-        s64_le entry_count;
-    };
-    static_assert(sizeof(CommonHeader) == 0x20, "CommonHeader is an invalid size");
-
     struct ControllerColor {
         u32_le body_color;
         u32_le button_color;
@@ -308,6 +300,9 @@ private:
     Vibration last_processed_vibration{};
     std::array<ControllerHolder, 10> connected_controllers{};
     bool can_controllers_vibrate{true};
+    /// Set when fields outside the sampling rings were modified and the next update must copy the
+    /// whole shared memory block rather than just the advanced ring entries.
+    bool full_update_pending{true};
 
     void InitNewlyAddedControler(std::size_t controller_idx);
     bool IsControllerSupported(NPadControllerType controller) const;
@@ -57,7 +57,8 @@ void Controller_Touchscreen::OnUpdate(u8* data, std::size_t size) {
         cur_entry.entry_count = 0;
     }
 
-    std::memcpy(data + SHARED_MEMORY_OFFSET, &shared_memory, sizeof(TouchScreenSharedMemory));
+    WriteRingUpdate(data, SHARED_MEMORY_OFFSET, shared_memory.header,
+                    shared_memory.shared_memory_entries);
 }
 
 void Controller_Touchscreen::OnLoadInputDevices() {
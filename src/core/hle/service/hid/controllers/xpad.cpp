@@ -18,7 +18,8 @@ void Controller_XPad::OnInit() {}
 void Controller_XPad::OnRelease() {}
 
 void Controller_XPad::OnUpdate(u8* data, std::size_t size) {
-    for (auto& xpad_entry : shared_memory.shared_memory_entries) {
+    for (std::size_t i = 0; i < shared_memory.shared_memory_entries.size(); ++i) {
+        auto& xpad_entry = shared_memory.shared_memory_entries[i];
         xpad_entry.header.timestamp = CoreTiming::GetTicks();
         xpad_entry.header.total_entry_count = 17;
 
@@ -35,10 +36,12 @@ void Controller_XPad::OnUpdate(u8* data, std::size_t size) {
 
         cur_entry.sampling_number = last_entry.sampling_number + 1;
         cur_entry.sampling_number2 = cur_entry.sampling_number;
-    }
-    // TODO(ogniK): Update xpad states
 
-    std::memcpy(data + SHARED_MEMORY_OFFSET, &shared_memory, sizeof(SharedMemory));
+        // TODO(ogniK): Update xpad states
+
+        WriteRingUpdate(data, SHARED_MEMORY_OFFSET + i * sizeof(XPadEntry), xpad_entry.header,
+                        xpad_entry.pad_states);
+    }
 }
 
 void Controller_XPad::OnLoadInputDevices() {}
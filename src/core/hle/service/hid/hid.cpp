@@ -133,7 +133,7 @@ private:
     }
 
     void UpdateControllers(u64 userdata, int cycles_late) {
-        const bool should_reload = Settings::values.is_device_reload_pending.exchange(false);
+        const bool should_reload = Settings::is_device_reload_pending.exchange(false);
         for (const auto& controller : controllers) {
             if (should_reload) {
                 controller->OnLoadInputDevices();
@@ -887,7 +887,7 @@ public:
 };
 
 void ReloadInputDevices() {
-    Settings::values.is_device_reload_pending.store(true);
+    Settings::is_device_reload_pending.store(true);
 }
 
 void InstallInterfaces(SM::ServiceManager& service_manager) {
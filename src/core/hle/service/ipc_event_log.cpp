@@ -0,0 +1,44 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <fmt/format.h>
+#include "core/core_timing.h"
+#include "core/hle/service/ipc_event_log.h"
+
+namespace Service {
+
+IPCEventLog& IPCEventLog::Instance() {
+    static IPCEventLog instance;
+    return instance;
+}
+
+void IPCEventLog::Record(const char* service, const char* function, u32 command, u32 raw_result) {
+    const u64 index = write_index.fetch_add(1, std::memory_order_relaxed);
+    IPCEvent& event = events[index & (RING_SIZE - 1)];
+    event.timestamp = CoreTiming::GetTicks();
+    event.service = service;
+    event.function = function;
+    event.command = command;
+    event.raw_result = raw_result;
+}
+
+std::string IPCEventLog::DumpToText() const {
+    const u64 end = write_index.load(std::memory_order_relaxed);
+    const u64 begin = end > RING_SIZE ? end - RING_SIZE : 0;
+
+    fmt::memory_buffer buf;
+    for (u64 i = begin; i < end; ++i) {
+        const IPCEvent& event = events[i & (RING_SIZE - 1)];
+        fmt::format_to(buf, "[{:20}] {}:{} (cmd 0x{:X}) -> 0x{:08X}\n", event.timestamp,
+                       event.service, event.function != nullptr ? event.function : "<unknown>",
+                       event.command, event.raw_result);
+    }
+    return fmt::to_string(buf);
+}
+
+void IPCEventLog::Clear() {
+    write_index.store(0, std::memory_order_relaxed);
+}
+
+} // namespace Service
@@ -0,0 +1,49 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <string>
+#include "common/common_types.h"
+
+namespace Service {
+
+/// A single dispatched IPC command in binary form. The strings are pointers into the services'
+/// static handler tables, so recording an event never allocates or formats anything.
+struct IPCEvent {
+    u64 timestamp;        ///< CoreTiming tick count at dispatch time
+    const char* service;  ///< Name of the service that handled the command
+    const char* function; ///< Name of the handler that serviced it
+    u32 command;          ///< IPC command id
+    u32 raw_result;       ///< Raw value of the last result code pushed into the response
+};
+
+/**
+ * Fixed-size ring of the most recently dispatched IPC commands. Recording an event is a handful
+ * of stores into preallocated memory, cheap enough to leave enabled for a whole session; events
+ * are only rendered to text when a dump is requested. Events are recorded from the emulation
+ * thread and the dump is not synchronized against it, so dumps should be taken while emulation is
+ * paused or shutting down.
+ */
+class IPCEventLog {
+public:
+    static IPCEventLog& Instance();
+
+    void Record(const char* service, const char* function, u32 command, u32 raw_result);
+
+    /// Renders the recorded events to text, oldest first.
+    std::string DumpToText() const;
+
+    void Clear();
+
+private:
+    static constexpr std::size_t RING_SIZE = 0x4000; // Must be a power of two
+
+    std::array<IPCEvent, RING_SIZE> events{};
+    std::atomic<u64> write_index{0};
+};
+
+} // namespace Service
@@ -335,7 +335,14 @@ public:
         vm_manager.ReprotectRange(*map_address + header.rw_offset, header.rw_size,
                                   Kernel::VMAPermission::ReadWrite);
 
-        Core::System::GetInstance().InvalidateCpuInstructionCaches();
+        // Invalidate stale translations for the remapped ranges only; the rest of the title's
+        // code stays translated.
+        auto& system = Core::System::GetInstance();
+        system.InvalidateCpuInstructionCacheRange(*map_address, nro_size + bss_size);
+        system.InvalidateCpuInstructionCacheRange(nro_addr, nro_size);
+        if (bss_size > 0) {
+            system.InvalidateCpuInstructionCacheRange(bss_addr, bss_size);
+        }
 
         nro.insert_or_assign(*map_address, NROInfo{hash, nro_size + bss_size});
 
@@ -388,7 +395,10 @@ public:
                                      Kernel::MemoryState::ModuleCodeStatic) == RESULT_SUCCESS);
         ASSERT(process->UnmapMemory(mapped_addr, 0, nro_size) == RESULT_SUCCESS);
 
-        Core::System::GetInstance().InvalidateCpuInstructionCaches();
+        // Invalidate stale translations for the unmapped module and its heap mirror only
+        auto& system = Core::System::GetInstance();
+        system.InvalidateCpuInstructionCacheRange(mapped_addr, nro_size);
+        system.InvalidateCpuInstructionCacheRange(heap_addr, nro_size);
 
         nro.erase(iter);
         IPC::ResponseBuilder rb{ctx, 2};
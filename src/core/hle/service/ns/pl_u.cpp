@@ -196,8 +196,7 @@ PL_U::PL_U() : ServiceFramework("pl:u"), impl{std::make_unique<Impl>()} {
             std::vector<u32> font_data_u32(font_fp->GetSize() / sizeof(u32));
             font_fp->ReadBytes<u32>(font_data_u32.data(), font_fp->GetSize());
             // We need to be BigEndian as u32s for the xor encryption
-            std::transform(font_data_u32.begin(), font_data_u32.end(), font_data_u32.begin(),
-                           Common::swap32);
+            Common::SwapArray32(font_data_u32.data(), font_data_u32.size());
             FontRegion region{
                 static_cast<u32>(offset + 8),
                 static_cast<u32>((font_data_u32.size() * sizeof(u32)) -
@@ -137,13 +137,7 @@ u32 nvhost_gpu::AllocateObjectContext(const std::vector<u8>& input, std::vector<
 }
 
 static void PushGPUEntries(Tegra::CommandList&& entries) {
-    if (entries.empty()) {
-        return;
-    }
-
-    auto& dma_pusher{Core::System::GetInstance().GPU().DmaPusher()};
-    dma_pusher.Push(std::move(entries));
-    dma_pusher.DispatchCalls();
+    Core::System::GetInstance().GPU().PushGPUEntries(std::move(entries));
 }
 
 u32 nvhost_gpu::SubmitGPFIFO(const std::vector<u8>& input, std::vector<u8>& output) {
@@ -159,9 +153,12 @@ u32 nvhost_gpu::SubmitGPFIFO(const std::vector<u8>& input, std::vector<u8>& outp
                                    params.num_entries * sizeof(Tegra::CommandListHeader),
                "Incorrect input size");
 
-    Tegra::CommandList entries(params.num_entries);
-    std::memcpy(entries.data(), &input[sizeof(IoctlSubmitGpfifo)],
-                params.num_entries * sizeof(Tegra::CommandListHeader));
+    // Build the command list in a single copy straight from the ioctl buffer, rather than
+    // zero-initializing the entries and then overwriting them.
+    const auto* const entries_begin{
+        reinterpret_cast<const Tegra::CommandListHeader*>(input.data() +
+                                                          sizeof(IoctlSubmitGpfifo))};
+    Tegra::CommandList entries(entries_begin, entries_begin + params.num_entries);
 
     PushGPUEntries(std::move(entries));
 
@@ -18,7 +18,10 @@ enum {
 };
 }
 
-nvmap::nvmap() = default;
+nvmap::nvmap() {
+    // Handle 0 is never valid; leave its slot empty.
+    handles.emplace_back();
+}
 nvmap::~nvmap() = default;
 
 VAddr nvmap::GetObjectAddress(u32 handle) const {
@@ -64,8 +67,8 @@ u32 nvmap::IocCreate(const std::vector<u8>& input, std::vector<u8>& output) {
     object->status = Object::Status::Created;
     object->refcount = 1;
 
-    u32 handle = next_handle++;
-    handles[handle] = std::move(object);
+    const u32 handle = static_cast<u32>(handles.size());
+    handles.push_back(std::move(object));
 
     params.handle = handle;
 
@@ -143,23 +146,24 @@ u32 nvmap::IocFromId(const std::vector<u8>& input, std::vector<u8>& output) {
 
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
 
-    auto itr = std::find_if(handles.begin(), handles.end(),
-                            [&](const auto& entry) { return entry.second->id == params.id; });
+    const auto itr = std::find_if(handles.begin(), handles.end(), [&](const auto& object) {
+        return object != nullptr && object->id == params.id;
+    });
     if (itr == handles.end()) {
         LOG_ERROR(Service_NVDRV, "Object does not exist, handle={:08X}", params.handle);
         return static_cast<u32>(NvErrCodes::InvalidValue);
     }
 
-    auto& object = itr->second;
+    const auto& object = *itr;
     if (object->status != Object::Status::Allocated) {
         LOG_ERROR(Service_NVDRV, "Object is not allocated, handle={:08X}", params.handle);
         return static_cast<u32>(NvErrCodes::InvalidValue);
     }
 
-    itr->second->refcount++;
+    object->refcount++;
 
     // Return the existing handle instead of creating a new one.
-    params.handle = itr->first;
+    params.handle = static_cast<u32>(std::distance(handles.begin(), itr));
 
     std::memcpy(output.data(), &params, sizeof(params));
     return 0;
@@ -218,12 +222,12 @@ u32 nvmap::IocFree(const std::vector<u8>& input, std::vector<u8>& output) {
 
     LOG_WARNING(Service_NVDRV, "(STUBBED) called");
 
-    auto itr = handles.find(params.handle);
-    if (itr == handles.end()) {
+    const auto object = GetObject(params.handle);
+    if (!object) {
         LOG_ERROR(Service_NVDRV, "Object does not exist, handle={:08X}", params.handle);
         return static_cast<u32>(NvErrCodes::InvalidValue);
     }
-    if (!itr->second->refcount) {
+    if (!object->refcount) {
         LOG_ERROR(
             Service_NVDRV,
             "There is no references to this object. The object is already freed. handle={:08X}",
@@ -231,21 +235,21 @@ u32 nvmap::IocFree(const std::vector<u8>& input, std::vector<u8>& output) {
         return static_cast<u32>(NvErrCodes::InvalidValue);
     }
 
-    itr->second->refcount--;
+    object->refcount--;
 
-    params.size = itr->second->size;
+    params.size = object->size;
 
-    if (itr->second->refcount == 0) {
+    if (object->refcount == 0) {
         params.flags = Freed;
         // The address of the nvmap is written to the output if we're finally freeing it, otherwise
         // 0 is written.
-        params.address = itr->second->addr;
+        params.address = object->addr;
     } else {
         params.flags = NotFreedYet;
         params.address = 0;
     }
 
-    handles.erase(params.handle);
+    handles[params.handle] = nullptr;
 
     std::memcpy(output.data(), &params, sizeof(params));
     return 0;
@@ -5,7 +5,6 @@
 #pragma once
 
 #include <memory>
-#include <unordered_map>
 #include <vector>
 #include "common/common_funcs.h"
 #include "common/common_types.h"
@@ -38,22 +37,20 @@ public:
     };
 
     std::shared_ptr<Object> GetObject(u32 handle) const {
-        auto itr = handles.find(handle);
-        if (itr != handles.end()) {
-            return itr->second;
+        if (handle >= handles.size()) {
+            return {};
         }
-        return {};
+        return handles[handle];
     }
 
 private:
-    /// Id to use for the next handle that is created.
-    u32 next_handle = 1;
-
     /// Id to use for the next object that is created.
     u32 next_id = 1;
 
-    /// Mapping of currently allocated handles to the objects they represent.
-    std::unordered_map<u32, std::shared_ptr<Object>> handles;
+    /// Currently allocated objects, indexed directly by handle. Handles are assigned sequentially
+    /// and never reused, so a freed handle simply leaves a null slot behind and lookups are a
+    /// bounds check plus an array index. Slot 0 is kept null so that 0 is never a valid handle.
+    std::vector<std::shared_ptr<Object>> handles;
 
     enum class IoctlCommand : u32 {
         Create = 0xC0080101,
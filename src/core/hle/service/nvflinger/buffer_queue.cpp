@@ -11,6 +11,7 @@
 #include "core/hle/kernel/readable_event.h"
 #include "core/hle/kernel/writable_event.h"
 #include "core/hle/service/nvflinger/buffer_queue.h"
+#include "core/perf_stats.h"
 
 namespace Service::NVFlinger {
 
@@ -25,74 +26,83 @@ BufferQueue::~BufferQueue() = default;
 void BufferQueue::SetPreallocatedBuffer(u32 slot, const IGBPBuffer& igbp_buffer) {
     LOG_WARNING(Service, "Adding graphics buffer {}", slot);
 
-    Buffer buffer{};
+    ASSERT(slot < MAX_BUFFER_SLOTS);
+    Buffer& buffer = buffers[slot];
     buffer.slot = slot;
     buffer.igbp_buffer = igbp_buffer;
     buffer.status = Buffer::Status::Free;
 
-    queue.emplace_back(buffer);
+    free_slots.emplace_back(slot);
     buffer_wait_event.writable->Signal();
 }
 
 std::optional<u32> BufferQueue::DequeueBuffer(u32 width, u32 height) {
-    auto itr = std::find_if(queue.begin(), queue.end(), [&](const Buffer& buffer) {
-        // Only consider free buffers. Buffers become free once again after they've been Acquired
-        // and Released by the compositor, see the NVFlinger::Compose method.
-        if (buffer.status != Buffer::Status::Free) {
-            return false;
-        }
-
+    // Only free slots are tracked here. Buffers become free once again after they've been
+    // Acquired and Released by the compositor, see the NVFlinger::Compose method.
+    auto itr = std::find_if(free_slots.begin(), free_slots.end(), [&](u32 slot) {
         // Make sure that the parameters match.
-        return buffer.igbp_buffer.width == width && buffer.igbp_buffer.height == height;
+        const IGBPBuffer& igbp_buffer = buffers[slot].igbp_buffer;
+        return igbp_buffer.width == width && igbp_buffer.height == height;
     });
 
-    if (itr == queue.end()) {
+    if (itr == free_slots.end()) {
         return {};
     }
 
-    itr->status = Buffer::Status::Dequeued;
-    return itr->slot;
+    const u32 slot = *itr;
+    free_slots.erase(itr);
+    buffers[slot].status = Buffer::Status::Dequeued;
+    return slot;
 }
 
 const IGBPBuffer& BufferQueue::RequestBuffer(u32 slot) const {
-    auto itr = std::find_if(queue.begin(), queue.end(),
-                            [&](const Buffer& buffer) { return buffer.slot == slot; });
-    ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Dequeued);
-    return itr->igbp_buffer;
+    ASSERT(slot < MAX_BUFFER_SLOTS);
+    ASSERT(buffers[slot].status == Buffer::Status::Dequeued);
+    return buffers[slot].igbp_buffer;
 }
 
 void BufferQueue::QueueBuffer(u32 slot, BufferTransformFlags transform,
                               const MathUtil::Rectangle<int>& crop_rect) {
-    auto itr = std::find_if(queue.begin(), queue.end(),
-                            [&](const Buffer& buffer) { return buffer.slot == slot; });
-    ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Dequeued);
-    itr->status = Buffer::Status::Queued;
-    itr->transform = transform;
-    itr->crop_rect = crop_rect;
+    ASSERT(slot < MAX_BUFFER_SLOTS);
+    Buffer& buffer = buffers[slot];
+    ASSERT(buffer.status == Buffer::Status::Dequeued);
+    buffer.status = Buffer::Status::Queued;
+    buffer.transform = transform;
+    buffer.crop_rect = crop_rect;
+    queued_slots.emplace_back(slot);
+
+    // Timestamp the start of this frame's life for latency attribution.
+    Core::System::GetInstance().GetPerfStats().RecordBufferQueued(slot);
+
+    if (buffer_queued_callback) {
+        buffer_queued_callback();
+    }
 }
 
 std::optional<std::reference_wrapper<const BufferQueue::Buffer>> BufferQueue::AcquireBuffer() {
-    auto itr = std::find_if(queue.begin(), queue.end(), [](const Buffer& buffer) {
-        return buffer.status == Buffer::Status::Queued;
-    });
-    if (itr == queue.end())
+    if (queued_slots.empty()) {
         return {};
-    itr->status = Buffer::Status::Acquired;
-    return *itr;
+    }
+    // Present in the order the application queued, not in slot order.
+    const u32 slot = queued_slots.front();
+    queued_slots.pop_front();
+    buffers[slot].status = Buffer::Status::Acquired;
+    return buffers[slot];
 }
 
 void BufferQueue::ReleaseBuffer(u32 slot) {
-    auto itr = std::find_if(queue.begin(), queue.end(),
-                            [&](const Buffer& buffer) { return buffer.slot == slot; });
-    ASSERT(itr != queue.end());
-    ASSERT(itr->status == Buffer::Status::Acquired);
-    itr->status = Buffer::Status::Free;
+    ASSERT(slot < MAX_BUFFER_SLOTS);
+    ASSERT(buffers[slot].status == Buffer::Status::Acquired);
+    buffers[slot].status = Buffer::Status::Free;
+    free_slots.emplace_back(slot);
 
     buffer_wait_event.writable->Signal();
 }
 
+void BufferQueue::SetBufferQueuedCallback(std::function<void()> callback) {
+    buffer_queued_callback = std::move(callback);
+}
+
 u32 BufferQueue::Query(QueryType type) {
     LOG_WARNING(Service, "(STUBBED) called type={}", static_cast<u32>(type));
 
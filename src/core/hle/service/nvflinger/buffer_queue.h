@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <array>
+#include <deque>
+#include <functional>
 #include <optional>
 #include <vector>
 
@@ -83,6 +86,10 @@ public:
     void ReleaseBuffer(u32 slot);
     u32 Query(QueryType type);
 
+    /// Registers a callback that is invoked whenever the application queues a buffer, so the
+    /// compositor can react to new frames instead of discovering them on its next periodic pass.
+    void SetBufferQueuedCallback(std::function<void()> callback);
+
     u32 GetId() const {
         return id;
     }
@@ -92,10 +99,20 @@ public:
     Kernel::SharedPtr<Kernel::ReadableEvent> GetBufferWaitEvent() const;
 
 private:
+    /// Maximum number of buffer slots per queue, matching the surface flinger limit.
+    static constexpr std::size_t MAX_BUFFER_SLOTS = 0x40;
+
     u32 id;
     u64 layer_id;
 
-    std::vector<Buffer> queue;
+    /// Buffer state indexed directly by slot, so per-slot operations don't scan a list.
+    std::array<Buffer, MAX_BUFFER_SLOTS> buffers{};
+    /// Slots that are free and may be handed out by DequeueBuffer.
+    std::vector<u32> free_slots;
+    /// Slots queued by the application, in presentation order.
+    std::deque<u32> queued_slots;
+
+    std::function<void()> buffer_queued_callback;
     Kernel::EventPair buffer_wait_event;
 };
 
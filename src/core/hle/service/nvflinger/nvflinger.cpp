@@ -9,8 +9,10 @@
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/microprofile_trace.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
+#include "core/dynamic_resolution.h"
 #include "core/core_timing.h"
 #include "core/core_timing_util.h"
 #include "core/hle/kernel/kernel.h"
@@ -44,10 +46,16 @@ NVFlinger::NVFlinger() {
         });
 
     CoreTiming::ScheduleEvent(frame_ticks, composition_event);
+
+    present_event = CoreTiming::RegisterEvent(
+        "ScreenPresent", [this](u64 userdata, int cycles_late) { PresentPendingBuffers(); });
 }
 
 NVFlinger::~NVFlinger() {
     CoreTiming::UnscheduleEvent(composition_event, 0);
+    // Presents may have been scheduled from another CPU thread and not yet moved to the event
+    // queue, so the threadsafe queue has to be drained as well.
+    CoreTiming::RemoveNormalAndThreadsafeEvent(present_event);
 }
 
 void NVFlinger::SetNVDrvInstance(std::shared_ptr<Nvidia::Module> instance) {
@@ -76,6 +84,7 @@ u64 NVFlinger::CreateLayer(u64 display_id) {
     u64 layer_id = next_layer_id++;
     u32 buffer_queue_id = next_buffer_queue_id++;
     auto buffer_queue = std::make_shared<BufferQueue>(buffer_queue_id, layer_id);
+    buffer_queue->SetBufferQueuedCallback([this] { OnBufferQueued(); });
     display.layers.emplace_back(layer_id, buffer_queue);
     buffer_queues.emplace_back(std::move(buffer_queue));
     return layer_id;
@@ -116,7 +125,48 @@ Layer& NVFlinger::GetLayer(u64 display_id, u64 layer_id) {
     return *itr;
 }
 
+void NVFlinger::OnBufferQueued() {
+    // Presenting right here is not an option: the queue may be touched from a different CPU
+    // thread than the one running the CoreTiming events that drive the renderer.
+    CoreTiming::ScheduleEventThreadsafe(0, present_event, 0);
+}
+
+void NVFlinger::PresentPendingBuffers() {
+    for (auto& display : displays) {
+        if (display.layers.empty())
+            continue;
+
+        PresentBuffer(*display.layers[0].buffer_queue);
+    }
+}
+
+bool NVFlinger::PresentBuffer(BufferQueue& buffer_queue) {
+    // Search for a queued buffer and acquire it
+    const auto buffer = buffer_queue.AcquireBuffer();
+    if (!buffer)
+        return false;
+
+    const auto& igbp_buffer = buffer->get().igbp_buffer;
+
+    Core::System::GetInstance().GetPerfStats().RecordBufferComposed(buffer->get().slot);
+
+    // Now send the buffer to the GPU for drawing.
+    // TODO(Subv): Support more than just disp0. The display device selection is probably based
+    // on which display we're drawing (Default, Internal, External, etc)
+    auto nvdisp = nvdrv->GetDevice<Nvidia::Devices::nvdisp_disp0>("/dev/nvdisp_disp0");
+    ASSERT(nvdisp);
+
+    nvdisp->flip(igbp_buffer.gpu_buffer_id, igbp_buffer.offset, igbp_buffer.format,
+                 igbp_buffer.width, igbp_buffer.height, igbp_buffer.stride,
+                 buffer->get().transform, buffer->get().crop_rect);
+
+    buffer_queue.ReleaseBuffer(buffer->get().slot);
+    return true;
+}
+
 void NVFlinger::Compose() {
+    Core::System::GetInstance().GetDynamicResolution().OnVSync();
+
     for (auto& display : displays) {
         // Trigger vsync for this display at the end of drawing
         SCOPE_EXIT({ display.vsync_event.writable->Signal(); });
@@ -131,33 +181,16 @@ void NVFlinger::Compose() {
         Layer& layer = display.layers[0];
         auto& buffer_queue = layer.buffer_queue;
 
-        // Search for a queued buffer and acquire it
-        auto buffer = buffer_queue->AcquireBuffer();
-
         MicroProfileFlip();
+        Common::FlushMicroProfileTrace();
 
-        if (!buffer) {
+        if (!PresentBuffer(*buffer_queue)) {
             auto& system_instance = Core::System::GetInstance();
 
             // There was no queued buffer to draw, render previous frame
             system_instance.GetPerfStats().EndGameFrame();
-            system_instance.Renderer().SwapBuffers({});
-            continue;
+            system_instance.GPU().SwapBuffers({});
         }
-
-        auto& igbp_buffer = buffer->get().igbp_buffer;
-
-        // Now send the buffer to the GPU for drawing.
-        // TODO(Subv): Support more than just disp0. The display device selection is probably based
-        // on which display we're drawing (Default, Internal, External, etc)
-        auto nvdisp = nvdrv->GetDevice<Nvidia::Devices::nvdisp_disp0>("/dev/nvdisp_disp0");
-        ASSERT(nvdisp);
-
-        nvdisp->flip(igbp_buffer.gpu_buffer_id, igbp_buffer.offset, igbp_buffer.format,
-                     igbp_buffer.width, igbp_buffer.height, igbp_buffer.stride,
-                     buffer->get().transform, buffer->get().crop_rect);
-
-        buffer_queue->ReleaseBuffer(buffer->get().slot);
     }
 }
 
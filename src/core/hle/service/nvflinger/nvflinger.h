@@ -82,6 +82,17 @@ private:
     /// Returns the layer identified by the specified id in the desired display.
     Layer& GetLayer(u64 display_id, u64 layer_id);
 
+    /// Called from the guest when a buffer is queued; schedules an immediate presentation pass
+    /// instead of letting the frame sit until the next periodic composition.
+    void OnBufferQueued();
+
+    /// Presents any queued buffers right away, without signaling the vsync events.
+    void PresentPendingBuffers();
+
+    /// Sends the next queued buffer of the given queue to the GPU for drawing, if there is one.
+    /// Returns whether a buffer was presented.
+    bool PresentBuffer(BufferQueue& buffer_queue);
+
     std::shared_ptr<Nvidia::Module> nvdrv;
 
     std::vector<Display> displays;
@@ -95,6 +106,10 @@ private:
 
     /// CoreTiming event that handles screen composition.
     CoreTiming::EventType* composition_event;
+
+    /// CoreTiming event armed from OnBufferQueued to present a freshly queued buffer without
+    /// waiting out the rest of the vsync interval.
+    CoreTiming::EventType* present_event;
 };
 
 } // namespace Service::NVFlinger
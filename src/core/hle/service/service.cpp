@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <fmt/format.h>
 #include "common/assert.h"
+#include "common/logging/backend.h"
 #include "common/logging/log.h"
 #include "common/string_util.h"
 #include "core/core.h"
@@ -21,6 +22,7 @@
 #include "core/hle/service/aoc/aoc_u.h"
 #include "core/hle/service/apm/apm.h"
 #include "core/hle/service/arp/arp.h"
+#include "core/hle/service/async_handler.h"
 #include "core/hle/service/audio/audio.h"
 #include "core/hle/service/bcat/module.h"
 #include "core/hle/service/bpc/bpc.h"
@@ -36,6 +38,7 @@
 #include "core/hle/service/friend/friend.h"
 #include "core/hle/service/grc/grc.h"
 #include "core/hle/service/hid/hid.h"
+#include "core/hle/service/ipc_event_log.h"
 #include "core/hle/service/lbl/lbl.h"
 #include "core/hle/service/ldn/ldn.h"
 #include "core/hle/service/ldr/ldr.h"
@@ -69,6 +72,7 @@
 #include "core/hle/service/usb/usb.h"
 #include "core/hle/service/vi/vi.h"
 #include "core/hle/service/wlan/wlan.h"
+#include "core/settings.h"
 
 namespace Service {
 
@@ -158,10 +162,21 @@ void ServiceFrameworkBase::InvokeRequest(Kernel::HLERequestContext& ctx) {
         return ReportUnimplementedFunction(ctx, info);
     }
 
-    LOG_TRACE(
-        Service, "{}",
-        MakeFunctionString(info->name, GetServiceName().c_str(), ctx.CommandBuffer()).c_str());
+    // Only build the formatted call description when trace logging would actually emit it;
+    // MakeFunctionString allocates on every IPC call otherwise.
+    if (Log::GetGlobalFilter().CheckMessage(Log::Class::Service, Log::Level::Trace)) {
+        LOG_TRACE(
+            Service, "{}",
+            MakeFunctionString(info->name, GetServiceName().c_str(), ctx.CommandBuffer()).c_str());
+    }
     handler_invoker(this, info->handler_callback, ctx);
+
+    // Record the dispatched command in binary form; rendering to text happens only when the
+    // event log is dumped.
+    if (Settings::values.record_ipc_events) {
+        IPCEventLog::Instance().Record(service_name.c_str(), info->name, ctx.GetCommand(),
+                                       ctx.GetLastResultRaw());
+    }
 }
 
 ResultCode ServiceFrameworkBase::HandleSyncRequest(Kernel::HLERequestContext& context) {
@@ -199,64 +214,92 @@ void Init(std::shared_ptr<SM::ServiceManager>& sm, FileSys::VfsFilesystem& vfs)
     // here and pass it into the respective InstallInterfaces functions.
     auto nv_flinger = std::make_shared<NVFlinger::NVFlinger>();
 
+    InitAsyncHandlers();
+
     SM::ServiceManager::InstallInterfaces(sm);
 
-    Account::InstallInterfaces(*sm);
-    AM::InstallInterfaces(*sm, nv_flinger);
-    AOC::InstallInterfaces(*sm);
-    APM::InstallInterfaces(*sm);
-    ARP::InstallInterfaces(*sm);
-    Audio::InstallInterfaces(*sm);
-    BCAT::InstallInterfaces(*sm);
-    BPC::InstallInterfaces(*sm);
-    BtDrv::InstallInterfaces(*sm);
-    BTM::InstallInterfaces(*sm);
-    Capture::InstallInterfaces(*sm);
-    ERPT::InstallInterfaces(*sm);
-    ES::InstallInterfaces(*sm);
-    EUPLD::InstallInterfaces(*sm);
-    Fatal::InstallInterfaces(*sm);
-    FGM::InstallInterfaces(*sm);
+    // These modules have construction side effects other components rely on before any of their
+    // services are contacted (the filesystem factories used by the loader, and the nvdrv instance
+    // NVFlinger composes through), so they are still built eagerly.
     FileSystem::InstallInterfaces(*sm, vfs);
-    Friend::InstallInterfaces(*sm);
-    GRC::InstallInterfaces(*sm);
-    HID::InstallInterfaces(*sm);
-    LBL::InstallInterfaces(*sm);
-    LDN::InstallInterfaces(*sm);
-    LDR::InstallInterfaces(*sm);
-    LM::InstallInterfaces(*sm);
-    Migration::InstallInterfaces(*sm);
-    Mii::InstallInterfaces(*sm);
-    MM::InstallInterfaces(*sm);
-    NCM::InstallInterfaces(*sm);
-    NFC::InstallInterfaces(*sm);
-    NFP::InstallInterfaces(*sm);
-    NIFM::InstallInterfaces(*sm);
-    NIM::InstallInterfaces(*sm);
-    NPNS::InstallInterfaces(*sm);
-    NS::InstallInterfaces(*sm);
     Nvidia::InstallInterfaces(*sm, *nv_flinger);
-    PCIe::InstallInterfaces(*sm);
-    PCTL::InstallInterfaces(*sm);
-    PCV::InstallInterfaces(*sm);
-    PlayReport::InstallInterfaces(*sm);
-    PM::InstallInterfaces(*sm);
-    PSC::InstallInterfaces(*sm);
-    PSM::InstallInterfaces(*sm);
-    Set::InstallInterfaces(*sm);
-    Sockets::InstallInterfaces(*sm);
-    SPL::InstallInterfaces(*sm);
-    SSL::InstallInterfaces(*sm);
-    Time::InstallInterfaces(*sm);
-    USB::InstallInterfaces(*sm);
-    VI::InstallInterfaces(*sm, nv_flinger);
-    WLAN::InstallInterfaces(*sm);
+
+    // Everything else is registered as a lazy factory and only constructed once the guest (or the
+    // frontend) actually requests one of its services. Most titles never touch the majority of
+    // these modules, so this keeps them out of boot time and memory entirely.
+    sm->RegisterLazyModule({"acc:aa", "acc:su", "acc:u0", "acc:u1"}, Account::InstallInterfaces);
+    sm->RegisterLazyModule({"appletAE", "appletOE", "idle:sys", "omm", "spsm", "tcap"},
+                           [nv_flinger](SM::ServiceManager& sm) {
+                               AM::InstallInterfaces(sm, nv_flinger);
+                           });
+    sm->RegisterLazyModule({"aoc:u"}, AOC::InstallInterfaces);
+    sm->RegisterLazyModule({"apm", "apm:p", "apm:sys"}, APM::InstallInterfaces);
+    sm->RegisterLazyModule({"arp:r", "arp:w"}, ARP::InstallInterfaces);
+    sm->RegisterLazyModule({"audctl", "audin:a", "audin:u", "audout:a", "audout:u", "audrec:a",
+                            "audrec:u", "audren:a", "audren:u", "codecctl", "hwopus"},
+                           Audio::InstallInterfaces);
+    sm->RegisterLazyModule({"bcat:a", "bcat:m", "bcat:s", "bcat:u"}, BCAT::InstallInterfaces);
+    sm->RegisterLazyModule({"bpc", "bpc:r"}, BPC::InstallInterfaces);
+    sm->RegisterLazyModule({"bt", "btdrv"}, BtDrv::InstallInterfaces);
+    sm->RegisterLazyModule({"btm", "btm:dbg", "btm:sys", "btm:u"}, BTM::InstallInterfaces);
+    sm->RegisterLazyModule({"caps:a", "caps:c", "caps:sc", "caps:ss", "caps:su", "caps:u"},
+                           Capture::InstallInterfaces);
+    sm->RegisterLazyModule({"erpt:c", "erpt:r"}, ERPT::InstallInterfaces);
+    sm->RegisterLazyModule({"es"}, ES::InstallInterfaces);
+    sm->RegisterLazyModule({"eupld:c", "eupld:r"}, EUPLD::InstallInterfaces);
+    sm->RegisterLazyModule({"fatal:p", "fatal:u"}, Fatal::InstallInterfaces);
+    sm->RegisterLazyModule({"fgm", "fgm:0", "fgm:9", "fgm:dbg"}, FGM::InstallInterfaces);
+    sm->RegisterLazyModule({"friend:a", "friend:m", "friend:s", "friend:u", "friend:v"},
+                           Friend::InstallInterfaces);
+    sm->RegisterLazyModule({"grc:c"}, GRC::InstallInterfaces);
+    sm->RegisterLazyModule(
+        {"hid", "hid:dbg", "hid:sys", "hid:tmp", "hidbus", "irs", "irs:sys", "xcd:sys"},
+        HID::InstallInterfaces);
+    sm->RegisterLazyModule({"lbl"}, LBL::InstallInterfaces);
+    sm->RegisterLazyModule({"ldn:m", "ldn:s", "ldn:u"}, LDN::InstallInterfaces);
+    sm->RegisterLazyModule({"ldr:dmnt", "ldr:pm", "ldr:ro", "ldr:shel"}, LDR::InstallInterfaces);
+    sm->RegisterLazyModule({"lm"}, LM::InstallInterfaces);
+    sm->RegisterLazyModule({"mig:usr"}, Migration::InstallInterfaces);
+    sm->RegisterLazyModule({"mii:e", "mii:u", "miiimg"}, Mii::InstallInterfaces);
+    sm->RegisterLazyModule({"mm:u"}, MM::InstallInterfaces);
+    sm->RegisterLazyModule({"lr", "ncm"}, NCM::InstallInterfaces);
+    sm->RegisterLazyModule({"nfc:am", "nfc:mf:u", "nfc:sys", "nfc:user"}, NFC::InstallInterfaces);
+    sm->RegisterLazyModule({"nfp:user"}, NFP::InstallInterfaces);
+    sm->RegisterLazyModule({"nifm:a", "nifm:s", "nifm:u"}, NIFM::InstallInterfaces);
+    sm->RegisterLazyModule({"nim", "nim:eca", "nim:shp", "ntc"}, NIM::InstallInterfaces);
+    sm->RegisterLazyModule({"npns:s", "npns:u"}, NPNS::InstallInterfaces);
+    sm->RegisterLazyModule(
+        {"ns:am2", "ns:dev", "ns:ec", "ns:rid", "ns:rt", "ns:su", "ns:vm", "ns:web", "pl:u"},
+        NS::InstallInterfaces);
+    sm->RegisterLazyModule({"pcie"}, PCIe::InstallInterfaces);
+    sm->RegisterLazyModule({"pctl", "pctl:a", "pctl:r", "pctl:s"}, PCTL::InstallInterfaces);
+    sm->RegisterLazyModule({"pcv", "pcv:arb", "pcv:imm"}, PCV::InstallInterfaces);
+    sm->RegisterLazyModule({"prepo:a", "prepo:a2", "prepo:m", "prepo:s", "prepo:u"},
+                           PlayReport::InstallInterfaces);
+    sm->RegisterLazyModule({"pm:bm", "pm:dmnt", "pm:info", "pm:shell"}, PM::InstallInterfaces);
+    sm->RegisterLazyModule({"psc:c", "psc:m"}, PSC::InstallInterfaces);
+    sm->RegisterLazyModule({"psm"}, PSM::InstallInterfaces);
+    sm->RegisterLazyModule({"set", "set:cal", "set:fd", "set:sys"}, Set::InstallInterfaces);
+    sm->RegisterLazyModule(
+        {"bsd:s", "bsd:u", "bsdcfg", "ethc:c", "ethc:i", "nsd:a", "nsd:u", "sfdnsres"},
+        Sockets::InstallInterfaces);
+    sm->RegisterLazyModule({"csrng", "spl:"}, SPL::InstallInterfaces);
+    sm->RegisterLazyModule({"ssl"}, SSL::InstallInterfaces);
+    sm->RegisterLazyModule({"time:a", "time:s", "time:u"}, Time::InstallInterfaces);
+    sm->RegisterLazyModule({"usb:ds", "usb:hs", "usb:pd", "usb:pd:c", "usb:pm"},
+                           USB::InstallInterfaces);
+    sm->RegisterLazyModule({"vi:m", "vi:s", "vi:u"}, [nv_flinger](SM::ServiceManager& sm) {
+        VI::InstallInterfaces(sm, nv_flinger);
+    });
+    sm->RegisterLazyModule({"wlan:inf", "wlan:lcl", "wlan:lg", "wlan:sg", "wlan:soc"},
+                           WLAN::InstallInterfaces);
 
     LOG_DEBUG(Service, "initialized OK");
 }
 
 /// Shutdown ServiceManager
 void Shutdown() {
+    ShutdownAsyncHandlers();
     LOG_DEBUG(Service, "shutdown OK");
 }
 } // namespace Service
@@ -2,6 +2,7 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <iterator>
 #include <tuple>
 #include "common/assert.h"
 #include "core/core.h"
@@ -72,10 +73,40 @@ ResultCode ServiceManager::UnregisterService(const std::string& name) {
     return RESULT_SUCCESS;
 }
 
+void ServiceManager::RegisterLazyModule(std::initializer_list<std::string> names,
+                                        std::function<void(ServiceManager&)> factory) {
+    auto shared_factory =
+        std::make_shared<std::function<void(ServiceManager&)>>(std::move(factory));
+    for (const auto& name : names) {
+        ASSERT_MSG(registered_services.find(name) == registered_services.end() &&
+                       lazy_modules.find(name) == lazy_modules.end(),
+                   "Service {} is already registered", name);
+        lazy_modules.emplace(name, shared_factory);
+    }
+}
+
+void ServiceManager::InstantiateLazyService(const std::string& name) {
+    const auto iter = lazy_modules.find(name);
+    if (iter == lazy_modules.end()) {
+        return;
+    }
+
+    // Drop every name belonging to this module before running the factory, so the
+    // RegisterService calls it makes don't come back through this path.
+    const auto factory = iter->second;
+    for (auto it = lazy_modules.begin(); it != lazy_modules.end();) {
+        it = it->second == factory ? lazy_modules.erase(it) : std::next(it);
+    }
+
+    LOG_DEBUG(Service_SM, "lazily instantiating module for service {}", name);
+    (*factory)(*this);
+}
+
 ResultVal<Kernel::SharedPtr<Kernel::ClientPort>> ServiceManager::GetServicePort(
     const std::string& name) {
 
     CASCADE_CODE(ValidateServiceName(name));
+    InstantiateLazyService(name);
     auto it = registered_services.find(name);
     if (it == registered_services.end()) {
         return ERR_SERVICE_NOT_REGISTERED;
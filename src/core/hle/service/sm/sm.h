@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <functional>
+#include <initializer_list>
 #include <memory>
 #include <string>
 #include <type_traits>
@@ -54,10 +56,19 @@ public:
     ResultVal<Kernel::SharedPtr<Kernel::ClientPort>> GetServicePort(const std::string& name);
     ResultVal<Kernel::SharedPtr<Kernel::ClientSession>> ConnectToService(const std::string& name);
 
+    /**
+     * Registers a service module that is only constructed once one of its services is actually
+     * requested. `names` lists every service the factory installs; the first lookup of any of
+     * them runs `factory`, which is expected to register all of them through RegisterService.
+     */
+    void RegisterLazyModule(std::initializer_list<std::string> names,
+                            std::function<void(ServiceManager&)> factory);
+
     template <typename T>
-    std::shared_ptr<T> GetService(const std::string& service_name) const {
+    std::shared_ptr<T> GetService(const std::string& service_name) {
         static_assert(std::is_base_of_v<Kernel::SessionRequestHandler, T>,
                       "Not a base of ServiceFrameworkBase");
+        InstantiateLazyService(service_name);
         auto service = registered_services.find(service_name);
         if (service == registered_services.end()) {
             LOG_DEBUG(Service, "Can't find service: {}", service_name);
@@ -73,11 +84,19 @@ public:
     void InvokeControlRequest(Kernel::HLERequestContext& context);
 
 private:
+    /// Runs the lazy factory responsible for `name`, if any, so the service becomes registered.
+    void InstantiateLazyService(const std::string& name);
+
     std::weak_ptr<SM> sm_interface;
     std::unique_ptr<Controller> controller_interface;
 
     /// Map of registered services, retrieved using GetServicePort or ConnectToService.
     std::unordered_map<std::string, Kernel::SharedPtr<Kernel::ClientPort>> registered_services;
+
+    /// Factories of modules that have not been constructed yet, keyed by each service name the
+    /// module would install. All names of one module share a single factory instance.
+    std::unordered_map<std::string, std::shared_ptr<std::function<void(ServiceManager&)>>>
+        lazy_modules;
 };
 
 } // namespace Service::SM
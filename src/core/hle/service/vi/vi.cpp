@@ -16,7 +16,9 @@
 #include "common/logging/log.h"
 #include "common/math_util.h"
 #include "common/swap.h"
+#include "core/core.h"
 #include "core/core_timing.h"
+#include "core/dynamic_resolution.h"
 #include "core/hle/ipc_helpers.h"
 #include "core/hle/kernel/readable_event.h"
 #include "core/hle/kernel/writable_event.h"
@@ -31,6 +33,12 @@
 
 namespace Service::VI {
 
+/// Resolution factor currently in effect; follows the dynamic resolution controller when it is
+/// enabled and the static resolution_factor setting otherwise.
+static float GetResolutionFactor() {
+    return Core::System::GetInstance().GetDynamicResolution().GetResolutionFactor();
+}
+
 struct DisplayInfo {
     char display_name[0x40]{"Default"};
     u64 unknown_1{1};
@@ -44,7 +52,12 @@ class Parcel {
 public:
     // This default size was chosen arbitrarily.
     static constexpr std::size_t DefaultBufferSize = 0x40;
-    Parcel() : buffer(DefaultBufferSize) {}
+
+    // Upper bound on a serialized response. The largest responses (preallocated buffer setup
+    // with a full IGBPBuffer) stay well under this.
+    static constexpr std::size_t MaxSerializeSize = 0x400;
+
+    Parcel() = default;
     explicit Parcel(std::vector<u8> data) : buffer(std::move(data)) {}
     virtual ~Parcel() = default;
 
@@ -99,14 +112,18 @@ public:
     template <typename T>
     void Write(const T& val) {
         static_assert(std::is_trivially_copyable_v<T>, "T must be trivially copyable.");
+        ASSERT(write_index + sizeof(T) <= MaxSerializeSize);
 
-        if (buffer.size() < write_index + sizeof(T)) {
-            buffer.resize(buffer.size() + sizeof(T) + DefaultBufferSize);
-        }
-
-        std::memcpy(buffer.data() + write_index, &val, sizeof(T));
+        std::memcpy(Scratch() + write_index, &val, sizeof(T));
         write_index += sizeof(T);
-        write_index = Common::AlignUp(write_index, 4);
+
+        // Alignment padding must be zeroed; the scratch buffer still holds the previous
+        // response's bytes.
+        const std::size_t aligned_index = Common::AlignUp(write_index, 4);
+        if (aligned_index != write_index) {
+            std::memset(Scratch() + write_index, 0, aligned_index - write_index);
+            write_index = aligned_index;
+        }
     }
 
     template <typename T>
@@ -130,7 +147,24 @@ public:
         DeserializeData();
     }
 
-    std::vector<u8> Serialize() {
+    /// View of a serialized response living in the per-thread scratch buffer. Only valid until
+    /// the next parcel is serialized on the same thread, which is fine for the usage pattern of
+    /// handing it straight to HLERequestContext::WriteBuffer.
+    struct SerializedView {
+        using value_type = u8;
+
+        const u8* data() const {
+            return view_data;
+        }
+        std::size_t size() const {
+            return view_size;
+        }
+
+        const u8* view_data;
+        std::size_t view_size;
+    };
+
+    SerializedView Serialize() {
         ASSERT(read_index == 0);
         write_index = sizeof(Header);
 
@@ -141,9 +175,16 @@ public:
         header.data_offset = sizeof(Header);
         header.objects_size = 4;
         header.objects_offset = sizeof(Header) + header.data_size;
-        std::memcpy(buffer.data(), &header, sizeof(Header));
+        std::memcpy(Scratch(), &header, sizeof(Header));
+
+        // Responses used to be returned in a zero-initialized vector of at least
+        // DefaultBufferSize bytes; preserve that shape, including the zeroed tail.
+        const std::size_t size =
+            std::max(Common::AlignUp(write_index, 4) + sizeof(u32), DefaultBufferSize);
+        ASSERT(size <= MaxSerializeSize);
+        std::memset(Scratch() + write_index, 0, size - write_index);
 
-        return buffer;
+        return SerializedView{Scratch(), size};
     }
 
 protected:
@@ -160,6 +201,14 @@ private:
     };
     static_assert(sizeof(Header) == 16, "ParcelHeader has wrong size");
 
+    /// Responses are serialized and copied out to the guest within a single transaction, so one
+    /// fixed scratch buffer per thread serves every response parcel without allocation.
+    static u8* Scratch() {
+        static thread_local std::array<u8, MaxSerializeSize> scratch;
+        return scratch.data();
+    }
+
+    /// Incoming request data; response parcels don't use it and leave it empty.
     std::vector<u8> buffer;
     std::size_t read_index = 0;
     std::size_t write_index = 0;
@@ -513,9 +562,9 @@ private:
             IGBPConnectRequestParcel request{ctx.ReadBuffer()};
             IGBPConnectResponseParcel response{
                 static_cast<u32>(static_cast<u32>(DisplayResolution::UndockedWidth) *
-                                 Settings::values.resolution_factor),
+                                 GetResolutionFactor()),
                 static_cast<u32>(static_cast<u32>(DisplayResolution::UndockedHeight) *
-                                 Settings::values.resolution_factor)};
+                                 GetResolutionFactor())};
             ctx.WriteBuffer(response.Serialize());
         } else if (transaction == TransactionId::SetPreallocatedBuffer) {
             IGBPSetPreallocatedBufferRequestParcel request{ctx.ReadBuffer()};
@@ -703,14 +752,14 @@ private:
 
         if (Settings::values.use_docked_mode) {
             rb.Push(static_cast<u32>(Service::VI::DisplayResolution::DockedWidth) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
             rb.Push(static_cast<u32>(Service::VI::DisplayResolution::DockedHeight) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
         } else {
             rb.Push(static_cast<u32>(Service::VI::DisplayResolution::UndockedWidth) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
             rb.Push(static_cast<u32>(Service::VI::DisplayResolution::UndockedHeight) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
         }
 
         rb.PushRaw<float>(60.0f); // This wouldn't seem to be correct for 30 fps games.
@@ -921,14 +970,14 @@ private:
 
         if (Settings::values.use_docked_mode) {
             rb.Push(static_cast<u64>(DisplayResolution::DockedWidth) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
             rb.Push(static_cast<u64>(DisplayResolution::DockedHeight) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
         } else {
             rb.Push(static_cast<u64>(DisplayResolution::UndockedWidth) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
             rb.Push(static_cast<u64>(DisplayResolution::UndockedHeight) *
-                    static_cast<u32>(Settings::values.resolution_factor));
+                    static_cast<u32>(GetResolutionFactor()));
         }
     }
 
@@ -948,8 +997,8 @@ private:
 
         IPC::RequestParser rp{ctx};
         DisplayInfo display_info;
-        display_info.width *= static_cast<u64>(Settings::values.resolution_factor);
-        display_info.height *= static_cast<u64>(Settings::values.resolution_factor);
+        display_info.width *= static_cast<u64>(GetResolutionFactor());
+        display_info.height *= static_cast<u64>(GetResolutionFactor());
         ctx.WriteBuffer(&display_info, sizeof(DisplayInfo));
         IPC::ResponseBuilder rb{ctx, 4};
         rb.Push(RESULT_SUCCESS);
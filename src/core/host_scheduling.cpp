@@ -0,0 +1,74 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "common/common_types.h"
+#include "common/logging/log.h"
+#include "common/thread.h"
+#include "core/host_scheduling.h"
+#include "core/settings.h"
+
+namespace Core::HostScheduling {
+
+namespace {
+
+/// Sets a preferred-node memory policy for the calling thread. Guest heap pages and the dynarmic
+/// code cache are first touched from the CPU thread, so first-touch placement under this policy
+/// keeps both on the same node instead of wherever the allocating thread happened to run.
+void ApplyNumaPolicy(s32 node) {
+#ifdef __linux__
+    // Values from linux/mempolicy.h, which is not available on every build host
+    constexpr int MPOL_PREFERRED = 1;
+
+    if (node < 0 || node >= static_cast<s32>(sizeof(unsigned long) * 8)) {
+        return;
+    }
+    const unsigned long nodemask = 1ul << node;
+    if (syscall(SYS_set_mempolicy, MPOL_PREFERRED, &nodemask, sizeof(nodemask) * 8 + 1) != 0) {
+        LOG_WARNING(Core, "Failed to set NUMA memory policy for node {}", node);
+    }
+#else
+    // Windows would need VirtualAllocExNuma at every allocation site; not implemented
+    LOG_WARNING(Core, "NUMA placement is only supported on Linux, ignoring node {}", node);
+#endif
+}
+
+} // Anonymous namespace
+
+void ApplyPolicy(HostThread thread) {
+    if (!Settings::values.enable_host_thread_scheduling) {
+        return;
+    }
+
+    u32 affinity_mask{};
+    switch (thread) {
+    case HostThread::Cpu:
+        affinity_mask = Settings::values.host_cpu_thread_affinity;
+        break;
+    case HostThread::Gpu:
+        affinity_mask = Settings::values.host_gpu_thread_affinity;
+        break;
+    case HostThread::Audio:
+        affinity_mask = Settings::values.host_audio_thread_affinity;
+        break;
+    }
+
+    if (affinity_mask != 0) {
+        Common::SetCurrentThreadAffinity(affinity_mask);
+    }
+
+    if (thread == HostThread::Cpu && Settings::values.host_numa_node >= 0) {
+        ApplyNumaPolicy(Settings::values.host_numa_node);
+    }
+
+    // Emulation threads contend with the frontend UI thread under load; running them above
+    // normal priority keeps the host scheduler from preempting them mid-slice.
+    Common::SetCurrentThreadPriority(Common::ThreadPriority::AboveNormal);
+}
+
+} // namespace Core::HostScheduling
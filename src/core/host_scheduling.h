@@ -0,0 +1,23 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+namespace Core::HostScheduling {
+
+/// Host threads that can be placed by the scheduling policy in Settings::values.
+enum class HostThread {
+    Cpu,   ///< Guest CPU emulation thread(s)
+    Gpu,   ///< Asynchronous GPU command processing thread
+    Audio, ///< Audio renderer mixing thread
+};
+
+/// Applies the configured affinity mask and raises the priority of the calling thread. Must be
+/// invoked from the thread being placed; an affinity mask of zero leaves the thread unpinned.
+/// For the CPU thread a configured NUMA node additionally sets a preferred memory policy, so
+/// guest RAM and JIT code pages first-touched from that thread land on the same node as the
+/// thread itself. Does nothing unless host thread scheduling is enabled in the settings.
+void ApplyPolicy(HostThread thread);
+
+} // namespace Core::HostScheduling
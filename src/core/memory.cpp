@@ -10,6 +10,7 @@
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "common/logging/log.h"
+#include "common/microprofile.h"
 #include "common/swap.h"
 #include "core/arm/arm_interface.h"
 #include "core/core.h"
@@ -22,7 +23,7 @@
 
 namespace Memory {
 
-static PageTable* current_page_table = nullptr;
+PageTable* current_page_table = nullptr;
 
 void SetCurrentPageTable(PageTable* page_table) {
     current_page_table = page_table;
@@ -70,16 +71,22 @@ static void MapPages(PageTable& page_table, VAddr base, u64 size, u8* memory, Pa
     RasterizerFlushVirtualRegion(base << PAGE_BITS, size * PAGE_SIZE,
                                  FlushMode::FlushAndInvalidate);
 
-    VAddr end = base + size;
-    while (base != end) {
-        ASSERT_MSG(base < page_table.pointers.size(), "out of range mapping at {:016X}", base);
+    const VAddr end = base + size;
+    ASSERT_MSG(end <= page_table.pointers.size(), "out of range mapping at {:016X}", end);
 
-        page_table.attributes[base] = type;
-        page_table.pointers[base] = memory;
+    // Batch the updates per array rather than per page, so the attribute fill and the unmapped
+    // case compile down to memset.
+    std::fill(page_table.attributes.begin() + base, page_table.attributes.begin() + end, type);
 
-        base += 1;
-        if (memory != nullptr)
+    if (memory == nullptr) {
+        std::fill(page_table.pointers.begin() + base, page_table.pointers.begin() + end, memory);
+    } else {
+        while (base != end) {
+            page_table.pointers[base] = memory;
+
+            base += 1;
             memory += PAGE_SIZE;
+        }
     }
 }
 
@@ -122,9 +129,13 @@ void RemoveDebugHook(PageTable& page_table, VAddr base, u64 size, MemoryHookPoin
 
 /**
  * Gets a pointer to the exact memory at the virtual address (i.e. not page aligned)
- * using a VMA from the current process
+ * using a VMA from the current process. When `run_length` is provided it receives the
+ * number of bytes from `vaddr` that stay inside the same VMA (and therefore the same
+ * host allocation), letting range operations resolve the mapping once per run instead
+ * of once per page.
  */
-static u8* GetPointerFromVMA(const Kernel::Process& process, VAddr vaddr) {
+static u8* GetPointerFromVMA(const Kernel::Process& process, VAddr vaddr,
+                             std::size_t* run_length = nullptr) {
     const auto& vm_manager = process.VMManager();
 
     const auto it = vm_manager.FindVMA(vaddr);
@@ -132,6 +143,9 @@ static u8* GetPointerFromVMA(const Kernel::Process& process, VAddr vaddr) {
 
     u8* direct_pointer = nullptr;
     const auto& vma = it->second;
+    if (run_length != nullptr) {
+        *run_length = vma.base + vma.size - vaddr;
+    }
     switch (vma.type) {
     case Kernel::VMAType::AllocatedMemoryBlock:
         direct_pointer = vma.backing_block->data() + vma.offset;
@@ -157,15 +171,7 @@ static u8* GetPointerFromVMA(VAddr vaddr) {
 }
 
 template <typename T>
-T Read(const VAddr vaddr) {
-    const u8* page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
-    if (page_pointer) {
-        // NOTE: Avoid adding any extra logic to this fast-path block
-        T value;
-        std::memcpy(&value, &page_pointer[vaddr & PAGE_MASK], sizeof(T));
-        return value;
-    }
-
+T ReadSlow(const VAddr vaddr) {
     // The memory access might do an MMIO or cached access, so we have to lock the HLE kernel state
     std::lock_guard<std::recursive_mutex> lock(HLE::g_hle_lock);
 
@@ -190,14 +196,7 @@ T Read(const VAddr vaddr) {
 }
 
 template <typename T>
-void Write(const VAddr vaddr, const T data) {
-    u8* page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
-    if (page_pointer) {
-        // NOTE: Avoid adding any extra logic to this fast-path block
-        std::memcpy(&page_pointer[vaddr & PAGE_MASK], &data, sizeof(T));
-        return;
-    }
-
+void WriteSlow(const VAddr vaddr, const T data) {
     // The memory access might do an MMIO or cached access, so we have to lock the HLE kernel state
     std::lock_guard<std::recursive_mutex> lock(HLE::g_hle_lock);
 
@@ -258,6 +257,42 @@ u8* GetPointer(const VAddr vaddr) {
     return nullptr;
 }
 
+u8* TryGetContiguousSpan(const VAddr vaddr, const std::size_t size) {
+    if (vaddr == 0 || size == 0) {
+        return nullptr;
+    }
+
+    const std::size_t first_page = vaddr >> PAGE_BITS;
+    const std::size_t last_page = (vaddr + size - 1) >> PAGE_BITS;
+
+    // Runs of plain memory pages resolve through the page table alone
+    if (current_page_table->pointers[first_page] != nullptr) {
+        std::size_t page = first_page;
+        while (page < last_page &&
+               current_page_table->pointers[page + 1] ==
+                   current_page_table->pointers[page] + PAGE_SIZE) {
+            ++page;
+        }
+        if (page == last_page) {
+            return current_page_table->pointers[first_page] + (vaddr & PAGE_MASK);
+        }
+    }
+
+    // Ranges touching rasterizer-cached pages have their backing resolved through the VMAs; the
+    // range still qualifies as long as every page lands at the expected host offset
+    u8* const base = GetPointer(vaddr);
+    if (base == nullptr) {
+        return nullptr;
+    }
+    const VAddr first_page_end = (vaddr & ~static_cast<VAddr>(PAGE_MASK)) + PAGE_SIZE;
+    for (VAddr page = first_page_end; page < vaddr + size; page += PAGE_SIZE) {
+        if (GetPointer(page) != base + (page - vaddr)) {
+            return nullptr;
+        }
+    }
+    return base;
+}
+
 std::string ReadCString(VAddr vaddr, std::size_t max_length) {
     std::string string;
     string.reserve(max_length);
@@ -356,16 +391,16 @@ void RasterizerFlushVirtualRegion(VAddr start, u64 size, FlushMode mode) {
         const VAddr overlap_end = std::min(end, region_end);
         const VAddr overlap_size = overlap_end - overlap_start;
 
-        auto& rasterizer = system_instance.Renderer().Rasterizer();
+        auto& gpu = system_instance.GPU();
         switch (mode) {
         case FlushMode::Flush:
-            rasterizer.FlushRegion(overlap_start, overlap_size);
+            gpu.FlushRegion(overlap_start, overlap_size);
             break;
         case FlushMode::Invalidate:
-            rasterizer.InvalidateRegion(overlap_start, overlap_size);
+            gpu.InvalidateRegion(overlap_start, overlap_size);
             break;
         case FlushMode::FlushAndInvalidate:
-            rasterizer.FlushAndInvalidateRegion(overlap_start, overlap_size);
+            gpu.FlushAndInvalidateRegion(overlap_start, overlap_size);
             break;
         }
     };
@@ -376,24 +411,22 @@ void RasterizerFlushVirtualRegion(VAddr start, u64 size, FlushMode mode) {
     CheckRegion(vm_manager.GetHeapRegionBaseAddress(), vm_manager.GetHeapRegionEndAddress());
 }
 
-u8 Read8(const VAddr addr) {
-    return Read<u8>(addr);
-}
+// The inlined fast paths in the header dispatch here for special pages.
+template u8 ReadSlow<u8>(VAddr vaddr);
+template u16_le ReadSlow<u16_le>(VAddr vaddr);
+template u32_le ReadSlow<u32_le>(VAddr vaddr);
+template u64_le ReadSlow<u64_le>(VAddr vaddr);
+template void WriteSlow<u8>(VAddr vaddr, u8 data);
+template void WriteSlow<u16_le>(VAddr vaddr, u16_le data);
+template void WriteSlow<u32_le>(VAddr vaddr, u32_le data);
+template void WriteSlow<u64_le>(VAddr vaddr, u64_le data);
 
-u16 Read16(const VAddr addr) {
-    return Read<u16_le>(addr);
-}
-
-u32 Read32(const VAddr addr) {
-    return Read<u32_le>(addr);
-}
-
-u64 Read64(const VAddr addr) {
-    return Read<u64_le>(addr);
-}
+MICROPROFILE_DEFINE(Memory_ReadBlock, "Memory", "ReadBlock", MP_RGB(100, 180, 255));
 
 void ReadBlock(const Kernel::Process& process, const VAddr src_addr, void* dest_buffer,
                const std::size_t size) {
+    MICROPROFILE_SCOPE(Memory_ReadBlock);
+
     const auto& page_table = process.VMManager().page_table;
 
     std::size_t remaining_size = size;
@@ -401,7 +434,7 @@ void ReadBlock(const Kernel::Process& process, const VAddr src_addr, void* dest_
     std::size_t page_offset = src_addr & PAGE_MASK;
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount =
+        std::size_t copy_amount =
             std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
         const VAddr current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -416,14 +449,39 @@ void ReadBlock(const Kernel::Process& process, const VAddr src_addr, void* dest_
         case PageType::Memory: {
             DEBUG_ASSERT(page_table.pointers[page_index]);
 
-            const u8* src_ptr = page_table.pointers[page_index] + page_offset;
+            // Extend the copy across the run of pages whose host backing is contiguous, so a
+            // large block costs one bounds computation and one memcpy instead of one per page.
+            const u8* const src_ptr = page_table.pointers[page_index] + page_offset;
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::Memory &&
+                   page_table.pointers[page_index + 1] ==
+                       page_table.pointers[page_index] + PAGE_SIZE) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
             std::memcpy(dest_buffer, src_ptr, copy_amount);
             break;
         }
         case PageType::RasterizerCachedMemory: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
-                                         FlushMode::Flush);
-            std::memcpy(dest_buffer, GetPointerFromVMA(process, current_vaddr), copy_amount);
+            // Coalesce the run of consecutive rasterizer-cached pages so the flush and the
+            // VMA walks are amortized over the whole span instead of paid per page.
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::RasterizerCachedMemory) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
+            RasterizerFlushVirtualRegion(current_vaddr, copy_amount, FlushMode::Flush);
+
+            std::size_t copied = 0;
+            while (copied < copy_amount) {
+                std::size_t run_length = 0;
+                const u8* src_ptr = GetPointerFromVMA(process, current_vaddr + copied, &run_length);
+                const std::size_t chunk = std::min(copy_amount - copied, run_length);
+                std::memcpy(static_cast<u8*>(dest_buffer) + copied, src_ptr, chunk);
+                copied += chunk;
+            }
             break;
         }
         default:
@@ -441,31 +499,19 @@ void ReadBlock(const VAddr src_addr, void* dest_buffer, const std::size_t size)
     ReadBlock(*Core::CurrentProcess(), src_addr, dest_buffer, size);
 }
 
-void Write8(const VAddr addr, const u8 data) {
-    Write<u8>(addr, data);
-}
-
-void Write16(const VAddr addr, const u16 data) {
-    Write<u16_le>(addr, data);
-}
-
-void Write32(const VAddr addr, const u32 data) {
-    Write<u32_le>(addr, data);
-}
-
-void Write64(const VAddr addr, const u64 data) {
-    Write<u64_le>(addr, data);
-}
+MICROPROFILE_DEFINE(Memory_WriteBlock, "Memory", "WriteBlock", MP_RGB(100, 180, 255));
 
 void WriteBlock(const Kernel::Process& process, const VAddr dest_addr, const void* src_buffer,
                 const std::size_t size) {
+    MICROPROFILE_SCOPE(Memory_WriteBlock);
+
     const auto& page_table = process.VMManager().page_table;
     std::size_t remaining_size = size;
     std::size_t page_index = dest_addr >> PAGE_BITS;
     std::size_t page_offset = dest_addr & PAGE_MASK;
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount =
+        std::size_t copy_amount =
             std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
         const VAddr current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -479,14 +525,39 @@ void WriteBlock(const Kernel::Process& process, const VAddr dest_addr, const voi
         case PageType::Memory: {
             DEBUG_ASSERT(page_table.pointers[page_index]);
 
-            u8* dest_ptr = page_table.pointers[page_index] + page_offset;
+            // Extend the copy across the run of pages whose host backing is contiguous, so a
+            // large block costs one bounds computation and one memcpy instead of one per page.
+            u8* const dest_ptr = page_table.pointers[page_index] + page_offset;
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::Memory &&
+                   page_table.pointers[page_index + 1] ==
+                       page_table.pointers[page_index] + PAGE_SIZE) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
             std::memcpy(dest_ptr, src_buffer, copy_amount);
             break;
         }
         case PageType::RasterizerCachedMemory: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
-                                         FlushMode::Invalidate);
-            std::memcpy(GetPointerFromVMA(process, current_vaddr), src_buffer, copy_amount);
+            // Coalesce the run of consecutive rasterizer-cached pages so the invalidate and
+            // the VMA walks are amortized over the whole span instead of paid per page.
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::RasterizerCachedMemory) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
+            RasterizerFlushVirtualRegion(current_vaddr, copy_amount, FlushMode::Invalidate);
+
+            std::size_t copied = 0;
+            while (copied < copy_amount) {
+                std::size_t run_length = 0;
+                u8* dest_ptr = GetPointerFromVMA(process, current_vaddr + copied, &run_length);
+                const std::size_t chunk = std::min(copy_amount - copied, run_length);
+                std::memcpy(dest_ptr, static_cast<const u8*>(src_buffer) + copied, chunk);
+                copied += chunk;
+            }
             break;
         }
         default:
@@ -504,14 +575,18 @@ void WriteBlock(const VAddr dest_addr, const void* src_buffer, const std::size_t
     WriteBlock(*Core::CurrentProcess(), dest_addr, src_buffer, size);
 }
 
+MICROPROFILE_DEFINE(Memory_ZeroBlock, "Memory", "ZeroBlock", MP_RGB(100, 180, 255));
+
 void ZeroBlock(const Kernel::Process& process, const VAddr dest_addr, const std::size_t size) {
+    MICROPROFILE_SCOPE(Memory_ZeroBlock);
+
     const auto& page_table = process.VMManager().page_table;
     std::size_t remaining_size = size;
     std::size_t page_index = dest_addr >> PAGE_BITS;
     std::size_t page_offset = dest_addr & PAGE_MASK;
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount =
+        std::size_t copy_amount =
             std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
         const VAddr current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -525,14 +600,39 @@ void ZeroBlock(const Kernel::Process& process, const VAddr dest_addr, const std:
         case PageType::Memory: {
             DEBUG_ASSERT(page_table.pointers[page_index]);
 
-            u8* dest_ptr = page_table.pointers[page_index] + page_offset;
+            // Extend the clear across the run of pages whose host backing is contiguous, so a
+            // large block costs one memset instead of one per page.
+            u8* const dest_ptr = page_table.pointers[page_index] + page_offset;
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::Memory &&
+                   page_table.pointers[page_index + 1] ==
+                       page_table.pointers[page_index] + PAGE_SIZE) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
             std::memset(dest_ptr, 0, copy_amount);
             break;
         }
         case PageType::RasterizerCachedMemory: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
-                                         FlushMode::Invalidate);
-            std::memset(GetPointerFromVMA(process, current_vaddr), 0, copy_amount);
+            // Coalesce the run of consecutive rasterizer-cached pages so the invalidate and
+            // the VMA walks are amortized over the whole span instead of paid per page.
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::RasterizerCachedMemory) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
+            RasterizerFlushVirtualRegion(current_vaddr, copy_amount, FlushMode::Invalidate);
+
+            std::size_t zeroed = 0;
+            while (zeroed < copy_amount) {
+                std::size_t run_length = 0;
+                u8* dest_ptr = GetPointerFromVMA(process, current_vaddr + zeroed, &run_length);
+                const std::size_t chunk = std::min(copy_amount - zeroed, run_length);
+                std::memset(dest_ptr, 0, chunk);
+                zeroed += chunk;
+            }
             break;
         }
         default:
@@ -545,15 +645,19 @@ void ZeroBlock(const Kernel::Process& process, const VAddr dest_addr, const std:
     }
 }
 
+MICROPROFILE_DEFINE(Memory_CopyBlock, "Memory", "CopyBlock", MP_RGB(100, 180, 255));
+
 void CopyBlock(const Kernel::Process& process, VAddr dest_addr, VAddr src_addr,
                const std::size_t size) {
+    MICROPROFILE_SCOPE(Memory_CopyBlock);
+
     const auto& page_table = process.VMManager().page_table;
     std::size_t remaining_size = size;
     std::size_t page_index = src_addr >> PAGE_BITS;
     std::size_t page_offset = src_addr & PAGE_MASK;
 
     while (remaining_size > 0) {
-        const std::size_t copy_amount =
+        std::size_t copy_amount =
             std::min(static_cast<std::size_t>(PAGE_SIZE) - page_offset, remaining_size);
         const VAddr current_vaddr = static_cast<VAddr>((page_index << PAGE_BITS) + page_offset);
 
@@ -567,14 +671,40 @@ void CopyBlock(const Kernel::Process& process, VAddr dest_addr, VAddr src_addr,
         }
         case PageType::Memory: {
             DEBUG_ASSERT(page_table.pointers[page_index]);
-            const u8* src_ptr = page_table.pointers[page_index] + page_offset;
+
+            // Extend the copy across the run of source pages whose host backing is contiguous,
+            // so the destination page walk in WriteBlock is amortized over the whole span.
+            const u8* const src_ptr = page_table.pointers[page_index] + page_offset;
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::Memory &&
+                   page_table.pointers[page_index + 1] ==
+                       page_table.pointers[page_index] + PAGE_SIZE) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
             WriteBlock(process, dest_addr, src_ptr, copy_amount);
             break;
         }
         case PageType::RasterizerCachedMemory: {
-            RasterizerFlushVirtualRegion(current_vaddr, static_cast<u32>(copy_amount),
-                                         FlushMode::Flush);
-            WriteBlock(process, dest_addr, GetPointerFromVMA(process, current_vaddr), copy_amount);
+            // Coalesce the run of consecutive rasterizer-cached pages so the flush and the
+            // VMA walks are amortized over the whole span instead of paid per page.
+            while (copy_amount < remaining_size &&
+                   page_table.attributes[page_index + 1] == PageType::RasterizerCachedMemory) {
+                ++page_index;
+                copy_amount +=
+                    std::min(static_cast<std::size_t>(PAGE_SIZE), remaining_size - copy_amount);
+            }
+            RasterizerFlushVirtualRegion(current_vaddr, copy_amount, FlushMode::Flush);
+
+            std::size_t copied = 0;
+            while (copied < copy_amount) {
+                std::size_t run_length = 0;
+                const u8* src_ptr = GetPointerFromVMA(process, current_vaddr + copied, &run_length);
+                const std::size_t chunk = std::min(copy_amount - copied, run_length);
+                WriteBlock(process, dest_addr + copied, src_ptr, chunk);
+                copied += chunk;
+            }
             break;
         }
         default:
@@ -5,11 +5,13 @@
 #pragma once
 
 #include <cstddef>
+#include <cstring>
 #include <string>
 #include <tuple>
 #include <vector>
 #include <boost/icl/interval_map.hpp>
 #include "common/common_types.h"
+#include "common/swap.h"
 #include "core/memory_hook.h"
 
 namespace Kernel {
@@ -119,21 +121,80 @@ enum : VAddr {
 void SetCurrentPageTable(PageTable* page_table);
 PageTable* GetCurrentPageTable();
 
+/**
+ * The currently active page table. Exposed so the fast-path accessors below can inline the
+ * pointer-array lookup into their callers; always change it through SetCurrentPageTable so the
+ * CPU cores are notified.
+ */
+extern PageTable* current_page_table;
+
 /// Determines if the given VAddr is valid for the specified process.
 bool IsValidVirtualAddress(const Kernel::Process& process, VAddr vaddr);
 bool IsValidVirtualAddress(VAddr vaddr);
 /// Determines if the given VAddr is a kernel address
 bool IsKernelVirtualAddress(VAddr vaddr);
 
-u8 Read8(VAddr addr);
-u16 Read16(VAddr addr);
-u32 Read32(VAddr addr);
-u64 Read64(VAddr addr);
+/// Out-of-line portion of the accessors below, handling unmapped, MMIO and rasterizer-cached
+/// pages. Instantiated in memory.cpp for the four access widths.
+template <typename T>
+T ReadSlow(VAddr vaddr);
+template <typename T>
+void WriteSlow(VAddr vaddr, T data);
+
+/**
+ * Reads a value from guest memory with the page-table lookup inlined into the caller. Pages
+ * backed by a host pointer - the overwhelming majority of accesses - complete without a
+ * function call; everything else drops into the out-of-line slow path.
+ */
+template <typename T>
+T FastRead(const VAddr vaddr) {
+    const u8* const page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
+    if (page_pointer != nullptr) {
+        // NOTE: Avoid adding any extra logic to this fast-path block
+        T value;
+        std::memcpy(&value, &page_pointer[vaddr & PAGE_MASK], sizeof(T));
+        return value;
+    }
+    return ReadSlow<T>(vaddr);
+}
 
-void Write8(VAddr addr, u8 data);
-void Write16(VAddr addr, u16 data);
-void Write32(VAddr addr, u32 data);
-void Write64(VAddr addr, u64 data);
+/// Writes a value to guest memory with the page-table lookup inlined into the caller.
+template <typename T>
+void FastWrite(const VAddr vaddr, const T data) {
+    u8* const page_pointer = current_page_table->pointers[vaddr >> PAGE_BITS];
+    if (page_pointer != nullptr) {
+        // NOTE: Avoid adding any extra logic to this fast-path block
+        std::memcpy(&page_pointer[vaddr & PAGE_MASK], &data, sizeof(T));
+        return;
+    }
+    WriteSlow<T>(vaddr, data);
+}
+
+inline u8 Read8(const VAddr addr) {
+    return FastRead<u8>(addr);
+}
+inline u16 Read16(const VAddr addr) {
+    return FastRead<u16_le>(addr);
+}
+inline u32 Read32(const VAddr addr) {
+    return FastRead<u32_le>(addr);
+}
+inline u64 Read64(const VAddr addr) {
+    return FastRead<u64_le>(addr);
+}
+
+inline void Write8(const VAddr addr, const u8 data) {
+    FastWrite<u8>(addr, data);
+}
+inline void Write16(const VAddr addr, const u16 data) {
+    FastWrite<u16_le>(addr, data);
+}
+inline void Write32(const VAddr addr, const u32 data) {
+    FastWrite<u32_le>(addr, data);
+}
+inline void Write64(const VAddr addr, const u64 data) {
+    FastWrite<u64_le>(addr, data);
+}
 
 void ReadBlock(const Kernel::Process& process, VAddr src_addr, void* dest_buffer, std::size_t size);
 void ReadBlock(VAddr src_addr, void* dest_buffer, std::size_t size);
@@ -145,6 +206,14 @@ void CopyBlock(VAddr dest_addr, VAddr src_addr, std::size_t size);
 
 u8* GetPointer(VAddr vaddr);
 
+/**
+ * Returns the host pointer backing [vaddr, vaddr + size) in the current process when the whole
+ * range is mapped contiguously in host memory, or nullptr otherwise. Lets IPC and DMA callers
+ * operate on guest memory in place instead of copying through an intermediate buffer. The caller
+ * is responsible for any rasterizer flush or invalidation the access requires.
+ */
+u8* TryGetContiguousSpan(VAddr vaddr, std::size_t size);
+
 std::string ReadCString(VAddr vaddr, std::size_t max_length);
 
 enum class FlushMode {
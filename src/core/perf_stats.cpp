@@ -6,7 +6,13 @@
 #include <chrono>
 #include <mutex>
 #include <thread>
+#include <fmt/format.h>
+#ifdef _WIN32
+#include <windows.h>
+#endif
+#include "common/host_trace.h"
 #include "common/math_util.h"
+#include "common/perf_counters.h"
 #include "core/perf_stats.h"
 #include "core/settings.h"
 
@@ -30,11 +36,23 @@ void PerfStats::EndSystemFrame() {
     accumulated_frametime += frame_end - frame_begin;
     system_frames += 1;
 
+    frame_time_window[frame_time_window_pos] =
+        duration_cast<DoubleSecs>(frame_end - frame_begin).count();
+    frame_time_window_pos = (frame_time_window_pos + 1) % FRAME_TIME_WINDOW_SIZE;
+    frame_time_window_count = std::min(frame_time_window_count + 1, FRAME_TIME_WINDOW_SIZE);
+
     previous_frame_length = frame_end - previous_frame_end;
     previous_frame_end = frame_end;
+
+    constexpr double FRAME_LENGTH = 1.0 / 60;
+    previous_frame_time_scale.store(
+        duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH,
+        std::memory_order_relaxed);
 }
 
 void PerfStats::EndGameFrame() {
+    HOST_TRACE_MARK("GuestFrame");
+
     std::lock_guard<std::mutex> lock(object_mutex);
 
     game_frames += 1;
@@ -55,22 +73,179 @@ PerfStatsResults PerfStats::GetAndResetStats(microseconds current_system_time_us
     results.frametime = duration_cast<DoubleSecs>(accumulated_frametime).count() /
                         static_cast<double>(system_frames);
     results.emulation_speed = system_us_per_second.count() / 1'000'000.0;
+    results.audio_underruns = audio_underruns.exchange(0, std::memory_order_relaxed);
 
     // Reset counters
     reset_point = now;
     reset_point_system_us = current_system_time_us;
     accumulated_frametime = Clock::duration::zero();
+    accumulated_phase_time.fill(Clock::duration::zero());
     system_frames = 0;
     game_frames = 0;
+    const_buffer_upload_bytes.store(0, std::memory_order_relaxed);
+    stream_buffer_stalls.store(0, std::memory_order_relaxed);
+    queue_to_compose_time = Clock::duration::zero();
+    compose_to_present_time = Clock::duration::zero();
+    present_to_swap_time = Clock::duration::zero();
+    composed_frames = 0;
+    presented_frames = 0;
 
     return results;
 }
 
-double PerfStats::GetLastFrameTimeScale() {
+void PerfStats::BeginPhase(Phase phase) {
     std::lock_guard<std::mutex> lock(object_mutex);
 
-    constexpr double FRAME_LENGTH = 1.0 / 60;
-    return duration_cast<DoubleSecs>(previous_frame_length).count() / FRAME_LENGTH;
+    phase_begin[static_cast<std::size_t>(phase)] = Clock::now();
+}
+
+void PerfStats::EndPhase(Phase phase) {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    const auto index = static_cast<std::size_t>(phase);
+    accumulated_phase_time[index] += Clock::now() - phase_begin[index];
+}
+
+double PerfStats::GetFrameTimePercentileMs(double fraction) {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    if (frame_time_window_count == 0) {
+        return 0.0;
+    }
+
+    std::array<double, FRAME_TIME_WINDOW_SIZE> sorted_times;
+    std::copy_n(frame_time_window.begin(), frame_time_window_count, sorted_times.begin());
+    std::sort(sorted_times.begin(), sorted_times.begin() + frame_time_window_count);
+
+    const auto index = std::min(static_cast<std::size_t>(fraction * frame_time_window_count),
+                                frame_time_window_count - 1);
+    return sorted_times[index] * 1000.0;
+}
+
+std::string PerfStats::GetMachineReadableDump() {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    std::array<double, FRAME_TIME_WINDOW_SIZE> sorted_times;
+    std::copy_n(frame_time_window.begin(), frame_time_window_count, sorted_times.begin());
+    std::sort(sorted_times.begin(), sorted_times.begin() + frame_time_window_count);
+
+    const auto percentile = [&](double fraction) {
+        if (frame_time_window_count == 0) {
+            return 0.0;
+        }
+        const auto index = std::min(static_cast<std::size_t>(fraction * frame_time_window_count),
+                                    frame_time_window_count - 1);
+        return sorted_times[index] * 1000.0;
+    };
+    const auto phase_ms = [this](Phase phase) {
+        return duration_cast<DoubleSecs>(accumulated_phase_time[static_cast<std::size_t>(phase)])
+                   .count() *
+               1000.0;
+    };
+    const auto average_latency_ms = [](Clock::duration total, u32 count) {
+        if (count == 0) {
+            return 0.0;
+        }
+        return duration_cast<DoubleSecs>(total).count() * 1000.0 / count;
+    };
+
+    std::string counters;
+    for (const auto& counter : Common::PerfCounterRegistry::Instance().GetSnapshot()) {
+        counters += fmt::format(",\"{}\":{}", counter.name, counter.value);
+    }
+
+    return fmt::format("{{\"frametime_p50_ms\":{:.3f},\"frametime_p95_ms\":{:.3f},"
+                       "\"frametime_p99_ms\":{:.3f},\"cpu_slice_ms\":{:.3f},"
+                       "\"gpu_dispatch_ms\":{:.3f},\"swap_ms\":{:.3f},"
+                       "\"queue_to_compose_ms\":{:.3f},\"compose_to_present_ms\":{:.3f},"
+                       "\"present_to_swap_ms\":{:.3f},\"presented_frames\":{},"
+                       "\"const_buffer_upload_bytes\":{},\"stream_buffer_stalls\":{},"
+                       "\"frames\":{}{}}}",
+                       percentile(0.50), percentile(0.95), percentile(0.99),
+                       phase_ms(Phase::CpuSlice), phase_ms(Phase::GpuDispatch),
+                       phase_ms(Phase::Swap),
+                       average_latency_ms(queue_to_compose_time, composed_frames),
+                       average_latency_ms(compose_to_present_time, presented_frames),
+                       average_latency_ms(present_to_swap_time, presented_frames),
+                       presented_frames,
+                       const_buffer_upload_bytes.load(std::memory_order_relaxed),
+                       stream_buffer_stalls.load(std::memory_order_relaxed),
+                       frame_time_window_count, counters);
+}
+
+void PerfStats::RecordBufferQueued(u32 slot) {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    if (slot < MAX_TRACKED_BUFFER_SLOTS) {
+        buffer_queued_time[slot] = Clock::now();
+    }
+}
+
+void PerfStats::RecordBufferComposed(u32 slot) {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    const auto now = Clock::now();
+    if (slot < MAX_TRACKED_BUFFER_SLOTS && buffer_queued_time[slot] != Clock::time_point{}) {
+        queue_to_compose_time += now - buffer_queued_time[slot];
+        composed_frames += 1;
+    }
+
+    pending_present_times.push_back(now);
+    // If presents stop arriving (e.g. the renderer is stalled), don't let the queue grow without
+    // bound; dropping the oldest entry only skews one sample.
+    if (pending_present_times.size() > 8) {
+        pending_present_times.pop_front();
+    }
+}
+
+void PerfStats::RecordFramePresented() {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    const auto now = Clock::now();
+    if (!pending_present_times.empty()) {
+        compose_to_present_time += now - pending_present_times.front();
+        pending_present_times.pop_front();
+    }
+    last_present_time = now;
+}
+
+void PerfStats::RecordSwapCompleted() {
+    std::lock_guard<std::mutex> lock(object_mutex);
+
+    if (last_present_time != Clock::time_point{}) {
+        present_to_swap_time += Clock::now() - last_present_time;
+        presented_frames += 1;
+    }
+}
+
+void PerfStats::AddAudioUnderrun() {
+    audio_underruns.fetch_add(1, std::memory_order_relaxed);
+}
+
+void PerfStats::AddConstBufferUpload(u64 bytes) {
+    const_buffer_upload_bytes.fetch_add(bytes, std::memory_order_relaxed);
+}
+
+void PerfStats::AddStreamBufferStall() {
+    stream_buffer_stalls.fetch_add(1, std::memory_order_relaxed);
+}
+
+double PerfStats::GetLastFrameTimeScale() const {
+    return previous_frame_time_scale.load(std::memory_order_relaxed);
+}
+
+FrameLimiter::FrameLimiter() {
+#ifdef _WIN32
+    // Request 1 ms scheduler granularity; the default timer resolution would make sleep_for
+    // overshoot by up to 15 ms, which is visible at 60 FPS.
+    timeBeginPeriod(1);
+#endif
+}
+
+FrameLimiter::~FrameLimiter() {
+#ifdef _WIN32
+    timeEndPeriod(1);
+#endif
 }
 
 void FrameLimiter::DoFrameLimiting(microseconds current_system_time_us) {
@@ -96,7 +271,25 @@ void FrameLimiter::DoFrameLimiting(microseconds current_system_time_us) {
         std::clamp(frame_limiting_delta_err, -max_lag_time_us, max_lag_time_us);
 
     if (frame_limiting_delta_err > microseconds::zero()) {
-        std::this_thread::sleep_for(frame_limiting_delta_err);
+        const auto wait_target = now + frame_limiting_delta_err;
+
+        // Sleep coarsely, waking up spin_window early, then busy-wait the remainder: sleep_for
+        // alone overshoots by the scheduler quantum, which is far too coarse for frame pacing.
+        const auto sleep_time = frame_limiting_delta_err - spin_window;
+        if (sleep_time > microseconds::zero()) {
+            const auto sleep_start = Clock::now();
+            std::this_thread::sleep_for(sleep_time);
+            const auto overshoot =
+                duration_cast<microseconds>(Clock::now() - sleep_start) - sleep_time;
+            // Track how much the host actually overshoots so the spin window stays as small as
+            // the OS timer resolution allows.
+            spin_window = std::clamp((spin_window * 7 + overshoot + 100us) / 8,
+                                     microseconds{100}, microseconds{5000});
+        }
+
+        while (Clock::now() < wait_target) {
+        }
+
         auto now_after_sleep = Clock::now();
         frame_limiting_delta_err -= duration_cast<microseconds>(now_after_sleep - now);
         now = now_after_sleep;
@@ -4,8 +4,13 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <deque>
 #include <mutex>
+#include <string>
 #include "common/common_types.h"
 
 namespace Core {
@@ -19,6 +24,8 @@ struct PerfStatsResults {
     double frametime;
     /// Ratio of walltime / emulated time elapsed
     double emulation_speed;
+    /// Number of audio buffer underruns in the sink since the last reset
+    u32 audio_underruns;
 };
 
 /**
@@ -29,21 +36,83 @@ class PerfStats {
 public:
     using Clock = std::chrono::high_resolution_clock;
 
+    /// Phases of a system frame whose walltime is accumulated separately.
+    enum class Phase : std::size_t {
+        CpuSlice,    ///< Guest CPU execution inside System::RunLoop
+        GpuDispatch, ///< GPU command list processing
+        Swap,        ///< Framebuffer presentation and buffer swap
+        Count,       ///< Total number of phases
+    };
+
     void BeginSystemFrame();
     void EndSystemFrame();
     void EndGameFrame();
 
+    void BeginPhase(Phase phase);
+    void EndPhase(Phase phase);
+
     PerfStatsResults GetAndResetStats(std::chrono::microseconds current_system_time_us);
 
+    /// Records an audio sink underrun. Wait-free, so it is safe to call from the real-time audio
+    /// callback.
+    void AddAudioUnderrun();
+
+    /// Adds to the number of const buffer bytes uploaded to the host GPU since the last reset.
+    void AddConstBufferUpload(u64 bytes);
+
+    /// Records a stream buffer map that had to stall on a fence the GPU had not reached yet.
+    void AddStreamBufferStall();
+
+    /// Frame lifecycle milestones, used to attribute where a frame's latency goes. A frame is
+    /// timestamped when the guest queues its buffer, when the compositor acquires that slot, when
+    /// the renderer presents it and when the host buffer swap returns; the three resulting
+    /// latencies are accumulated and exported through GetMachineReadableDump.
+    void RecordBufferQueued(u32 slot);
+    void RecordBufferComposed(u32 slot);
+    void RecordFramePresented();
+    void RecordSwapCompleted();
+
+    /**
+     * Serializes the rolling frame-time percentiles (p50/p95/p99 over the last
+     * FRAME_TIME_WINDOW_SIZE frames) and the per-phase walltime accumulated since the last reset
+     * into a single JSON line, for consumption by external test harnesses. Percentiles expose
+     * stutter that the averages in PerfStatsResults hide.
+     */
+    std::string GetMachineReadableDump();
+
+    /**
+     * Returns the given frame-time percentile (fraction in [0, 1]) in milliseconds over the
+     * rolling window, or 0.0 when no frames have been recorded yet. Used by the dynamic
+     * resolution controller as its load signal.
+     */
+    double GetFrameTimePercentileMs(double fraction);
+
     /**
      * Gets the ratio between walltime and the emulated time of the previous system frame. This is
-     * useful for scaling inputs or outputs moving between the two time domains.
+     * useful for scaling inputs or outputs moving between the two time domains. Wait-free, so it
+     * is safe to call from the real-time audio callback.
      */
-    double GetLastFrameTimeScale();
+    double GetLastFrameTimeScale() const;
 
 private:
     std::mutex object_mutex;
 
+    /// Cumulative number of audio sink underruns since last reset. Kept outside object_mutex so
+    /// the audio callback never blocks on the emulation thread.
+    std::atomic<u32> audio_underruns{0};
+
+    /// Cumulative const buffer bytes uploaded to the host GPU since last reset. Atomic so the
+    /// renderer can report it regardless of which thread runs the GPU.
+    std::atomic<u64> const_buffer_upload_bytes{0};
+
+    /// Cumulative number of stream buffer fence stalls since last reset. Atomic so the renderer
+    /// can report it regardless of which thread runs the GPU.
+    std::atomic<u32> stream_buffer_stalls{0};
+
+    /// Walltime / emulated time ratio of the previous system frame. Kept outside object_mutex so
+    /// the audio callback can poll it without blocking on the emulation thread.
+    std::atomic<double> previous_frame_time_scale{1.0};
+
     /// Point when the cumulative counters were reset
     Clock::time_point reset_point = Clock::now();
     /// System time when the cumulative counters were reset
@@ -56,6 +125,44 @@ private:
     /// Cumulative number of game frames (GSP frame submissions) since last reset
     u32 game_frames = 0;
 
+    /// Number of recent frame times kept for percentile reporting (~4 seconds at 60 FPS)
+    static constexpr std::size_t FRAME_TIME_WINDOW_SIZE = 256;
+
+    /// Rolling window of recent frame times, in seconds
+    std::array<double, FRAME_TIME_WINDOW_SIZE> frame_time_window{};
+    /// Next slot of frame_time_window to overwrite
+    std::size_t frame_time_window_pos = 0;
+    /// Number of valid entries in frame_time_window
+    std::size_t frame_time_window_count = 0;
+
+    /// Cumulative walltime spent in each frame phase since last reset
+    std::array<Clock::duration, static_cast<std::size_t>(Phase::Count)> accumulated_phase_time{};
+    /// Point when each currently-running phase began
+    std::array<Clock::time_point, static_cast<std::size_t>(Phase::Count)> phase_begin{};
+
+    /// Maximum number of buffer slots tracked for frame lifecycle timestamps; matches the
+    /// BufferQueue slot limit.
+    static constexpr std::size_t MAX_TRACKED_BUFFER_SLOTS = 0x40;
+
+    /// Walltime when the guest queued the buffer currently occupying each slot
+    std::array<Clock::time_point, MAX_TRACKED_BUFFER_SLOTS> buffer_queued_time{};
+    /// Compose timestamps of frames handed to the renderer but not yet presented. Holds more than
+    /// one entry when the asynchronous GPU thread runs the renderer behind the compositor.
+    std::deque<Clock::time_point> pending_present_times;
+    /// Walltime when the renderer last presented a frame, pending its host swap completion
+    Clock::time_point last_present_time{};
+
+    /// Cumulative guest-queue-to-compose latency of frames composed since last reset
+    Clock::duration queue_to_compose_time = Clock::duration::zero();
+    /// Cumulative compose-to-present latency of frames presented since last reset
+    Clock::duration compose_to_present_time = Clock::duration::zero();
+    /// Cumulative present-to-host-swap-completion latency of frames swapped since last reset
+    Clock::duration present_to_swap_time = Clock::duration::zero();
+    /// Number of frames composed since last reset
+    u32 composed_frames = 0;
+    /// Number of frames whose host swap completed since last reset
+    u32 presented_frames = 0;
+
     /// Point when the previous system frame ended
     Clock::time_point previous_frame_end = reset_point;
     /// Point when the current system frame began
@@ -68,6 +175,9 @@ class FrameLimiter {
 public:
     using Clock = std::chrono::high_resolution_clock;
 
+    FrameLimiter();
+    ~FrameLimiter();
+
     void DoFrameLimiting(std::chrono::microseconds current_system_time_us);
 
 private:
@@ -78,6 +188,10 @@ private:
 
     /// Accumulated difference between walltime and emulated time
     std::chrono::microseconds frame_limiting_delta_err{0};
+
+    /// Estimated overshoot of sleep_for past the requested duration; the limiter wakes up this
+    /// much early and busy-waits the remainder for sub-millisecond pacing
+    std::chrono::microseconds spin_window{1000};
 };
 
 } // namespace Core
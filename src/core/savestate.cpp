@@ -0,0 +1,117 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/process.h"
+#include "core/hle/kernel/vm_manager.h"
+#include "core/memory.h"
+#include "core/savestate.h"
+#include "video_core/engines/maxwell_3d.h"
+#include "video_core/gpu.h"
+
+namespace Core {
+
+static u64 HashPage(const u8* data) {
+    return Common::CityHash64(reinterpret_cast<const char*>(data), Memory::PAGE_SIZE);
+}
+
+SavestateManager::SavestateManager() = default;
+SavestateManager::~SavestateManager() = default;
+
+void SavestateManager::Capture(System& system) {
+    const Kernel::Process* const process = system.CurrentProcess();
+    ASSERT_MSG(process != nullptr, "Cannot capture a savestate before a process is loaded");
+
+    const auto& vm_manager = process->VMManager();
+    std::map<VAddr, MemoryPage> new_pages;
+    std::vector<u8> buffer(Memory::PAGE_SIZE);
+
+    auto vma = vm_manager.FindVMA(vm_manager.GetAddressSpaceBaseAddress());
+    while (vm_manager.IsValidHandle(vma)) {
+        const auto& entry = vma->second;
+        if (entry.type != Kernel::VMAType::Free && entry.type != Kernel::VMAType::MMIO) {
+            const VAddr end = entry.base + entry.size;
+            for (VAddr addr = entry.base; addr < end; addr += Memory::PAGE_SIZE) {
+                Memory::ReadBlock(*process, addr, buffer.data(), buffer.size());
+                const u64 hash = HashPage(buffer.data());
+
+                const auto prev = pages.find(addr);
+                if (prev != pages.end() && prev->second.hash == hash) {
+                    // Unchanged since the previous capture: share its backing storage instead of
+                    // copying the page again.
+                    new_pages.emplace(addr, prev->second);
+                } else {
+                    new_pages.emplace(addr,
+                                      MemoryPage{hash, std::make_shared<std::vector<u8>>(buffer)});
+                }
+            }
+        }
+        const VAddr next = entry.base + entry.size;
+        if (next <= entry.base) {
+            break;
+        }
+        vma = vm_manager.FindVMA(next);
+    }
+    pages = std::move(new_pages);
+
+    for (std::size_t i = 0; i < cpu_contexts.size(); ++i) {
+        system.ArmInterface(i).SaveContext(cpu_contexts[i]);
+    }
+
+    timing_events = CoreTiming::SaveEventQueue(global_timer);
+
+    const auto& maxwell = system.GPU().Maxwell3D();
+    gpu_regs.resize(sizeof(maxwell.regs));
+    std::memcpy(gpu_regs.data(), &maxwell.regs, gpu_regs.size());
+
+    has_snapshot = true;
+    LOG_DEBUG(Core, "Captured savestate: {} pages, {} pending events", pages.size(),
+              timing_events.size());
+}
+
+bool SavestateManager::Restore(System& system) {
+    if (!has_snapshot) {
+        return false;
+    }
+
+    const Kernel::Process* const process = system.CurrentProcess();
+    ASSERT_MSG(process != nullptr, "Cannot restore a savestate without a loaded process");
+
+    std::size_t restored_pages = 0;
+    std::vector<u8> buffer(Memory::PAGE_SIZE);
+    for (const auto& [addr, page] : pages) {
+        if (!Memory::IsValidVirtualAddress(*process, addr)) {
+            // The guest unmapped this region after the capture; without kernel object
+            // serialization we cannot re-create the mapping, so skip it.
+            continue;
+        }
+        Memory::ReadBlock(*process, addr, buffer.data(), buffer.size());
+        if (HashPage(buffer.data()) == page.hash) {
+            continue;
+        }
+        // WriteBlock goes through the rasterizer cache, flushing and invalidating as needed.
+        Memory::WriteBlock(*process, addr, page.data->data(), page.data->size());
+        ++restored_pages;
+    }
+
+    for (std::size_t i = 0; i < cpu_contexts.size(); ++i) {
+        system.ArmInterface(i).LoadContext(cpu_contexts[i]);
+    }
+
+    CoreTiming::LoadEventQueue(global_timer, timing_events);
+
+    auto& maxwell = system.GPU().Maxwell3D();
+    std::memcpy(&maxwell.regs, gpu_regs.data(), gpu_regs.size());
+    // The register file changed behind the rasterizer's back, so raise every dirty flag.
+    maxwell.dirty_flags = {};
+
+    LOG_DEBUG(Core, "Restored savestate: {} of {} pages differed", restored_pages, pages.size());
+    return true;
+}
+
+} // namespace Core
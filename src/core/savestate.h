@@ -0,0 +1,71 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <map>
+#include <memory>
+#include <vector>
+#include "common/common_types.h"
+#include "core/arm/arm_interface.h"
+#include "core/core_cpu.h"
+#include "core/core_timing.h"
+
+namespace Core {
+
+class System;
+
+/**
+ * Captures and restores in-session snapshots of the emulated machine: guest memory, the CPU
+ * contexts of all cores, the pending CoreTiming event queue and the Maxwell3D register file.
+ *
+ * Snapshots are incremental: guest memory is captured at page granularity and pages whose
+ * contents are unchanged since the previous capture share their backing storage with it, so
+ * repeated captures of a mostly-idle title only copy the pages that were actually written.
+ * Restoring likewise only writes back pages that differ from the current memory contents,
+ * which keeps the rasterizer cache invalidation limited to the touched regions.
+ *
+ * Kernel objects (threads, handles, sessions) are not serialized, so snapshots are only valid
+ * within the session that captured them, and both Capture() and Restore() must be called from
+ * the CPU thread while emulation is paused at a stable point (e.g. between timing slices).
+ */
+class SavestateManager {
+public:
+    SavestateManager();
+    ~SavestateManager();
+
+    /// Captures the current machine state, reusing unchanged pages from the previous snapshot.
+    void Capture(System& system);
+
+    /// Returns true if a snapshot has been captured this session.
+    bool HasSnapshot() const {
+        return has_snapshot;
+    }
+
+    /// Restores the captured machine state. Returns false if no snapshot has been captured.
+    bool Restore(System& system);
+
+private:
+    struct MemoryPage {
+        u64 hash;
+        std::shared_ptr<std::vector<u8>> data;
+    };
+
+    bool has_snapshot = false;
+
+    /// Guest memory at page granularity, keyed by virtual address. Pages that were unchanged
+    /// between captures share their backing vector with the previous snapshot.
+    std::map<VAddr, MemoryPage> pages;
+
+    std::array<ARM_Interface::ThreadContext, NUM_CPU_CORES> cpu_contexts{};
+
+    s64 global_timer = 0;
+    std::vector<CoreTiming::SnapshotEvent> timing_events;
+
+    /// Raw copy of Maxwell3D::regs; all dirty flags are raised on restore.
+    std::vector<u8> gpu_regs;
+};
+
+} // namespace Core
@@ -2,6 +2,12 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <memory>
+
+#include "common/logging/backend.h"
+#include "common/microprofile_trace.h"
+#include "common/logging/filter.h"
 #include "core/core.h"
 #include "core/gdbstub/gdbstub.h"
 #include "core/hle/service/hid/hid.h"
@@ -62,10 +68,43 @@ const std::array<const char*, NumMouseButtons> mapping = {{
 
 Values values = {};
 
+std::atomic_bool is_device_reload_pending{true};
+
+namespace {
+// The currently published snapshot and its generation. The shared_ptr is only ever touched
+// through the std::atomic_load/atomic_store free functions, so readers on the emulation threads
+// never race with a frontend thread publishing new settings.
+std::shared_ptr<const Values> settings_snapshot;
+std::atomic<u32> settings_generation{0};
+} // Anonymous namespace
+
+u32 GetGeneration() {
+    return settings_generation.load(std::memory_order_acquire);
+}
+
+std::shared_ptr<const Values> AcquireSnapshot() {
+    if (auto snapshot = std::atomic_load_explicit(&settings_snapshot, std::memory_order_acquire)) {
+        return snapshot;
+    }
+    // Apply() has not been called yet (e.g. unit tests); fall back to a copy of the live values.
+    return std::make_shared<const Values>(values);
+}
+
 void Apply() {
+    std::atomic_store_explicit(&settings_snapshot,
+                               std::shared_ptr<const Values>{std::make_shared<Values>(values)},
+                               std::memory_order_release);
+    settings_generation.fetch_add(1, std::memory_order_release);
+
+    Log::Filter log_filter;
+    log_filter.ParseFilterString(values.log_filter);
+    Log::SetGlobalFilter(log_filter);
+
     GDBStub::SetServerPort(values.gdbstub_port);
     GDBStub::ToggleServer(values.use_gdbstub);
 
+    Common::SetMicroProfileTraceEnabled(values.dump_trace);
+
     auto& system_instance = Core::System::GetInstance();
     if (system_instance.IsPoweredOn()) {
         system_instance.Renderer().RefreshBaseSettings();
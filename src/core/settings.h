@@ -7,6 +7,7 @@
 #include <array>
 #include <atomic>
 #include <map>
+#include <memory>
 #include <optional>
 #include <string>
 #include <vector>
@@ -345,6 +346,11 @@ struct TouchscreenInput {
     u32 rotation_angle;
 };
 
+enum class RendererBackend {
+    OpenGL = 0,
+    Vulkan = 1,
+};
+
 struct Values {
     // System
     bool use_docked_mode;
@@ -370,11 +376,15 @@ struct Values {
 
     std::string motion_device;
     TouchscreenInput touchscreen;
-    std::atomic_bool is_device_reload_pending{true};
 
     // Core
     bool use_cpu_jit;
     bool use_multi_core;
+    bool enable_host_thread_scheduling;
+    u32 host_cpu_thread_affinity;
+    u32 host_gpu_thread_affinity;
+    u32 host_audio_thread_affinity;
+    s32 host_numa_node;
 
     // Data Storage
     bool use_virtual_sd;
@@ -382,10 +392,19 @@ struct Values {
     std::string sdmc_dir;
 
     // Renderer
+    RendererBackend renderer_backend;
     float resolution_factor;
+    bool use_dynamic_resolution;
+    float dynamic_resolution_min;
     bool use_frame_limit;
     u16 frame_limit;
     bool use_accurate_gpu_emulation;
+    bool use_asynchronous_gpu_emulation;
+    bool use_asynchronous_shaders;
+    bool use_texture_upload_dedup;
+    u32 gpu_cache_budget_mb;
+    bool dump_frames;
+    u32 dump_frames_interval;
 
     float bg_red;
     float bg_green;
@@ -407,6 +426,10 @@ struct Values {
     std::string program_args;
     bool dump_exefs;
     bool dump_nso;
+    bool dump_shader_corpus;
+    bool use_cpu_framebuffer_copy;
+    bool record_ipc_events;
+    bool dump_trace;
 
     // WebService
     bool enable_telemetry;
@@ -418,5 +441,21 @@ struct Values {
     std::map<u64, std::vector<std::string>> disabled_addons;
 } extern values;
 
+/// Set when the frontend has remapped input devices and the HLE input emulation should pick the
+/// new mappings up. Lives outside of Values so that the settings struct stays copyable.
+extern std::atomic_bool is_device_reload_pending;
+
+/// Returns the generation counter that is bumped every time Apply() publishes a new snapshot.
+/// Hot code can poll this with a single atomic load to detect that settings have changed.
+u32 GetGeneration();
+
+/// Returns the immutable settings snapshot published by the most recent Apply() call. Hot paths
+/// should acquire the snapshot once per frame (or once per generation change) instead of reading
+/// the mutable `values` global per operation, so that settings can be edited while emulation runs.
+std::shared_ptr<const Values> AcquireSnapshot();
+
+/// Publishes `values` as a new immutable snapshot and applies the settings that are safe to change
+/// at runtime (frame limiter, log filter, input devices, GDB stub). Safe to call while a title is
+/// running; readers holding the previous snapshot keep a consistent view until they re-acquire.
 void Apply();
 } // namespace Settings
@@ -0,0 +1,121 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "common/string_util.h"
+#include "core/settings.h"
+#include "core/title_profiles.h"
+
+namespace Settings {
+
+namespace {
+
+/// One profile key: the config name it is stored under and how its value lands in values
+struct ProfileKey {
+    const char* name;
+    void (*apply)(const std::string& value);
+};
+
+bool ParseBool(const std::string& value) {
+    return value == "1" || value == "true";
+}
+
+// The recognized keys deliberately mirror the names the base config files use, so a tuning can
+// be moved between the global config and a title profile without translation. Only settings
+// that are safe to change per title are listed; input and data storage stay global.
+constexpr ProfileKey PROFILE_KEYS[] = {
+    {"use_cpu_jit", [](const std::string& v) { values.use_cpu_jit = ParseBool(v); }},
+    {"use_multi_core", [](const std::string& v) { values.use_multi_core = ParseBool(v); }},
+    {"use_docked_mode", [](const std::string& v) { values.use_docked_mode = ParseBool(v); }},
+    {"resolution_factor",
+     [](const std::string& v) { values.resolution_factor = std::strtof(v.c_str(), nullptr); }},
+    {"use_dynamic_resolution",
+     [](const std::string& v) { values.use_dynamic_resolution = ParseBool(v); }},
+    {"dynamic_resolution_min",
+     [](const std::string& v) {
+         values.dynamic_resolution_min = std::strtof(v.c_str(), nullptr);
+     }},
+    {"gpu_cache_budget_mb",
+     [](const std::string& v) {
+         values.gpu_cache_budget_mb = static_cast<u32>(std::strtoul(v.c_str(), nullptr, 0));
+     }},
+    {"use_frame_limit", [](const std::string& v) { values.use_frame_limit = ParseBool(v); }},
+    {"frame_limit",
+     [](const std::string& v) {
+         values.frame_limit = static_cast<u16>(std::strtoul(v.c_str(), nullptr, 0));
+     }},
+    {"use_accurate_gpu_emulation",
+     [](const std::string& v) { values.use_accurate_gpu_emulation = ParseBool(v); }},
+    {"use_asynchronous_gpu_emulation",
+     [](const std::string& v) { values.use_asynchronous_gpu_emulation = ParseBool(v); }},
+    {"use_asynchronous_shaders",
+     [](const std::string& v) { values.use_asynchronous_shaders = ParseBool(v); }},
+    {"use_texture_upload_dedup",
+     [](const std::string& v) { values.use_texture_upload_dedup = ParseBool(v); }},
+};
+
+/// Applies a single "key = value" line, returning whether a known key was set
+bool ApplyProfileLine(const std::string& line, const std::string& path) {
+    const auto separator = line.find('=');
+    if (separator == std::string::npos) {
+        LOG_WARNING(Config, "Ignoring malformed line in {}: {}", path, line);
+        return false;
+    }
+    const std::string key = Common::StripSpaces(line.substr(0, separator));
+    const std::string value = Common::StripSpaces(line.substr(separator + 1));
+    for (const auto& profile_key : PROFILE_KEYS) {
+        if (key == profile_key.name) {
+            profile_key.apply(value);
+            return true;
+        }
+    }
+    LOG_WARNING(Config, "Ignoring unknown key in {}: {}", path, key);
+    return false;
+}
+
+} // Anonymous namespace
+
+void ApplyTitleProfile(u64 title_id) {
+    const std::string path = fmt::format(
+        "{}title_profiles/{:016X}.ini", FileUtil::GetUserPath(FileUtil::UserPath::ConfigDir),
+        title_id);
+    if (!FileUtil::Exists(path)) {
+        return;
+    }
+
+    std::string contents;
+    if (FileUtil::ReadFileToString(true, path.c_str(), contents) == 0) {
+        LOG_ERROR(Config, "Failed to read title profile {}", path);
+        return;
+    }
+
+    std::vector<std::string> lines;
+    Common::SplitString(contents, '\n', lines);
+
+    std::size_t applied = 0;
+    for (const std::string& raw_line : lines) {
+        const std::string line = Common::StripSpaces(raw_line);
+        if (line.empty() || line[0] == '#' || line[0] == ';') {
+            continue;
+        }
+        if (ApplyProfileLine(line, path)) {
+            ++applied;
+        }
+    }
+
+    if (applied == 0) {
+        return;
+    }
+    LOG_INFO(Config, "Applied {} setting(s) from title profile {}", applied, path);
+    Apply();
+}
+
+} // namespace Settings
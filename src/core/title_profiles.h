@@ -0,0 +1,20 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include "common/common_types.h"
+
+namespace Settings {
+
+/**
+ * Applies the per-title performance profile for the given title ID on top of the base config,
+ * if one exists. Profiles live at <config>/title_profiles/<title id>.ini as flat key=value
+ * files using the same key names as the [Renderer]/[Core]/[System] config sections, limited to
+ * the performance-relevant settings. When any key is applied, the updated values are published
+ * through Apply() so running components pick them up via the snapshot mechanism.
+ */
+void ApplyTitleProfile(u64 title_id);
+
+} // namespace Settings
@@ -5,11 +5,9 @@
 #include <algorithm>
 #include <chrono>
 #include <mutex>
-#include <thread>
 #include <tuple>
 #include "common/math_util.h"
 #include "common/quaternion.h"
-#include "common/thread.h"
 #include "common/vector_math.h"
 #include "input_common/motion_emu.h"
 
@@ -19,17 +17,9 @@ namespace InputCommon {
 class MotionEmuDevice {
 public:
     MotionEmuDevice(int update_millisecond, float sensitivity)
-        : update_millisecond(update_millisecond),
-          update_duration(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        : update_duration(std::chrono::duration_cast<std::chrono::steady_clock::duration>(
               std::chrono::milliseconds(update_millisecond))),
-          sensitivity(sensitivity), motion_emu_thread(&MotionEmuDevice::MotionEmuThread, this) {}
-
-    ~MotionEmuDevice() {
-        if (motion_emu_thread.joinable()) {
-            shutdown_event.Set();
-            motion_emu_thread.join();
-        }
-    }
+          sensitivity(sensitivity), last_update(std::chrono::steady_clock::now()) {}
 
     void BeginTilt(int x, int y) {
         mouse_origin = Math::MakeVec(x, y);
@@ -58,11 +48,47 @@ public:
 
     std::tuple<Math::Vec3<float>, Math::Vec3<float>> GetStatus() {
         std::lock_guard<std::mutex> guard(status_mutex);
+
+        // The sensor state is integrated lazily when the emulated title actually reads it,
+        // instead of on a dedicated thread waking up every update period. Polls arriving faster
+        // than the configured period reuse the previous step, which also keeps the derived
+        // angular rate well conditioned.
+        const auto now = std::chrono::steady_clock::now();
+        if (now - last_update < update_duration) {
+            return status;
+        }
+        const float elapsed_seconds =
+            std::chrono::duration_cast<std::chrono::duration<float>>(now - last_update).count();
+        last_update = now;
+
+        const Math::Quaternion<float> old_q = q;
+        {
+            std::lock_guard<std::mutex> tilt_guard(tilt_mutex);
+
+            // Find the quaternion describing current 3DS tilting
+            q = MakeQuaternion(Math::MakeVec(-tilt_direction.y, 0.0f, tilt_direction.x),
+                               tilt_angle);
+        }
+
+        auto inv_q = q.Inverse();
+
+        // Set the gravity vector in world space
+        auto gravity = Math::MakeVec(0.0f, -1.0f, 0.0f);
+
+        // Find the angular rate vector in world space
+        auto angular_rate = ((q - old_q) * inv_q).xyz * 2;
+        angular_rate *= 180 / (MathUtil::PI * elapsed_seconds);
+
+        // Transform the two vectors from world space to 3DS space
+        gravity = QuaternionRotate(inv_q, gravity);
+        angular_rate = QuaternionRotate(inv_q, angular_rate);
+
+        // Update the sensor state
+        status = std::make_tuple(gravity, angular_rate);
         return status;
     }
 
 private:
-    const int update_millisecond;
     const std::chrono::steady_clock::duration update_duration;
     const float sensitivity;
 
@@ -74,52 +100,10 @@ private:
 
     bool is_tilting = false;
 
-    Common::Event shutdown_event;
-
-    std::tuple<Math::Vec3<float>, Math::Vec3<float>> status;
     std::mutex status_mutex;
-
-    // Note: always keep the thread declaration at the end so that other objects are initialized
-    // before this!
-    std::thread motion_emu_thread;
-
-    void MotionEmuThread() {
-        auto update_time = std::chrono::steady_clock::now();
-        Math::Quaternion<float> q = MakeQuaternion(Math::Vec3<float>(), 0);
-        Math::Quaternion<float> old_q;
-
-        while (!shutdown_event.WaitUntil(update_time)) {
-            update_time += update_duration;
-            old_q = q;
-
-            {
-                std::lock_guard<std::mutex> guard(tilt_mutex);
-
-                // Find the quaternion describing current 3DS tilting
-                q = MakeQuaternion(Math::MakeVec(-tilt_direction.y, 0.0f, tilt_direction.x),
-                                   tilt_angle);
-            }
-
-            auto inv_q = q.Inverse();
-
-            // Set the gravity vector in world space
-            auto gravity = Math::MakeVec(0.0f, -1.0f, 0.0f);
-
-            // Find the angular rate vector in world space
-            auto angular_rate = ((q - old_q) * inv_q).xyz * 2;
-            angular_rate *= 1000 / update_millisecond / MathUtil::PI * 180;
-
-            // Transform the two vectors from world space to 3DS space
-            gravity = QuaternionRotate(inv_q, gravity);
-            angular_rate = QuaternionRotate(inv_q, angular_rate);
-
-            // Update the sensor state
-            {
-                std::lock_guard<std::mutex> guard(status_mutex);
-                status = std::make_tuple(gravity, angular_rate);
-            }
-        }
-    }
+    std::chrono::steady_clock::time_point last_update;
+    Math::Quaternion<float> q = MakeQuaternion(Math::Vec3<float>(), 0);
+    std::tuple<Math::Vec3<float>, Math::Vec3<float>> status;
 };
 
 // Interface wrapper held by input receiver as a unique_ptr. It holds the implementation class as
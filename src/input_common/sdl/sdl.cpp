@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <functional>
@@ -58,23 +59,31 @@ public:
         : guid{std::move(guid_)}, port{port_}, sdl_joystick{joystick, deleter} {}
 
     void SetButton(int button, bool value) {
-        std::lock_guard<std::mutex> lock(mutex);
-        state.buttons[button] = value;
+        if (button < 0 || button >= MAX_BUTTONS) {
+            return;
+        }
+        state.buttons[button].store(value, std::memory_order_relaxed);
     }
 
     bool GetButton(int button) const {
-        std::lock_guard<std::mutex> lock(mutex);
-        return state.buttons.at(button);
+        if (button < 0 || button >= MAX_BUTTONS) {
+            return false;
+        }
+        return state.buttons[button].load(std::memory_order_relaxed);
     }
 
     void SetAxis(int axis, Sint16 value) {
-        std::lock_guard<std::mutex> lock(mutex);
-        state.axes[axis] = value;
+        if (axis < 0 || axis >= MAX_AXES) {
+            return;
+        }
+        state.axes[axis].store(value, std::memory_order_relaxed);
     }
 
     float GetAxis(int axis) const {
-        std::lock_guard<std::mutex> lock(mutex);
-        return state.axes.at(axis) / 32767.0f;
+        if (axis < 0 || axis >= MAX_AXES) {
+            return 0.0f;
+        }
+        return state.axes[axis].load(std::memory_order_relaxed) / 32767.0f;
     }
 
     std::tuple<float, float> GetAnalog(int axis_x, int axis_y) const {
@@ -95,13 +104,17 @@ public:
     }
 
     void SetHat(int hat, Uint8 direction) {
-        std::lock_guard<std::mutex> lock(mutex);
-        state.hats[hat] = direction;
+        if (hat < 0 || hat >= MAX_HATS) {
+            return;
+        }
+        state.hats[hat].store(direction, std::memory_order_relaxed);
     }
 
     bool GetHatDirection(int hat, Uint8 direction) const {
-        std::lock_guard<std::mutex> lock(mutex);
-        return (state.hats.at(hat) & direction) != 0;
+        if (hat < 0 || hat >= MAX_HATS) {
+            return false;
+        }
+        return (state.hats[hat].load(std::memory_order_relaxed) & direction) != 0;
     }
     /**
      * The guid of the joystick
@@ -128,15 +141,20 @@ public:
     }
 
 private:
+    static constexpr int MAX_BUTTONS = 64;
+    static constexpr int MAX_AXES = 16;
+    static constexpr int MAX_HATS = 8;
+
+    // Each field is an independent atomic, so GetStatus() calls from the HID update are wait-free
+    // reads that never contend with the SDL poll thread or with hotplug handling.
     struct State {
-        std::unordered_map<int, bool> buttons;
-        std::unordered_map<int, Sint16> axes;
-        std::unordered_map<int, Uint8> hats;
+        std::array<std::atomic<bool>, MAX_BUTTONS> buttons{};
+        std::array<std::atomic<Sint16>, MAX_AXES> axes{};
+        std::array<std::atomic<Uint8>, MAX_HATS> hats{};
     } state;
     std::string guid;
     int port;
     std::unique_ptr<SDL_Joystick, decltype(&SDL_JoystickClose)> sdl_joystick;
-    mutable std::mutex mutex;
 };
 
 /**
@@ -289,12 +307,16 @@ void PollLoop() {
     while (initialized) {
         // Wait for 10 ms or until an event happens
         if (SDL_WaitEventTimeout(&event, 10)) {
-            // Don't handle the event if we are configuring
-            if (polling) {
-                event_queue.Push(event);
-            } else {
-                HandleGameControllerEvent(event);
-            }
+            // Drain everything that has accumulated in one batch instead of paying the wait
+            // machinery per event
+            do {
+                // Don't handle the event if we are configuring
+                if (polling) {
+                    event_queue.Push(event);
+                } else {
+                    HandleGameControllerEvent(event);
+                }
+            } while (initialized && SDL_PollEvent(&event));
         }
     }
     CloseSDLJoysticks();
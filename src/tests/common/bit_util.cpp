@@ -0,0 +1,31 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+
+#include "common/bit_util.h"
+
+namespace Common {
+
+TEST_CASE("BitUtils::CountTrailingZeroes", "[common]") {
+    REQUIRE(Common::CountTrailingZeroes32(0) == 32);
+    REQUIRE(Common::CountTrailingZeroes64(0) == 64);
+    REQUIRE(Common::CountTrailingZeroes32(9) == 0);
+    REQUIRE(Common::CountTrailingZeroes32(8) == 3);
+    REQUIRE(Common::CountTrailingZeroes64(9) == 0);
+    REQUIRE(Common::CountTrailingZeroes64(8) == 3);
+    REQUIRE(Common::CountTrailingZeroes32(0x801000) == 12);
+    REQUIRE(Common::CountTrailingZeroes64(0x801000000000UL) == 36);
+}
+
+TEST_CASE("BitUtils::CountLeadingZeroes", "[common]") {
+    REQUIRE(Common::CountLeadingZeroes32(0) == 32);
+    REQUIRE(Common::CountLeadingZeroes64(0) == 64);
+    REQUIRE(Common::CountLeadingZeroes32(1) == 31);
+    REQUIRE(Common::CountLeadingZeroes32(0x80000000) == 0);
+    REQUIRE(Common::CountLeadingZeroes64(1) == 63);
+    REQUIRE(Common::CountLeadingZeroes64(0x8000000000000000UL) == 0);
+}
+
+} // namespace Common
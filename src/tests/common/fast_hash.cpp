@@ -0,0 +1,61 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <random>
+#include <vector>
+#include <catch2/catch.hpp>
+#include "common/fast_hash.h"
+
+namespace Common {
+
+static std::vector<u8> MakeTestBuffer(std::size_t size) {
+    std::mt19937_64 rng{0x1234'5678'9ABC'DEF0};
+    std::vector<u8> buffer(size);
+    for (auto& byte : buffer) {
+        byte = static_cast<u8>(rng());
+    }
+    return buffer;
+}
+
+TEST_CASE("FastHash64 streaming matches one-shot", "[common]") {
+    const auto buffer = MakeTestBuffer(1024 * 1024 + 37);
+    const u64 expected = FastHash64(buffer.data(), buffer.size());
+
+    for (const std::size_t chunk_size : {std::size_t{1}, std::size_t{63}, std::size_t{64},
+                                         std::size_t{4096}, std::size_t{65521}}) {
+        FastHashState state;
+        for (std::size_t offset = 0; offset < buffer.size(); offset += chunk_size) {
+            state.Update(buffer.data() + offset, std::min(chunk_size, buffer.size() - offset));
+        }
+        REQUIRE(state.Finalize() == expected);
+    }
+}
+
+TEST_CASE("FastHash64 basic properties", "[common]") {
+    const auto buffer = MakeTestBuffer(8192);
+
+    // Deterministic across calls
+    REQUIRE(FastHash64(buffer.data(), buffer.size()) == FastHash64(buffer.data(), buffer.size()));
+
+    // Prefixes of differing lengths hash differently, including ones only separated by zero bytes
+    const std::vector<u8> zeros(256);
+    REQUIRE(FastHash64(zeros.data(), 16) != FastHash64(zeros.data(), 17));
+    REQUIRE(FastHash64(zeros.data(), 64) != FastHash64(zeros.data(), 128));
+
+    // A single flipped bit changes the hash
+    auto modified = buffer;
+    modified[buffer.size() / 2] ^= 1;
+    REQUIRE(FastHash64(buffer.data(), buffer.size()) !=
+            FastHash64(modified.data(), modified.size()));
+
+    // Finalize is repeatable and non-destructive
+    FastHashState state;
+    state.Update(buffer.data(), buffer.size());
+    const u64 first = state.Finalize();
+    REQUIRE(state.Finalize() == first);
+    REQUIRE(first == FastHash64(buffer.data(), buffer.size()));
+}
+
+} // namespace Common
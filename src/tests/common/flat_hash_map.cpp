@@ -0,0 +1,82 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstddef>
+#include <memory>
+#include <catch2/catch.hpp>
+#include "common/common_types.h"
+#include "common/flat_hash_map.h"
+
+namespace Common {
+
+TEST_CASE("FlatHashMap: Basic Tests", "[common]") {
+    FlatHashMap<u64, int> map;
+    REQUIRE(map.Empty());
+
+    map.Insert(42, 1);
+    map.Insert(43, 2);
+    REQUIRE(map.Size() == 2);
+    REQUIRE(*map.Find(42) == 1);
+    REQUIRE(*map.Find(43) == 2);
+    REQUIRE(map.Find(44) == nullptr);
+
+    // Inserting an existing key replaces its value without growing the map.
+    map.Insert(42, 3);
+    REQUIRE(map.Size() == 2);
+    REQUIRE(*map.Find(42) == 3);
+
+    REQUIRE(map.Erase(42));
+    REQUIRE(!map.Erase(42));
+    REQUIRE(map.Find(42) == nullptr);
+    REQUIRE(*map.Find(43) == 2);
+
+    map.Clear();
+    REQUIRE(map.Empty());
+    REQUIRE(map.Find(43) == nullptr);
+}
+
+TEST_CASE("FlatHashMap: Growth And Collisions", "[common]") {
+    FlatHashMap<u64, u64> map;
+
+    // Page-aligned keys exercise the hash scrambling and force several rehashes.
+    constexpr u64 count = 10000;
+    for (u64 i = 0; i < count; ++i) {
+        map.Insert(i << 12, i);
+    }
+    REQUIRE(map.Size() == count);
+    for (u64 i = 0; i < count; ++i) {
+        const u64* value = map.Find(i << 12);
+        REQUIRE(value != nullptr);
+        REQUIRE(*value == i);
+    }
+
+    // Erase the even keys and verify backward shifting keeps the odd ones reachable.
+    for (u64 i = 0; i < count; i += 2) {
+        REQUIRE(map.Erase(i << 12));
+    }
+    REQUIRE(map.Size() == count / 2);
+    for (u64 i = 0; i < count; ++i) {
+        const u64* value = map.Find(i << 12);
+        if (i % 2 == 0) {
+            REQUIRE(value == nullptr);
+        } else {
+            REQUIRE(*value == i);
+        }
+    }
+}
+
+TEST_CASE("FlatHashMap: Non-Trivial Values", "[common]") {
+    FlatHashMap<u64, std::shared_ptr<int>> map;
+    map.Reserve(100);
+
+    auto value = std::make_shared<int>(7);
+    map.Insert(0x1000, value);
+    REQUIRE(value.use_count() == 2);
+
+    REQUIRE(**map.Find(0x1000) == 7);
+    REQUIRE(map.Erase(0x1000));
+    REQUIRE(value.use_count() == 1);
+}
+
+} // namespace Common
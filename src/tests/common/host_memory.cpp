@@ -0,0 +1,38 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+#include "common/host_memory.h"
+
+namespace Common {
+
+constexpr std::size_t BACKING_SIZE = 4 * 1024 * 1024;
+constexpr std::size_t VIRTUAL_SIZE = 64 * 1024 * 1024;
+constexpr std::size_t PAGE = 64 * 1024;
+
+TEST_CASE("HostMemory: Aliased mappings", "[common]") {
+    HostMemory mem(BACKING_SIZE, VIRTUAL_SIZE);
+    if (!mem.IsValid()) {
+        // Fastmem is not supported on this host; nothing to test.
+        return;
+    }
+
+    // The same backing page mapped at two places must observe each other's writes.
+    mem.Map(0, 0, PAGE);
+    mem.Map(8 * PAGE, 0, PAGE);
+
+    u8* const virt = mem.VirtualBasePointer();
+    virt[42] = 0x7f;
+    REQUIRE(virt[8 * PAGE + 42] == 0x7f);
+
+    // Writes through an alias are visible in the backing block as well.
+    virt[8 * PAGE + 43] = 0x55;
+    REQUIRE(mem.BackingBasePointer()[43] == 0x55);
+
+    // Unmapping one alias must not disturb the other.
+    mem.Unmap(8 * PAGE, PAGE);
+    REQUIRE(virt[42] == 0x7f);
+}
+
+} // namespace Common
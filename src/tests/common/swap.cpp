@@ -0,0 +1,46 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+
+#include <numeric>
+#include <vector>
+#include "common/swap.h"
+
+namespace Common {
+
+TEST_CASE("Swap::SwapArray", "[common]") {
+    // Lengths straddle the vector width so both the SIMD body and the scalar tail get exercised.
+    for (const std::size_t count : {std::size_t{0}, std::size_t{1}, std::size_t{7},
+                                    std::size_t{16}, std::size_t{33}}) {
+        std::vector<u16> data16(count);
+        std::iota(data16.begin(), data16.end(), static_cast<u16>(0x1234));
+        std::vector<u16> expected16(data16);
+        for (auto& value : expected16) {
+            value = swap16(value);
+        }
+        SwapArray16(data16.data(), data16.size());
+        REQUIRE(data16 == expected16);
+
+        std::vector<u32> data32(count);
+        std::iota(data32.begin(), data32.end(), 0x12345678);
+        std::vector<u32> expected32(data32);
+        for (auto& value : expected32) {
+            value = swap32(value);
+        }
+        SwapArray32(data32.data(), data32.size());
+        REQUIRE(data32 == expected32);
+
+        std::vector<u64> data64(count);
+        std::iota(data64.begin(), data64.end(), 0x0123456789ABCDEFULL);
+        std::vector<u64> expected64(data64);
+        for (auto& value : expected64) {
+            value = swap64(value);
+        }
+        SwapArray64(data64.data(), data64.size());
+        REQUIRE(data64 == expected64);
+    }
+}
+
+} // namespace Common
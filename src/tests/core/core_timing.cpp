@@ -6,10 +6,12 @@
 
 #include <array>
 #include <bitset>
+#include <limits>
 #include <string>
 #include "common/file_util.h"
 #include "core/core.h"
 #include "core/core_timing.h"
+#include "core/core_timing_util.h"
 
 // Numbers are chosen randomly to make sure the correct one is given.
 static constexpr std::array<u64, 5> CB_IDS{{42, 144, 93, 1026, UINT64_C(0xFFFF7FFFF7FFFF)}};
@@ -235,3 +237,36 @@ TEST_CASE("CoreTiming[ChainScheduling]", "[core]") {
     REQUIRE(0 == reschedules);
     REQUIRE(MAX_SLICE_LENGTH == CoreTiming::GetDowncount());
 }
+
+TEST_CASE("CoreTiming[FixedPointConversions]", "[core]") {
+    // Reference results via exact integer math, split so the intermediate never overflows:
+    // value * numerator / denominator
+    const auto reference = [](u64 value, u64 numerator, u64 denominator) {
+        return value / denominator * numerator + value % denominator * numerator / denominator;
+    };
+    // The fixed-point conversions truncate their 2^-64-scaled ratio, so they may come out one
+    // unit below the exact result, never above it or more than one off.
+    const auto close_enough = [](u64 exact, u64 converted) {
+        return converted <= exact && exact - converted <= 1;
+    };
+
+    const std::array<u64, 6> values{{0, 1, 1000, 1234567, 123456789012, 3601000000000}};
+    for (const u64 value : values) {
+        REQUIRE(close_enough(reference(value, CoreTiming::BASE_CLOCK_RATE, 1000000),
+                             static_cast<u64>(CoreTiming::usToCycles(value))));
+        REQUIRE(close_enough(reference(value, CoreTiming::BASE_CLOCK_RATE, 1000000000),
+                             static_cast<u64>(CoreTiming::nsToCycles(value))));
+        REQUIRE(close_enough(reference(value, 1000000000, CoreTiming::BASE_CLOCK_RATE),
+                             CoreTiming::cyclesToNs(static_cast<s64>(value))));
+        REQUIRE(close_enough(reference(value, 1000000, CoreTiming::BASE_CLOCK_RATE),
+                             static_cast<u64>(CoreTiming::cyclesToUs(static_cast<s64>(value)))));
+        REQUIRE(close_enough(reference(value, 1000, CoreTiming::BASE_CLOCK_RATE),
+                             CoreTiming::cyclesToMs(static_cast<s64>(value))));
+    }
+
+    // Inputs too large to represent still saturate instead of wrapping.
+    REQUIRE(std::numeric_limits<s64>::max() ==
+            CoreTiming::usToCycles(std::numeric_limits<u64>::max()));
+    REQUIRE(std::numeric_limits<s64>::max() ==
+            CoreTiming::nsToCycles(std::numeric_limits<u64>::max()));
+}
@@ -0,0 +1,44 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <string>
+#include <catch2/catch.hpp>
+#include "common/hex_util.h"
+#include "core/crypto/sha_util.h"
+
+namespace Core::Crypto {
+
+static SHA256Hash HashOf(const std::string& input) {
+    return CalculateSHA256(reinterpret_cast<const u8*>(input.data()), input.size());
+}
+
+// FIPS 180-4 test vectors; these exercise whichever implementation the host CPU selects.
+TEST_CASE("CalculateSHA256 matches the FIPS 180-4 test vectors", "[core][crypto]") {
+    REQUIRE(HashOf("") ==
+            Common::HexStringToArray<0x20>(
+                "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"));
+    REQUIRE(HashOf("abc") ==
+            Common::HexStringToArray<0x20>(
+                "ba7816bf8f01cfea414140de5dae2223b00361a396177a9cb410ff61f20015ad"));
+    REQUIRE(HashOf("abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq") ==
+            Common::HexStringToArray<0x20>(
+                "248d6a61d20638b8e5c026930c3e6039a33ce45964ff2167f6ecedd419db06c1"));
+}
+
+TEST_CASE("CalculateSHA256 handles padding around the block boundary", "[core][crypto]") {
+    // 55, 56 and 64 byte messages cover a padded single block, the length field spilling into a
+    // second block, and an exactly full block respectively.
+    REQUIRE(HashOf(std::string(55, 'a')) ==
+            Common::HexStringToArray<0x20>(
+                "9f4390f8d30c2dd92ec9f095b65e2b9ae9b0a925a5258e241c9f1e910f734318"));
+    REQUIRE(HashOf(std::string(56, 'a')) ==
+            Common::HexStringToArray<0x20>(
+                "b35439a4ac6f0948b6d6f9e3c6af0f5f590ce20f1bde7090ef7970686ec6738a"));
+    REQUIRE(HashOf(std::string(64, 'a')) ==
+            Common::HexStringToArray<0x20>(
+                "ffe054fe7ae0cb6dc65c3af9b61d5209f439851db43d0ba5997337df154668eb"));
+}
+
+} // namespace Core::Crypto
@@ -0,0 +1,60 @@
+// Copyright 2018 yuzu emulator team
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <catch2/catch.hpp>
+
+#include <memory>
+#include <vector>
+#include "core/file_sys/vfs_overlay.h"
+#include "core/file_sys/vfs_vector.h"
+
+namespace {
+
+void AddExtent(std::map<u64, std::vector<u8>>& extents, u64 offset, std::vector<u8> bytes) {
+    FileSys::OverlayVfsFile::AddExtent(extents, offset, bytes.data(), bytes.size());
+}
+
+} // Anonymous namespace
+
+TEST_CASE("OverlayVfsFile serves patched ranges over the backing file", "[core][file_sys]") {
+    const auto backing =
+        std::make_shared<FileSys::VectorVfsFile>(std::vector<u8>(0x20, 0xAA), "test.bin");
+
+    std::map<u64, std::vector<u8>> extents;
+    AddExtent(extents, 4, {1, 2, 3, 4});
+    AddExtent(extents, 0x10, {5, 6});
+
+    FileSys::OverlayVfsFile file(backing, std::move(extents), "test.bin", nullptr);
+    REQUIRE(file.GetSize() == 0x20);
+
+    // A read spanning base and patched bytes sees the overlay only where extents cover it.
+    REQUIRE((file.ReadBytes(6, 3) == std::vector<u8>{0xAA, 1, 2, 3, 4, 0xAA}));
+    REQUIRE((file.ReadBytes(2, 0x10) == std::vector<u8>{5, 6}));
+    REQUIRE(file.ReadByte(0) == 0xAA);
+
+    // The backing file is untouched and the overlay rejects writes.
+    REQUIRE(backing->ReadByte(4) == 0xAA);
+    const std::vector<u8> data{9};
+    REQUIRE(file.Write(data.data(), data.size(), 0) == 0);
+}
+
+TEST_CASE("OverlayVfsFile::AddExtent keeps extents sorted and non-overlapping",
+          "[core][file_sys]") {
+    std::map<u64, std::vector<u8>> extents;
+    AddExtent(extents, 0, {1, 1, 1, 1});
+    AddExtent(extents, 8, {3, 3, 3, 3});
+
+    // Painting across both records trims them and coalesces everything into one extent.
+    AddExtent(extents, 2, {2, 2, 2, 2, 2, 2, 2});
+    REQUIRE(extents.size() == 1);
+    REQUIRE(extents.begin()->first == 0);
+    REQUIRE((extents.begin()->second ==
+            std::vector<u8>{1, 1, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3}));
+
+    // A record in the middle of an extent overwrites in place.
+    AddExtent(extents, 4, {7, 7});
+    REQUIRE(extents.size() == 1);
+    REQUIRE((extents.begin()->second ==
+            std::vector<u8>{1, 1, 2, 2, 7, 7, 2, 2, 2, 3, 3, 3}));
+}
@@ -2,12 +2,17 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+#include <optional>
+
+#include "common/assert.h"
 #include "common/microprofile.h"
 #include "core/core.h"
 #include "core/memory.h"
 #include "video_core/dma_pusher.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/gpu.h"
+#include "video_core/tracer/gpu_tracer.h"
 
 namespace Tegra {
 
@@ -22,6 +27,12 @@ void DmaPusher::DispatchCalls() {
 
     // On entering GPU code, assume all memory may be touched by the ARM core.
     gpu.Maxwell3D().dirty_flags.OnMemoryWrite();
+    gpu.Maxwell3D().InvalidateTextureDescriptors();
+
+    if (auto* const recorder = gpu.TraceRecorder()) {
+        // Capture the guest memory the engines can observe before any command executes
+        recorder->CaptureMemory(gpu.MemoryManager());
+    }
 
     dma_pushbuffer_subindex = 0;
 
@@ -30,38 +41,69 @@ void DmaPusher::DispatchCalls() {
             break;
         }
     }
+
+    if (auto* const recorder = gpu.TraceRecorder()) {
+        recorder->RecordDispatchBoundary();
+    }
 }
 
 bool DmaPusher::Step() {
-    if (dma_get != dma_put) {
-        // Push buffer non-empty, read a word
-        const CommandHeader command_header{
-            Memory::Read32(*gpu.MemoryManager().GpuToCpuAddress(dma_get))};
+    if (!ib_enable || dma_pushbuffer.empty()) {
+        // Pushbuffer empty and IB empty or nonexistent - nothing to do
+        return false;
+    }
 
-        dma_get += sizeof(u32);
+    const CommandList& command_list{dma_pushbuffer.front()};
+    const CommandListHeader command_list_header{command_list[dma_pushbuffer_subindex++]};
+    const GPUVAddr dma_get{command_list_header.addr};
+    const GPUVAddr dma_put{dma_get + command_list_header.size * sizeof(u32)};
+    const bool non_main{command_list_header.is_non_main != 0};
 
-        if (!non_main) {
-            dma_mget = dma_get;
-        }
+    if (dma_pushbuffer_subindex >= command_list.size()) {
+        // We've gone through the current list, remove it from the queue
+        dma_pushbuffer.pop();
+        dma_pushbuffer_subindex = 0;
+    }
+
+    if (command_list_header.size == 0) {
+        return true;
+    }
+
+    // Fetch the whole pushbuffer segment in one go and decode the headers from the linear copy,
+    // instead of reading one word at a time through the memory system.
+    const std::optional<VAddr> address{gpu.MemoryManager().GpuToCpuAddress(dma_get)};
+    ASSERT_MSG(address, "Invalid GPU address");
+
+    command_headers.resize(command_list_header.size);
+    Memory::ReadBlock(*address, command_headers.data(), command_list_header.size * sizeof(u32));
+
+    for (std::size_t index = 0; index < command_headers.size();) {
+        const CommandHeader& command_header = command_headers[index];
 
-        // now, see if we're in the middle of a command
         if (dma_state.length_pending) {
             // Second word of long non-inc methods command - method count
             dma_state.length_pending = 0;
             dma_state.method_count = command_header.method_count_;
+            ++index;
         } else if (dma_state.method_count) {
             // Data word of methods command
-            CallMethod(command_header.argument);
-
-            if (!dma_state.non_incrementing) {
+            if (dma_state.non_incrementing) {
+                // All remaining data words of the run target the same method, so the whole span
+                // can be forwarded in a single call.
+                const u32 max_write{static_cast<u32>(std::min<std::size_t>(
+                    dma_state.method_count, command_headers.size() - index))};
+                CallMultiMethod(&command_header.argument, max_write);
+                dma_state.method_count -= max_write;
+                index += max_write;
+            } else {
+                CallMethod(command_header.argument);
                 dma_state.method++;
+                if (dma_increment_once) {
+                    dma_state.non_incrementing = true;
+                }
+                dma_state.method_count--;
+                ++index;
             }
-
-            if (dma_increment_once) {
-                dma_state.non_incrementing = true;
-            }
-
-            dma_state.method_count--;
         } else {
             // No command active - this is the first word of a new one
             switch (command_header.mode) {
@@ -87,24 +129,15 @@ bool DmaPusher::Step() {
                 dma_state.non_incrementing = false;
                 dma_increment_once = true;
                 break;
+            default:
+                break;
             }
+            ++index;
         }
-    } else if (ib_enable && !dma_pushbuffer.empty()) {
-        // Current pushbuffer empty, but we have more IB entries to read
-        const CommandList& command_list{dma_pushbuffer.front()};
-        const CommandListHeader& command_list_header{command_list[dma_pushbuffer_subindex++]};
-        dma_get = command_list_header.addr;
-        dma_put = dma_get + command_list_header.size * sizeof(u32);
-        non_main = command_list_header.is_non_main;
-
-        if (dma_pushbuffer_subindex >= command_list.size()) {
-            // We've gone through the current list, remove it from the queue
-            dma_pushbuffer.pop();
-            dma_pushbuffer_subindex = 0;
-        }
-    } else {
-        // Otherwise, pushbuffer empty and IB empty or nonexistent - nothing to do
-        return {};
+    }
+
+    if (!non_main) {
+        dma_mget = dma_put;
     }
 
     return true;
@@ -120,4 +153,9 @@ void DmaPusher::CallMethod(u32 argument) const {
     gpu.CallMethod({dma_state.method, argument, dma_state.subchannel, dma_state.method_count});
 }
 
+void DmaPusher::CallMultiMethod(const u32* base_start, u32 num_methods) const {
+    gpu.CallMultiMethod(dma_state.method, dma_state.subchannel, base_start, num_methods,
+                        dma_state.method_count);
+}
+
 } // namespace Tegra
@@ -28,6 +28,14 @@ void Fermi2D::CallMethod(const GPU::MethodCall& method_call) {
     }
 }
 
+void Fermi2D::CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending) {
+    // The 2D engine has no bulk data registers, so a non-incrementing burst is just repeated
+    // writes to the same register; only the last value can matter for anything but the trigger.
+    for (u32 i = 0; i < amount; ++i) {
+        CallMethod({method, base_start[i], 0, methods_pending - i});
+    }
+}
+
 void Fermi2D::HandleSurfaceCopy() {
     LOG_WARNING(HW_GPU, "Requested a surface copy with operation {}",
                 static_cast<u32>(regs.operation));
@@ -35,10 +43,6 @@ void Fermi2D::HandleSurfaceCopy() {
     const GPUVAddr source = regs.src.Address();
     const GPUVAddr dest = regs.dst.Address();
 
-    // TODO(Subv): Only same-format and same-size copies are allowed for now.
-    ASSERT(regs.src.format == regs.dst.format);
-    ASSERT(regs.src.width * regs.src.height == regs.dst.width * regs.dst.height);
-
     // TODO(Subv): Only raw copies are implemented.
     ASSERT(regs.operation == Regs::Operation::SrcCopy);
 
@@ -49,8 +53,15 @@ void Fermi2D::HandleSurfaceCopy() {
     u32 dst_bytes_per_pixel = RenderTargetBytesPerPixel(regs.dst.format);
 
     if (!rasterizer.AccelerateSurfaceCopy(regs.src, regs.dst)) {
+        // TODO(Subv): Only same-format and same-size copies are allowed for now.
+        ASSERT(regs.src.format == regs.dst.format);
+        ASSERT(regs.src.width * regs.src.height == regs.dst.width * regs.dst.height);
+
         // All copies here update the main memory, so mark all rasterizer states as invalid.
-        Core::System::GetInstance().GPU().Maxwell3D().dirty_flags.OnMemoryWrite();
+        auto& maxwell3d = Core::System::GetInstance().GPU().Maxwell3D();
+        maxwell3d.dirty_flags.OnMemoryWrite();
+        maxwell3d.InvalidateTextureDescriptorsInRange(
+            dest, dst_bytes_per_pixel * regs.dst.width * regs.dst.height);
 
         rasterizer.FlushRegion(source_cpu, src_bytes_per_pixel * regs.src.width * regs.src.height);
         // We have to invalidate the destination region to evict any outdated surfaces from the
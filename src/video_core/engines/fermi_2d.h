@@ -29,6 +29,9 @@ public:
     /// Write the value to the register identified by method.
     void CallMethod(const GPU::MethodCall& method_call);
 
+    /// Write multiple values to the register identified by method.
+    void CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending);
+
     struct Regs {
         static constexpr std::size_t NUM_REGS = 0x258;
 
@@ -99,12 +102,14 @@ public:
                 // TODO(Subv): This is only a guess.
                 u32 trigger;
 
-                INSERT_PADDING_WORDS(0x1A3);
+                INSERT_PADDING_WORDS(0x1A2);
             };
             std::array<u32, NUM_REGS> reg_array;
         };
     } regs{};
 
+    static_assert(sizeof(Regs) == Regs::NUM_REGS * sizeof(u32), "Fermi2D Regs has wrong size");
+
     MemoryManager& memory_manager;
 
 private:
@@ -29,29 +29,45 @@ void KeplerMemory::CallMethod(const GPU::MethodCall& method_call) {
         break;
     }
     case KEPLERMEMORY_REG_INDEX(data): {
-        ProcessData(method_call.argument);
+        ProcessData(&method_call.argument, 1);
         break;
     }
     }
 }
 
-void KeplerMemory::ProcessData(u32 data) {
+void KeplerMemory::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
+                                   u32 methods_pending) {
+    if (method == KEPLERMEMORY_REG_INDEX(data)) {
+        ProcessData(base_start, amount);
+        return;
+    }
+    for (u32 i = 0; i < amount; ++i) {
+        CallMethod({method, base_start[i], 0, methods_pending - i});
+    }
+}
+
+void KeplerMemory::ProcessData(const u32* data, u32 amount) {
     ASSERT_MSG(regs.exec.linear, "Non-linear uploads are not supported");
     ASSERT(regs.dest.x == 0 && regs.dest.y == 0 && regs.dest.z == 0);
 
-    GPUVAddr address = regs.dest.Address();
-    VAddr dest_address =
+    const GPUVAddr address = regs.dest.Address();
+    const VAddr dest_address =
         *memory_manager.GpuToCpuAddress(address + state.write_offset * sizeof(u32));
+    const std::size_t size = amount * sizeof(u32);
 
     // We have to invalidate the destination region to evict any outdated surfaces from the cache.
     // We do this before actually writing the new data because the destination address might contain
-    // a dirty surface that will have to be written back to memory.
-    rasterizer.InvalidateRegion(dest_address, sizeof(u32));
+    // a dirty surface that will have to be written back to memory. Doing this once for the whole
+    // span keeps unrelated cache entries alive across inline-to-memory uploads.
+    rasterizer.InvalidateRegion(dest_address, size);
 
-    Memory::Write32(dest_address, data);
-    Core::System::GetInstance().GPU().Maxwell3D().dirty_flags.OnMemoryWrite();
+    Memory::WriteBlock(dest_address, data, size);
+    auto& maxwell3d = Core::System::GetInstance().GPU().Maxwell3D();
+    maxwell3d.dirty_flags.OnMemoryWrite();
+    maxwell3d.InvalidateTextureDescriptorsInRange(address + state.write_offset * sizeof(u32),
+                                                  size);
 
-    state.write_offset++;
+    state.write_offset += amount;
 }
 
 } // namespace Tegra::Engines
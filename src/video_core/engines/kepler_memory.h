@@ -29,6 +29,9 @@ public:
     /// Write the value to the register identified by method.
     void CallMethod(const GPU::MethodCall& method_call);
 
+    /// Write multiple values to the register identified by method.
+    void CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending);
+
     struct Regs {
         static constexpr size_t NUM_REGS = 0x7F;
 
@@ -71,6 +74,9 @@ public:
         };
     } regs{};
 
+    static_assert(sizeof(Regs) == Regs::NUM_REGS * sizeof(u32),
+                  "KeplerMemory Regs has wrong size");
+
     struct {
         u32 write_offset = 0;
     } state{};
@@ -79,7 +85,7 @@ private:
     MemoryManager& memory_manager;
     VideoCore::RasterizerInterface& rasterizer;
 
-    void ProcessData(u32 data);
+    void ProcessData(const u32* data, u32 amount);
 };
 
 #define ASSERT_REG_POSITION(field_name, position)                                                  \
@@ -5,6 +5,7 @@
 #include <cinttypes>
 #include <cstring>
 #include "common/assert.h"
+#include "common/microprofile.h"
 #include "core/core.h"
 #include "core/core_timing.h"
 #include "core/memory.h"
@@ -22,6 +23,7 @@ constexpr u32 MacroRegistersStart = 0xE00;
 Maxwell3D::Maxwell3D(VideoCore::RasterizerInterface& rasterizer, MemoryManager& memory_manager)
     : memory_manager(memory_manager), rasterizer{rasterizer}, macro_interpreter(*this) {
     InitializeRegisterDefaults();
+    InitializeDirtyRegisterGroups();
 }
 
 void Maxwell3D::InitializeRegisterDefaults() {
@@ -80,7 +82,7 @@ void Maxwell3D::InitializeRegisterDefaults() {
     }
 }
 
-void Maxwell3D::CallMacroMethod(u32 method, std::vector<u32> parameters) {
+void Maxwell3D::CallMacroMethod(u32 method, MacroParams parameters) {
     // Reset the current macro.
     executing_macro = 0;
 
@@ -97,7 +99,146 @@ void Maxwell3D::CallMacroMethod(u32 method, std::vector<u32> parameters) {
     macro_interpreter.Execute(search->second, std::move(parameters));
 }
 
+void Maxwell3D::InitializeDirtyRegisterGroups() {
+    const auto set_range = [this](std::size_t begin, std::size_t num_words, DirtyGroup group) {
+        const u32 mask{1u << static_cast<u32>(group)};
+        for (std::size_t reg = begin; reg < begin + num_words; ++reg) {
+            dirty_register_groups[reg] |= mask;
+        }
+    };
+    const auto set = [&set_range](std::size_t reg, DirtyGroup group) { set_range(reg, 1, group); };
+
+    set_range(MAXWELL3D_REG_INDEX(blend_color), sizeof(regs.blend_color) / sizeof(u32),
+              DirtyGroup::BlendState);
+    set_range(MAXWELL3D_REG_INDEX(blend), sizeof(regs.blend) / sizeof(u32),
+              DirtyGroup::BlendState);
+    set_range(MAXWELL3D_REG_INDEX(independent_blend), sizeof(regs.independent_blend) / sizeof(u32),
+              DirtyGroup::BlendState);
+    // The independent blend enable selects both the blend and the color mask layout
+    set(MAXWELL3D_REG_INDEX(independent_blend_enable), DirtyGroup::BlendState);
+    set(MAXWELL3D_REG_INDEX(independent_blend_enable), DirtyGroup::ColorMask);
+
+    set(MAXWELL3D_REG_INDEX(color_mask_common), DirtyGroup::ColorMask);
+    set_range(MAXWELL3D_REG_INDEX(color_mask), sizeof(regs.color_mask) / sizeof(u32),
+              DirtyGroup::ColorMask);
+
+    set_range(MAXWELL3D_REG_INDEX(cull), sizeof(regs.cull) / sizeof(u32), DirtyGroup::CullMode);
+    set(MAXWELL3D_REG_INDEX(screen_y_control), DirtyGroup::CullMode);
+    // The front face flip depends on the viewport transform as well
+    set_range(MAXWELL3D_REG_INDEX(viewport_transform), sizeof(regs.viewport_transform) / sizeof(u32),
+              DirtyGroup::CullMode);
+
+    set(MAXWELL3D_REG_INDEX(depth_test_enable), DirtyGroup::DepthTest);
+    set(MAXWELL3D_REG_INDEX(depth_write_enabled), DirtyGroup::DepthTest);
+    set(MAXWELL3D_REG_INDEX(depth_test_func), DirtyGroup::DepthTest);
+
+    set(MAXWELL3D_REG_INDEX(frag_color_clamp), DirtyGroup::FragmentColorClamp);
+
+    set_range(MAXWELL3D_REG_INDEX(logic_op), sizeof(regs.logic_op) / sizeof(u32),
+              DirtyGroup::LogicOp);
+
+    set_range(MAXWELL3D_REG_INDEX(multisample_control),
+              sizeof(regs.multisample_control) / sizeof(u32), DirtyGroup::MultisampleControl);
+
+    set(MAXWELL3D_REG_INDEX(point_size), DirtyGroup::PointSize);
+
+    set(MAXWELL3D_REG_INDEX(polygon_offset_point_enable), DirtyGroup::PolygonOffset);
+    set(MAXWELL3D_REG_INDEX(polygon_offset_line_enable), DirtyGroup::PolygonOffset);
+    set(MAXWELL3D_REG_INDEX(polygon_offset_fill_enable), DirtyGroup::PolygonOffset);
+    set(MAXWELL3D_REG_INDEX(polygon_offset_factor), DirtyGroup::PolygonOffset);
+    set(MAXWELL3D_REG_INDEX(polygon_offset_units), DirtyGroup::PolygonOffset);
+    set(MAXWELL3D_REG_INDEX(polygon_offset_clamp), DirtyGroup::PolygonOffset);
+
+    set_range(MAXWELL3D_REG_INDEX(primitive_restart), sizeof(regs.primitive_restart) / sizeof(u32),
+              DirtyGroup::PrimitiveRestart);
+
+    set_range(MAXWELL3D_REG_INDEX(rt), sizeof(regs.rt) / sizeof(u32), DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(rt_separate_frag_data), DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(rt_control), DirtyGroup::RenderTargets);
+    set_range(MAXWELL3D_REG_INDEX(zeta), sizeof(regs.zeta) / sizeof(u32),
+              DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(zeta_enable), DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(zeta_width), DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(zeta_height), DirtyGroup::RenderTargets);
+    set(MAXWELL3D_REG_INDEX(framebuffer_srgb), DirtyGroup::RenderTargets);
+
+    set(MAXWELL3D_REG_INDEX(stencil_enable), DirtyGroup::StencilTest);
+    set(MAXWELL3D_REG_INDEX(stencil_two_side_enable), DirtyGroup::StencilTest);
+    // stencil_front_op_fail through stencil_front_mask are contiguous
+    set_range(MAXWELL3D_REG_INDEX(stencil_front_op_fail), 7, DirtyGroup::StencilTest);
+    // stencil_back_op_fail through stencil_back_func_func are contiguous
+    set_range(MAXWELL3D_REG_INDEX(stencil_back_op_fail), 4, DirtyGroup::StencilTest);
+    // stencil_back_func_ref through stencil_back_func_mask are contiguous
+    set_range(MAXWELL3D_REG_INDEX(stencil_back_func_ref), 3, DirtyGroup::StencilTest);
+}
+
+/// Registers a title writes between the draws of a batch without breaking their shared state:
+/// the draw trigger itself and the vertex/index windows it consumes.
+static constexpr bool IsDrawParameterRegister(u32 method) {
+    switch (method) {
+    case MAXWELL3D_REG_INDEX(draw.vertex_begin_gl):
+    case MAXWELL3D_REG_INDEX(draw.vertex_end_gl):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.first):
+    case MAXWELL3D_REG_INDEX(vertex_buffer.count):
+    case MAXWELL3D_REG_INDEX(index_array.first):
+    case MAXWELL3D_REG_INDEX(index_array.count):
+    case MAXWELL3D_REG_INDEX(vb_element_base):
+        return true;
+    default:
+        return false;
+    }
+}
+
+constexpr std::array<Maxwell3D::MethodHandler, Maxwell3D::Regs::NUM_REGS>
+Maxwell3D::BuildMethodHandlerTable() {
+    std::array<MethodHandler, Regs::NUM_REGS> table{};
+
+    table[MAXWELL3D_REG_INDEX(macros.data)] = [](Maxwell3D& maxwell3d, u32 argument) {
+        maxwell3d.ProcessMacroUpload(argument);
+    };
+    table[MAXWELL3D_REG_INDEX(macros.bind)] = [](Maxwell3D& maxwell3d, u32 argument) {
+        maxwell3d.ProcessMacroBind(argument);
+    };
+    for (std::size_t i = 0; i < Regs::NumCBData; ++i) {
+        table[MAXWELL3D_REG_INDEX(const_buffer.cb_data[0]) + i] =
+            [](Maxwell3D& maxwell3d, u32 argument) { maxwell3d.ProcessCBData(argument); };
+    }
+    table[MAXWELL3D_REG_INDEX(cb_bind[0].raw_config)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessCBBind(Regs::ShaderStage::Vertex);
+    };
+    table[MAXWELL3D_REG_INDEX(cb_bind[1].raw_config)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessCBBind(Regs::ShaderStage::TesselationControl);
+    };
+    table[MAXWELL3D_REG_INDEX(cb_bind[2].raw_config)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessCBBind(Regs::ShaderStage::TesselationEval);
+    };
+    table[MAXWELL3D_REG_INDEX(cb_bind[3].raw_config)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessCBBind(Regs::ShaderStage::Geometry);
+    };
+    table[MAXWELL3D_REG_INDEX(cb_bind[4].raw_config)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessCBBind(Regs::ShaderStage::Fragment);
+    };
+    table[MAXWELL3D_REG_INDEX(draw.vertex_end_gl)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.DrawArrays();
+    };
+    table[MAXWELL3D_REG_INDEX(clear_buffers)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessClearBuffers();
+    };
+    table[MAXWELL3D_REG_INDEX(query.query_get)] = [](Maxwell3D& maxwell3d, u32) {
+        maxwell3d.ProcessQueryGet();
+    };
+
+    return table;
+}
+
+const std::array<Maxwell3D::MethodHandler, Maxwell3D::Regs::NUM_REGS>
+    Maxwell3D::method_handler_table = BuildMethodHandlerTable();
+
+MICROPROFILE_DEFINE(GPU_Maxwell3D, "GPU", "Maxwell3D Methods", MP_RGB(128, 128, 192));
+
 void Maxwell3D::CallMethod(const GPU::MethodCall& method_call) {
+    MICROPROFILE_SCOPE(GPU_Maxwell3D);
+
     auto debug_context = Core::System::GetInstance().GetGPUDebugContext();
 
     // It is an error to write to a register other than the current macro's ARG register before it
@@ -122,6 +263,9 @@ void Maxwell3D::CallMethod(const GPU::MethodCall& method_call) {
         // Call the macro when there are no more parameters in the command buffer
         if (method_call.IsLastCall()) {
             CallMacroMethod(executing_macro, std::move(macro_params));
+            // Return the moved-from buffer to its empty inline state so the next macro call
+            // starts without touching the heap.
+            macro_params.clear();
         }
         return;
     }
@@ -135,6 +279,14 @@ void Maxwell3D::CallMethod(const GPU::MethodCall& method_call) {
 
     if (regs.reg_array[method_call.method] != method_call.argument) {
         regs.reg_array[method_call.method] = method_call.argument;
+
+        // Mark the state groups this register belongs to as dirty
+        dirty_flags.state_groups |= dirty_register_groups[method_call.method];
+
+        if (!IsDrawParameterRegister(method_call.method)) {
+            dirty_flags.non_draw_writes = true;
+        }
+
         // Vertex format
         if (method_call.method >= MAXWELL3D_REG_INDEX(vertex_attrib_format) &&
             method_call.method <
@@ -158,68 +310,10 @@ void Maxwell3D::CallMethod(const GPU::MethodCall& method_call) {
         }
     }
 
-    switch (method_call.method) {
-    case MAXWELL3D_REG_INDEX(macros.data): {
-        ProcessMacroUpload(method_call.argument);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(macros.bind): {
-        ProcessMacroBind(method_call.argument);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[0]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[1]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[2]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[3]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[4]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[5]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[6]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[7]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[8]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[9]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[10]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[11]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[12]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[13]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[14]):
-    case MAXWELL3D_REG_INDEX(const_buffer.cb_data[15]): {
-        ProcessCBData(method_call.argument);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(cb_bind[0].raw_config): {
-        ProcessCBBind(Regs::ShaderStage::Vertex);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(cb_bind[1].raw_config): {
-        ProcessCBBind(Regs::ShaderStage::TesselationControl);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(cb_bind[2].raw_config): {
-        ProcessCBBind(Regs::ShaderStage::TesselationEval);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(cb_bind[3].raw_config): {
-        ProcessCBBind(Regs::ShaderStage::Geometry);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(cb_bind[4].raw_config): {
-        ProcessCBBind(Regs::ShaderStage::Fragment);
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(draw.vertex_end_gl): {
-        DrawArrays();
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(clear_buffers): {
-        ProcessClearBuffers();
-        break;
-    }
-    case MAXWELL3D_REG_INDEX(query.query_get): {
-        ProcessQueryGet();
-        break;
-    }
-    default:
-        break;
+    // Registers with side effects beyond the register write itself are dispatched through the
+    // handler table; the common case of a plain state register takes the null fast path.
+    if (const MethodHandler handler = method_handler_table[method_call.method]) {
+        handler(*this, method_call.argument);
     }
 
     if (debug_context) {
@@ -231,6 +325,9 @@ void Maxwell3D::ProcessMacroUpload(u32 data) {
     ASSERT_MSG(regs.macros.upload_address < macro_memory.size(),
                "upload_address exceeded macro_memory size!");
     macro_memory[regs.macros.upload_address++] = data;
+
+    // Any compiled macro may now be stale
+    macro_interpreter.ClearCache();
 }
 
 void Maxwell3D::ProcessMacroBind(u32 data) {
@@ -271,23 +368,29 @@ void Maxwell3D::ProcessQueryGet() {
     switch (regs.query.query_get.mode) {
     case Regs::QueryMode::Write:
     case Regs::QueryMode::Write2: {
+        // The writes are deferred until the commands issued so far have actually completed on
+        // the host GPU, like they would on hardware, instead of landing synchronously as if the
+        // GPU were infinitely fast. The rasterizer runs them immediately when the backend can't
+        // track completion or accurate emulation is requested.
         u32 sequence = regs.query.query_sequence;
         if (regs.query.query_get.short_query) {
             // Write the current query sequence to the sequence address.
             // TODO(Subv): Find out what happens if you use a long query type but mark it as a short
             // query.
-            Memory::Write32(*address, sequence);
+            rasterizer.DeferMemoryWrite(
+                [address = *address, sequence] { Memory::Write32(address, sequence); });
         } else {
-            // Write the 128-bit result structure in long mode. Note: We emulate an infinitely fast
-            // GPU, this command may actually take a while to complete in real hardware due to GPU
-            // wait queues.
+            // Write the 128-bit result structure in long mode.
             LongQueryResult query_result{};
             query_result.value = result;
             // TODO(Subv): Generate a real GPU timestamp and write it here instead of CoreTiming
             query_result.timestamp = CoreTiming::GetTicks();
-            Memory::WriteBlock(*address, &query_result, sizeof(query_result));
+            rasterizer.DeferMemoryWrite([address = *address, query_result] {
+                Memory::WriteBlock(address, &query_result, sizeof(query_result));
+            });
         }
         dirty_flags.OnMemoryWrite();
+        InvalidateTextureDescriptorsInRange(sequence_address, sizeof(LongQueryResult));
         break;
     }
     default:
@@ -335,6 +438,9 @@ void Maxwell3D::DrawArrays() {
     } else {
         regs.vertex_buffer.count = 0;
     }
+
+    // Until something other than the draw parameters changes, further draws are mergeable
+    dirty_flags.non_draw_writes = false;
 }
 
 void Maxwell3D::ProcessCBBind(Regs::ShaderStage stage) {
@@ -352,6 +458,41 @@ void Maxwell3D::ProcessCBBind(Regs::ShaderStage stage) {
     buffer.size = regs.const_buffer.cb_size;
 }
 
+void Maxwell3D::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
+                                u32 methods_pending) {
+    // Writes to the const buffer data registers are the only bulk writes with a dedicated fast
+    // path; everything else (including macro arguments) keeps the per-method handling.
+    if (method >= MAXWELL3D_REG_INDEX(const_buffer.cb_data[0]) &&
+        method <= MAXWELL3D_REG_INDEX(const_buffer.cb_data[15])) {
+        ProcessCBMultiData(base_start, amount);
+        return;
+    }
+
+    for (u32 i = 0; i < amount; ++i) {
+        CallMethod({method, base_start[i], 0, methods_pending - i});
+    }
+}
+
+void Maxwell3D::ProcessCBMultiData(const u32* start_base, u32 amount) {
+    // Write the input values to the current const buffer at the current position.
+    const GPUVAddr buffer_address = regs.const_buffer.BufferAddress();
+    ASSERT(buffer_address != 0);
+
+    // Don't allow writing past the end of the buffer.
+    ASSERT(regs.const_buffer.cb_pos + amount * sizeof(u32) <= regs.const_buffer.cb_size);
+
+    const std::optional<VAddr> address =
+        memory_manager.GpuToCpuAddress(buffer_address + regs.const_buffer.cb_pos);
+
+    Memory::WriteBlock(*address, start_base, amount * sizeof(u32));
+    dirty_flags.OnMemoryWrite();
+    InvalidateTextureDescriptorsInRange(buffer_address + regs.const_buffer.cb_pos,
+                                        amount * sizeof(u32));
+
+    // Increment the current buffer position.
+    regs.const_buffer.cb_pos = regs.const_buffer.cb_pos + amount * sizeof(u32);
+}
+
 void Maxwell3D::ProcessCBData(u32 value) {
     // Write the input value to the current const buffer at the current position.
     GPUVAddr buffer_address = regs.const_buffer.BufferAddress();
@@ -365,12 +506,43 @@ void Maxwell3D::ProcessCBData(u32 value) {
 
     Memory::Write32(*address, value);
     dirty_flags.OnMemoryWrite();
+    InvalidateTextureDescriptorsInRange(buffer_address + regs.const_buffer.cb_pos, sizeof(u32));
 
     // Increment the current buffer position.
     regs.const_buffer.cb_pos = regs.const_buffer.cb_pos + 4;
 }
 
+void Maxwell3D::InvalidateTextureDescriptorsInRange(GPUVAddr addr, u64 size) {
+    const GPUVAddr tic_start = regs.tic.TICAddress();
+    const GPUVAddr tic_end = tic_start + (regs.tic.tic_limit + 1) * sizeof(Texture::TICEntry);
+    const GPUVAddr tsc_start = regs.tsc.TSCAddress();
+    const GPUVAddr tsc_end = tsc_start + (regs.tsc.tsc_limit + 1) * sizeof(Texture::TSCEntry);
+
+    if ((addr < tic_end && addr + size > tic_start) ||
+        (addr < tsc_end && addr + size > tsc_start)) {
+        InvalidateTextureDescriptors();
+    }
+}
+
+void Maxwell3D::ValidateTextureDescriptorShadow() const {
+    if (shadow_descriptor_generation == texture_descriptor_generation &&
+        shadow_tic_address == regs.tic.TICAddress() &&
+        shadow_tsc_address == regs.tsc.TSCAddress()) {
+        return;
+    }
+    tic_entry_shadow.clear();
+    tsc_entry_shadow.clear();
+    shadow_descriptor_generation = texture_descriptor_generation;
+    shadow_tic_address = regs.tic.TICAddress();
+    shadow_tsc_address = regs.tsc.TSCAddress();
+}
+
 Texture::TICEntry Maxwell3D::GetTICEntry(u32 tic_index) const {
+    ValidateTextureDescriptorShadow();
+    if (const auto itr = tic_entry_shadow.find(tic_index); itr != tic_entry_shadow.end()) {
+        return itr->second;
+    }
+
     GPUVAddr tic_base_address = regs.tic.TICAddress();
 
     GPUVAddr tic_address_gpu = tic_base_address + tic_index * sizeof(Texture::TICEntry);
@@ -391,10 +563,16 @@ Texture::TICEntry Maxwell3D::GetTICEntry(u32 tic_index) const {
     // TODO(Subv): Different data types for separate components are not supported
     ASSERT(r_type == g_type && r_type == b_type && r_type == a_type);
 
+    tic_entry_shadow.emplace(tic_index, tic_entry);
     return tic_entry;
 }
 
 Texture::TSCEntry Maxwell3D::GetTSCEntry(u32 tsc_index) const {
+    ValidateTextureDescriptorShadow();
+    if (const auto itr = tsc_entry_shadow.find(tsc_index); itr != tsc_entry_shadow.end()) {
+        return itr->second;
+    }
+
     GPUVAddr tsc_base_address = regs.tsc.TSCAddress();
 
     GPUVAddr tsc_address_gpu = tsc_base_address + tsc_index * sizeof(Texture::TSCEntry);
@@ -402,11 +580,14 @@ Texture::TSCEntry Maxwell3D::GetTSCEntry(u32 tsc_index) const {
 
     Texture::TSCEntry tsc_entry;
     Memory::ReadBlock(*tsc_address_cpu, &tsc_entry, sizeof(Texture::TSCEntry));
+
+    tsc_entry_shadow.emplace(tsc_index, tsc_entry);
     return tsc_entry;
 }
 
-std::vector<Texture::FullTextureInfo> Maxwell3D::GetStageTextures(Regs::ShaderStage stage) const {
-    std::vector<Texture::FullTextureInfo> textures;
+Common::SmallVector<Texture::FullTextureInfo, 8> Maxwell3D::GetStageTextures(
+    Regs::ShaderStage stage) const {
+    Common::SmallVector<Texture::FullTextureInfo, 8> textures;
 
     auto& fragment_shader = state.shader_stages[static_cast<std::size_t>(stage)];
     auto& tex_info_buffer = fragment_shader.const_buffers[regs.tex_cb_index];
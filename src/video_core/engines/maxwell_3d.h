@@ -12,6 +12,7 @@
 #include "common/common_funcs.h"
 #include "common/common_types.h"
 #include "common/math_util.h"
+#include "common/small_vector.h"
 #include "video_core/gpu.h"
 #include "video_core/macro_interpreter.h"
 #include "video_core/memory_manager.h"
@@ -1086,25 +1087,74 @@ public:
     State state{};
     MemoryManager& memory_manager;
 
+    /// Pipeline state groups tracked with a dirty bit each, so the rasterizer can skip
+    /// re-deriving GL state for groups whose registers did not change since the last draw.
+    enum class DirtyGroup : u32 {
+        BlendState = 0,
+        ColorMask,
+        CullMode,
+        DepthTest,
+        FragmentColorClamp,
+        LogicOp,
+        MultisampleControl,
+        PointSize,
+        PolygonOffset,
+        PrimitiveRestart,
+        RenderTargets,
+        StencilTest,
+    };
+
     struct DirtyFlags {
         bool vertex_attrib_format = true;
         u32 vertex_array = 0xFFFFFFFF;
 
+        /// Bitset of DirtyGroup entries whose registers changed since the last sync
+        u32 state_groups = 0xFFFFFFFF;
+
+        /// Set when a register outside the draw-parameter window, or guest memory, changed since
+        /// the last draw. While clear, consecutive draws share their entire pipeline state and
+        /// only the vertex/index windows moved, so the rasterizer may merge them.
+        bool non_draw_writes = true;
+
+        bool IsStateGroupDirty(DirtyGroup group) const {
+            return (state_groups & (1u << static_cast<u32>(group))) != 0;
+        }
+
+        void MarkStateGroupClean(DirtyGroup group) {
+            state_groups &= ~(1u << static_cast<u32>(group));
+        }
+
         void OnMemoryWrite() {
             vertex_array = 0xFFFFFFFF;
+            non_draw_writes = true;
         }
     };
 
     DirtyFlags dirty_flags;
 
+    /// Invalidates the host shadow of the TIC/TSC descriptor tables. Called when arbitrary
+    /// guest memory may have been written, e.g. on re-entering GPU code from the CPU.
+    void InvalidateTextureDescriptors() {
+        ++texture_descriptor_generation;
+    }
+
+    /// Invalidates the descriptor shadow only when the given GPU memory write overlaps the
+    /// TIC/TSC tables. Engines writing guest memory at a known address call this alongside
+    /// dirty_flags.OnMemoryWrite().
+    void InvalidateTextureDescriptorsInRange(GPUVAddr addr, u64 size);
+
     /// Reads a register value located at the input method address
     u32 GetRegisterValue(u32 method) const;
 
     /// Write the value to the register identified by method.
     void CallMethod(const GPU::MethodCall& method_call);
 
+    /// Writes a span of arguments targeting the same register in bulk.
+    void CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending);
+
     /// Returns a list of enabled textures for the specified shader stage.
-    std::vector<Texture::FullTextureInfo> GetStageTextures(Regs::ShaderStage stage) const;
+    Common::SmallVector<Texture::FullTextureInfo, 8> GetStageTextures(
+        Regs::ShaderStage stage) const;
 
     /// Returns the texture information for a specific texture in a specific shader stage.
     Texture::FullTextureInfo GetStageTexture(Regs::ShaderStage stage, std::size_t offset) const;
@@ -1121,8 +1171,24 @@ public:
 private:
     void InitializeRegisterDefaults();
 
+    /// Fills the table mapping each register to the dirty state groups it belongs to.
+    void InitializeDirtyRegisterGroups();
+
+    /// Handler for a method write with side effects beyond the register update itself.
+    using MethodHandler = void (*)(Maxwell3D&, u32 argument);
+
+    /// Builds the per-register method handler table from the register layout. Registers without
+    /// side effects get a null handler and only need the plain register write.
+    static constexpr std::array<MethodHandler, Regs::NUM_REGS> BuildMethodHandlerTable();
+
+    /// Method handler table indexed by register, evaluated at compile time.
+    static const std::array<MethodHandler, Regs::NUM_REGS> method_handler_table;
+
     VideoCore::RasterizerInterface& rasterizer;
 
+    /// Per-register bitset of the DirtyGroup entries affected by a write to that register
+    std::array<u32, Regs::NUM_REGS> dirty_register_groups{};
+
     /// Start offsets of each macro in macro_memory
     std::unordered_map<u32, u32> macro_offsets;
 
@@ -1132,7 +1198,7 @@ private:
     /// Macro method that is currently being executed / being fed parameters.
     u32 executing_macro = 0;
     /// Parameters that have been submitted to the macro call so far.
-    std::vector<u32> macro_params;
+    MacroParams macro_params;
 
     /// Interpreter for the macro codes uploaded to the GPU.
     MacroInterpreter macro_interpreter;
@@ -1143,12 +1209,29 @@ private:
     /// Retrieves information about a specific TSC entry from the TSC buffer.
     Texture::TSCEntry GetTSCEntry(u32 tsc_index) const;
 
+    /// Clears the descriptor shadow when it is stale: either the tables were moved through the
+    /// tic/tsc registers or a memory write bumped the descriptor generation.
+    void ValidateTextureDescriptorShadow() const;
+
+    /// Host-side shadow of the TIC/TSC descriptor tables. Descriptors are fetched for every
+    /// texture of every stage of every draw, so unchanged entries are served from here instead
+    /// of being re-read from guest memory.
+    mutable std::unordered_map<u32, Texture::TICEntry> tic_entry_shadow;
+    mutable std::unordered_map<u32, Texture::TSCEntry> tsc_entry_shadow;
+    /// Generation the shadow was last validated against, plus the table addresses it was built
+    /// for. Mutable because the shadow is maintained inside the const descriptor getters.
+    mutable u64 shadow_descriptor_generation = 0;
+    mutable GPUVAddr shadow_tic_address = 0;
+    mutable GPUVAddr shadow_tsc_address = 0;
+    /// Bumped whenever guest memory that may hold descriptors has been written
+    u64 texture_descriptor_generation = 0;
+
     /**
      * Call a macro on this engine.
      * @param method Method to call
      * @param parameters Arguments to the method call
      */
-    void CallMacroMethod(u32 method, std::vector<u32> parameters);
+    void CallMacroMethod(u32 method, MacroParams parameters);
 
     /// Handles writes to the macro uploading register.
     void ProcessMacroUpload(u32 data);
@@ -1165,6 +1248,9 @@ private:
     /// Handles a write to the CB_DATA[i] register.
     void ProcessCBData(u32 value);
 
+    /// Handles a write of multiple words to the const buffer data registers.
+    void ProcessCBMultiData(const u32* start_base, u32 amount);
+
     /// Handles a write to the CB_BIND register.
     void ProcessCBBind(Regs::ShaderStage stage);
 
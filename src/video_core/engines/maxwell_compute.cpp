@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include "common/logging/log.h"
+#include "common/perf_counters.h"
 #include "core/core.h"
 #include "video_core/engines/maxwell_compute.h"
 
@@ -16,8 +17,14 @@ void MaxwellCompute::CallMethod(const GPU::MethodCall& method_call) {
 
     switch (method_call.method) {
     case MAXWELL_COMPUTE_REG_INDEX(compute): {
-        LOG_CRITICAL(HW_GPU, "Compute shaders are not implemented");
-        UNREACHABLE();
+        // Executing the kernel on the GPU requires a compute stage in the shader decompiler and
+        // storage buffer support in the renderer, neither of which exists yet. Skipping the
+        // dispatch keeps titles that use compute pre-passes running (with the affected effects
+        // broken) instead of aborting emulation; the counter makes skipped work visible when
+        // triaging such titles.
+        static auto& skipped_counter = Common::GetPerfCounter("gpu_compute_dispatches_skipped");
+        skipped_counter.Add();
+        LOG_ERROR(HW_GPU, "Compute dispatch skipped, compute shaders are not implemented");
         break;
     }
     default:
@@ -33,6 +33,15 @@ void MaxwellDMA::CallMethod(const GPU::MethodCall& method_call) {
 #undef MAXWELLDMA_REG_INDEX
 }
 
+void MaxwellDMA::CallMultiMethod(u32 method, const u32* base_start, u32 amount,
+                                 u32 methods_pending) {
+    // The DMA engine has no bulk data registers; a burst to one register only triggers work
+    // through the exec register, so every value still has to be processed in order.
+    for (u32 i = 0; i < amount; ++i) {
+        CallMethod({method, base_start[i], 0, methods_pending - i});
+    }
+}
+
 void MaxwellDMA::HandleCopy() {
     LOG_WARNING(HW_GPU, "Requested a DMA copy");
 
@@ -57,7 +66,11 @@ void MaxwellDMA::HandleCopy() {
     }
 
     // All copies here update the main memory, so mark all rasterizer states as invalid.
-    Core::System::GetInstance().GPU().Maxwell3D().dirty_flags.OnMemoryWrite();
+    auto& maxwell3d = Core::System::GetInstance().GPU().Maxwell3D();
+    maxwell3d.dirty_flags.OnMemoryWrite();
+    // The exact written span depends on the copy mode below; drop the whole descriptor shadow
+    // rather than reasoning about it, DMA copies are rare.
+    maxwell3d.InvalidateTextureDescriptors();
 
     if (regs.exec.is_dst_linear && regs.exec.is_src_linear) {
         // When the enable_2d bit is disabled, the copy is performed as if we were copying a 1D
@@ -70,8 +83,10 @@ void MaxwellDMA::HandleCopy() {
 
         // If both the source and the destination are in linear layout, perform a line-by-line
         // copy. We're going to take a subrect of size (x_count, y_count) from the source
-        // rectangle. There is no need to manually flush/invalidate the regions because
-        // CopyBlock does that for us.
+        // rectangle. Flush the source and invalidate the destination as single spans up front so
+        // the per-line copies don't each walk the rasterizer caches.
+        rasterizer.FlushRegion(source_cpu, (regs.y_count - 1) * regs.src_pitch + regs.x_count);
+        rasterizer.InvalidateRegion(dest_cpu, (regs.y_count - 1) * regs.dst_pitch + regs.x_count);
         for (u32 line = 0; line < regs.y_count; ++line) {
             const VAddr source_line = source_cpu + line * regs.src_pitch;
             const VAddr dest_line = dest_cpu + line * regs.dst_pitch;
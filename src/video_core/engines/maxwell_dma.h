@@ -26,6 +26,9 @@ public:
     /// Write the value to the register identified by method.
     void CallMethod(const GPU::MethodCall& method_call);
 
+    /// Write multiple values to the register identified by method.
+    void CallMultiMethod(u32 method, const u32* base_start, u32 amount, u32 methods_pending);
+
     struct Regs {
         static constexpr std::size_t NUM_REGS = 0x1D6;
 
@@ -128,12 +131,14 @@ public:
 
                 Parameters src_params;
 
-                INSERT_PADDING_WORDS(0x13);
+                INSERT_PADDING_WORDS(0x6);
             };
             std::array<u32, NUM_REGS> reg_array;
         };
     } regs{};
 
+    static_assert(sizeof(Regs) == Regs::NUM_REGS * sizeof(u32), "MaxwellDMA Regs has wrong size");
+
     MemoryManager& memory_manager;
 
 private:
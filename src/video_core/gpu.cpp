@@ -3,13 +3,19 @@
 // Refer to the license.txt file included.
 
 #include "common/assert.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
+#include "core/settings.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/engines/kepler_memory.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/engines/maxwell_compute.h"
 #include "video_core/engines/maxwell_dma.h"
 #include "video_core/gpu.h"
+#include "video_core/gpu_thread.h"
 #include "video_core/rasterizer_interface.h"
+#include "video_core/renderer_base.h"
+#include "video_core/tracer/gpu_tracer.h"
 
 namespace Tegra {
 
@@ -24,7 +30,8 @@ u32 FramebufferConfig::BytesPerPixel(PixelFormat format) {
     UNREACHABLE();
 }
 
-GPU::GPU(VideoCore::RasterizerInterface& rasterizer) {
+GPU::GPU(VideoCore::RendererBase& renderer) : renderer{renderer} {
+    auto& rasterizer{renderer.Rasterizer()};
     memory_manager = std::make_unique<Tegra::MemoryManager>();
     dma_pusher = std::make_unique<Tegra::DmaPusher>(*this);
     maxwell_3d = std::make_unique<Engines::Maxwell3D>(rasterizer, *memory_manager);
@@ -32,10 +39,63 @@ GPU::GPU(VideoCore::RasterizerInterface& rasterizer) {
     maxwell_compute = std::make_unique<Engines::MaxwellCompute>();
     maxwell_dma = std::make_unique<Engines::MaxwellDMA>(rasterizer, *memory_manager);
     kepler_memory = std::make_unique<Engines::KeplerMemory>(rasterizer, *memory_manager);
+
+    if (Settings::values.use_asynchronous_gpu_emulation) {
+        gpu_thread = std::make_unique<VideoCore::GPUThread::ThreadManager>(renderer, *dma_pusher);
+    }
 }
 
 GPU::~GPU() = default;
 
+void GPU::PushGPUEntries(Tegra::CommandList&& entries) {
+    if (entries.empty()) {
+        return;
+    }
+
+    if (gpu_thread) {
+        gpu_thread->SubmitList(std::move(entries));
+        return;
+    }
+    auto& perf_stats = Core::System::GetInstance().GetPerfStats();
+    perf_stats.BeginPhase(Core::PerfStats::Phase::GpuDispatch);
+    dma_pusher->Push(std::move(entries));
+    dma_pusher->DispatchCalls();
+    perf_stats.EndPhase(Core::PerfStats::Phase::GpuDispatch);
+}
+
+void GPU::SwapBuffers(
+    std::optional<std::reference_wrapper<const Tegra::FramebufferConfig>> framebuffer) {
+    if (gpu_thread) {
+        gpu_thread->SwapBuffers(framebuffer);
+        return;
+    }
+    renderer.SwapBuffers(framebuffer);
+}
+
+void GPU::FlushRegion(VAddr addr, u64 size) {
+    if (gpu_thread) {
+        gpu_thread->FlushRegion(addr, size);
+        return;
+    }
+    renderer.Rasterizer().FlushRegion(addr, size);
+}
+
+void GPU::InvalidateRegion(VAddr addr, u64 size) {
+    if (gpu_thread) {
+        gpu_thread->InvalidateRegion(addr, size);
+        return;
+    }
+    renderer.Rasterizer().InvalidateRegion(addr, size);
+}
+
+void GPU::FlushAndInvalidateRegion(VAddr addr, u64 size) {
+    if (gpu_thread) {
+        gpu_thread->FlushAndInvalidateRegion(addr, size);
+        return;
+    }
+    renderer.Rasterizer().FlushAndInvalidateRegion(addr, size);
+}
+
 Engines::Maxwell3D& GPU::Maxwell3D() {
     return *maxwell_3d;
 }
@@ -60,6 +120,18 @@ const DmaPusher& GPU::DmaPusher() const {
     return *dma_pusher;
 }
 
+void GPU::StartTraceRecording(const std::string& path) {
+    auto recorder = std::make_unique<Tracer::Recorder>(path);
+    if (!recorder->IsGood()) {
+        return;
+    }
+    trace_recorder = std::move(recorder);
+}
+
+void GPU::StopTraceRecording() {
+    trace_recorder.reset();
+}
+
 u32 RenderTargetBytesPerPixel(RenderTargetFormat format) {
     ASSERT(format != RenderTargetFormat::NONE);
 
@@ -133,6 +205,10 @@ void GPU::CallMethod(const MethodCall& method_call) {
 
     ASSERT(method_call.subchannel < bound_engines.size());
 
+    if (trace_recorder) {
+        trace_recorder->RecordMethodCall(method_call);
+    }
+
     if (method_call.method == static_cast<u32>(BufferMethods::BindObject)) {
         // Bind the current subchannel to the desired engine id.
         LOG_DEBUG(HW_GPU, "Binding subchannel {} to engine {}", method_call.subchannel,
@@ -170,4 +246,39 @@ void GPU::CallMethod(const MethodCall& method_call) {
     }
 }
 
+void GPU::CallMultiMethod(u32 method, u32 subchannel, const u32* base_start, u32 amount,
+                          u32 methods_pending) {
+    LOG_TRACE(HW_GPU, "Processing method {:08X} on subchannel {} with {} arguments", method,
+              subchannel, amount);
+
+    ASSERT(subchannel < bound_engines.size());
+
+    // Only engines with bulk data methods benefit from multi-method processing; the rest (and
+    // the special buffer methods) fall back to per-method calls. While recording a trace the
+    // fast path is skipped as well, so every method goes through the single recording point in
+    // CallMethod.
+    if (!trace_recorder && method >= static_cast<u32>(BufferMethods::CountBufferMethods)) {
+        switch (bound_engines[subchannel]) {
+        case EngineID::FERMI_TWOD_A:
+            fermi_2d->CallMultiMethod(method, base_start, amount, methods_pending);
+            return;
+        case EngineID::MAXWELL_B:
+            maxwell_3d->CallMultiMethod(method, base_start, amount, methods_pending);
+            return;
+        case EngineID::MAXWELL_DMA_COPY_A:
+            maxwell_dma->CallMultiMethod(method, base_start, amount, methods_pending);
+            return;
+        case EngineID::KEPLER_INLINE_TO_MEMORY_B:
+            kepler_memory->CallMultiMethod(method, base_start, amount, methods_pending);
+            return;
+        default:
+            break;
+        }
+    }
+
+    for (u32 i = 0; i < amount; ++i) {
+        CallMethod({method, base_start[i], subchannel, methods_pending - i});
+    }
+}
+
 } // namespace Tegra
@@ -5,7 +5,10 @@
 #pragma once
 
 #include <array>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <string>
 #include <vector>
 #include "common/common_types.h"
 #include "core/hle/service/nvflinger/buffer_queue.h"
@@ -13,11 +16,19 @@
 #include "video_core/memory_manager.h"
 
 namespace VideoCore {
-class RasterizerInterface;
+class RendererBase;
+
+namespace GPUThread {
+class ThreadManager;
 }
+} // namespace VideoCore
 
 namespace Tegra {
 
+namespace Tracer {
+class Recorder;
+}
+
 enum class RenderTargetFormat : u32 {
     NONE = 0x0,
     RGBA32_FLOAT = 0xC0,
@@ -117,7 +128,7 @@ enum class EngineID {
 
 class GPU final {
 public:
-    explicit GPU(VideoCore::RasterizerInterface& rasterizer);
+    explicit GPU(VideoCore::RendererBase& renderer);
     ~GPU();
 
     struct MethodCall {
@@ -138,6 +149,27 @@ public:
     /// Calls a GPU method.
     void CallMethod(const MethodCall& method_call);
 
+    /// Calls a GPU method with a span of arguments targeting the same method.
+    void CallMultiMethod(u32 method, u32 subchannel, const u32* base_start, u32 amount,
+                         u32 methods_pending);
+
+    /// Pushes command list entries to the GPU for processing. In asynchronous mode this only
+    /// queues the work for the GPU thread and returns immediately.
+    void PushGPUEntries(Tegra::CommandList&& entries);
+
+    /// Swap buffers (render frame)
+    void SwapBuffers(
+        std::optional<std::reference_wrapper<const Tegra::FramebufferConfig>> framebuffer);
+
+    /// Notify rasterizer that any caches of the specified region should be flushed to Switch memory
+    void FlushRegion(VAddr addr, u64 size);
+
+    /// Notify rasterizer that any caches of the specified region should be invalidated
+    void InvalidateRegion(VAddr addr, u64 size);
+
+    /// Notify rasterizer that any caches of the specified region should be flushed and invalidated
+    void FlushAndInvalidateRegion(VAddr addr, u64 size);
+
     /// Returns a reference to the Maxwell3D GPU engine.
     Engines::Maxwell3D& Maxwell3D();
 
@@ -156,10 +188,29 @@ public:
     /// Returns a const reference to the GPU DMA pusher.
     const Tegra::DmaPusher& DmaPusher() const;
 
+    /// Starts recording the GPU command stream and referenced memory to a trace file.
+    void StartTraceRecording(const std::string& path);
+
+    /// Finishes and closes the active trace recording, if any.
+    void StopTraceRecording();
+
+    /// Returns the active trace recorder, or nullptr when not recording.
+    Tracer::Recorder* TraceRecorder() {
+        return trace_recorder.get();
+    }
+
 private:
+    VideoCore::RendererBase& renderer;
+
     std::unique_ptr<Tegra::DmaPusher> dma_pusher;
     std::unique_ptr<Tegra::MemoryManager> memory_manager;
 
+    /// Active trace recorder, only created while recording
+    std::unique_ptr<Tracer::Recorder> trace_recorder;
+
+    /// Dedicated GPU thread, only created when asynchronous GPU emulation is enabled
+    std::unique_ptr<VideoCore::GPUThread::ThreadManager> gpu_thread;
+
     /// Mapping of command subchannels to their bound engine ids.
     std::array<EngineID, 8> bound_engines = {};
 
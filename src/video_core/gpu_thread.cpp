@@ -0,0 +1,127 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "common/microprofile.h"
+#include "common/perf_counters.h"
+#include "core/core.h"
+#include "core/core_timing.h"
+#include "core/frontend/emu_window.h"
+#include "core/host_scheduling.h"
+#include "core/perf_stats.h"
+#include "video_core/dma_pusher.h"
+#include "video_core/gpu_thread.h"
+#include "video_core/renderer_base.h"
+
+namespace VideoCore::GPUThread {
+
+ThreadManager::ThreadManager(RendererBase& renderer, Tegra::DmaPusher& dma_pusher)
+    : renderer{renderer}, dma_pusher{dma_pusher}, thread{&ThreadManager::RunThread, this} {}
+
+ThreadManager::~ThreadManager() {
+    // Notify GPU thread that a shutdown is pending
+    PushCommand(EndProcessingCommand{});
+    thread.join();
+}
+
+void ThreadManager::SubmitList(Tegra::CommandList&& entries) {
+    if (entries.empty()) {
+        return;
+    }
+    PushCommand(SubmitListCommand(std::move(entries)));
+}
+
+void ThreadManager::SwapBuffers(
+    std::optional<std::reference_wrapper<const Tegra::FramebufferConfig>> framebuffer) {
+    // Mailbox-style present: guest frame production never waits for the host to finish
+    // presenting. If the previous present is still in flight (host vsync or a compositor
+    // stall), this frame is dropped and the next swap carries newer content instead.
+    if (state.signaled_fence.load() < last_swap_fence) {
+        static auto& dropped_counter = Common::GetPerfCounter("gpu_frames_dropped");
+        dropped_counter.Add();
+    } else {
+        std::optional<Tegra::FramebufferConfig> framebuffer_copy;
+        if (framebuffer) {
+            framebuffer_copy = framebuffer->get();
+        }
+        last_swap_fence = PushCommand(SwapBuffersCommand(std::move(framebuffer_copy)));
+    }
+
+    // Frame pacing has to throttle the producer, so with the swap no longer blocking it runs
+    // here on the emulation thread; the renderer skips it in asynchronous mode (see
+    // RendererOpenGL::SwapBuffers).
+    auto& system = Core::System::GetInstance();
+    system.GetPerfStats().EndSystemFrame();
+    system.FrameLimiter().DoFrameLimiting(CoreTiming::GetGlobalTimeUs());
+    system.GetPerfStats().BeginSystemFrame();
+}
+
+void ThreadManager::FlushRegion(VAddr addr, u64 size) {
+    // The CPU is about to read back memory, so the flush must complete before returning
+    state.WaitForFence(PushCommand(FlushRegionCommand(addr, size)));
+}
+
+void ThreadManager::InvalidateRegion(VAddr addr, u64 size) {
+    // Queue ordering guarantees the invalidate happens before any subsequent command list
+    PushCommand(InvalidateRegionCommand(addr, size));
+}
+
+void ThreadManager::FlushAndInvalidateRegion(VAddr addr, u64 size) {
+    state.WaitForFence(PushCommand(FlushAndInvalidateRegionCommand(addr, size)));
+}
+
+void ThreadManager::RunThread() {
+    MicroProfileOnThreadCreate("GpuThread");
+    Core::HostScheduling::ApplyPolicy(Core::HostScheduling::HostThread::Gpu);
+
+    // The emulation thread gives up the graphics context before this thread is started, so all
+    // rendering for the session happens from here
+    auto& render_window{renderer.GetRenderWindow()};
+    render_window.MakeCurrent();
+
+    while (true) {
+        CommandData next{push_queue.PopWait()};
+
+        if (std::holds_alternative<EndProcessingCommand>(next)) {
+            break;
+        } else if (auto* submit_list = std::get_if<SubmitListCommand>(&next)) {
+            auto& perf_stats = Core::System::GetInstance().GetPerfStats();
+            perf_stats.BeginPhase(Core::PerfStats::Phase::GpuDispatch);
+            dma_pusher.Push(std::move(submit_list->entries));
+            dma_pusher.DispatchCalls();
+            perf_stats.EndPhase(Core::PerfStats::Phase::GpuDispatch);
+        } else if (auto* swap_buffers = std::get_if<SwapBuffersCommand>(&next)) {
+            renderer.SwapBuffers(swap_buffers->framebuffer
+                                     ? std::optional<std::reference_wrapper<
+                                           const Tegra::FramebufferConfig>>{*swap_buffers
+                                                                                 ->framebuffer}
+                                     : std::nullopt);
+        } else if (auto* flush = std::get_if<FlushRegionCommand>(&next)) {
+            renderer.Rasterizer().FlushRegion(flush->addr, flush->size);
+        } else if (auto* invalidate = std::get_if<InvalidateRegionCommand>(&next)) {
+            renderer.Rasterizer().InvalidateRegion(invalidate->addr, invalidate->size);
+        } else if (auto* flush_and_invalidate =
+                       std::get_if<FlushAndInvalidateRegionCommand>(&next)) {
+            renderer.Rasterizer().FlushAndInvalidateRegion(flush_and_invalidate->addr,
+                                                           flush_and_invalidate->size);
+        } else {
+            UNREACHABLE();
+        }
+
+        state.SignalCommandProcessed();
+    }
+
+    render_window.DoneCurrent();
+
+#if MICROPROFILE_ENABLED
+    MicroProfileOnThreadExit();
+#endif
+}
+
+u64 ThreadManager::PushCommand(CommandData&& command_data) {
+    push_queue.Push(std::move(command_data));
+    return ++pushed_fence;
+}
+
+} // namespace VideoCore::GPUThread
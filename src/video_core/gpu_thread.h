@@ -0,0 +1,131 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <variant>
+
+#include "common/common_types.h"
+#include "common/threadsafe_queue.h"
+#include "video_core/gpu.h"
+
+namespace VideoCore {
+class RendererBase;
+}
+
+namespace VideoCore::GPUThread {
+
+/// Command to signal to the GPU thread that processing has ended
+struct EndProcessingCommand final {};
+
+/// Command to signal to the GPU thread that a command list is ready for processing
+struct SubmitListCommand final {
+    explicit SubmitListCommand(Tegra::CommandList&& entries) : entries{std::move(entries)} {}
+
+    Tegra::CommandList entries;
+};
+
+/// Command to signal to the GPU thread that a swap buffers is pending
+struct SwapBuffersCommand final {
+    explicit SwapBuffersCommand(std::optional<Tegra::FramebufferConfig> framebuffer)
+        : framebuffer{std::move(framebuffer)} {}
+
+    std::optional<Tegra::FramebufferConfig> framebuffer;
+};
+
+/// Command to signal to the GPU thread to flush a region
+struct FlushRegionCommand final {
+    explicit constexpr FlushRegionCommand(VAddr addr, u64 size) : addr{addr}, size{size} {}
+
+    VAddr addr;
+    u64 size;
+};
+
+/// Command to signal to the GPU thread to invalidate a region
+struct InvalidateRegionCommand final {
+    explicit constexpr InvalidateRegionCommand(VAddr addr, u64 size) : addr{addr}, size{size} {}
+
+    VAddr addr;
+    u64 size;
+};
+
+/// Command to signal to the GPU thread to flush and invalidate a region
+struct FlushAndInvalidateRegionCommand final {
+    explicit constexpr FlushAndInvalidateRegionCommand(VAddr addr, u64 size)
+        : addr{addr}, size{size} {}
+
+    VAddr addr;
+    u64 size;
+};
+
+using CommandData = std::variant<EndProcessingCommand, SubmitListCommand, SwapBuffersCommand,
+                                 FlushRegionCommand, InvalidateRegionCommand,
+                                 FlushAndInvalidateRegionCommand>;
+
+/// Struct used to synchronize the GPU thread
+struct SynchState final {
+    std::atomic<u64> signaled_fence{};
+    std::mutex fence_mutex;
+    std::condition_variable fence_cv;
+
+    void SignalCommandProcessed() {
+        {
+            std::lock_guard<std::mutex> lock{fence_mutex};
+            ++signaled_fence;
+        }
+        fence_cv.notify_all();
+    }
+
+    void WaitForFence(u64 fence) {
+        std::unique_lock<std::mutex> lock{fence_mutex};
+        fence_cv.wait(lock, [this, fence] { return signaled_fence.load() >= fence; });
+    }
+};
+
+/// Runs the GPU on a dedicated host thread, consuming work through a lock-free SPSC queue
+class ThreadManager final {
+public:
+    explicit ThreadManager(RendererBase& renderer, Tegra::DmaPusher& dma_pusher);
+    ~ThreadManager();
+
+    /// Push GPU command entries to be processed
+    void SubmitList(Tegra::CommandList&& entries);
+
+    /// Swap buffers (render frame)
+    void SwapBuffers(
+        std::optional<std::reference_wrapper<const Tegra::FramebufferConfig>> framebuffer);
+
+    /// Notify rasterizer that any caches of the specified region should be flushed
+    void FlushRegion(VAddr addr, u64 size);
+
+    /// Notify rasterizer that any caches of the specified region should be invalidated
+    void InvalidateRegion(VAddr addr, u64 size);
+
+    /// Notify rasterizer that any caches of the specified region should be flushed/invalidated
+    void FlushAndInvalidateRegion(VAddr addr, u64 size);
+
+private:
+    /// GPU thread main loop
+    void RunThread();
+
+    /// Pushes a command to be executed by the GPU thread, returning its fence
+    u64 PushCommand(CommandData&& command_data);
+
+    RendererBase& renderer;
+    Tegra::DmaPusher& dma_pusher;
+
+    Common::SPSCQueue<CommandData> push_queue;
+    SynchState state;
+    u64 pushed_fence{};
+    u64 last_swap_fence{};
+
+    std::thread thread;
+};
+
+} // namespace VideoCore::GPUThread
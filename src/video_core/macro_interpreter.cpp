@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "common/assert.h"
 #include "common/logging/log.h"
 #include "video_core/engines/maxwell_3d.h"
@@ -11,7 +13,9 @@ namespace Tegra {
 
 MacroInterpreter::MacroInterpreter(Engines::Maxwell3D& maxwell3d) : maxwell3d(maxwell3d) {}
 
-void MacroInterpreter::Execute(u32 offset, std::vector<u32> parameters) {
+void MacroInterpreter::Execute(u32 offset, MacroParams parameters) {
+    const CompiledMacro& code{GetCompiledMacro(offset)};
+
     Reset();
     registers[1] = parameters[0];
     this->parameters = std::move(parameters);
@@ -19,13 +23,73 @@ void MacroInterpreter::Execute(u32 offset, std::vector<u32> parameters) {
     // Execute the code until we hit an exit condition.
     bool keep_executing = true;
     while (keep_executing) {
-        keep_executing = Step(offset, false);
+        keep_executing = Step(code, false);
     }
 
     // Assert the the macro used all the input parameters
     ASSERT(next_parameter_index == this->parameters.size());
 }
 
+void MacroInterpreter::ClearCache() {
+    macro_cache.clear();
+}
+
+const MacroInterpreter::CompiledMacro& MacroInterpreter::GetCompiledMacro(u32 offset) {
+    const auto search{macro_cache.find(offset)};
+    if (search != macro_cache.end()) {
+        return search->second;
+    }
+    return macro_cache.emplace(offset, CompileMacro(offset)).first->second;
+}
+
+MacroInterpreter::CompiledMacro MacroInterpreter::CompileMacro(u32 offset) const {
+    const auto& macro_memory{maxwell3d.GetMacroMemory()};
+    CompiledMacro program;
+
+    // Branch displacements are static, so a single linear sweep can cover every reachable
+    // instruction: keep decoding until all known branch targets and the exit's delay slot have
+    // been passed.
+    u32 last_needed{1};
+    bool exit_seen{};
+    for (u32 index = 0; index < last_needed || !exit_seen; ++index) {
+        ASSERT_MSG(offset + index < macro_memory.size(), "Macro overflows macro memory");
+        const CompiledInstruction inst{DecodeInstruction({macro_memory[offset + index]})};
+        if (inst.operation == Operation::Branch) {
+            const s32 target{static_cast<s32>(index) +
+                             inst.branch_target / static_cast<s32>(sizeof(u32))};
+            ASSERT_MSG(target >= 0, "Macro branch target underflows the macro");
+            // The branch target's own delay slot is covered by the sweep as well
+            last_needed = std::max(last_needed, static_cast<u32>(target) + 2);
+        }
+        if (inst.is_exit) {
+            exit_seen = true;
+            // Exit has a delay slot, so the next instruction must be decoded too
+            last_needed = std::max(last_needed, index + 2);
+        }
+        program.push_back(inst);
+    }
+    return program;
+}
+
+MacroInterpreter::CompiledInstruction MacroInterpreter::DecodeInstruction(Opcode opcode) {
+    CompiledInstruction inst{};
+    inst.operation = opcode.operation;
+    inst.alu_operation = opcode.alu_operation;
+    inst.result_operation = opcode.result_operation;
+    inst.branch_condition = opcode.branch_condition;
+    inst.branch_annul = opcode.branch_annul != 0;
+    inst.is_exit = opcode.is_exit != 0;
+    inst.dst = opcode.dst;
+    inst.src_a = opcode.src_a;
+    inst.src_b = opcode.src_b;
+    inst.immediate = opcode.immediate;
+    inst.bf_src_bit = opcode.bf_src_bit;
+    inst.bf_dst_bit = opcode.bf_dst_bit;
+    inst.bf_mask = opcode.GetBitfieldMask();
+    inst.branch_target = opcode.GetBranchTarget();
+    return inst;
+}
+
 void MacroInterpreter::Reset() {
     registers = {};
     pc = 0;
@@ -38,10 +102,12 @@ void MacroInterpreter::Reset() {
     carry_flag = false;
 }
 
-bool MacroInterpreter::Step(u32 offset, bool is_delay_slot) {
+bool MacroInterpreter::Step(const CompiledMacro& code, bool is_delay_slot) {
     u32 base_address = pc;
 
-    Opcode opcode = GetOpcode(offset);
+    ASSERT((pc % sizeof(u32)) == 0);
+    ASSERT(pc / sizeof(u32) < code.size());
+    const CompiledInstruction& opcode = code[pc / sizeof(u32)];
     pc += 4;
 
     // Update the program counter if we were delayed
@@ -67,8 +133,8 @@ bool MacroInterpreter::Step(u32 offset, bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        src = (src >> opcode.bf_src_bit) & opcode.GetBitfieldMask();
-        dst &= ~(opcode.GetBitfieldMask() << opcode.bf_dst_bit);
+        src = (src >> opcode.bf_src_bit) & opcode.bf_mask;
+        dst &= ~(opcode.bf_mask << opcode.bf_dst_bit);
         dst |= src << opcode.bf_dst_bit;
         ProcessResult(opcode.result_operation, opcode.dst, dst);
         break;
@@ -77,7 +143,7 @@ bool MacroInterpreter::Step(u32 offset, bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        u32 result = ((src >> dst) & opcode.GetBitfieldMask()) << opcode.bf_dst_bit;
+        u32 result = ((src >> dst) & opcode.bf_mask) << opcode.bf_dst_bit;
 
         ProcessResult(opcode.result_operation, opcode.dst, result);
         break;
@@ -86,7 +152,7 @@ bool MacroInterpreter::Step(u32 offset, bool is_delay_slot) {
         u32 dst = GetRegister(opcode.src_a);
         u32 src = GetRegister(opcode.src_b);
 
-        u32 result = ((src >> opcode.bf_src_bit) & opcode.GetBitfieldMask()) << dst;
+        u32 result = ((src >> opcode.bf_src_bit) & opcode.bf_mask) << dst;
 
         ProcessResult(opcode.result_operation, opcode.dst, result);
         break;
@@ -103,39 +169,32 @@ bool MacroInterpreter::Step(u32 offset, bool is_delay_slot) {
         if (taken) {
             // Ignore the delay slot if the branch has the annul bit.
             if (opcode.branch_annul) {
-                pc = base_address + opcode.GetBranchTarget();
+                pc = base_address + opcode.branch_target;
                 return true;
             }
 
-            delayed_pc = base_address + opcode.GetBranchTarget();
+            delayed_pc = base_address + opcode.branch_target;
             // Execute one more instruction due to the delay slot.
-            return Step(offset, true);
+            return Step(code, true);
         }
         break;
     }
     default:
         UNIMPLEMENTED_MSG("Unimplemented macro operation {}",
-                          static_cast<u32>(opcode.operation.Value()));
+                          static_cast<u32>(opcode.operation));
     }
 
     if (opcode.is_exit) {
         // Exit has a delay slot, execute the next instruction
         // Note: Executing an exit during a branch delay slot will cause the instruction at the
         // branch target to be executed before exiting.
-        Step(offset, true);
+        Step(code, true);
         return false;
     }
 
     return true;
 }
 
-MacroInterpreter::Opcode MacroInterpreter::GetOpcode(u32 offset) const {
-    const auto& macro_memory{maxwell3d.GetMacroMemory()};
-    ASSERT((pc % sizeof(u32)) == 0);
-    ASSERT((pc + offset) < macro_memory.size() * sizeof(u32));
-    return {macro_memory[offset + pc / sizeof(u32)]};
-}
-
 u32 MacroInterpreter::GetALUResult(ALUOperation operation, u32 src_a, u32 src_b) {
     switch (operation) {
     case ALUOperation::Add: {
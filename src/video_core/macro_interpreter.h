@@ -6,16 +6,21 @@
 
 #include <array>
 #include <optional>
-#include <vector>
+#include <unordered_map>
 
 #include "common/bit_field.h"
 #include "common/common_types.h"
+#include "common/small_vector.h"
 
 namespace Tegra {
 namespace Engines {
 class Maxwell3D;
 }
 
+/// Parameters of a macro call. Almost all macros take a handful of arguments, so they are kept in
+/// inline storage to avoid a heap allocation on every call.
+using MacroParams = Common::SmallVector<u32, 0x20>;
+
 class MacroInterpreter final {
 public:
     explicit MacroInterpreter(Engines::Maxwell3D& maxwell3d);
@@ -25,7 +30,10 @@ public:
      * @param offset Offset to start execution at.
      * @param parameters The parameters of the macro.
      */
-    void Execute(u32 offset, std::vector<u32> parameters);
+    void Execute(u32 offset, MacroParams parameters);
+
+    /// Invalidates all compiled macros. Called when macro memory is rewritten.
+    void ClearCache();
 
 private:
     enum class Operation : u32 {
@@ -104,17 +112,49 @@ private:
         BitField<12, 6, u32> increment;
     };
 
+    /**
+     * A macro instruction with all of its fields extracted ahead of time, so the hot execution
+     * loop does not re-fetch and re-decode opcode bitfields on every step.
+     */
+    struct CompiledInstruction {
+        Operation operation;
+        ALUOperation alu_operation;
+        ResultOperation result_operation;
+        BranchCondition branch_condition;
+        bool branch_annul;
+        bool is_exit;
+        u32 dst;
+        u32 src_a;
+        u32 src_b;
+        s32 immediate;
+        u32 bf_src_bit;
+        u32 bf_dst_bit;
+        u32 bf_mask;
+        s32 branch_target; ///< Branch displacement in bytes, relative to the instruction.
+    };
+
+    /// A macro compiled down to a flat program of decoded instructions.
+    using CompiledMacro = std::vector<CompiledInstruction>;
+
     /// Resets the execution engine state, zeroing registers, etc.
     void Reset();
 
     /**
      * Executes a single macro instruction located at the current program counter. Returns whether
      * the interpreter should keep running.
-     * @param offset Offset to start execution at.
+     * @param code The compiled macro to execute.
      * @param is_delay_slot Whether the current step is being executed due to a delay slot in a
      * previous instruction.
      */
-    bool Step(u32 offset, bool is_delay_slot);
+    bool Step(const CompiledMacro& code, bool is_delay_slot);
+
+    /// Returns the compiled program for the macro at the given offset, compiling it on demand.
+    const CompiledMacro& GetCompiledMacro(u32 offset);
+
+    /// Decodes all instructions reachable from the start of the macro.
+    CompiledMacro CompileMacro(u32 offset) const;
+
+    static CompiledInstruction DecodeInstruction(Opcode opcode);
 
     /// Calculates the result of an ALU operation. src_a OP src_b;
     u32 GetALUResult(ALUOperation operation, u32 src_a, u32 src_b);
@@ -126,9 +166,6 @@ private:
     /// Evaluates the branch condition and returns whether the branch should be taken or not.
     bool EvaluateBranchCondition(BranchCondition cond, u32 value) const;
 
-    /// Reads an opcode at the current program counter location.
-    Opcode GetOpcode(u32 offset) const;
-
     /// Returns the specified register's value. Register 0 is hardcoded to always return 0.
     u32 GetRegister(u32 register_id) const;
 
@@ -161,8 +198,11 @@ private:
     /// Method address to use for the next Send instruction.
     MethodAddress method_address = {};
 
+    /// Compiled macros, keyed by their start offset in macro memory.
+    std::unordered_map<u32, CompiledMacro> macro_cache;
+
     /// Input parameters of the current macro.
-    std::vector<u32> parameters;
+    MacroParams parameters;
     /// Index of the next parameter that will be fetched by the 'parm' instruction.
     u32 next_parameter_index = 0;
 
@@ -2,6 +2,8 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <algorithm>
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/logging/log.h"
@@ -29,6 +31,9 @@ GPUVAddr MemoryManager::AllocateSpace(u64 size, u64 align) {
         slot = static_cast<u64>(PageStatus::Allocated);
     }
 
+    unmapped_search_start = std::max(unmapped_search_start, *gpu_addr + size);
+    tlb_page_index = NO_TLB_PAGE;
+
     return *gpu_addr;
 }
 
@@ -41,6 +46,8 @@ GPUVAddr MemoryManager::AllocateSpace(GPUVAddr gpu_addr, u64 size, u64 align) {
         slot = static_cast<u64>(PageStatus::Allocated);
     }
 
+    tlb_page_index = NO_TLB_PAGE;
+
     return gpu_addr;
 }
 
@@ -57,6 +64,9 @@ GPUVAddr MemoryManager::MapBufferEx(VAddr cpu_addr, u64 size) {
         slot = cpu_addr + offset;
     }
 
+    unmapped_search_start = std::max(unmapped_search_start, *gpu_addr + size);
+    tlb_page_index = NO_TLB_PAGE;
+
     const MappedRegion region{cpu_addr, *gpu_addr, size};
     mapped_regions.push_back(region);
 
@@ -90,12 +100,39 @@ GPUVAddr MemoryManager::MapBufferEx(VAddr cpu_addr, GPUVAddr gpu_addr, u64 size)
         slot = cpu_addr + offset;
     }
 
+    tlb_page_index = NO_TLB_PAGE;
+
     const MappedRegion region{cpu_addr, gpu_addr, size};
     mapped_regions.push_back(region);
 
     return gpu_addr;
 }
 
+void MemoryManager::RemapBatch(const std::vector<RemapEntry>& entries) {
+    for (const auto& entry : entries) {
+        ASSERT((entry.gpu_addr & PAGE_MASK) == 0);
+
+        for (u64 offset{}; offset < entry.size; offset += PAGE_SIZE) {
+            PageSlot(entry.gpu_addr + offset) = entry.cpu_addr + offset;
+        }
+
+        // Rebinding the same range is the common case during remap storms; updating the existing
+        // region keeps mapped_regions from growing with every rebind.
+        const auto it = std::find_if(mapped_regions.begin(), mapped_regions.end(),
+                                     [&entry](const MappedRegion& region) {
+                                         return region.gpu_addr == entry.gpu_addr &&
+                                                region.size == entry.size;
+                                     });
+        if (it != mapped_regions.end()) {
+            it->cpu_addr = entry.cpu_addr;
+        } else {
+            mapped_regions.push_back({entry.cpu_addr, entry.gpu_addr, entry.size});
+        }
+    }
+
+    tlb_page_index = NO_TLB_PAGE;
+}
+
 GPUVAddr MemoryManager::UnmapBuffer(GPUVAddr gpu_addr, u64 size) {
     ASSERT((gpu_addr & PAGE_MASK) == 0);
 
@@ -108,6 +145,9 @@ GPUVAddr MemoryManager::UnmapBuffer(GPUVAddr gpu_addr, u64 size) {
         slot = static_cast<u64>(PageStatus::Unmapped);
     }
 
+    unmapped_search_start = std::min(unmapped_search_start, gpu_addr);
+    tlb_page_index = NO_TLB_PAGE;
+
     // Delete the region mappings that are contained within the unmapped region
     mapped_regions.erase(std::remove_if(mapped_regions.begin(), mapped_regions.end(),
                                         [&](const MappedRegion& region) {
@@ -134,8 +174,36 @@ std::optional<GPUVAddr> MemoryManager::FindFreeBlock(GPUVAddr region_start, u64
     u64 free_space{};
     align = (align + PAGE_MASK) & ~PAGE_MASK;
 
+    if (status == PageStatus::Unmapped) {
+        // Everything below the allocation cursor has been handed out at some point; searching
+        // there again would make every mapping operation scan the whole address space.
+        gpu_addr = Common::AlignUp(std::max(gpu_addr, unmapped_search_start), align);
+    }
+
     while (gpu_addr + free_space < MAX_ADDRESS) {
-        if (PageSlot(gpu_addr + free_space) == static_cast<u64>(status)) {
+        const GPUVAddr probe_addr{gpu_addr + free_space};
+        const auto& block{page_table[(probe_addr >> (PAGE_BITS + PAGE_TABLE_BITS)) &
+                                     PAGE_TABLE_MASK]};
+
+        if (!block) {
+            // An absent block means every page in it is unmapped, so the whole remainder of the
+            // block can be accepted or skipped at once instead of page by page.
+            const u64 block_remaining{(PAGE_BLOCK_SIZE - ((probe_addr >> PAGE_BITS) &
+                                                          PAGE_BLOCK_MASK))
+                                      << PAGE_BITS};
+            if (status == PageStatus::Unmapped) {
+                free_space += block_remaining;
+                if (free_space >= size) {
+                    return gpu_addr;
+                }
+            } else {
+                gpu_addr = Common::AlignUp(probe_addr + block_remaining, align);
+                free_space = 0;
+            }
+            continue;
+        }
+
+        if ((*block)[(probe_addr >> PAGE_BITS) & PAGE_BLOCK_MASK] == static_cast<u64>(status)) {
             free_space += PAGE_SIZE;
             if (free_space >= size) {
                 return gpu_addr;
@@ -151,7 +219,16 @@ std::optional<GPUVAddr> MemoryManager::FindFreeBlock(GPUVAddr region_start, u64
 }
 
 std::optional<VAddr> MemoryManager::GpuToCpuAddress(GPUVAddr gpu_addr) {
-    const VAddr base_addr{PageSlot(gpu_addr)};
+    const GPUVAddr page_index{gpu_addr >> PAGE_BITS};
+    VAddr base_addr;
+
+    if (page_index == tlb_page_index) {
+        base_addr = tlb_page_slot;
+    } else {
+        base_addr = ReadPageSlot(gpu_addr);
+        tlb_page_index = page_index;
+        tlb_page_slot = base_addr;
+    }
 
     if (base_addr == static_cast<u64>(PageStatus::Allocated) ||
         base_addr == static_cast<u64>(PageStatus::Unmapped)) {
@@ -172,6 +249,14 @@ std::vector<GPUVAddr> MemoryManager::CpuToGpuAddress(VAddr cpu_addr) const {
     return results;
 }
 
+VAddr MemoryManager::ReadPageSlot(GPUVAddr gpu_addr) const {
+    const auto& block{page_table[(gpu_addr >> (PAGE_BITS + PAGE_TABLE_BITS)) & PAGE_TABLE_MASK]};
+    if (!block) {
+        return static_cast<VAddr>(PageStatus::Unmapped);
+    }
+    return (*block)[(gpu_addr >> PAGE_BITS) & PAGE_BLOCK_MASK];
+}
+
 VAddr& MemoryManager::PageSlot(GPUVAddr gpu_addr) {
     auto& block{page_table[(gpu_addr >> (PAGE_BITS + PAGE_TABLE_BITS)) & PAGE_TABLE_MASK]};
     if (!block) {
@@ -25,6 +25,19 @@ public:
     GPUVAddr MapBufferEx(VAddr cpu_addr, u64 size);
     GPUVAddr MapBufferEx(VAddr cpu_addr, GPUVAddr gpu_addr, u64 size);
     GPUVAddr UnmapBuffer(GPUVAddr gpu_addr, u64 size);
+
+    /// One entry of a batched remap; remapping overwrites whatever the pages currently point at.
+    struct RemapEntry {
+        VAddr cpu_addr;
+        GPUVAddr gpu_addr;
+        u64 size;
+    };
+
+    /// Rebinds a batch of page ranges in one pass, updating the tracked regions in place and
+    /// invalidating the translation cache once at the end instead of per entry. This is the
+    /// backend of the nvhost_as_gpu remap ioctl, which sparse-binding titles hit with hundreds
+    /// of entries at a time.
+    void RemapBatch(const std::vector<RemapEntry>& entries);
     GPUVAddr GetRegionEnd(GPUVAddr region_start) const;
     std::optional<VAddr> GpuToCpuAddress(GPUVAddr gpu_addr);
     std::vector<GPUVAddr> CpuToGpuAddress(VAddr cpu_addr) const;
@@ -33,6 +46,18 @@ public:
     static constexpr u64 PAGE_SIZE = 1 << PAGE_BITS;
     static constexpr u64 PAGE_MASK = PAGE_SIZE - 1;
 
+    struct MappedRegion {
+        VAddr cpu_addr;
+        GPUVAddr gpu_addr;
+        u64 size;
+    };
+
+    /// Returns the currently mapped buffer regions, used by the GPU tracer to capture the guest
+    /// memory the engines can reference.
+    const std::vector<MappedRegion>& GetMappedRegions() const {
+        return mapped_regions;
+    }
+
 private:
     enum class PageStatus : u64 {
         Unmapped = 0xFFFFFFFFFFFFFFFFULL,
@@ -44,6 +69,9 @@ private:
                                           PageStatus status);
     VAddr& PageSlot(GPUVAddr gpu_addr);
 
+    /// Reads a page slot without creating the backing block; absent blocks read as Unmapped.
+    VAddr ReadPageSlot(GPUVAddr gpu_addr) const;
+
     static constexpr u64 MAX_ADDRESS{0x10000000000ULL};
     static constexpr u64 PAGE_TABLE_BITS{10};
     static constexpr u64 PAGE_TABLE_SIZE{1 << PAGE_TABLE_BITS};
@@ -55,11 +83,16 @@ private:
     using PageBlock = std::array<VAddr, PAGE_BLOCK_SIZE>;
     std::array<std::unique_ptr<PageBlock>, PAGE_TABLE_SIZE> page_table{};
 
-    struct MappedRegion {
-        VAddr cpu_addr;
-        GPUVAddr gpu_addr;
-        u64 size;
-    };
+    /// Allocation cursor: no unmapped run below this address needs to be considered by
+    /// FindFreeBlock, moved forward on allocation and rewound on unmap.
+    GPUVAddr unmapped_search_start{};
+
+    /// One-entry TLB caching the last translated page, invalidated whenever the page table is
+    /// written. GpuToCpuAddress is called for every texture and buffer fetch, and consecutive
+    /// fetches overwhelmingly hit the same page.
+    GPUVAddr tlb_page_index{NO_TLB_PAGE};
+    VAddr tlb_page_slot{};
+    static constexpr GPUVAddr NO_TLB_PAGE{~0ULL};
 
     std::vector<MappedRegion> mapped_regions;
 };
@@ -4,13 +4,17 @@
 
 #pragma once
 
+#include <algorithm>
+#include <memory>
 #include <set>
-#include <unordered_map>
+#include <vector>
 
 #include <boost/icl/interval_map.hpp>
 #include <boost/range/iterator_range_core.hpp>
 
 #include "common/common_types.h"
+#include "common/flat_hash_map.h"
+#include "common/perf_counters.h"
 #include "core/settings.h"
 #include "video_core/rasterizer_interface.h"
 
@@ -65,19 +69,75 @@ class RasterizerCache : NonCopyable {
     friend class RasterizerCacheObject;
 
 public:
-    explicit RasterizerCache(VideoCore::RasterizerInterface& rasterizer) : rasterizer{rasterizer} {}
+    explicit RasterizerCache(VideoCore::RasterizerInterface& rasterizer) : rasterizer{rasterizer} {
+        // TryGet runs several times per draw and per tracked memory write, so start with enough
+        // slots that the map doesn't rehash while the cache warms up.
+        map_cache.Reserve(1024);
+    }
 
     /// Write any cached resources overlapping the specified region back to memory
     void FlushRegion(Tegra::GPUVAddr addr, size_t size) {
+        if (size == 0) {
+            return;
+        }
+
+        // CPU-readback titles flush the same render target dozens of times per frame as the
+        // guest walks adjacent rows. Requests are coalesced into a clean range: while nothing
+        // has been modified since, anything inside the last flushed span is known clean and
+        // the interval lookup and sort can be skipped outright.
+        if (modified_ticks == clean_range_ticks && addr >= clean_range_addr &&
+            addr + size <= clean_range_addr + clean_range_size) {
+            static auto& coalesced_counter =
+                Common::GetPerfCounter("rasterizer_cache_flushes_coalesced");
+            coalesced_counter.Add();
+            return;
+        }
+
         const auto& objects{GetSortedObjectsFromRegion(addr, size)};
         for (auto& object : objects) {
             FlushObject(object);
         }
+
+        if (modified_ticks == clean_range_ticks && addr <= clean_range_addr + clean_range_size &&
+            clean_range_addr <= addr + size) {
+            // Adjacent or overlapping request: widen the known-clean span
+            const VAddr end{std::max(clean_range_addr + clean_range_size, addr + size)};
+            clean_range_addr = std::min(clean_range_addr, static_cast<VAddr>(addr));
+            clean_range_size = end - clean_range_addr;
+        } else {
+            clean_range_addr = addr;
+            clean_range_size = size;
+        }
+        clean_range_ticks = modified_ticks;
     }
 
     /// Mark the specified region as being invalidated
     void InvalidateRegion(VAddr addr, u64 size) {
-        const auto& objects{GetSortedObjectsFromRegion(addr, size)};
+        if (size == 0) {
+            return;
+        }
+
+        // This runs on every guest write to a tracked page, so avoid the modification-order sort
+        // needed for flushing: unregistration order doesn't matter unless objects get flushed.
+        std::vector<T> objects;
+        const ObjectInterval interval{addr, addr + size};
+        for (auto& pair : boost::make_iterator_range(interval_cache.equal_range(interval))) {
+            for (auto& cached_object : pair.second) {
+                if (!cached_object) {
+                    continue;
+                }
+                objects.push_back(cached_object);
+            }
+        }
+
+        if (GetSettings().use_accurate_gpu_emulation) {
+            // Unregister flushes in this mode, so dirty objects have to go back in the order they
+            // were modified.
+            std::sort(objects.begin(), objects.end(), [](const T& a, const T& b) -> bool {
+                return a->GetLastModifiedTicks() < b->GetLastModifiedTicks();
+            });
+        }
+
         for (auto& object : objects) {
             if (!object->IsRegistered()) {
                 // Skip duplicates
@@ -95,11 +155,29 @@ public:
     }
 
 protected:
+    /// Returns the settings snapshot this cache operates under, re-acquiring it when a new
+    /// generation has been published. Flushing and unregistration run per tracked memory access,
+    /// so they poll a single atomic generation counter instead of reading the mutable global.
+    const Settings::Values& GetSettings() {
+        const u32 generation{Settings::GetGeneration()};
+        if (!settings_snapshot || settings_generation != generation) {
+            settings_snapshot = Settings::AcquireSnapshot();
+            settings_generation = generation;
+        }
+        return *settings_snapshot;
+    }
+
     /// Tries to get an object from the cache with the specified address
     T TryGet(VAddr addr) const {
-        const auto iter = map_cache.find(addr);
-        if (iter != map_cache.end())
-            return iter->second;
+        static auto& hit_counter = Common::GetPerfCounter("rasterizer_cache_hits");
+        static auto& miss_counter = Common::GetPerfCounter("rasterizer_cache_misses");
+
+        const T* object = map_cache.Find(addr);
+        if (object != nullptr) {
+            hit_counter.Add();
+            return *object;
+        }
+        miss_counter.Add();
         return nullptr;
     }
 
@@ -107,7 +185,7 @@ protected:
     void Register(const T& object) {
         object->SetIsRegistered(true);
         interval_cache.add({GetInterval(object), ObjectSet{object}});
-        map_cache.insert({object->GetAddr(), object});
+        map_cache.Insert(object->GetAddr(), object);
         rasterizer.UpdatePagesCachedCount(object->GetAddr(), object->GetSizeInBytes(), 1);
     }
 
@@ -116,12 +194,12 @@ protected:
         object->SetIsRegistered(false);
         rasterizer.UpdatePagesCachedCount(object->GetAddr(), object->GetSizeInBytes(), -1);
         // Only flush if use_accurate_gpu_emulation is enabled, as it incurs a performance hit
-        if (Settings::values.use_accurate_gpu_emulation) {
+        if (GetSettings().use_accurate_gpu_emulation) {
             FlushObject(object);
         }
 
         interval_cache.subtract({GetInterval(object), ObjectSet{object}});
-        map_cache.erase(object->GetAddr());
+        map_cache.Erase(object->GetAddr());
     }
 
     /// Returns a ticks counter used for tracking when cached objects were last modified
@@ -130,7 +208,9 @@ protected:
     }
 
 private:
-    /// Returns a list of cached objects from the specified memory region, ordered by access time
+    /// Returns a list of dirty cached objects from the specified memory region, ordered by
+    /// access time. Clean objects have nothing to write back, so they are filtered here rather
+    /// than caught one call later in FlushObject.
     std::vector<T> GetSortedObjectsFromRegion(VAddr addr, u64 size) {
         if (size == 0) {
             return {};
@@ -140,16 +220,18 @@ private:
         const ObjectInterval interval{addr, addr + size};
         for (auto& pair : boost::make_iterator_range(interval_cache.equal_range(interval))) {
             for (auto& cached_object : pair.second) {
-                if (!cached_object) {
+                if (!cached_object || !cached_object->IsDirty()) {
                     continue;
                 }
                 objects.push_back(cached_object);
             }
         }
 
-        std::sort(objects.begin(), objects.end(), [](const T& a, const T& b) -> bool {
-            return a->GetLastModifiedTicks() < b->GetLastModifiedTicks();
-        });
+        if (objects.size() > 1) {
+            std::sort(objects.begin(), objects.end(), [](const T& a, const T& b) -> bool {
+                return a->GetLastModifiedTicks() < b->GetLastModifiedTicks();
+            });
+        }
 
         return objects;
     }
@@ -164,7 +246,7 @@ private:
     }
 
     using ObjectSet = std::set<T>;
-    using ObjectCache = std::unordered_map<VAddr, T>;
+    using ObjectCache = Common::FlatHashMap<VAddr, T>;
     using IntervalCache = boost::icl::interval_map<VAddr, ObjectSet>;
     using ObjectInterval = typename IntervalCache::interval_type;
 
@@ -176,5 +258,15 @@ private:
     ObjectCache map_cache;
     IntervalCache interval_cache; ///< Cache of objects
     u64 modified_ticks{};         ///< Counter of cache state ticks, used for in-order flushing
+
+    /// Span known to hold no dirty objects, valid while modified_ticks still equals
+    /// clean_range_ticks; lets repeat flushes of the same surface exit without a lookup
+    VAddr clean_range_addr{};
+    u64 clean_range_size{};
+    u64 clean_range_ticks{};
     VideoCore::RasterizerInterface& rasterizer;
+
+    /// Cached settings snapshot and the generation it was acquired at (see GetSettings)
+    std::shared_ptr<const Settings::Values> settings_snapshot;
+    u32 settings_generation{};
 };
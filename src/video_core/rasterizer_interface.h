@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <functional>
 #include "common/common_types.h"
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/gpu.h"
@@ -55,6 +56,13 @@ public:
         return false;
     }
 
+    /// Runs the given guest memory write (semaphore/query result) once all GPU commands issued
+    /// so far have completed on the host. Backends that cannot track host command completion
+    /// run the write immediately instead.
+    virtual void DeferMemoryWrite(std::function<void()> do_write) {
+        do_write();
+    }
+
     /// Increase/decrease the number of object in pages touching the specified region
     virtual void UpdatePagesCachedCount(Tegra::GPUVAddr addr, u64 size, int delta) {}
 };
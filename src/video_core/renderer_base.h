@@ -57,6 +57,14 @@ public:
         return *rasterizer;
     }
 
+    Core::Frontend::EmuWindow& GetRenderWindow() {
+        return render_window;
+    }
+
+    const Core::Frontend::EmuWindow& GetRenderWindow() const {
+        return render_window;
+    }
+
     /// Refreshes the settings common to all renderers
     void RefreshBaseSettings();
 
@@ -6,6 +6,7 @@
 #include <memory>
 
 #include "common/alignment.h"
+#include "common/cityhash.h"
 #include "core/core.h"
 #include "core/memory.h"
 #include "video_core/renderer_opengl/gl_buffer_cache.h"
@@ -33,6 +34,11 @@ GLintptr OGLBufferCache::UploadMemory(Tegra::GPUVAddr gpu_addr, std::size_t size
             }
             Unregister(entry);
         }
+    } else {
+        // Small buffers (mostly constant buffers) change rarely between draws, but registering
+        // them in the rasterizer cache would mark their pages as cached and slow down every
+        // guest write to them. Key them by address and content hash instead.
+        return UploadSmallMemory(*cpu_addr, size, alignment);
     }
 
     AlignBuffer(alignment);
@@ -55,6 +61,31 @@ GLintptr OGLBufferCache::UploadMemory(Tegra::GPUVAddr gpu_addr, std::size_t size
     return uploaded_offset;
 }
 
+GLintptr OGLBufferCache::UploadSmallMemory(VAddr cpu_addr, std::size_t size,
+                                           std::size_t alignment) {
+    small_staging.resize(size);
+    Memory::ReadBlock(cpu_addr, small_staging.data(), size);
+
+    const u64 hash{Common::CityHash64(reinterpret_cast<const char*>(small_staging.data()), size)};
+    const auto search = small_cache.find(cpu_addr);
+    if (search != small_cache.end()) {
+        const auto& entry = search->second;
+        if (entry.hash == hash && entry.size >= size && entry.alignment == alignment) {
+            return entry.offset;
+        }
+    }
+
+    AlignBuffer(alignment);
+    const GLintptr uploaded_offset = buffer_offset;
+    std::memcpy(buffer_ptr, small_staging.data(), size);
+
+    buffer_ptr += size;
+    buffer_offset += size;
+
+    small_cache[cpu_addr] = {hash, size, alignment, uploaded_offset};
+    return uploaded_offset;
+}
+
 GLintptr OGLBufferCache::UploadHostMemory(const void* raw_pointer, std::size_t size,
                                           std::size_t alignment) {
     AlignBuffer(alignment);
@@ -84,6 +115,8 @@ bool OGLBufferCache::Map(std::size_t max_size) {
 
     if (invalidate) {
         InvalidateAll();
+        // Offsets of previous uploads are no longer valid after the buffer has been orphaned.
+        small_cache.clear();
     }
     return invalidate;
 }
@@ -92,6 +125,10 @@ void OGLBufferCache::Unmap() {
     stream_buffer.Unmap(buffer_offset - buffer_offset_base);
 }
 
+bool OGLBufferCache::CanMapWithoutInvalidation(std::size_t max_size) const {
+    return !stream_buffer.WouldInvalidate(static_cast<GLsizeiptr>(max_size), 4);
+}
+
 GLuint OGLBufferCache::GetHandle() const {
     return stream_buffer.GetHandle();
 }
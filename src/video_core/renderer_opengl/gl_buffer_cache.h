@@ -7,6 +7,8 @@
 #include <cstddef>
 #include <memory>
 #include <tuple>
+#include <unordered_map>
+#include <vector>
 
 #include "common/common_types.h"
 #include "video_core/rasterizer_cache.h"
@@ -53,14 +55,33 @@ public:
     bool Map(std::size_t max_size);
     void Unmap();
 
+    /// Whether Map can provide max_size bytes without invalidating earlier uploads.
+    bool CanMapWithoutInvalidation(std::size_t max_size) const;
+
     GLuint GetHandle() const;
 
 protected:
     void AlignBuffer(std::size_t alignment);
 
 private:
+    /// Uploads without registering in the rasterizer cache, reusing the previous upload when the
+    /// data behind the address has not changed.
+    GLintptr UploadSmallMemory(VAddr cpu_addr, std::size_t size, std::size_t alignment);
+
+    /// Entry for buffers too small to be worth registering in the rasterizer cache, keyed by
+    /// guest address and validated with a content hash.
+    struct SmallBufferEntry {
+        u64 hash = 0;
+        std::size_t size = 0;
+        std::size_t alignment = 0;
+        GLintptr offset = 0;
+    };
+
     OGLStreamBuffer stream_buffer;
 
+    std::unordered_map<VAddr, SmallBufferEntry> small_cache;
+    std::vector<u8> small_staging;
+
     u8* buffer_ptr = nullptr;
     GLintptr buffer_offset = 0;
     GLintptr buffer_offset_base = 0;
@@ -0,0 +1,190 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <glad/glad.h>
+
+#include "common/scope_exit.h"
+#include "video_core/renderer_opengl/gl_format_reinterpreter.h"
+#include "video_core/renderer_opengl/gl_state.h"
+
+namespace OpenGL {
+
+using VideoCore::Surface::PixelFormat;
+
+namespace {
+
+constexpr char vertex_shader[] = R"(#version 430 core
+void main() {
+    // Oversized triangle covering the whole viewport, no vertex buffers required
+    const vec2 positions[3] = vec2[](vec2(-1.0, -1.0), vec2(3.0, -1.0), vec2(-1.0, 3.0));
+    gl_Position = vec4(positions[gl_VertexID], 0.0, 1.0);
+}
+)";
+
+// The packing matches GL_UNSIGNED_INT_24_8: depth in the upper 24 bits, stencil in the lower 8.
+// That is the same raw layout the pixel buffer fallback produces when it aliases the data into a
+// 32-bit color texture, and unpackUnorm4x8 distributes the bytes exactly like an
+// GL_UNSIGNED_INT_8_8_8_8_REV color upload would.
+constexpr char z24s8_to_abgr8_fragment[] = R"(#version 430 core
+layout (binding = 0) uniform sampler2D depth_tex;
+layout (binding = 1) uniform usampler2D stencil_tex;
+layout (location = 0) out vec4 color;
+void main() {
+    ivec2 coord = ivec2(gl_FragCoord.xy);
+    uint depth = uint(texelFetch(depth_tex, coord, 0).r * 16777215.0 + 0.5);
+    uint stencil = texelFetch(stencil_tex, coord, 0).r;
+    color = unpackUnorm4x8((depth << 8) | stencil);
+}
+)";
+
+constexpr char abgr8_to_z24s8_fragment[] = R"(#version 430 core
+#extension GL_ARB_shader_stencil_export : require
+layout (binding = 0) uniform sampler2D color_tex;
+void main() {
+    uint bits = packUnorm4x8(texelFetch(color_tex, ivec2(gl_FragCoord.xy), 0));
+    gl_FragDepth = float(bits >> 8) / 16777215.0;
+    gl_FragStencilRefARB = int(bits & 0xffu);
+}
+)";
+
+constexpr char z32f_to_r32f_fragment[] = R"(#version 430 core
+layout (binding = 0) uniform sampler2D depth_tex;
+layout (location = 0) out vec4 color;
+void main() {
+    color = vec4(texelFetch(depth_tex, ivec2(gl_FragCoord.xy), 0).r, 0.0, 0.0, 0.0);
+}
+)";
+
+constexpr char r32f_to_z32f_fragment[] = R"(#version 430 core
+layout (binding = 0) uniform sampler2D color_tex;
+void main() {
+    gl_FragDepth = texelFetch(color_tex, ivec2(gl_FragCoord.xy), 0).r;
+}
+)";
+
+u32 PairKey(PixelFormat src_format, PixelFormat dst_format) {
+    return (static_cast<u32>(src_format) << 16) | static_cast<u32>(dst_format);
+}
+
+} // Anonymous namespace
+
+FormatReinterpreterOpenGL::FormatReinterpreterOpenGL() {
+    vertex_array.Create();
+    draw_framebuffer.Create();
+    sampler.Create();
+    glSamplerParameteri(sampler.handle, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glSamplerParameteri(sampler.handle, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+}
+
+FormatReinterpreterOpenGL::~FormatReinterpreterOpenGL() = default;
+
+FormatReinterpreterOpenGL::Pipeline* FormatReinterpreterOpenGL::GetPipeline(
+    PixelFormat src_format, PixelFormat dst_format) {
+    const u32 key{PairKey(src_format, dst_format)};
+    if (const auto itr = pipelines.find(key); itr != pipelines.end()) {
+        return itr->second.program.handle != 0 ? &itr->second : nullptr;
+    }
+
+    Pipeline& pipeline{pipelines[key]};
+    switch (src_format) {
+    case PixelFormat::Z24S8:
+    case PixelFormat::S8Z24:
+        // S8Z24 textures are stored as Z24S8 on the GPU, so both alias the same way.
+        if (dst_format == PixelFormat::ABGR8U) {
+            pipeline.program.CreateFromSource(vertex_shader, nullptr, z24s8_to_abgr8_fragment);
+            pipeline.dst_attachment = GL_COLOR_ATTACHMENT0;
+            pipeline.reads_stencil = true;
+        }
+        break;
+    case PixelFormat::ABGR8U:
+        // Writing the stencil half needs the shader stencil export extension.
+        if ((dst_format == PixelFormat::Z24S8 || dst_format == PixelFormat::S8Z24) &&
+            GLAD_GL_ARB_shader_stencil_export) {
+            pipeline.program.CreateFromSource(vertex_shader, nullptr, abgr8_to_z24s8_fragment);
+            pipeline.dst_attachment = GL_DEPTH_STENCIL_ATTACHMENT;
+            pipeline.writes_stencil = true;
+        }
+        break;
+    case PixelFormat::Z32F:
+        if (dst_format == PixelFormat::R32F) {
+            pipeline.program.CreateFromSource(vertex_shader, nullptr, z32f_to_r32f_fragment);
+            pipeline.dst_attachment = GL_COLOR_ATTACHMENT0;
+        }
+        break;
+    case PixelFormat::R32F:
+        if (dst_format == PixelFormat::Z32F) {
+            pipeline.program.CreateFromSource(vertex_shader, nullptr, r32f_to_z32f_fragment);
+            pipeline.dst_attachment = GL_DEPTH_ATTACHMENT;
+        }
+        break;
+    default:
+        break;
+    }
+    return pipeline.program.handle != 0 ? &pipeline : nullptr;
+}
+
+bool FormatReinterpreterOpenGL::Reinterpret(GLuint src_texture, PixelFormat src_format,
+                                            GLuint dst_texture, PixelFormat dst_format, u32 width,
+                                            u32 height) {
+    Pipeline* const pipeline{GetPipeline(src_format, dst_format)};
+    if (pipeline == nullptr) {
+        return false;
+    }
+
+    const OpenGLState prev_state{OpenGLState::GetCurState()};
+    SCOPE_EXIT({ prev_state.Apply(); });
+
+    OpenGLState state;
+    state.draw.draw_framebuffer = draw_framebuffer.handle;
+    state.draw.vertex_array = vertex_array.handle;
+    state.draw.shader_program = pipeline->program.handle;
+    state.viewports[0].x = 0;
+    state.viewports[0].y = 0;
+    state.viewports[0].width = static_cast<GLint>(width);
+    state.viewports[0].height = static_cast<GLint>(height);
+    state.texture_units[0].texture = src_texture;
+    state.texture_units[0].target = GL_TEXTURE_2D;
+    state.texture_units[0].sampler = sampler.handle;
+
+    // The stencil half of a depth-stencil source is sampled through a texture view, since a
+    // texture can only expose either its depth or its stencil aspect at a time.
+    OGLTexture stencil_view;
+    if (pipeline->reads_stencil) {
+        glGenTextures(1, &stencil_view.handle);
+        glTextureView(stencil_view.handle, GL_TEXTURE_2D, src_texture, GL_DEPTH24_STENCIL8, 0, 1, 0,
+                      1);
+        glTextureParameteri(stencil_view.handle, GL_DEPTH_STENCIL_TEXTURE_MODE, GL_STENCIL_INDEX);
+        state.texture_units[1].texture = stencil_view.handle;
+        state.texture_units[1].target = GL_TEXTURE_2D;
+        state.texture_units[1].sampler = sampler.handle;
+    }
+
+    if (pipeline->dst_attachment != GL_COLOR_ATTACHMENT0) {
+        state.depth.test_enabled = true;
+        state.depth.test_func = GL_ALWAYS;
+        state.depth.write_mask = GL_TRUE;
+    }
+    if (pipeline->writes_stencil) {
+        // The replace reference value comes from the shader's stencil export.
+        state.stencil.test_enabled = true;
+        state.stencil.front.test_func = GL_ALWAYS;
+        state.stencil.front.write_mask = 0xFF;
+        state.stencil.front.action_stencil_fail = GL_REPLACE;
+        state.stencil.front.action_depth_fail = GL_REPLACE;
+        state.stencil.front.action_depth_pass = GL_REPLACE;
+        state.stencil.back = state.stencil.front;
+    }
+    state.Apply();
+
+    // Detach whatever the previous pass left bound before attaching the destination.
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0, 0);
+    glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, pipeline->dst_attachment, GL_TEXTURE_2D,
+                           dst_texture, 0);
+
+    glDrawArrays(GL_TRIANGLES, 0, 3);
+    return true;
+}
+
+} // namespace OpenGL
@@ -0,0 +1,54 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <unordered_map>
+#include <glad/glad.h>
+#include "common/common_types.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+#include "video_core/surface.h"
+
+namespace OpenGL {
+
+/**
+ * Executes reinterpretation between aliasing surface formats as small fragment passes on the GPU,
+ * so the texel data never has to leave video memory. Pipelines are created lazily and cached by
+ * (source, destination) pixel format pair; pairs without a pipeline fall back to the caller's
+ * pixel buffer copy.
+ */
+class FormatReinterpreterOpenGL final {
+public:
+    FormatReinterpreterOpenGL();
+    ~FormatReinterpreterOpenGL();
+
+    /// Draws src_texture reinterpreted into dst_texture. Returns false when there is no pipeline
+    /// for this format pair and the caller has to fall back to a buffer copy.
+    bool Reinterpret(GLuint src_texture, VideoCore::Surface::PixelFormat src_format,
+                     GLuint dst_texture, VideoCore::Surface::PixelFormat dst_format, u32 width,
+                     u32 height);
+
+private:
+    struct Pipeline {
+        OGLProgram program;
+        /// Framebuffer attachment the destination is bound to.
+        GLenum dst_attachment{};
+        /// Whether the source stencil has to be sampled through a texture view.
+        bool reads_stencil{};
+        /// Whether the fragment shader exports a stencil reference.
+        bool writes_stencil{};
+    };
+
+    /// Returns the pipeline for the format pair, building it on first use, or nullptr when the
+    /// pair is unsupported. Unsupported pairs are remembered with a null program.
+    Pipeline* GetPipeline(VideoCore::Surface::PixelFormat src_format,
+                          VideoCore::Surface::PixelFormat dst_format);
+
+    std::unordered_map<u32, Pipeline> pipelines;
+    OGLVertexArray vertex_array;
+    OGLFramebuffer draw_framebuffer;
+    OGLSampler sampler;
+};
+
+} // namespace OpenGL
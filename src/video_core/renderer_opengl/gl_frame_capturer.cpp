@@ -0,0 +1,127 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <fmt/format.h>
+
+#include "common/common_paths.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_opengl/gl_frame_capturer.h"
+
+namespace OpenGL {
+
+// Long enough to outlast any realistic frame; the wait only bites when capture outruns the GPU by
+// the entire slot ring.
+constexpr GLuint64 FENCE_TIMEOUT_NS = 1'000'000'000;
+
+FrameCapturer::FrameCapturer() {
+    write_thread = std::thread([this] { WriteThread(); });
+}
+
+FrameCapturer::~FrameCapturer() {
+    // Collect any readbacks still in flight so the tail frames of a run aren't lost. Requires the
+    // GL context to still be current, which holds where the renderer is torn down.
+    for (std::size_t i = 0; i < NUM_SLOTS; ++i) {
+        Slot& slot = slots[(next_slot + i) % NUM_SLOTS];
+        if (slot.fence != nullptr) {
+            glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+            HarvestSlot(slot);
+        }
+    }
+
+    // Wake the writer with an empty sentinel frame and wait for the queue to drain
+    write_queue.Push(PendingFrame{});
+    write_thread.join();
+}
+
+void FrameCapturer::Capture(u32 width, u32 height, u64 frame_index) {
+    Slot& slot = slots[next_slot];
+    next_slot = (next_slot + 1) % NUM_SLOTS;
+
+    if (slot.fence != nullptr) {
+        // This readback was queued NUM_SLOTS captures ago, so the fence has normally long
+        // signaled and this does not block.
+        glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, FENCE_TIMEOUT_NS);
+        HarvestSlot(slot);
+    }
+
+    const std::size_t size = static_cast<std::size_t>(width) * height * 4;
+    if (slot.pbo.handle == 0) {
+        slot.pbo.Create();
+    }
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo.handle);
+    if (slot.buffer_size != size) {
+        glBufferData(GL_PIXEL_PACK_BUFFER, size, nullptr, GL_STREAM_READ);
+        slot.buffer_size = size;
+    }
+
+    // With a pack buffer bound this only enqueues the transfer; the pixels arrive in the buffer
+    // whenever the GPU finishes the frame.
+    glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    slot.width = width;
+    slot.height = height;
+    slot.frame_index = frame_index;
+}
+
+void FrameCapturer::HarvestSlot(Slot& slot) {
+    glDeleteSync(slot.fence);
+    slot.fence = nullptr;
+
+    PendingFrame frame;
+    frame.width = slot.width;
+    frame.height = slot.height;
+    frame.frame_index = slot.frame_index;
+    frame.pixels.resize(slot.buffer_size);
+
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo.handle);
+    glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(slot.buffer_size),
+                       frame.pixels.data());
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    write_queue.Push(std::move(frame));
+}
+
+void FrameCapturer::WriteThread() {
+    const std::string dump_dir =
+        FileUtil::GetUserPath(FileUtil::UserPath::DumpDir) + "frames" DIR_SEP;
+    FileUtil::CreateFullPath(dump_dir);
+
+    while (true) {
+        const PendingFrame frame = write_queue.PopWait();
+        if (frame.pixels.empty()) {
+            // Shutdown sentinel
+            break;
+        }
+
+        const std::string path = fmt::format("{}frame_{:08}.ppm", dump_dir, frame.frame_index);
+        FileUtil::IOFile file(path, "wb");
+        if (!file.IsOpen()) {
+            LOG_ERROR(Render_OpenGL, "Failed to open frame dump file {}", path);
+            continue;
+        }
+
+        const std::string header = fmt::format("P6\n{} {}\n255\n", frame.width, frame.height);
+        file.WriteBytes(header.data(), header.size());
+
+        // OpenGL returns rows bottom-up; emit them top-down and drop alpha for the PPM
+        std::vector<u8> row(static_cast<std::size_t>(frame.width) * 3);
+        for (u32 y = 0; y < frame.height; ++y) {
+            const u8* const src =
+                frame.pixels.data() +
+                static_cast<std::size_t>(frame.height - 1 - y) * frame.width * 4;
+            for (u32 x = 0; x < frame.width; ++x) {
+                row[x * 3 + 0] = src[x * 4 + 0];
+                row[x * 3 + 1] = src[x * 4 + 1];
+                row[x * 3 + 2] = src[x * 4 + 2];
+            }
+            file.WriteBytes(row.data(), row.size());
+        }
+    }
+}
+
+} // namespace OpenGL
@@ -0,0 +1,66 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <thread>
+#include <vector>
+#include <glad/glad.h>
+#include "common/common_types.h"
+#include "common/threadsafe_queue.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
+
+namespace OpenGL {
+
+/**
+ * Reads back presented frames through a ring of pixel-pack buffers guarded by GL fences and
+ * writes them to the dump directory from a background thread. A frame's buffer is only mapped
+ * once its fence has signaled, which happens a few presents after the readback was queued, so
+ * capturing does not force a pipeline drain on the frame being captured.
+ */
+class FrameCapturer {
+public:
+    FrameCapturer();
+    ~FrameCapturer();
+
+    /// Queues an asynchronous readback of the current read framebuffer. Call with the presented
+    /// frame still bound, after drawing and before the buffer swap.
+    void Capture(u32 width, u32 height, u64 frame_index);
+
+private:
+    struct Slot {
+        OGLBuffer pbo;
+        GLsync fence = nullptr;
+        u32 width = 0;
+        u32 height = 0;
+        u64 frame_index = 0;
+        std::size_t buffer_size = 0;
+    };
+
+    struct PendingFrame {
+        std::vector<u8> pixels; ///< Tightly packed RGBA rows, bottom-up as OpenGL reads them
+        u32 width;
+        u32 height;
+        u64 frame_index;
+    };
+
+    /// Retrieves the pixels of a signaled slot and hands them to the writer thread.
+    void HarvestSlot(Slot& slot);
+
+    /// Writer thread body: encodes queued frames and writes them to disk.
+    void WriteThread();
+
+    /// Number of frames a readback may stay in flight before it is collected.
+    static constexpr std::size_t NUM_SLOTS = 4;
+
+    std::array<Slot, NUM_SLOTS> slots;
+    std::size_t next_slot = 0;
+
+    Common::SPSCQueue<PendingFrame> write_queue;
+    std::thread write_thread;
+};
+
+} // namespace OpenGL
@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "core/core.h"
@@ -16,6 +17,24 @@ namespace OpenGL {
 constexpr u32 TRIANGLES_PER_QUAD = 6;
 constexpr std::array<u32, TRIANGLES_PER_QUAD> QUAD_MAP = {0, 1, 2, 0, 2, 3};
 
+namespace {
+
+/// Expands guest quad indices into triangle indices. Templated on the index type so the inner
+/// loop compiles to fixed-size loads and stores instead of per-index memcpy calls.
+template <typename T>
+void ExpandQuadIndices(u8* dst_pointer, const u8* source, u32 quad_count) {
+    const T* const src{reinterpret_cast<const T*>(source)};
+    T* dst{reinterpret_cast<T*>(dst_pointer)};
+    for (u32 primitive = 0; primitive < quad_count; ++primitive) {
+        const T* const quad{src + primitive * 4};
+        for (std::size_t i = 0; i < TRIANGLES_PER_QUAD; ++i) {
+            *dst++ = quad[QUAD_MAP[i]];
+        }
+    }
+}
+
+} // Anonymous namespace
+
 PrimitiveAssembler::PrimitiveAssembler(OGLBufferCache& buffer_cache) : buffer_cache(buffer_cache) {}
 
 PrimitiveAssembler::~PrimitiveAssembler() = default;
@@ -25,18 +44,27 @@ std::size_t PrimitiveAssembler::CalculateQuadSize(u32 count) const {
     return (count / 4) * TRIANGLES_PER_QUAD * sizeof(GLuint);
 }
 
-GLintptr PrimitiveAssembler::MakeQuadArray(u32 first, u32 count) {
+GLintptr PrimitiveAssembler::MakeQuadArray(u32 count) {
     const std::size_t size{CalculateQuadSize(count)};
-    auto [dst_pointer, index_offset] = buffer_cache.ReserveMemory(size);
+    const u32 quad_count{count / 4};
 
-    for (u32 primitive = 0; primitive < count / 4; ++primitive) {
-        for (u32 i = 0; i < TRIANGLES_PER_QUAD; ++i) {
-            const u32 index = first + primitive * 4 + QUAD_MAP[i];
-            std::memcpy(dst_pointer, &index, sizeof(index));
-            dst_pointer += sizeof(index);
+    // Extend the canonical pattern when this draw needs more quads than any previous one; the
+    // shared prefix is identical for every draw, so smaller draws reuse it as-is.
+    const std::size_t pattern_size{quad_count * TRIANGLES_PER_QUAD};
+    if (quad_array_pattern.size() < pattern_size) {
+        const u32 generated_quads{
+            static_cast<u32>(quad_array_pattern.size() / TRIANGLES_PER_QUAD)};
+        quad_array_pattern.resize(pattern_size);
+        for (u32 primitive = generated_quads; primitive < quad_count; ++primitive) {
+            for (std::size_t i = 0; i < TRIANGLES_PER_QUAD; ++i) {
+                quad_array_pattern[primitive * TRIANGLES_PER_QUAD + i] =
+                    primitive * 4 + QUAD_MAP[i];
+            }
         }
     }
 
+    auto [dst_pointer, index_offset] = buffer_cache.ReserveMemory(size);
+    std::memcpy(dst_pointer, quad_array_pattern.data(), size);
     return index_offset;
 }
 
@@ -49,14 +77,18 @@ GLintptr PrimitiveAssembler::MakeQuadIndexed(Tegra::GPUVAddr gpu_addr, std::size
     const std::optional<VAddr> cpu_addr{memory_manager.GpuToCpuAddress(gpu_addr)};
     const u8* source{Memory::GetPointer(*cpu_addr)};
 
-    for (u32 primitive = 0; primitive < count / 4; ++primitive) {
-        for (std::size_t i = 0; i < TRIANGLES_PER_QUAD; ++i) {
-            const u32 index = primitive * 4 + QUAD_MAP[i];
-            const u8* src_offset = source + (index * index_size);
-
-            std::memcpy(dst_pointer, src_offset, index_size);
-            dst_pointer += index_size;
-        }
+    switch (index_size) {
+    case 1:
+        ExpandQuadIndices<u8>(dst_pointer, source, count / 4);
+        break;
+    case 2:
+        ExpandQuadIndices<u16>(dst_pointer, source, count / 4);
+        break;
+    case 4:
+        ExpandQuadIndices<u32>(dst_pointer, source, count / 4);
+        break;
+    default:
+        UNREACHABLE_MSG("Invalid quad index size {}", index_size);
     }
 
     return index_offset;
@@ -22,12 +22,17 @@ public:
     /// Calculates the size required by MakeQuadArray and MakeQuadIndexed.
     std::size_t CalculateQuadSize(u32 count) const;
 
-    GLintptr MakeQuadArray(u32 first, u32 count);
+    /// Writes quad-to-triangle indices starting at vertex zero; callers apply the draw's first
+    /// vertex through the base vertex instead, so the generated pattern is reusable across draws.
+    GLintptr MakeQuadArray(u32 count);
 
     GLintptr MakeQuadIndexed(Tegra::GPUVAddr gpu_addr, std::size_t index_size, u32 count);
 
 private:
     OGLBufferCache& buffer_cache;
+
+    /// Canonical quad-to-triangle index pattern, grown on demand and reused across draws.
+    std::vector<u32> quad_array_pattern;
 };
 
 } // namespace OpenGL
\ No newline at end of file
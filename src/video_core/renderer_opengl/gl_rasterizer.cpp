@@ -4,6 +4,7 @@
 
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <string_view>
@@ -12,13 +13,17 @@
 #include <glad/glad.h>
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/host_trace.h"
+#include "common/cityhash.h"
 #include "common/logging/log.h"
 #include "common/math_util.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/frontend/emu_window.h"
 #include "core/hle/kernel/process.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/renderer_opengl/gl_rasterizer.h"
@@ -102,12 +107,6 @@ struct FramebufferCacheKey {
 RasterizerOpenGL::RasterizerOpenGL(Core::Frontend::EmuWindow& window, ScreenInfo& info)
     : res_cache{*this}, shader_cache{*this}, emu_window{window}, screen_info{info},
       buffer_cache(*this, STREAM_BUFFER_SIZE) {
-    // Create sampler objects
-    for (std::size_t i = 0; i < texture_samplers.size(); ++i) {
-        texture_samplers[i].Create();
-        state.texture_units[i].sampler = texture_samplers[i].sampler.handle;
-    }
-
     OpenGLState::ApplyDefaultState();
 
     shader_program_manager = std::make_unique<GLShader::ProgramManager>();
@@ -268,8 +267,9 @@ DrawParameters RasterizerOpenGL::SetupDraw() {
             // MakeQuadArray always generates u32 indexes
             params.index_format = GL_UNSIGNED_INT;
             params.count = (regs.vertex_buffer.count / 4) * 6;
-            params.index_buffer_offset =
-                primitive_assembler.MakeQuadArray(regs.vertex_buffer.first, params.count);
+            params.index_buffer_offset = primitive_assembler.MakeQuadArray(params.count);
+            // The generated indices start at vertex zero; apply the first vertex here instead.
+            params.base_vertex = static_cast<GLint>(regs.vertex_buffer.first);
         }
         return params;
     }
@@ -291,14 +291,10 @@ DrawParameters RasterizerOpenGL::SetupDraw() {
     return params;
 }
 
-void RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
+bool RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
     MICROPROFILE_SCOPE(OpenGL_Shader);
     const auto& gpu = Core::System::GetInstance().GPU().Maxwell3D();
 
-    // Next available bindpoints to use when uploading the const buffers and textures to the GLSL
-    // shaders. The constbuffer bindpoint starts after the shader stage configuration bind points.
-    u32 current_constbuffer_bindpoint = Tegra::Engines::Maxwell3D::Regs::MaxShaderStage;
-    u32 current_texture_bindpoint = 0;
     std::array<bool, Maxwell::NumClipDistances> clip_distances{};
 
     for (std::size_t index = 0; index < Maxwell::MaxShaderProgram; ++index) {
@@ -319,15 +315,39 @@ void RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
 
         GLShader::MaxwellUniformData ubo{};
         ubo.SetFromRegs(gpu.state.shader_stages[stage]);
-        const GLintptr offset = buffer_cache.UploadHostMemory(
-            &ubo, sizeof(ubo), static_cast<std::size_t>(uniform_buffer_alignment));
 
-        // Bind the buffer
-        glBindBufferRange(GL_UNIFORM_BUFFER, static_cast<GLuint>(stage), buffer_cache.GetHandle(),
-                          offset, static_cast<GLsizeiptr>(sizeof(ubo)));
+        // The block is small but it is one more stream-buffer bump and driver call on every
+        // draw; reuse the previous upload and binding while the contents are unchanged. The
+        // shadow copy is zero-initialized, so padding always compares equal.
+        auto& cached = stage_uniform_cache[stage];
+        if (!cached.valid || std::memcmp(&ubo, &cached.data, sizeof(ubo)) != 0) {
+            cached.data = ubo;
+            cached.offset = buffer_cache.UploadHostMemory(
+                &ubo, sizeof(ubo), static_cast<std::size_t>(uniform_buffer_alignment));
+            cached.valid = true;
+
+            // Bind the buffer
+            glBindBufferRange(GL_UNIFORM_BUFFER, static_cast<GLuint>(stage),
+                              buffer_cache.GetHandle(), cached.offset,
+                              static_cast<GLsizeiptr>(sizeof(ubo)));
+        }
 
         Shader shader{shader_cache.GetStageProgram(program)};
 
+        if (program == Maxwell::ShaderProgram::Geometry &&
+            shader->IsPassthroughGeometryShader(primitive_mode)) {
+            // The shader only copies its input primitive to the output stream - drop the stage
+            // entirely and let the vertices pass through directly.
+            shader_program_manager->UseTrivialGeometryShader();
+            continue;
+        }
+
+        if (!shader->IsProgramReady()) {
+            // The program is still linking on one of the driver's compiler threads - skip this
+            // draw instead of stalling the emulation thread waiting for it.
+            return false;
+        }
+
         switch (program) {
         case Maxwell::ShaderProgram::VertexA:
         case Maxwell::ShaderProgram::VertexB: {
@@ -352,13 +372,10 @@ void RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
         }
 
         // Configure the const buffers for this shader stage.
-        current_constbuffer_bindpoint =
-            SetupConstBuffers(static_cast<Maxwell::ShaderStage>(stage), shader, primitive_mode,
-                              current_constbuffer_bindpoint);
+        SetupConstBuffers(static_cast<Maxwell::ShaderStage>(stage), shader);
 
         // Configure the textures for this shader stage.
-        current_texture_bindpoint = SetupTextures(static_cast<Maxwell::ShaderStage>(stage), shader,
-                                                  primitive_mode, current_texture_bindpoint);
+        SetupTextures(static_cast<Maxwell::ShaderStage>(stage), shader);
 
         // Workaround for Intel drivers.
         // When a clip distance is enabled but not set in the shader it crops parts of the screen
@@ -376,6 +393,7 @@ void RasterizerOpenGL::SetupShaders(GLenum primitive_mode) {
     }
 
     SyncClipEnabled(clip_distances);
+    return true;
 }
 
 void RasterizerOpenGL::SetupCachedFramebuffer(const FramebufferCacheKey& fbkey,
@@ -565,7 +583,52 @@ void RasterizerOpenGL::ConfigureFramebuffers(OpenGLState& current_state, bool us
     SyncViewport(current_state);
 }
 
+void RasterizerOpenGL::ConfigureClearFramebuffer(OpenGLState& current_state, bool using_color_fb,
+                                                 bool using_depth_fb) {
+    auto& gpu = Core::System::GetInstance().GPU().Maxwell3D();
+    const auto& regs = gpu.regs;
+    const std::size_t render_target = regs.clear_buffers.RT.Value();
+
+    if (gpu.dirty_flags.IsStateGroupDirty(Tegra::Engines::Maxwell3D::DirtyGroup::RenderTargets)) {
+        clear_target_cache.valid = false;
+    }
+
+    auto& cache = clear_target_cache;
+    if (cache.valid && cache.render_target == render_target &&
+        cache.using_color == using_color_fb && cache.using_depth == using_depth_fb) {
+        // Only the clear parameters changed since the last clear; rebind the framebuffer it
+        // resolved and refresh the modification marks without walking the surface cache.
+        if (cache.color_surface) {
+            cache.color_surface->MarkAsModified(true, res_cache);
+        }
+        if (cache.depth_surface) {
+            cache.depth_surface->MarkAsModified(true, res_cache);
+        }
+        current_state.draw.draw_framebuffer = cache.framebuffer;
+        current_state.framebuffer_srgb.enabled = cache.framebuffer_srgb;
+        SyncViewport(current_state);
+        return;
+    }
+
+    ConfigureFramebuffers(current_state, using_color_fb, using_depth_fb, false, render_target);
+
+    // The surface cache is warm after the configuration walk, so fetching the surfaces again
+    // for the cache only costs a lookup
+    cache.color_surface =
+        using_color_fb ? res_cache.GetColorBufferSurface(render_target, false) : nullptr;
+    cache.depth_surface = using_depth_fb ? res_cache.GetDepthBufferSurface(false) : nullptr;
+    cache.render_target = render_target;
+    cache.using_color = using_color_fb;
+    cache.using_depth = using_depth_fb;
+    cache.framebuffer = current_state.draw.draw_framebuffer;
+    cache.framebuffer_srgb = current_state.framebuffer_srgb.enabled;
+    cache.valid = true;
+    gpu.dirty_flags.MarkStateGroupClean(Tegra::Engines::Maxwell3D::DirtyGroup::RenderTargets);
+}
+
 void RasterizerOpenGL::Clear() {
+    FlushPendingDraws();
+
     const auto prev_state{state};
     SCOPE_EXIT({ prev_state.Apply(); });
 
@@ -632,8 +695,7 @@ void RasterizerOpenGL::Clear() {
 
     ScopeAcquireGLContext acquire_context{emu_window};
 
-    ConfigureFramebuffers(clear_state, use_color, use_depth || use_stencil, false,
-                          regs.clear_buffers.RT.Value());
+    ConfigureClearFramebuffer(clear_state, use_color, use_depth || use_stencil);
     if (regs.clear_flags.scissor) {
         SyncScissorTest(clear_state);
     }
@@ -662,27 +724,52 @@ void RasterizerOpenGL::DrawArrays() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_Drawing);
+    HOST_TRACE_SCOPE("OpenGL_Drawing");
+
+    static auto& draw_counter = Common::GetPerfCounter("gpu_draws");
+    draw_counter.Add();
+
+    // Draws can recycle the surfaces the last clear resolved
+    clear_target_cache.valid = false;
+
     auto& gpu = Core::System::GetInstance().GPU().Maxwell3D();
     const auto& regs = gpu.regs;
 
     ScopeAcquireGLContext acquire_context{emu_window};
 
+    if (TryMergeDraw()) {
+        accelerate_draw = AccelDraw::Disabled;
+        return;
+    }
+
+    // The new draw needs its own state setup, so the previous batch has to land first
+    FlushPendingDraws();
+
     ConfigureFramebuffers(state);
-    SyncColorMask();
-    SyncFragmentColorClampState();
-    SyncMultiSampleState();
-    SyncDepthTestState();
-    SyncStencilTestState();
-    SyncBlendState();
-    SyncLogicOpState();
-    SyncCullMode();
-    SyncPrimitiveRestart();
+
+    // Only re-derive the GL state of groups whose Maxwell registers actually changed
+    using DirtyGroup = Tegra::Engines::Maxwell3D::DirtyGroup;
+    const auto sync_state_group = [&](DirtyGroup group, auto&& sync) {
+        if (gpu.dirty_flags.IsStateGroupDirty(group)) {
+            sync();
+            gpu.dirty_flags.MarkStateGroupClean(group);
+        }
+    };
+    sync_state_group(DirtyGroup::ColorMask, [this] { SyncColorMask(); });
+    sync_state_group(DirtyGroup::FragmentColorClamp, [this] { SyncFragmentColorClampState(); });
+    sync_state_group(DirtyGroup::MultisampleControl, [this] { SyncMultiSampleState(); });
+    sync_state_group(DirtyGroup::DepthTest, [this] { SyncDepthTestState(); });
+    sync_state_group(DirtyGroup::StencilTest, [this] { SyncStencilTestState(); });
+    sync_state_group(DirtyGroup::BlendState, [this] { SyncBlendState(); });
+    sync_state_group(DirtyGroup::LogicOp, [this] { SyncLogicOpState(); });
+    sync_state_group(DirtyGroup::CullMode, [this] { SyncCullMode(); });
+    sync_state_group(DirtyGroup::PrimitiveRestart, [this] { SyncPrimitiveRestart(); });
     SyncScissorTest(state);
     // Alpha Testing is synced on shaders.
     SyncTransformFeedback();
-    SyncPointState();
+    sync_state_group(DirtyGroup::PointSize, [this] { SyncPointState(); });
     CheckAlphaTests();
-    SyncPolygonOffset();
+    sync_state_group(DirtyGroup::PolygonOffset, [this] { SyncPolygonOffset(); });
     // TODO(bunnei): Sync framebuffer_scale uniform here
     // TODO(bunnei): Sync scissorbox uniform(s) here
 
@@ -712,33 +799,139 @@ void RasterizerOpenGL::DrawArrays() {
         Common::AlignUp<std::size_t>(buffer_size, 4) +
         (sizeof(GLShader::MaxwellUniformData) + uniform_buffer_alignment) * Maxwell::MaxShaderStage;
 
-    // Add space for at least 18 constant buffers
-    buffer_size += Maxwell::MaxConstBuffers * (MaxConstbufferSize + uniform_buffer_alignment);
-
     bool invalidate = buffer_cache.Map(buffer_size);
     if (invalidate) {
         // As all cached buffers are invalidated, we need to recheck their state.
         gpu.dirty_flags.vertex_array = 0xFFFFFFFF;
+        for (auto& cached : stage_uniform_cache) {
+            cached.valid = false;
+        }
     }
 
     SetupVertexFormat();
     SetupVertexBuffer();
     DrawParameters params = SetupDraw();
-    SetupShaders(params.primitive_mode);
+    if (!SetupShaders(params.primitive_mode)) {
+        buffer_cache.Unmap();
+        return;
+    }
 
     buffer_cache.Unmap();
 
     shader_program_manager->ApplyTo(state);
     state.Apply();
 
-    // Execute draw call
-    params.DispatchDraw();
+    // Defer the draw call; consecutive draws that only move the vertex or index window are
+    // appended to this batch and submitted as one multi-draw by FlushPendingDraws.
+    pending_draws.push_back(params);
+    pending_draw_topology = regs.draw.topology;
+
+    accelerate_draw = AccelDraw::Disabled;
+}
+
+bool RasterizerOpenGL::TryMergeDraw() {
+    auto& gpu = Core::System::GetInstance().GPU().Maxwell3D();
+    const auto& regs = gpu.regs;
+
+    // The engine guarantees that while non_draw_writes is clear, no register outside the
+    // draw-parameter window and no guest memory changed since the batched draws were set up.
+    if (pending_draws.empty() || gpu.dirty_flags.non_draw_writes) {
+        return false;
+    }
+
+    // Multi-draws cannot express per-draw instance offsets, and the quad path owns its own
+    // index generation; neither is worth merging.
+    if (gpu.state.current_instance != 0 || pending_draws.front().current_instance != 0) {
+        return false;
+    }
+    if (regs.draw.topology != pending_draw_topology ||
+        regs.draw.topology == Maxwell::PrimitiveTopology::Quads) {
+        return false;
+    }
+
+    const bool is_indexed = accelerate_draw == AccelDraw::Indexed;
+    const auto& first_draw = pending_draws.front();
+    if (is_indexed != first_draw.use_indexed) {
+        return false;
+    }
+
+    DrawParameters params{};
+    params.primitive_mode = first_draw.primitive_mode;
+    params.use_indexed = is_indexed;
+
+    if (is_indexed) {
+        if (MaxwellToGL::IndexFormat(regs.index_array.format) != first_draw.index_format) {
+            return false;
+        }
+
+        // The batched draws still reference their stream buffer uploads, so the new index data
+        // must not recycle the buffer from under them.
+        const std::size_t index_size = Common::AlignUp(CalculateIndexBufferSize(), 4);
+        if (!buffer_cache.CanMapWithoutInvalidation(index_size)) {
+            return false;
+        }
+
+        MICROPROFILE_SCOPE(OpenGL_Index);
+        buffer_cache.Map(index_size);
+        params.index_format = first_draw.index_format;
+        params.count = regs.index_array.count;
+        params.index_buffer_offset =
+            buffer_cache.UploadMemory(regs.index_array.IndexStart(), CalculateIndexBufferSize());
+        params.base_vertex = static_cast<GLint>(regs.vb_element_base);
+        buffer_cache.Unmap();
+    } else {
+        params.count = regs.vertex_buffer.count;
+        params.vertex_first = regs.vertex_buffer.first;
+    }
+
+    pending_draws.push_back(params);
+    return true;
+}
+
+void RasterizerOpenGL::FlushPendingDraws() {
+    if (pending_draws.empty()) {
+        return;
+    }
+
+    if (pending_draws.size() == 1) {
+        pending_draws.front().DispatchDraw();
+    } else {
+        static auto& merged_counter = Common::GetPerfCounter("gpu_merged_draws");
+        merged_counter.Add(pending_draws.size());
+
+        const auto drawcount = static_cast<GLsizei>(pending_draws.size());
+        const auto& first_draw = pending_draws.front();
+        std::vector<GLsizei> counts;
+        counts.reserve(pending_draws.size());
+
+        if (first_draw.use_indexed) {
+            std::vector<const void*> offsets;
+            std::vector<GLint> base_vertices;
+            offsets.reserve(pending_draws.size());
+            base_vertices.reserve(pending_draws.size());
+            for (const auto& draw : pending_draws) {
+                counts.push_back(draw.count);
+                offsets.push_back(reinterpret_cast<const void*>(draw.index_buffer_offset));
+                base_vertices.push_back(draw.base_vertex);
+            }
+            glMultiDrawElementsBaseVertex(first_draw.primitive_mode, counts.data(),
+                                          first_draw.index_format, offsets.data(), drawcount,
+                                          base_vertices.data());
+        } else {
+            std::vector<GLint> firsts;
+            firsts.reserve(pending_draws.size());
+            for (const auto& draw : pending_draws) {
+                counts.push_back(draw.count);
+                firsts.push_back(draw.vertex_first);
+            }
+            glMultiDrawArrays(first_draw.primitive_mode, firsts.data(), counts.data(), drawcount);
+        }
+    }
+    pending_draws.clear();
 
     // Disable scissor test
     state.viewports[0].scissor.enabled = false;
 
-    accelerate_draw = AccelDraw::Disabled;
-
     // Unbind textures for potential future use as framebuffer attachments
     for (auto& texture_unit : state.texture_units) {
         texture_unit.Unbind();
@@ -746,12 +939,62 @@ void RasterizerOpenGL::DrawArrays() {
     state.Apply();
 }
 
-void RasterizerOpenGL::FlushAll() {}
+void RasterizerOpenGL::FlushAll() {
+    FlushPendingDraws();
+    RunDeferredMemoryWrites(true);
+}
+
+void RasterizerOpenGL::DeferMemoryWrite(std::function<void()> do_write) {
+    if (GetSettings().use_accurate_gpu_emulation) {
+        // Land the write synchronously; some titles poll the result right after the method
+        do_write();
+        return;
+    }
+
+    // Retire whatever has completed in the meantime so the queue stays short
+    RunDeferredMemoryWrites(false);
+
+    OGLSync fence;
+    fence.Create();
+    deferred_memory_writes.emplace_back(std::move(fence), std::move(do_write));
+}
+
+void RasterizerOpenGL::RunDeferredMemoryWrites(bool blocking) {
+    while (!deferred_memory_writes.empty()) {
+        auto& [fence, do_write] = deferred_memory_writes.front();
+
+        // Poll first: by the time the guest looks at a query result, the GPU has usually long
+        // completed the commands in front of it.
+        if (glClientWaitSync(fence.handle, 0, 0) == GL_TIMEOUT_EXPIRED) {
+            if (!blocking) {
+                // Writes land in submission order, so nothing behind this one is ready either
+                return;
+            }
+            glClientWaitSync(fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        }
+
+        do_write();
+        deferred_memory_writes.pop_front();
+    }
+}
+
+const Settings::Values& RasterizerOpenGL::GetSettings() {
+    const u32 generation{Settings::GetGeneration()};
+    if (!settings_snapshot || settings_generation != generation) {
+        settings_snapshot = Settings::AcquireSnapshot();
+        settings_generation = generation;
+    }
+    return *settings_snapshot;
+}
 
 void RasterizerOpenGL::FlushRegion(VAddr addr, u64 size) {
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    FlushPendingDraws();
+
+    // Any pending query/semaphore writes must land before the CPU inspects guest memory
+    RunDeferredMemoryWrites(true);
 
-    if (Settings::values.use_accurate_gpu_emulation) {
+    if (GetSettings().use_accurate_gpu_emulation) {
         // Only flush if use_accurate_gpu_emulation is enabled, as it incurs a performance hit
         res_cache.FlushRegion(addr, size);
     }
@@ -759,6 +1002,10 @@ void RasterizerOpenGL::FlushRegion(VAddr addr, u64 size) {
 
 void RasterizerOpenGL::InvalidateRegion(VAddr addr, u64 size) {
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+
+    // Batched draws may still sample from the surfaces about to be invalidated
+    FlushPendingDraws();
+    clear_target_cache.valid = false;
     res_cache.InvalidateRegion(addr, size);
     shader_cache.InvalidateRegion(addr, size);
     buffer_cache.InvalidateRegion(addr, size);
@@ -772,12 +1019,16 @@ void RasterizerOpenGL::FlushAndInvalidateRegion(VAddr addr, u64 size) {
 bool RasterizerOpenGL::AccelerateSurfaceCopy(const Tegra::Engines::Fermi2D::Regs::Surface& src,
                                              const Tegra::Engines::Fermi2D::Regs::Surface& dst) {
     MICROPROFILE_SCOPE(OpenGL_Blits);
+    FlushPendingDraws();
 
-    if (Settings::values.use_accurate_gpu_emulation) {
+    if (GetSettings().use_accurate_gpu_emulation) {
         // Skip the accelerated copy and perform a slow but more accurate copy
         return false;
     }
 
+    // The copy may create or recycle the surfaces the last clear resolved
+    clear_target_cache.valid = false;
+
     res_cache.FermiCopySurface(src, dst);
     return true;
 }
@@ -794,12 +1045,27 @@ bool RasterizerOpenGL::AccelerateDisplay(const Tegra::FramebufferConfig& config,
     }
 
     MICROPROFILE_SCOPE(OpenGL_CacheManagement);
+    FlushPendingDraws();
 
-    const auto& surface{res_cache.TryFindFramebufferSurface(framebuffer_addr)};
+    auto surface{res_cache.TryFindFramebufferSurface(framebuffer_addr)};
     if (!surface) {
-        return {};
+        if (Settings::values.use_cpu_framebuffer_copy) {
+            // Debug fallback: let the renderer deswizzle and upload the framebuffer on the CPU
+            return {};
+        }
+        // Load the framebuffer into the cache so presentation samples the surface texture
+        // directly; subsequent frames hit the lookup above without any further copies.
+        surface = res_cache.GetFramebufferSurface(config, framebuffer_addr);
+        if (!surface) {
+            return {};
+        }
     }
 
+    // Presentation runs after the frame's rendering, so this is the spot to start an async
+    // readback for surfaces the guest CPU reads back (e.g. screenshot or video capture); the
+    // flush triggered by that read then completes from the staged copy.
+    surface->StageReadback();
+
     // Verify that the cached surface is the same size and format as the requested framebuffer
     const auto& params{surface->GetSurfaceParams()};
     const auto& pixel_format{
@@ -810,114 +1076,82 @@ bool RasterizerOpenGL::AccelerateDisplay(const Tegra::FramebufferConfig& config,
 
     screen_info.display_texture = surface->Texture().handle;
 
+    // Presentation marks a frame boundary: settle the surface cache back under its budget
+    res_cache.EvictOverBudget();
+
     return true;
 }
 
-void RasterizerOpenGL::SamplerInfo::Create() {
-    sampler.Create();
-    mag_filter = min_filter = Tegra::Texture::TextureFilter::Linear;
-    wrap_u = wrap_v = wrap_p = Tegra::Texture::WrapMode::Wrap;
-    uses_depth_compare = false;
-    depth_compare_func = Tegra::Texture::DepthCompareFunc::Never;
-
-    // default is GL_LINEAR_MIPMAP_LINEAR
-    glSamplerParameteri(sampler.handle, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    // Other attributes have correct defaults
-    glSamplerParameteri(sampler.handle, GL_TEXTURE_COMPARE_FUNC, GL_NEVER);
+std::size_t RasterizerOpenGL::TSCEntryHash::operator()(
+    const Tegra::Texture::TSCEntry& entry) const {
+    static_assert(std::is_trivially_copyable_v<Tegra::Texture::TSCEntry>);
+    return static_cast<std::size_t>(
+        Common::CityHash64(reinterpret_cast<const char*>(&entry), sizeof(entry)));
 }
 
-void RasterizerOpenGL::SamplerInfo::SyncWithConfig(const Tegra::Texture::TSCEntry& config) {
-    const GLuint s = sampler.handle;
-    if (mag_filter != config.mag_filter) {
-        mag_filter = config.mag_filter;
-        glSamplerParameteri(
-            s, GL_TEXTURE_MAG_FILTER,
-            MaxwellToGL::TextureFilterMode(mag_filter, Tegra::Texture::TextureMipmapFilter::None));
-    }
-    if (min_filter != config.min_filter || mip_filter != config.mip_filter) {
-        min_filter = config.min_filter;
-        mip_filter = config.mip_filter;
-        glSamplerParameteri(s, GL_TEXTURE_MIN_FILTER,
-                            MaxwellToGL::TextureFilterMode(min_filter, mip_filter));
-    }
-
-    if (wrap_u != config.wrap_u) {
-        wrap_u = config.wrap_u;
-        glSamplerParameteri(s, GL_TEXTURE_WRAP_S, MaxwellToGL::WrapMode(wrap_u));
-    }
-    if (wrap_v != config.wrap_v) {
-        wrap_v = config.wrap_v;
-        glSamplerParameteri(s, GL_TEXTURE_WRAP_T, MaxwellToGL::WrapMode(wrap_v));
-    }
-    if (wrap_p != config.wrap_p) {
-        wrap_p = config.wrap_p;
-        glSamplerParameteri(s, GL_TEXTURE_WRAP_R, MaxwellToGL::WrapMode(wrap_p));
-    }
-
-    if (uses_depth_compare != (config.depth_compare_enabled == 1)) {
-        uses_depth_compare = (config.depth_compare_enabled == 1);
-        if (uses_depth_compare) {
-            glSamplerParameteri(s, GL_TEXTURE_COMPARE_MODE, GL_COMPARE_REF_TO_TEXTURE);
-        } else {
-            glSamplerParameteri(s, GL_TEXTURE_COMPARE_MODE, GL_NONE);
-        }
-    }
+bool RasterizerOpenGL::TSCEntryEqual::operator()(const Tegra::Texture::TSCEntry& lhs,
+                                                 const Tegra::Texture::TSCEntry& rhs) const {
+    return std::memcmp(&lhs, &rhs, sizeof(lhs)) == 0;
+}
 
-    if (depth_compare_func != config.depth_compare_func) {
-        depth_compare_func = config.depth_compare_func;
-        glSamplerParameteri(s, GL_TEXTURE_COMPARE_FUNC,
-                            MaxwellToGL::DepthCompareFunc(depth_compare_func));
+GLuint RasterizerOpenGL::GetSampler(const Tegra::Texture::TSCEntry& config) {
+    const auto [iter, is_new] = sampler_cache.try_emplace(config);
+    OGLSampler& sampler = iter->second;
+    if (!is_new) {
+        return sampler.handle;
     }
 
-    GLvec4 new_border_color;
+    // Cached samplers are immutable: the full state is applied once here and every texture unit
+    // that resolves to the same TSC config shares the object.
+    sampler.Create();
+    const GLuint s = sampler.handle;
+    glSamplerParameteri(
+        s, GL_TEXTURE_MAG_FILTER,
+        MaxwellToGL::TextureFilterMode(config.mag_filter, Tegra::Texture::TextureMipmapFilter::None));
+    glSamplerParameteri(s, GL_TEXTURE_MIN_FILTER,
+                        MaxwellToGL::TextureFilterMode(config.min_filter, config.mip_filter));
+    glSamplerParameteri(s, GL_TEXTURE_WRAP_S, MaxwellToGL::WrapMode(config.wrap_u));
+    glSamplerParameteri(s, GL_TEXTURE_WRAP_T, MaxwellToGL::WrapMode(config.wrap_v));
+    glSamplerParameteri(s, GL_TEXTURE_WRAP_R, MaxwellToGL::WrapMode(config.wrap_p));
+    glSamplerParameteri(s, GL_TEXTURE_COMPARE_MODE,
+                        config.depth_compare_enabled == 1 ? GL_COMPARE_REF_TO_TEXTURE : GL_NONE);
+    glSamplerParameteri(s, GL_TEXTURE_COMPARE_FUNC,
+                        MaxwellToGL::DepthCompareFunc(config.depth_compare_func));
+
+    GLvec4 border_color;
     if (config.srgb_conversion) {
-        new_border_color[0] = config.srgb_border_color_r / 255.0f;
-        new_border_color[1] = config.srgb_border_color_g / 255.0f;
-        new_border_color[2] = config.srgb_border_color_g / 255.0f;
+        border_color[0] = config.srgb_border_color_r / 255.0f;
+        border_color[1] = config.srgb_border_color_g / 255.0f;
+        border_color[2] = config.srgb_border_color_g / 255.0f;
     } else {
-        new_border_color[0] = config.border_color_r;
-        new_border_color[1] = config.border_color_g;
-        new_border_color[2] = config.border_color_b;
+        border_color[0] = config.border_color_r;
+        border_color[1] = config.border_color_g;
+        border_color[2] = config.border_color_b;
     }
-    new_border_color[3] = config.border_color_a;
-
-    if (border_color != new_border_color) {
-        border_color = new_border_color;
-        glSamplerParameterfv(s, GL_TEXTURE_BORDER_COLOR, border_color.data());
+    border_color[3] = config.border_color_a;
+    glSamplerParameterfv(s, GL_TEXTURE_BORDER_COLOR, border_color.data());
+
+    const float max_anisotropic = static_cast<float>(1 << config.max_anisotropy.Value());
+    if (GLAD_GL_ARB_texture_filter_anisotropic) {
+        glSamplerParameterf(s, GL_TEXTURE_MAX_ANISOTROPY, max_anisotropic);
+    } else if (GLAD_GL_EXT_texture_filter_anisotropic) {
+        glSamplerParameterf(s, GL_TEXTURE_MAX_ANISOTROPY_EXT, max_anisotropic);
     }
 
-    const float anisotropic_max = static_cast<float>(1 << config.max_anisotropy.Value());
-    if (anisotropic_max != max_anisotropic) {
-        max_anisotropic = anisotropic_max;
-        if (GLAD_GL_ARB_texture_filter_anisotropic) {
-            glSamplerParameterf(s, GL_TEXTURE_MAX_ANISOTROPY, max_anisotropic);
-        } else if (GLAD_GL_EXT_texture_filter_anisotropic) {
-            glSamplerParameterf(s, GL_TEXTURE_MAX_ANISOTROPY_EXT, max_anisotropic);
-        }
-    }
-    const float lod_min = static_cast<float>(config.min_lod_clamp.Value()) / 256.0f;
-    if (lod_min != min_lod) {
-        min_lod = lod_min;
-        glSamplerParameterf(s, GL_TEXTURE_MIN_LOD, min_lod);
-    }
+    glSamplerParameterf(s, GL_TEXTURE_MIN_LOD,
+                        static_cast<float>(config.min_lod_clamp.Value()) / 256.0f);
+    glSamplerParameterf(s, GL_TEXTURE_MAX_LOD,
+                        static_cast<float>(config.max_lod_clamp.Value()) / 256.0f);
 
-    const float lod_max = static_cast<float>(config.max_lod_clamp.Value()) / 256.0f;
-    if (lod_max != max_lod) {
-        max_lod = lod_max;
-        glSamplerParameterf(s, GL_TEXTURE_MAX_LOD, max_lod);
-    }
     const u32 bias = config.mip_lod_bias.Value();
     // Sign extend the 13-bit value.
     constexpr u32 mask = 1U << (13 - 1);
-    const float bias_lod = static_cast<s32>((bias ^ mask) - mask) / 256.f;
-    if (lod_bias != bias_lod) {
-        lod_bias = bias_lod;
-        glSamplerParameterf(s, GL_TEXTURE_LOD_BIAS, lod_bias);
-    }
+    glSamplerParameterf(s, GL_TEXTURE_LOD_BIAS, static_cast<s32>((bias ^ mask) - mask) / 256.f);
+
+    return s;
 }
 
-u32 RasterizerOpenGL::SetupConstBuffers(Maxwell::ShaderStage stage, Shader& shader,
-                                        GLenum primitive_mode, u32 current_bindpoint) {
+void RasterizerOpenGL::SetupConstBuffers(Maxwell::ShaderStage stage, Shader& shader) {
     MICROPROFILE_SCOPE(OpenGL_UBO);
     const auto& gpu = Core::System::GetInstance().GPU();
     const auto& maxwell3d = gpu.Maxwell3D();
@@ -965,54 +1199,106 @@ u32 RasterizerOpenGL::SetupConstBuffers(Maxwell::ShaderStage stage, Shader& shad
         size = Common::AlignUp(size, sizeof(GLvec4));
         ASSERT_MSG(size <= MaxConstbufferSize, "Constbuffer too big");
 
-        GLintptr const_buffer_offset = buffer_cache.UploadMemory(
-            buffer.address, size, static_cast<std::size_t>(uniform_buffer_alignment));
-
-        // Now configure the bindpoint of the buffer inside the shader
-        glUniformBlockBinding(shader->GetProgramHandle(primitive_mode),
-                              shader->GetProgramResourceIndex(used_buffer),
-                              current_bindpoint + bindpoint);
+        auto& binding =
+            const_buffer_bindings[static_cast<std::size_t>(stage)][used_buffer.GetIndex()];
 
         // Prepare values for multibind
-        bind_buffers[bindpoint] = buffer_cache.GetHandle();
-        bind_offsets[bindpoint] = const_buffer_offset;
+        bind_buffers[bindpoint] = UploadConstBuffer(binding, buffer.address, size);
+        bind_offsets[bindpoint] = 0;
         bind_sizes[bindpoint] = size;
     }
 
-    glBindBuffersRange(GL_UNIFORM_BUFFER, current_bindpoint, static_cast<GLsizei>(entries.size()),
-                       bind_buffers.data(), bind_offsets.data(), bind_sizes.data());
+    // The generated GLSL declares each const buffer at the binding point matching its position in
+    // the entries vector, so a single consecutive multibind covers the whole stage.
+    glBindBuffersRange(GL_UNIFORM_BUFFER, GLShader::GetConstBufferBinding(stage, 0),
+                       static_cast<GLsizei>(entries.size()), bind_buffers.data(),
+                       bind_offsets.data(), bind_sizes.data());
+}
+
+GLuint RasterizerOpenGL::UploadConstBuffer(ConstBufferBinding& binding, Tegra::GPUVAddr gpu_addr,
+                                           std::size_t size) {
+    auto& memory_manager = Core::System::GetInstance().GPU().MemoryManager();
+    const std::optional<VAddr> cpu_addr{memory_manager.GpuToCpuAddress(gpu_addr)};
+
+    const_buffer_staging.resize(size);
+    Memory::ReadBlock(*cpu_addr, const_buffer_staging.data(), size);
+
+    if (binding.buffer.handle == 0) {
+        binding.buffer.Create();
+        binding.shadow.assign(MaxConstbufferSize, 0);
+        glBindBuffer(GL_UNIFORM_BUFFER, binding.buffer.handle);
+        // Allocate the full const buffer range up front and zero it so that the buffer object and
+        // the shadow copy start out in sync, even when later draws use a larger size.
+        glBufferData(GL_UNIFORM_BUFFER, MaxConstbufferSize, binding.shadow.data(),
+                     GL_DYNAMIC_DRAW);
+    }
+
+    const u8* const data{const_buffer_staging.data()};
+    u8* const shadow{binding.shadow.data()};
+
+    // Most draws only touch a handful of uniforms, so narrow the upload down to the range of
+    // bytes that actually changed since the previous draw.
+    std::size_t upload_begin = 0;
+    while (upload_begin < size && shadow[upload_begin] == data[upload_begin]) {
+        ++upload_begin;
+    }
+    if (upload_begin < size) {
+        std::size_t upload_end = size;
+        while (upload_end > upload_begin && shadow[upload_end - 1] == data[upload_end - 1]) {
+            --upload_end;
+        }
+        const std::size_t upload_size = upload_end - upload_begin;
+        glBindBuffer(GL_UNIFORM_BUFFER, binding.buffer.handle);
+        glBufferSubData(GL_UNIFORM_BUFFER, static_cast<GLintptr>(upload_begin),
+                        static_cast<GLsizeiptr>(upload_size), data + upload_begin);
+        std::memcpy(shadow + upload_begin, data + upload_begin, upload_size);
+        Core::System::GetInstance().GetPerfStats().AddConstBufferUpload(upload_size);
+    }
 
-    return current_bindpoint + static_cast<u32>(entries.size());
+    return binding.buffer.handle;
 }
 
-u32 RasterizerOpenGL::SetupTextures(Maxwell::ShaderStage stage, Shader& shader,
-                                    GLenum primitive_mode, u32 current_unit) {
+void RasterizerOpenGL::SetupTextures(Maxwell::ShaderStage stage, Shader& shader) {
     MICROPROFILE_SCOPE(OpenGL_Texture);
     const auto& gpu = Core::System::GetInstance().GPU();
     const auto& maxwell3d = gpu.Maxwell3D();
     const auto& entries = shader->GetShaderEntries().texture_samplers;
 
-    ASSERT_MSG(current_unit + entries.size() <= std::size(state.texture_units),
+    // The generated GLSL declares each sampler at the texture unit matching its position in the
+    // entries vector, so the samplers never have to be pointed at their units here.
+    const u32 base_unit = GLShader::GetTextureBinding(stage, 0);
+    ASSERT_MSG(base_unit + entries.size() <= std::size(state.texture_units),
                "Exceeded the number of active textures.");
 
     for (u32 bindpoint = 0; bindpoint < entries.size(); ++bindpoint) {
         const auto& entry = entries[bindpoint];
-        const u32 current_bindpoint = current_unit + bindpoint;
-
-        // Bind the uniform to the sampler.
-
-        glProgramUniform1i(shader->GetProgramHandle(primitive_mode),
-                           shader->GetUniformLocation(entry), current_bindpoint);
+        const u32 current_bindpoint = base_unit + bindpoint;
 
         const auto texture = maxwell3d.GetStageTexture(entry.GetStage(), entry.GetOffset());
+        auto& binding = texture_bindings[current_bindpoint];
+
+        // If the TIC/TSC state of the unit is unchanged since the last draw and the surface is
+        // still registered (i.e. its guest memory was not written or evicted), the texture unit
+        // already holds the right handles and the cache lookup can be skipped entirely.
+        if (binding.surface != nullptr && binding.surface->IsRegistered() &&
+            binding.info.enabled == texture.enabled &&
+            std::memcmp(&binding.info.tic, &texture.tic, sizeof(texture.tic)) == 0 &&
+            std::memcmp(&binding.info.tsc, &texture.tsc, sizeof(texture.tsc)) == 0) {
+            continue;
+        }
+
+        // BitField members delete copy assignment, so snapshot the POD state bytewise.
+        std::memcpy(&binding.info, &texture, sizeof(texture));
 
         if (!texture.enabled) {
+            binding.surface = nullptr;
             state.texture_units[current_bindpoint].texture = 0;
             continue;
         }
 
-        texture_samplers[current_bindpoint].SyncWithConfig(texture.tsc);
+        state.texture_units[current_bindpoint].sampler = GetSampler(texture.tsc);
         Surface surface = res_cache.GetTextureSurface(texture, entry);
+        binding.surface = surface;
         if (surface != nullptr) {
             state.texture_units[current_bindpoint].texture = surface->Texture().handle;
             state.texture_units[current_bindpoint].target = surface->Target();
@@ -1029,8 +1315,6 @@ u32 RasterizerOpenGL::SetupTextures(Maxwell::ShaderStage stage, Shader& shader,
             state.texture_units[current_bindpoint].texture = 0;
         }
     }
-
-    return current_unit + static_cast<u32>(entries.size());
 }
 
 void RasterizerOpenGL::SyncViewport(OpenGLState& current_state) {
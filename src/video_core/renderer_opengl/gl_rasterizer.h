@@ -6,10 +6,13 @@
 
 #include <array>
 #include <cstddef>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
 #include <optional>
 #include <tuple>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -59,6 +62,7 @@ public:
     bool AccelerateDisplay(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr,
                            u32 pixel_stride) override;
     bool AccelerateDrawBatch(bool is_indexed) override;
+    void DeferMemoryWrite(std::function<void()> do_write) override;
     void UpdatePagesCachedCount(Tegra::GPUVAddr addr, u64 size, int delta) override;
 
     /// Maximum supported size that a constbuffer can have in bytes.
@@ -67,31 +71,20 @@ public:
                   "The maximum size of a constbuffer must be a multiple of the size of GLvec4");
 
 private:
-    class SamplerInfo {
-    public:
-        OGLSampler sampler;
-
-        /// Creates the sampler object, initializing its state so that it's in sync with the
-        /// SamplerInfo struct.
-        void Create();
-        /// Syncs the sampler object with the config, updating any necessary state.
-        void SyncWithConfig(const Tegra::Texture::TSCEntry& info);
-
-    private:
-        Tegra::Texture::TextureFilter mag_filter = Tegra::Texture::TextureFilter::Nearest;
-        Tegra::Texture::TextureFilter min_filter = Tegra::Texture::TextureFilter::Nearest;
-        Tegra::Texture::TextureMipmapFilter mip_filter = Tegra::Texture::TextureMipmapFilter::None;
-        Tegra::Texture::WrapMode wrap_u = Tegra::Texture::WrapMode::ClampToEdge;
-        Tegra::Texture::WrapMode wrap_v = Tegra::Texture::WrapMode::ClampToEdge;
-        Tegra::Texture::WrapMode wrap_p = Tegra::Texture::WrapMode::ClampToEdge;
-        bool uses_depth_compare = false;
-        Tegra::Texture::DepthCompareFunc depth_compare_func =
-            Tegra::Texture::DepthCompareFunc::Always;
-        GLvec4 border_color = {};
-        float min_lod = 0.0f;
-        float max_lod = 16.0f;
-        float lod_bias = 0.0f;
-        float max_anisotropic = 1.0f;
+    /// Hashes a TSC config by value so identical sampler states share one GL sampler object.
+    struct TSCEntryHash {
+        std::size_t operator()(const Tegra::Texture::TSCEntry& entry) const;
+    };
+    struct TSCEntryEqual {
+        bool operator()(const Tegra::Texture::TSCEntry& lhs,
+                        const Tegra::Texture::TSCEntry& rhs) const;
+    };
+
+    /// Last TIC/TSC state applied to one texture unit, so draws that don't touch the texture
+    /// tables skip the surface cache lookup and sampler resolution entirely.
+    struct TextureBinding {
+        Tegra::Texture::FullTextureInfo info{};
+        Surface surface;
     };
 
     /**
@@ -105,25 +98,44 @@ private:
                                bool using_depth_fb = true, bool preserve_contents = true,
                                std::optional<std::size_t> single_color_target = {});
 
+    /**
+     * Configures the framebuffer for a clear. Consecutive clears of the same target reuse the
+     * binding resolved by the previous one as long as no draw, cache invalidation or render
+     * target register write happened in between, skipping the surface cache walk entirely.
+     */
+    void ConfigureClearFramebuffer(OpenGLState& current_state, bool using_color_fb,
+                                   bool using_depth_fb);
+
     /*
-     * Configures the current constbuffers to use for the draw command.
+     * Configures the current constbuffers to use for the draw command. The buffers are bound at
+     * the fixed binding points baked into the generated GLSL for this stage.
      * @param stage The shader stage to configure buffers for.
      * @param shader The shader object that contains the specified stage.
-     * @param current_bindpoint The offset at which to start counting new buffer bindpoints.
-     * @returns The next available bindpoint for use in the next shader stage.
      */
-    u32 SetupConstBuffers(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage, Shader& shader,
-                          GLenum primitive_mode, u32 current_bindpoint);
+    void SetupConstBuffers(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage, Shader& shader);
+
+    /// Dedicated uniform buffer for one (stage, const buffer slot) pair. The shadow copy mirrors
+    /// the last uploaded contents so each draw only re-uploads the byte range that changed.
+    struct ConstBufferBinding {
+        OGLBuffer buffer;
+        std::vector<u8> shadow;
+    };
+
+    /*
+     * Uploads a guest const buffer through its dedicated buffer object, diffing the guest data
+     * against the binding's shadow copy so only the changed range goes over the bus.
+     * @returns The handle of the buffer object to bind.
+     */
+    GLuint UploadConstBuffer(ConstBufferBinding& binding, Tegra::GPUVAddr gpu_addr,
+                             std::size_t size);
 
     /*
-     * Configures the current textures to use for the draw command.
+     * Configures the current textures to use for the draw command. The textures are bound to the
+     * fixed texture units baked into the generated GLSL for this stage.
      * @param stage The shader stage to configure textures for.
      * @param shader The shader object that contains the specified stage.
-     * @param current_unit The offset at which to start counting unused texture units.
-     * @returns The next available bindpoint for use in the next shader stage.
      */
-    u32 SetupTextures(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage, Shader& shader,
-                      GLenum primitive_mode, u32 current_unit);
+    void SetupTextures(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage, Shader& shader);
 
     /// Syncs the viewport and depth range to match the guest state
     void SyncViewport(OpenGLState& current_state);
@@ -198,13 +210,62 @@ private:
 
     std::map<FramebufferCacheKey, OGLFramebuffer> framebuffer_cache;
 
-    std::array<SamplerInfo, Tegra::Engines::Maxwell3D::Regs::NumTextureSamplers> texture_samplers;
+    /**
+     * Runs the deferred guest memory writes whose fences have been signaled, i.e. those whose
+     * preceding GPU commands have completed on the host. When blocking, waits until every
+     * pending write has landed; used before guest memory is handed back to the CPU.
+     */
+    void RunDeferredMemoryWrites(bool blocking);
+
+    /// Guest memory writes (semaphore/query results) waiting on host GPU command completion,
+    /// in submission order
+    std::deque<std::pair<OGLSync, std::function<void()>>> deferred_memory_writes;
+
+    /// Framebuffer binding resolved by the last clear, reused across consecutive clears.
+    /// Draws, cache invalidations and render target register writes invalidate it, since any of
+    /// those can change which surfaces back the clear target.
+    struct ClearTargetCache {
+        bool valid = false;
+        std::size_t render_target = 0;
+        bool using_color = false;
+        bool using_depth = false;
+        Surface color_surface;
+        Surface depth_surface;
+        GLuint framebuffer = 0;
+        bool framebuffer_srgb = false;
+    } clear_target_cache;
+
+    /// Returns the shared sampler object for the TSC config, creating and fully configuring it on
+    /// first use. Identical configs across stages and draws reuse one immutable GL sampler.
+    GLuint GetSampler(const Tegra::Texture::TSCEntry& config);
+
+    std::unordered_map<Tegra::Texture::TSCEntry, OGLSampler, TSCEntryHash, TSCEntryEqual>
+        sampler_cache;
+
+    std::array<TextureBinding, GLShader::NUM_TEXTURE_BINDINGS> texture_bindings;
 
     static constexpr std::size_t STREAM_BUFFER_SIZE = 128 * 1024 * 1024;
     OGLBufferCache buffer_cache;
     PrimitiveAssembler primitive_assembler{buffer_cache};
     GLint uniform_buffer_alignment;
 
+    std::array<std::array<ConstBufferBinding, Tegra::Engines::Maxwell3D::Regs::MaxConstBuffers>,
+               Tegra::Engines::Maxwell3D::Regs::MaxShaderStage>
+        const_buffer_bindings;
+    /// Scratch buffer the guest const buffer contents are read into before diffing
+    std::vector<u8> const_buffer_staging;
+
+    /// Per-stage shadow copy of the last uploaded common uniform block and the stream-buffer
+    /// offset it lives at, so draws with unchanged state skip the upload and rebind entirely.
+    /// Offsets die with the stream buffer contents, when Map reports an invalidation.
+    struct StageUniformCache {
+        GLShader::MaxwellUniformData data{};
+        GLintptr offset = 0;
+        bool valid = false;
+    };
+    std::array<StageUniformCache, Tegra::Engines::Maxwell3D::Regs::MaxShaderStage>
+        stage_uniform_cache;
+
     std::size_t CalculateVertexArraysSize() const;
 
     std::size_t CalculateIndexBufferSize() const;
@@ -214,13 +275,34 @@ private:
 
     DrawParameters SetupDraw();
 
-    void SetupShaders(GLenum primitive_mode);
+    /// Appends the current draw to the pending batch when nothing but the draw parameters
+    /// changed since the previous draw. Returns false when a full state setup is required.
+    bool TryMergeDraw();
+
+    /// Submits the deferred draw batch, as a single multi-draw when it holds more than one call.
+    void FlushPendingDraws();
+
+    /// Returns false when a draw has to be skipped because a shader is still linking
+    /// asynchronously.
+    bool SetupShaders(GLenum primitive_mode);
 
     void SetupCachedFramebuffer(const FramebufferCacheKey& fbkey, OpenGLState& current_state);
 
     enum class AccelDraw { Disabled, Arrays, Indexed };
     AccelDraw accelerate_draw = AccelDraw::Disabled;
 
+    /// Draw calls deferred since the last state change, all sharing one set of pipeline state;
+    /// dispatched together by FlushPendingDraws.
+    std::vector<DrawParameters> pending_draws;
+    Tegra::Engines::Maxwell3D::Regs::PrimitiveTopology pending_draw_topology{};
+
+    /// Returns the settings snapshot the rasterizer operates under, re-acquiring it when a new
+    /// generation has been published (see Settings::AcquireSnapshot).
+    const Settings::Values& GetSettings();
+
+    std::shared_ptr<const Settings::Values> settings_snapshot;
+    u32 settings_generation{};
+
     using CachedPageMap = boost::icl::interval_map<u64, int>;
     CachedPageMap cached_pages;
 };
@@ -3,12 +3,17 @@
 // Refer to the license.txt file included.
 
 #include <algorithm>
+#include <future>
+#include <vector>
 #include <glad/glad.h>
 
 #include "common/alignment.h"
 #include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/detached_tasks.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/perf_counters.h"
 #include "common/scope_exit.h"
 #include "core/core.h"
 #include "core/hle/kernel/process.h"
@@ -189,6 +194,39 @@ std::size_t SurfaceParams::InnerMemorySize(bool force_gl, bool layer_only,
     return params;
 }
 
+/*static*/ SurfaceParams SurfaceParams::CreateForFramebufferConfig(
+    const Tegra::FramebufferConfig& config, VAddr framebuffer_addr) {
+    SurfaceParams params{};
+
+    // Framebuffers handed off for presentation are block-linear images with the default block
+    // height, matching what the CPU deswizzle path used to assume.
+    params.is_tiled = true;
+    params.block_width = 1;
+    params.block_height = 16;
+    params.block_depth = 1;
+    params.tile_width_spacing = 1;
+    params.pixel_format = VideoCore::Surface::PixelFormatFromGPUPixelFormat(config.pixel_format);
+    params.srgb_conversion = false;
+    params.component_type = ComponentType::UNorm;
+    params.type = GetFormatType(params.pixel_format);
+    params.width = config.width;
+    params.height = config.height;
+    params.unaligned_height = config.height;
+    params.target = SurfaceTarget::Texture2D;
+    params.depth = 1;
+    params.max_mip_level = 1;
+    params.is_layered = false;
+    params.rt = {};
+
+    // The framebuffer address is already a CPU address, so there is no GPU mapping to resolve.
+    params.addr = framebuffer_addr;
+    params.gpu_addr = 0;
+    params.size_in_bytes = params.SizeInBytesRaw();
+    params.size_in_bytes_gl = params.SizeInBytesGL();
+
+    return params;
+}
+
 /*static*/ SurfaceParams SurfaceParams::CreateForDepthBuffer(
     u32 zeta_width, u32 zeta_height, Tegra::GPUVAddr zeta_address, Tegra::DepthFormat format,
     u32 block_width, u32 block_height, u32 block_depth,
@@ -384,17 +422,38 @@ void SwizzleFunc(const MortonSwizzleMode& mode, const SurfaceParams& params,
         depth = 1U;
     }
     if (params.is_layered) {
-        u64 offset = params.GetMipmapLevelOffset(mip_level);
-        u64 offset_gl = 0;
+        const u64 offset = params.GetMipmapLevelOffset(mip_level);
         const u64 layer_size = params.LayerMemorySize();
         const u64 gl_size = params.LayerSizeGL(mip_level);
-        for (u32 i = 0; i < params.depth; i++) {
+
+        const auto swizzle_layer = [&, offset](u32 layer) {
             MortonSwizzle(mode, params.pixel_format, params.MipWidth(mip_level),
                           params.MipBlockHeight(mip_level), params.MipHeight(mip_level),
                           params.MipBlockDepth(mip_level), params.tile_width_spacing, 1,
-                          gl_buffer.data() + offset_gl, gl_size, params.addr + offset);
-            offset += layer_size;
-            offset_gl += gl_size;
+                          gl_buffer.data() + layer * gl_size, gl_size,
+                          params.addr + offset + layer * layer_size);
+        };
+
+        // Every layer works on its own slice of the staging buffer and its own span of guest
+        // memory, so large layered surfaces (cubemap reflection probes, texture arrays) fan the
+        // unswizzling out across the worker pool instead of converting face by face.
+        constexpr u64 PARALLEL_LAYER_THRESHOLD = 64 * 1024;
+        if (params.depth > 1 && gl_size >= PARALLEL_LAYER_THRESHOLD) {
+            std::vector<std::future<void>> layer_tasks;
+            layer_tasks.reserve(params.depth - 1);
+            for (u32 i = 1; i < params.depth; i++) {
+                layer_tasks.emplace_back(Common::DetachedTasks::AddTaskWithHandle(
+                    Common::DetachedTasks::Priority::LatencySensitive,
+                    [&swizzle_layer, i] { swizzle_layer(i); }));
+            }
+            swizzle_layer(0);
+            for (auto& task : layer_tasks) {
+                task.get();
+            }
+        } else {
+            for (u32 i = 0; i < params.depth; i++) {
+                swizzle_layer(i);
+            }
         }
     } else {
         const u64 offset = params.GetMipmapLevelOffset(mip_level);
@@ -411,10 +470,69 @@ static void FastCopySurface(const Surface& src_surface, const Surface& dst_surfa
 
     const u32 width{std::min(src_params.width, dst_params.width)};
     const u32 height{std::min(src_params.height, dst_params.height)};
+    const u32 depth{std::min(src_params.depth, dst_params.depth)};
 
     glCopyImageSubData(src_surface->Texture().handle, SurfaceTargetToGL(src_params.target), 0, 0, 0,
                        0, dst_surface->Texture().handle, SurfaceTargetToGL(dst_params.target), 0, 0,
-                       0, 0, width, height, 1);
+                       0, 0, width, height, depth);
+}
+
+MICROPROFILE_DEFINE(OpenGL_BlitSurface, "OpenGL", "BlitSurface", MP_RGB(128, 192, 64));
+static void BlitSurface(const Surface& src_surface, const Surface& dst_surface,
+                        GLuint read_fb_handle, GLuint draw_fb_handle) {
+    MICROPROFILE_SCOPE(OpenGL_BlitSurface);
+
+    const auto& src_params{src_surface->GetSurfaceParams()};
+    const auto& dst_params{dst_surface->GetSurfaceParams()};
+
+    OpenGLState prev_state{OpenGLState::GetCurState()};
+    SCOPE_EXIT({ prev_state.Apply(); });
+
+    OpenGLState state;
+    state.draw.read_framebuffer = read_fb_handle;
+    state.draw.draw_framebuffer = draw_fb_handle;
+    state.Apply();
+
+    u32 buffers{};
+    if (src_params.type == SurfaceType::ColorTexture) {
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               src_surface->Texture().handle, 0);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0,
+                               0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D,
+                               dst_surface->Texture().handle, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0,
+                               0);
+        buffers = GL_COLOR_BUFFER_BIT;
+    } else if (src_params.type == SurfaceType::Depth) {
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                               src_surface->Texture().handle, 0);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_TEXTURE_2D,
+                               dst_surface->Texture().handle, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_STENCIL_ATTACHMENT, GL_TEXTURE_2D, 0, 0);
+        buffers = GL_DEPTH_BUFFER_BIT;
+    } else if (src_params.type == SurfaceType::DepthStencil) {
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glFramebufferTexture2D(GL_READ_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D,
+                               src_surface->Texture().handle, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, 0, 0);
+        glFramebufferTexture2D(GL_DRAW_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_TEXTURE_2D,
+                               dst_surface->Texture().handle, 0);
+        buffers = GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT;
+    } else {
+        UNREACHABLE_MSG("Unsupported blit surface type={}", static_cast<u32>(src_params.type));
+    }
+
+    // Scaling color blits can filter; depth and stencil blits must not.
+    const GLenum filter =
+        static_cast<GLenum>(buffers == GL_COLOR_BUFFER_BIT ? GL_LINEAR : GL_NEAREST);
+    glBlitFramebuffer(0, 0, static_cast<GLint>(src_params.width),
+                      static_cast<GLint>(src_params.height), 0, 0,
+                      static_cast<GLint>(dst_params.width), static_cast<GLint>(dst_params.height),
+                      buffers, filter);
 }
 
 MICROPROFILE_DEFINE(OpenGL_CopySurface, "OpenGL", "CopySurface", MP_RGB(128, 192, 64));
@@ -715,12 +833,26 @@ void CachedSurface::LoadGLBuffer() {
     }
 }
 
+u64 CachedSurface::CalculateContentHash() const {
+    // Chain the per-mip hashes so the result covers the whole upload payload.
+    u64 hash = 0;
+    for (const auto& level : gl_buffer) {
+        hash = Common::CityHash64WithSeed(reinterpret_cast<const char*>(level.data()),
+                                          level.size(), hash);
+    }
+    return hash;
+}
+
 MICROPROFILE_DEFINE(OpenGL_SurfaceFlush, "OpenGL", "Surface Flush", MP_RGB(128, 192, 64));
 void CachedSurface::FlushGLBuffer() {
     MICROPROFILE_SCOPE(OpenGL_SurfaceFlush);
 
     ASSERT_MSG(!IsPixelFormatASTC(params.pixel_format), "Unimplemented");
 
+    // Once the guest CPU has read this surface back, later frames stage their readbacks at
+    // render time so this flush can complete without stalling the pipeline.
+    cpu_read_candidate = true;
+
     // OpenGL temporary buffer needs to be big enough to store raw texture size
     gl_buffer.resize(1);
     gl_buffer[0].resize(GetSizeInBytes());
@@ -728,12 +860,23 @@ void CachedSurface::FlushGLBuffer() {
     const FormatTuple& tuple = GetFormatTuple(params.pixel_format, params.component_type);
     // Ensure no bad interactions with GL_UNPACK_ALIGNMENT
     ASSERT(params.width * GetBytesPerPixel(params.pixel_format) % 4 == 0);
-    glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.width));
     ASSERT(!tuple.compressed);
-    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
-    glGetTextureImage(texture.handle, 0, tuple.format, tuple.type,
-                      static_cast<GLsizei>(gl_buffer[0].size()), gl_buffer[0].data());
-    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    if (auto* const staged = FindCurrentStagedReadback()) {
+        // A readback issued at render time already holds the current contents; its fence is
+        // usually long signaled by the time the guest reads, so this does not stall.
+        glClientWaitSync(staged->fence.handle, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, staged->pbo.handle);
+        glGetBufferSubData(GL_PIXEL_PACK_BUFFER, 0, static_cast<GLsizeiptr>(gl_buffer[0].size()),
+                           gl_buffer[0].data());
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        staged->pending = false;
+    } else {
+        glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.width));
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+        glGetTextureImage(texture.handle, 0, tuple.format, tuple.type,
+                          static_cast<GLsizei>(gl_buffer[0].size()), gl_buffer[0].data());
+        glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    }
     ConvertFormatAsNeeded_FlushGLBuffer(gl_buffer[0], params.pixel_format, params.width,
                                         params.height);
     ASSERT(params.type != SurfaceType::Fill);
@@ -749,6 +892,56 @@ void CachedSurface::FlushGLBuffer() {
     }
 }
 
+CachedSurface::StagedReadback* CachedSurface::FindCurrentStagedReadback() {
+    for (auto& staged : staging_buffers) {
+        if (staged.pending && staged.modified_ticks == GetLastModifiedTicks()) {
+            return &staged;
+        }
+    }
+    return nullptr;
+}
+
+void CachedSurface::StageReadback() {
+    if (!cpu_read_candidate || !IsDirty() || IsPixelFormatASTC(params.pixel_format)) {
+        return;
+    }
+    if (FindCurrentStagedReadback() != nullptr) {
+        // The current contents are already staged.
+        return;
+    }
+
+    const FormatTuple& tuple = GetFormatTuple(params.pixel_format, params.component_type);
+    if (tuple.compressed) {
+        return;
+    }
+
+    auto& staged = staging_buffers[next_staging_buffer];
+    next_staging_buffer = (next_staging_buffer + 1) % NUM_STAGING_BUFFERS;
+
+    const std::size_t size{GetSizeInBytes()};
+    if (staged.pbo.handle == 0) {
+        staged.pbo.Create();
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, staged.pbo.handle);
+        glBufferData(GL_PIXEL_PACK_BUFFER, static_cast<GLsizeiptr>(size), nullptr,
+                     GL_STREAM_READ);
+    } else {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, staged.pbo.handle);
+    }
+
+    // With a pack buffer bound, the readback is queued after the rendering commands and runs
+    // asynchronously; only the copy out of the buffer in FlushGLBuffer synchronizes.
+    glPixelStorei(GL_PACK_ROW_LENGTH, static_cast<GLint>(params.width));
+    glGetTextureImage(texture.handle, 0, tuple.format, tuple.type, static_cast<GLsizei>(size),
+                      nullptr);
+    glPixelStorei(GL_PACK_ROW_LENGTH, 0);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    staged.fence.Release();
+    staged.fence.Create();
+    staged.modified_ticks = GetLastModifiedTicks();
+    staged.pending = true;
+}
+
 void CachedSurface::UploadGLMipmapTexture(u32 mip_map, GLuint read_fb_handle,
                                           GLuint draw_fb_handle) {
     const auto& rect{params.GetRect(mip_map)};
@@ -853,7 +1046,16 @@ void CachedSurface::UploadGLMipmapTexture(u32 mip_map, GLuint read_fb_handle,
                             tuple.type, &gl_buffer[mip_map][buffer_offset]);
             break;
         case SurfaceTarget::TextureCubemap: {
-            std::size_t start = buffer_offset;
+            if (GLAD_GL_ARB_direct_state_access) {
+                // All six faces are contiguous in the staging buffer, so one layered upload
+                // replaces the per-face calls
+                glTextureSubImage3D(target_tex, mip_map, x0, y0, 0,
+                                    static_cast<GLsizei>(rect.GetWidth()),
+                                    static_cast<GLsizei>(rect.GetHeight()),
+                                    static_cast<GLsizei>(params.depth), tuple.format, tuple.type,
+                                    &gl_buffer[mip_map][buffer_offset]);
+                break;
+            }
             for (std::size_t face = 0; face < params.depth; ++face) {
                 glTexSubImage2D(static_cast<GLenum>(GL_TEXTURE_CUBE_MAP_POSITIVE_X + face), mip_map,
                                 x0, y0, static_cast<GLsizei>(rect.GetWidth()),
@@ -883,6 +1085,9 @@ void CachedSurface::UploadGLTexture(GLuint read_fb_handle, GLuint draw_fb_handle
 
     MICROPROFILE_SCOPE(OpenGL_TextureUL);
 
+    static auto& upload_bytes_counter = Common::GetPerfCounter("gpu_texture_upload_bytes");
+    upload_bytes_counter.Add(params.size_in_bytes_gl);
+
     for (u32 i = 0; i < params.max_mip_level; i++)
         UploadGLMipmapTexture(i, read_fb_handle, draw_fb_handle);
 }
@@ -896,7 +1101,23 @@ RasterizerCacheOpenGL::RasterizerCacheOpenGL(RasterizerOpenGL& rasterizer)
 
 Surface RasterizerCacheOpenGL::GetTextureSurface(const Tegra::Texture::FullTextureInfo& config,
                                                  const GLShader::SamplerEntry& entry) {
-    return GetSurface(SurfaceParams::CreateForTexture(config, entry));
+    TextureParamsKey key{config.tic, entry.IsArray()};
+    key.hash = Common::CityHash64WithSeed(reinterpret_cast<const char*>(&key.tic), sizeof(key.tic),
+                                          key.is_array ? 1 : 0);
+
+    const auto [iter, inserted] = texture_params_cache.try_emplace(key);
+    SurfaceParams& params{iter->second};
+    if (inserted) {
+        params = SurfaceParams::CreateForTexture(config, entry);
+    } else {
+        // The derived format and size fields only depend on the descriptor bits, but the
+        // GPU-to-CPU mapping of the address can change between identical configs.
+        auto& memory_manager{Core::System::GetInstance().GPU().MemoryManager()};
+        const auto cpu_addr{memory_manager.GpuToCpuAddress(params.gpu_addr)};
+        params.addr = cpu_addr ? *cpu_addr : 0;
+    }
+
+    return GetSurface(params);
 }
 
 Surface RasterizerCacheOpenGL::GetDepthBufferSurface(bool preserve_contents) {
@@ -933,10 +1154,42 @@ Surface RasterizerCacheOpenGL::GetColorBufferSurface(std::size_t index, bool pre
 
 void RasterizerCacheOpenGL::LoadSurface(const Surface& surface) {
     surface->LoadGLBuffer();
-    surface->UploadGLTexture(read_framebuffer.handle, draw_framebuffer.handle);
+    if (!Settings::values.use_texture_upload_dedup || !TryDedupUpload(surface)) {
+        surface->UploadGLTexture(read_framebuffer.handle, draw_framebuffer.handle);
+    }
     surface->MarkAsModified(false, *this);
 }
 
+bool RasterizerCacheOpenGL::TryDedupUpload(const Surface& surface) {
+    const u64 content_hash = surface->CalculateContentHash();
+    bool copied = false;
+
+    const auto iter = upload_dedup_cache.find(content_hash);
+    if (iter != upload_dedup_cache.end()) {
+        const auto source = iter->second.lock();
+        // The source texture only still matches the hashed payload if it has neither been
+        // rendered to (dirty) nor evicted. There is no aliasing: the destination gets its own
+        // copy, so either surface can be rendered to afterwards without affecting the other.
+        if (source && source != surface && source->IsRegistered() && !source->IsDirty() &&
+            source->GetSurfaceParams().IsCompatibleSurface(surface->GetSurfaceParams()) &&
+            source->GetSurfaceParams().max_mip_level == surface->GetSurfaceParams().max_mip_level) {
+            const auto& src_params{source->GetSurfaceParams()};
+            const auto& dst_params{surface->GetSurfaceParams()};
+            for (u32 mip = 0; mip < dst_params.max_mip_level; ++mip) {
+                glCopyImageSubData(source->Texture().handle, SurfaceTargetToGL(src_params.target),
+                                   mip, 0, 0, 0, surface->Texture().handle,
+                                   SurfaceTargetToGL(dst_params.target), mip, 0, 0, 0,
+                                   dst_params.MipWidth(mip), dst_params.MipHeight(mip),
+                                   dst_params.MipDepth(mip));
+            }
+            copied = true;
+        }
+    }
+
+    upload_dedup_cache[content_hash] = surface;
+    return copied;
+}
+
 Surface RasterizerCacheOpenGL::GetSurface(const SurfaceParams& params, bool preserve_contents) {
     if (params.addr == 0 || params.height * params.width == 0) {
         return {};
@@ -947,6 +1200,7 @@ Surface RasterizerCacheOpenGL::GetSurface(const SurfaceParams& params, bool pres
     if (surface) {
         if (surface->GetSurfaceParams().IsCompatibleSurface(params)) {
             // Use the cached surface as-is
+            surface->MarkUsed(frame_use_tick);
             return surface;
         } else if (preserve_contents) {
             // If surface parameters changed and we care about keeping the previous data, recreate
@@ -954,6 +1208,7 @@ Surface RasterizerCacheOpenGL::GetSurface(const SurfaceParams& params, bool pres
             Surface new_surface{RecreateSurface(surface, params)};
             Unregister(surface);
             Register(new_surface);
+            RegisterMipLevels(new_surface);
             return new_surface;
         } else {
             // Delete the old surface before creating a new one to prevent collisions.
@@ -964,15 +1219,65 @@ Surface RasterizerCacheOpenGL::GetSurface(const SurfaceParams& params, bool pres
     // No cached surface found - get a new one
     surface = GetUncachedSurface(params);
     Register(surface);
+    RegisterMipLevels(surface);
 
-    // Only load surface from memory if we care about the contents
-    if (preserve_contents) {
+    // Only load surface from memory if we care about the contents. If the address aliases a mip
+    // level of an already uploaded chain, the contents come from a GPU copy of that level.
+    if (preserve_contents && !TryLoadMipLevelAlias(surface, params)) {
         LoadSurface(surface);
     }
 
     return surface;
 }
 
+void RasterizerCacheOpenGL::RegisterMipLevels(const Surface& surface) {
+    const auto& params{surface->GetSurfaceParams()};
+    if (params.max_mip_level <= 1) {
+        return;
+    }
+    for (u32 level = 1; level < params.max_mip_level; ++level) {
+        const VAddr level_addr{params.addr + params.GetMipmapLevelOffset(level)};
+        mip_level_index[level_addr] = MipLevelAlias{surface, level};
+    }
+}
+
+bool RasterizerCacheOpenGL::TryLoadMipLevelAlias(const Surface& surface,
+                                                 const SurfaceParams& params) {
+    if (GetSettings().use_accurate_gpu_emulation) {
+        return false;
+    }
+    // Only single-level requests are serviced; a request for a chain starting mid-way through
+    // another chain would still need the lower levels decoded from memory.
+    if (params.max_mip_level != 1) {
+        return false;
+    }
+
+    const auto itr{mip_level_index.find(params.addr)};
+    if (itr == mip_level_index.end()) {
+        return false;
+    }
+    const Surface owner{itr->second.owner.lock()};
+    if (!owner || !owner->IsRegistered()) {
+        mip_level_index.erase(itr);
+        return false;
+    }
+
+    const u32 level{itr->second.level};
+    const auto& owner_params{owner->GetSurfaceParams()};
+    if (owner_params.pixel_format != params.pixel_format ||
+        owner_params.target != params.target ||
+        owner_params.MipWidth(level) != params.width ||
+        owner_params.MipHeight(level) != params.height) {
+        return false;
+    }
+
+    glCopyImageSubData(owner->Texture().handle, SurfaceTargetToGL(owner_params.target), level, 0,
+                       0, 0, surface->Texture().handle, SurfaceTargetToGL(params.target), 0, 0, 0,
+                       0, params.width, params.height,
+                       std::min(owner_params.MipDepth(level), params.depth));
+    return true;
+}
+
 Surface RasterizerCacheOpenGL::GetUncachedSurface(const SurfaceParams& params) {
     Surface surface{TryGetReservedSurface(params)};
     if (!surface) {
@@ -1015,17 +1320,23 @@ void RasterizerCacheOpenGL::FermiCopySurface(
     const auto& src_params = SurfaceParams::CreateForFermiCopySurface(src_config);
     const auto& dst_params = SurfaceParams::CreateForFermiCopySurface(dst_config);
 
-    ASSERT(src_params.width == dst_params.width);
-    ASSERT(src_params.height == dst_params.height);
-    ASSERT(src_params.pixel_format == dst_params.pixel_format);
-    ASSERT(src_params.block_height == dst_params.block_height);
-    ASSERT(src_params.is_tiled == dst_params.is_tiled);
     ASSERT(src_params.depth == dst_params.depth);
-    ASSERT(src_params.depth == 1); // Currently, FastCopySurface only works with 2D surfaces
     ASSERT(src_params.target == dst_params.target);
     ASSERT(src_params.rt.index == dst_params.rt.index);
 
-    FastCopySurface(GetSurface(src_params, true), GetSurface(dst_params, false));
+    const Surface src_surface{GetSurface(src_params, true)};
+    const Surface dst_surface{GetSurface(dst_params, false)};
+
+    if (src_params.pixel_format == dst_params.pixel_format &&
+        src_params.width == dst_params.width && src_params.height == dst_params.height) {
+        FastCopySurface(src_surface, dst_surface);
+    } else {
+        // Scaling or format-converting copies go through a framebuffer blit, which keeps the
+        // operation on the GPU instead of bouncing through guest memory.
+        BlitSurface(src_surface, dst_surface, read_framebuffer.handle, draw_framebuffer.handle);
+    }
+
+    dst_surface->MarkAsModified(true, *this);
 }
 
 void RasterizerCacheOpenGL::AccurateCopySurface(const Surface& src_surface,
@@ -1048,14 +1359,15 @@ Surface RasterizerCacheOpenGL::RecreateSurface(const Surface& old_surface,
     Surface new_surface{GetUncachedSurface(new_params)};
 
     // With use_accurate_gpu_emulation enabled, do an accurate surface copy
-    if (Settings::values.use_accurate_gpu_emulation) {
+    if (GetSettings().use_accurate_gpu_emulation) {
         AccurateCopySurface(old_surface, new_surface);
         return new_surface;
     }
 
-    // For compatible surfaces, we can just do fast glCopyImageSubData based copy
+    // For compatible surfaces, we can just do fast glCopyImageSubData based copy. Formats with
+    // the same bits per pixel alias each other, so the data can stay GPU-resident across the
+    // reinterpretation instead of being flushed and reloaded through guest memory.
     if (old_params.target == new_params.target && old_params.type == new_params.type &&
-        old_params.depth == new_params.depth && old_params.depth == 1 &&
         GetFormatBpp(old_params.pixel_format) == GetFormatBpp(new_params.pixel_format)) {
         FastCopySurface(old_surface, new_surface);
         return new_surface;
@@ -1063,6 +1375,15 @@ Surface RasterizerCacheOpenGL::RecreateSurface(const Surface& old_surface,
 
     switch (new_params.target) {
     case SurfaceTarget::Texture2D:
+        // Prefer a GPU-side reinterpretation pass; the pixel buffer round trip is the fallback
+        // for format pairs without a pipeline.
+        if (format_reinterpreter.Reinterpret(
+                old_surface->Texture().handle, old_params.pixel_format,
+                new_surface->Texture().handle, new_params.pixel_format,
+                std::min(old_params.width, new_params.width),
+                std::min(old_params.height, new_params.height))) {
+            break;
+        }
         CopySurface(old_surface, new_surface, copy_pbo.handle);
         break;
     case SurfaceTarget::Texture3D:
@@ -1086,8 +1407,14 @@ Surface RasterizerCacheOpenGL::TryFindFramebufferSurface(VAddr addr) const {
     return TryGet(addr);
 }
 
+Surface RasterizerCacheOpenGL::GetFramebufferSurface(const Tegra::FramebufferConfig& config,
+                                                     VAddr framebuffer_addr) {
+    return GetSurface(SurfaceParams::CreateForFramebufferConfig(config, framebuffer_addr));
+}
+
 void RasterizerCacheOpenGL::ReserveSurface(const Surface& surface) {
     const auto& surface_reserve_key{SurfaceReserveKey::Create(surface->GetSurfaceParams())};
+    surface->MarkUsed(frame_use_tick);
     surface_reserve[surface_reserve_key] = surface;
 }
 
@@ -1095,9 +1422,52 @@ Surface RasterizerCacheOpenGL::TryGetReservedSurface(const SurfaceParams& params
     const auto& surface_reserve_key{SurfaceReserveKey::Create(params)};
     auto search{surface_reserve.find(surface_reserve_key)};
     if (search != surface_reserve.end()) {
+        search->second->MarkUsed(frame_use_tick);
         return search->second;
     }
     return {};
 }
 
+void RasterizerCacheOpenGL::EvictOverBudget() {
+    ++frame_use_tick;
+
+    std::size_t total_bytes = 0;
+    for (const auto& entry : surface_reserve) {
+        total_bytes += entry.second->GetSurfaceParams().size_in_bytes_gl;
+    }
+
+    static auto& occupancy_counter = Common::GetPerfCounter("gpu_surface_cache_bytes");
+    static auto& surface_counter = Common::GetPerfCounter("gpu_surface_cache_surfaces");
+    occupancy_counter.Set(total_bytes);
+    surface_counter.Set(surface_reserve.size());
+
+    const std::size_t budget{static_cast<std::size_t>(GetSettings().gpu_cache_budget_mb) << 20};
+    if (budget == 0 || total_bytes <= budget) {
+        return;
+    }
+
+    // Only surfaces that are neither registered in the address map nor waiting to be flushed
+    // can be dropped without losing guest-visible data; evict the stalest of those first.
+    std::vector<std::pair<u64, SurfaceReserveKey>> candidates;
+    for (const auto& entry : surface_reserve) {
+        if (!entry.second->IsRegistered() && !entry.second->IsDirty()) {
+            candidates.emplace_back(entry.second->GetLastUseTick(), entry.first);
+        }
+    }
+    std::sort(candidates.begin(), candidates.end(),
+              [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    static auto& eviction_counter = Common::GetPerfCounter("gpu_surface_cache_evictions");
+    for (const auto& [tick, key] : candidates) {
+        if (total_bytes <= budget) {
+            break;
+        }
+        const auto iter = surface_reserve.find(key);
+        total_bytes -= iter->second->GetSurfaceParams().size_in_bytes_gl;
+        surface_reserve.erase(iter);
+        eviction_counter.Add();
+    }
+    occupancy_counter.Set(total_bytes);
+}
+
 } // namespace OpenGL
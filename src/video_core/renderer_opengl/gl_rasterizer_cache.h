@@ -5,6 +5,7 @@
 #pragma once
 
 #include <array>
+#include <cstring>
 #include <map>
 #include <memory>
 #include <string>
@@ -17,6 +18,7 @@
 #include "video_core/engines/fermi_2d.h"
 #include "video_core/engines/maxwell_3d.h"
 #include "video_core/rasterizer_cache.h"
+#include "video_core/renderer_opengl/gl_format_reinterpreter.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/gl_shader_gen.h"
 #include "video_core/surface.h"
@@ -184,6 +186,10 @@ struct SurfaceParams {
     /// Creates SurfaceParams from a framebuffer configuration
     static SurfaceParams CreateForFramebuffer(std::size_t index);
 
+    /// Creates SurfaceParams for a framebuffer handed off for presentation
+    static SurfaceParams CreateForFramebufferConfig(const Tegra::FramebufferConfig& config,
+                                                    VAddr framebuffer_addr);
+
     /// Creates SurfaceParams for a depth buffer configuration
     static SurfaceParams CreateForDepthBuffer(
         u32 zeta_width, u32 zeta_height, Tegra::GPUVAddr zeta_address, Tegra::DepthFormat format,
@@ -301,21 +307,58 @@ public:
         return params;
     }
 
+    /// Tick of the frame this surface was last retrieved on; drives LRU eviction of the reserve.
+    u64 GetLastUseTick() const {
+        return last_use_tick;
+    }
+
+    void MarkUsed(u64 tick) {
+        last_use_tick = tick;
+    }
+
     // Read/Write data in Switch memory to/from gl_buffer
     void LoadGLBuffer();
     void FlushGLBuffer();
 
+    /// Hashes the decoded upload payload currently held in gl_buffer, covering every mip level.
+    /// Only valid between LoadGLBuffer and the next flush.
+    u64 CalculateContentHash() const;
+
+    /// Starts an asynchronous readback of the surface into the next pixel-pack buffer of the
+    /// staging ring. Only surfaces the guest CPU has flushed before issue readbacks; a later
+    /// FlushGLBuffer then completes from the staged copy instead of stalling the GL pipeline.
+    void StageReadback();
+
     // Upload data in gl_buffer to this surface's texture
     void UploadGLTexture(GLuint read_fb_handle, GLuint draw_fb_handle);
 
 private:
     void UploadGLMipmapTexture(u32 mip_map, GLuint read_fb_handle, GLuint draw_fb_handle);
 
+    /// One slot of the readback staging ring.
+    struct StagedReadback {
+        OGLBuffer pbo;
+        OGLSync fence;
+        u64 modified_ticks = 0;
+        bool pending = false;
+    };
+
+    /// Returns the staged readback matching the surface's current modification tick, or nullptr
+    /// when no staged copy is up to date.
+    StagedReadback* FindCurrentStagedReadback();
+
     OGLTexture texture;
     std::vector<std::vector<u8>> gl_buffer;
     SurfaceParams params;
     GLenum gl_target;
     std::size_t cached_size_in_bytes;
+
+    static constexpr std::size_t NUM_STAGING_BUFFERS = 3;
+    std::array<StagedReadback, NUM_STAGING_BUFFERS> staging_buffers;
+    std::size_t next_staging_buffer = 0;
+    /// Set on the first CPU flush; only such surfaces are worth staging readbacks for.
+    bool cpu_read_candidate = false;
+    u64 last_use_tick = 0;
 };
 
 class RasterizerCacheOpenGL final : public RasterizerCache<Surface> {
@@ -335,10 +378,19 @@ public:
     /// Tries to find a framebuffer using on the provided CPU address
     Surface TryFindFramebufferSurface(VAddr addr) const;
 
+    /// Gets the surface for a framebuffer handed off for presentation, loading it into the cache
+    /// from guest memory if no rendered surface covers it
+    Surface GetFramebufferSurface(const Tegra::FramebufferConfig& config, VAddr framebuffer_addr);
+
     /// Copies the contents of one surface to another
     void FermiCopySurface(const Tegra::Engines::Fermi2D::Regs::Surface& src_config,
                           const Tegra::Engines::Fermi2D::Regs::Surface& dst_config);
 
+    /// Evicts least-recently-used idle surfaces until the estimated GPU memory held by the cache
+    /// fits the configured budget again, and publishes the occupancy to the counter registry.
+    /// Called once per presented frame.
+    void EvictOverBudget();
+
 private:
     void LoadSurface(const Surface& surface);
     Surface GetSurface(const SurfaceParams& params, bool preserve_contents = true);
@@ -359,17 +411,77 @@ private:
     void AccurateCopySurface(const Surface& src_surface, const Surface& dst_surface);
     void FastLayeredCopySurface(const Surface& src_surface, const Surface& dst_surface);
 
+    /// Tries to satisfy an upload by copying from a registered surface that previously uploaded
+    /// identical content, returning true if the surface's texture was filled GPU-side.
+    bool TryDedupUpload(const Surface& surface);
+
+    /// Records the guest addresses of the non-base mip levels of a mipmapped surface, so later
+    /// requests landing on one of them are recognized as aliases of this surface.
+    void RegisterMipLevels(const Surface& surface);
+
+    /// Tries to fill a new surface whose address aliases a mip level of a cached surface by
+    /// copying that level GPU-side, returning true on success.
+    bool TryLoadMipLevelAlias(const Surface& surface, const SurfaceParams& params);
+
     /// The surface reserve is a "backup" cache, this is where we put unique surfaces that have
     /// previously been used. This is to prevent surfaces from being constantly created and
     /// destroyed when used with different surface parameters.
     std::unordered_map<SurfaceReserveKey, Surface> surface_reserve;
 
+    /// Monotonic frame counter stamping surface uses, advanced by EvictOverBudget
+    u64 frame_use_tick = 0;
+
+    /// Maps the content hash of each uploaded payload to the surface that uploaded it, so that
+    /// identical content appearing at a different guest address (double-buffered atlases) can be
+    /// copied GPU-side instead of re-uploaded. Entries don't keep surfaces alive.
+    std::unordered_map<u64, std::weak_ptr<CachedSurface>> upload_dedup_cache;
+
+    /// One non-base mip level of a cached mipmapped surface. Entries don't keep surfaces alive
+    /// and are dropped lazily once the owner has been unregistered.
+    struct MipLevelAlias {
+        std::weak_ptr<CachedSurface> owner;
+        u32 level;
+    };
+
+    /// Maps the guest address of every non-base mip level of cached mipmapped surfaces to its
+    /// owner, so a surface request for an individual level is serviced with a GPU copy from the
+    /// already uploaded chain instead of a fresh decode and upload from guest memory.
+    std::unordered_map<VAddr, MipLevelAlias> mip_level_index;
+
+    /// Identifies one texture configuration by its raw TIC descriptor bits plus the shader's
+    /// array-ness, with the hash precomputed so map lookups cost one integer compare before
+    /// falling back to a byte-wise descriptor comparison.
+    struct TextureParamsKey {
+        Tegra::Texture::TICEntry tic;
+        bool is_array;
+        u64 hash;
+
+        bool operator==(const TextureParamsKey& rhs) const {
+            return hash == rhs.hash && is_array == rhs.is_array &&
+                   std::memcmp(&tic, &rhs.tic, sizeof(tic)) == 0;
+        }
+    };
+
+    struct TextureParamsKeyHash {
+        std::size_t operator()(const TextureParamsKey& key) const {
+            return static_cast<std::size_t>(key.hash);
+        }
+    };
+
+    /// Memoizes SurfaceParams::CreateForTexture: identical texture descriptors are bound thousands
+    /// of times per frame, and the derived format/size arithmetic is identical every time. Only
+    /// the GPU-to-CPU address translation is redone on a hit, as mappings can change.
+    std::unordered_map<TextureParamsKey, SurfaceParams, TextureParamsKeyHash> texture_params_cache;
+
     OGLFramebuffer read_framebuffer;
     OGLFramebuffer draw_framebuffer;
 
     /// Use a Pixel Buffer Object to download the previous texture and then upload it to the new one
     /// using the new format.
     OGLBuffer copy_pbo;
+
+    /// GPU-side fragment passes for the reinterpretations that would otherwise go through the PBO
+    FormatReinterpreterOpenGL format_reinterpreter;
 };
 
 } // namespace OpenGL
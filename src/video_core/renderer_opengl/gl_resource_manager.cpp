@@ -3,6 +3,7 @@
 // Refer to the license.txt file included.
 
 #include <utility>
+#include <vector>
 #include <glad/glad.h>
 #include "common/common_types.h"
 #include "common/microprofile.h"
@@ -15,12 +16,66 @@ MICROPROFILE_DEFINE(OpenGL_ResourceDeletion, "OpenGL", "Resource Deletion", MP_R
 
 namespace OpenGL {
 
+namespace {
+
+/**
+ * Pool of OpenGL object names for a single object type. Names are generated in batches instead
+ * of one glGen* call per object, and deletions are queued up and issued as a single glDelete*
+ * call from ReleaseDeferredNames() at the end of the frame. Only fresh names are handed out by
+ * Create(); released names go back to the driver rather than being reused, since textures with
+ * immutable storage cannot be respecified under a recycled name. All access happens from the
+ * thread that owns the GL context, so no synchronization is needed.
+ */
+class NamePool {
+public:
+    using GenFunction = PFNGLGENTEXTURESPROC;
+    using DeleteFunction = PFNGLDELETETEXTURESPROC;
+
+    GLuint Create(GenFunction gen_names) {
+        if (free_names.empty()) {
+            free_names.resize(GenBatchSize);
+            gen_names(static_cast<GLsizei>(GenBatchSize), free_names.data());
+        }
+        const GLuint name = free_names.back();
+        free_names.pop_back();
+        return name;
+    }
+
+    void DeferRelease(GLuint name) {
+        pending_deletes.push_back(name);
+    }
+
+    void ReleaseDeferredNames(DeleteFunction delete_names) {
+        if (pending_deletes.empty())
+            return;
+        delete_names(static_cast<GLsizei>(pending_deletes.size()), pending_deletes.data());
+        pending_deletes.clear();
+    }
+
+private:
+    static constexpr std::size_t GenBatchSize = 64;
+
+    std::vector<GLuint> free_names;
+    std::vector<GLuint> pending_deletes;
+};
+
+NamePool texture_name_pool;
+NamePool buffer_name_pool;
+
+} // Anonymous namespace
+
+void ReleaseDeferredResources() {
+    MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
+    texture_name_pool.ReleaseDeferredNames(glDeleteTextures);
+    buffer_name_pool.ReleaseDeferredNames(glDeleteBuffers);
+}
+
 void OGLTexture::Create() {
     if (handle != 0)
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
-    glGenTextures(1, &handle);
+    handle = texture_name_pool.Create(glGenTextures);
 }
 
 void OGLTexture::Release() {
@@ -28,7 +83,7 @@ void OGLTexture::Release() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
-    glDeleteTextures(1, &handle);
+    texture_name_pool.DeferRelease(handle);
     OpenGLState::GetCurState().UnbindTexture(handle).Apply();
     handle = 0;
 }
@@ -84,6 +139,24 @@ void OGLProgram::CreateFromSource(const char* vert_shader, const char* geo_shade
     Create(separable_program, vert.handle, geo.handle, frag.handle);
 }
 
+bool OGLProgram::CreateFromBinary(GLenum binary_format, const u8* binary, std::size_t length) {
+    if (handle != 0)
+        return true;
+
+    MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
+    const GLuint program = glCreateProgram();
+    glProgramBinary(program, binary_format, binary, static_cast<GLsizei>(length));
+
+    GLint link_status{};
+    glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+    if (link_status != GL_TRUE) {
+        glDeleteProgram(program);
+        return false;
+    }
+    handle = program;
+    return true;
+}
+
 void OGLProgram::Release() {
     if (handle == 0)
         return;
@@ -117,7 +190,7 @@ void OGLBuffer::Create() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceCreation);
-    glGenBuffers(1, &handle);
+    handle = buffer_name_pool.Create(glGenBuffers);
 }
 
 void OGLBuffer::Release() {
@@ -125,7 +198,7 @@ void OGLBuffer::Release() {
         return;
 
     MICROPROFILE_SCOPE(OpenGL_ResourceDeletion);
-    glDeleteBuffers(1, &handle);
+    buffer_name_pool.DeferRelease(handle);
     OpenGLState::GetCurState().ResetBuffer(handle).Apply();
     handle = 0;
 }
@@ -11,6 +11,14 @@
 
 namespace OpenGL {
 
+/**
+ * Issues the batched glDelete* calls for all resources released since the last call. Texture and
+ * buffer deletions are deferred here so that surface churn within a frame costs one driver call
+ * per object type instead of one per object. Must be called once per frame with the GL context
+ * current, after rendering has finished.
+ */
+void ReleaseDeferredResources();
+
 class OGLTexture : private NonCopyable {
 public:
     OGLTexture() = default;
@@ -111,6 +119,9 @@ public:
     void CreateFromSource(const char* vert_shader, const char* geo_shader, const char* frag_shader,
                           bool separable_program = false);
 
+    /// Creates a program from a driver binary blob, returning false if the driver rejected it
+    bool CreateFromBinary(GLenum binary_format, const u8* binary, std::size_t length);
+
     /// Deletes the internal OpenGL resource
     void Release();
 
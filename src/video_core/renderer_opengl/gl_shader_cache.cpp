@@ -2,19 +2,31 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <cstring>
+#include <thread>
+
 #include <boost/functional/hash.hpp>
+#include <fmt/format.h>
 #include "common/assert.h"
+#include "common/file_util.h"
 #include "common/hash.h"
+#include "common/host_trace.h"
+#include "common/perf_counters.h"
 #include "core/core.h"
 #include "core/memory.h"
+#include "core/settings.h"
 #include "video_core/engines/maxwell_3d.h"
+#include "video_core/engines/shader_header.h"
 #include "video_core/renderer_opengl/gl_rasterizer.h"
 #include "video_core/renderer_opengl/gl_shader_cache.h"
+#include "video_core/renderer_opengl/gl_shader_decompiler.h"
 #include "video_core/renderer_opengl/gl_shader_manager.h"
 #include "video_core/renderer_opengl/utils.h"
 
 namespace OpenGL {
 
+static constexpr u32 PROGRAM_OFFSET{10};
+
 /// Gets the address for the specified shader stage program
 static VAddr GetShaderAddress(Maxwell::ShaderProgram program) {
     const auto& gpu = Core::System::GetInstance().GPU().Maxwell3D();
@@ -30,9 +42,55 @@ static GLShader::ProgramCode GetShaderCode(VAddr addr) {
     return program_code;
 }
 
-/// Helper function to set shader uniform block bindings for a single shader stage
-static void SetShaderUniformBlockBinding(GLuint shader, const char* name,
-                                         Maxwell::ShaderStage binding, std::size_t expected_size) {
+/// Returns the file name suffix identifying the stage of a shader corpus dump
+static const char* GetCorpusStageSuffix(Maxwell::ShaderProgram program_type) {
+    switch (program_type) {
+    case Maxwell::ShaderProgram::VertexA:
+        return "vsa";
+    case Maxwell::ShaderProgram::VertexB:
+        return "vs";
+    case Maxwell::ShaderProgram::Geometry:
+        return "gs";
+    case Maxwell::ShaderProgram::Fragment:
+        return "fs";
+    default:
+        return "unk";
+    }
+}
+
+/**
+ * Dumps the raw Maxwell bytecode of a shader into <dump>/shader_corpus/, keyed by its unique
+ * identifier, so yuzu-shader-bench can replay decompilation and driver compilation offline.
+ * Dual vertex programs additionally dump their VertexB half next to the VertexA file.
+ */
+static void DumpShaderToCorpus(const GLShader::ShaderSetup& setup,
+                               Maxwell::ShaderProgram program_type) {
+    const std::string corpus_dir =
+        FileUtil::GetUserPath(FileUtil::UserPath::DumpDir) + "shader_corpus/";
+    if (!FileUtil::CreateFullPath(corpus_dir)) {
+        LOG_ERROR(Render_OpenGL, "Failed to create shader corpus directory {}", corpus_dir);
+        return;
+    }
+    const auto dump = [&corpus_dir, &setup](const char* suffix, const GLShader::ProgramCode& code,
+                                            std::size_t size_in_bytes) {
+        const std::string path =
+            fmt::format("{}{:016x}-{}.bin", corpus_dir, setup.program.unique_identifier, suffix);
+        if (FileUtil::Exists(path)) {
+            return;
+        }
+        FileUtil::IOFile file{path, "wb"};
+        if (file.IsOpen()) {
+            file.WriteBytes(code.data(), size_in_bytes);
+        }
+    };
+    dump(GetCorpusStageSuffix(program_type), setup.program.code, setup.program.real_size);
+    if (setup.IsDualProgram()) {
+        dump("vsb", setup.program.code_b, setup.program.real_size_b);
+    }
+}
+
+/// Helper function to validate the size of a single stage config uniform block
+static void ValidateUniformBlockSize(GLuint shader, const char* name, std::size_t expected_size) {
     const GLuint ub_index = glGetUniformBlockIndex(shader, name);
     if (ub_index == GL_INVALID_INDEX) {
         return;
@@ -42,44 +100,50 @@ static void SetShaderUniformBlockBinding(GLuint shader, const char* name,
     glGetActiveUniformBlockiv(shader, ub_index, GL_UNIFORM_BLOCK_DATA_SIZE, &ub_size);
     ASSERT_MSG(static_cast<std::size_t>(ub_size) == expected_size,
                "Uniform block size did not match! Got {}, expected {}", ub_size, expected_size);
-    glUniformBlockBinding(shader, ub_index, static_cast<GLuint>(binding));
 }
 
-/// Sets shader uniform block bindings for an entire shader program
-static void SetShaderUniformBlockBindings(GLuint shader) {
-    SetShaderUniformBlockBinding(shader, "vs_config", Maxwell::ShaderStage::Vertex,
-                                 sizeof(GLShader::MaxwellUniformData));
-    SetShaderUniformBlockBinding(shader, "gs_config", Maxwell::ShaderStage::Geometry,
-                                 sizeof(GLShader::MaxwellUniformData));
-    SetShaderUniformBlockBinding(shader, "fs_config", Maxwell::ShaderStage::Fragment,
-                                 sizeof(GLShader::MaxwellUniformData));
+/// Returns true when new programs should be linked on the driver's compiler threads
+static bool IsAsyncCompileEnabled() {
+    return Settings::values.use_asynchronous_shaders && GLAD_GL_ARB_parallel_shader_compile;
+}
+
+/// Sanity checks the stage config uniform blocks of a linked shader program. The generated GLSL
+/// carries static layout(binding) qualifiers, so no bindings have to be assigned here.
+static void ValidateUniformBlockSizes(GLuint shader) {
+    ValidateUniformBlockSize(shader, "vs_config", sizeof(GLShader::MaxwellUniformData));
+    ValidateUniformBlockSize(shader, "gs_config", sizeof(GLShader::MaxwellUniformData));
+    ValidateUniformBlockSize(shader, "fs_config", sizeof(GLShader::MaxwellUniformData));
 }
 
-CachedShader::CachedShader(VAddr addr, Maxwell::ShaderProgram program_type)
+CachedShader::CachedShader(VAddr addr, Maxwell::ShaderProgram program_type,
+                           ShaderDiskCacheOpenGL& disk_cache)
     : addr{addr}, program_type{program_type}, setup{GetShaderCode(addr)} {
+    HOST_TRACE_SCOPE("ShaderCompile");
+
+    if (program_type == Maxwell::ShaderProgram::VertexA) {
+        // VertexB is always enabled, so when VertexA is enabled, we have two vertex shaders.
+        // Conventional HW does not support this, so we combine VertexA and VertexB into one
+        // stage here.
+        setup.SetProgramB(GetShaderCode(GetShaderAddress(Maxwell::ShaderProgram::VertexB)));
+    }
+    CalculateProperties();
+
+    if (Settings::values.dump_shader_corpus) {
+        DumpShaderToCorpus(setup, program_type);
+    }
 
     GLShader::ProgramResult program_result;
     GLenum gl_type{};
 
     switch (program_type) {
     case Maxwell::ShaderProgram::VertexA:
-        // VertexB is always enabled, so when VertexA is enabled, we have two vertex shaders.
-        // Conventional HW does not support this, so we combine VertexA and VertexB into one
-        // stage here.
-        setup.SetProgramB(GetShaderCode(GetShaderAddress(Maxwell::ShaderProgram::VertexB)));
     case Maxwell::ShaderProgram::VertexB:
-        CalculateProperties();
-        program_result = GLShader::GenerateVertexShader(setup);
         gl_type = GL_VERTEX_SHADER;
         break;
     case Maxwell::ShaderProgram::Geometry:
-        CalculateProperties();
-        program_result = GLShader::GenerateGeometryShader(setup);
         gl_type = GL_GEOMETRY_SHADER;
         break;
     case Maxwell::ShaderProgram::Fragment:
-        CalculateProperties();
-        program_result = GLShader::GenerateFragmentShader(setup);
         gl_type = GL_FRAGMENT_SHADER;
         break;
     default:
@@ -88,61 +152,227 @@ CachedShader::CachedShader(VAddr addr, Maxwell::ShaderProgram program_type)
         return;
     }
 
+    // On warm runs the disk cache lets us skip the decompiler entirely, and the program
+    // binary (when the driver still matches) lets us skip compilation too.
+    const ShaderDiskCacheEntry* precompiled{disk_cache.GetEntry(setup.program.unique_identifier)};
+    if (precompiled != nullptr) {
+        program_result = {precompiled->code, precompiled->entries};
+    } else {
+        switch (program_type) {
+        case Maxwell::ShaderProgram::VertexA:
+        case Maxwell::ShaderProgram::VertexB:
+            program_result = GLShader::GenerateVertexShader(setup);
+            break;
+        case Maxwell::ShaderProgram::Geometry:
+            program_result = GLShader::GenerateGeometryShader(setup);
+            break;
+        case Maxwell::ShaderProgram::Fragment:
+            program_result = GLShader::GenerateFragmentShader(setup);
+            break;
+        default:
+            return;
+        }
+    }
+
     entries = program_result.second;
     shader_length = entries.shader_length;
 
     if (program_type != Maxwell::ShaderProgram::Geometry) {
-        OGLShader shader;
-        shader.Create(program_result.first.c_str(), gl_type);
-        program.Create(true, shader.handle);
-        SetShaderUniformBlockBindings(program.handle);
-        LabelGLObject(GL_PROGRAM, program.handle, addr);
+        if (precompiled == nullptr || !precompiled->HasProgramBinary() ||
+            !program.CreateFromBinary(precompiled->binary_format, precompiled->binary.data(),
+                                      precompiled->binary.size())) {
+            if (IsAsyncCompileEnabled()) {
+                CompileDeferred(program, program_result.first, gl_type);
+                link_pending = true;
+            } else {
+                OGLShader shader;
+                shader.Create(program_result.first.c_str(), gl_type);
+                program.Create(true, shader.handle);
+            }
+        }
+        if (!link_pending) {
+            ValidateUniformBlockSizes(program.handle);
+            LabelGLObject(GL_PROGRAM, program.handle, addr);
+        }
     } else {
-        // Store shader's code to lazily build it on draw
         geometry_programs.code = program_result.first;
+
+        // Analyze the bytecode rather than the generated GLSL so warm disk cache runs, which
+        // skip the decompiler entirely, reach the same verdict.
+        Tegra::Shader::Header header;
+        std::memcpy(&header, setup.program.code.data(), sizeof(header));
+        gs_output_vertices = header.common4.max_output_vertices;
+        is_passthrough_geometry =
+            GLShader::Decompiler::IsPassthroughGeometryShader(setup.program.code, PROGRAM_OFFSET);
+
+        if (IsAsyncCompileEnabled()) {
+            PrecompileGeometryPrograms();
+        }
+        // Otherwise the topology variants are lazily built on first draw.
+    }
+
+    if (precompiled == nullptr) {
+        auto disk_entry{std::make_unique<ShaderDiskCacheEntry>()};
+        disk_entry->unique_identifier = setup.program.unique_identifier;
+        disk_entry->program_type = static_cast<u32>(program_type);
+        disk_entry->code = program_result.first;
+        disk_entry->entries = entries;
+        if (link_pending) {
+            // The program binary is not available until the link completes - hold the entry
+            // back and write it out when the link is validated.
+            pending_disk_cache = &disk_cache;
+            pending_disk_entry = std::move(disk_entry);
+        } else {
+            disk_cache.SaveEntry(std::move(*disk_entry), program.handle);
+        }
     }
 }
 
-GLuint CachedShader::GetProgramResourceIndex(const GLShader::ConstBufferEntry& buffer) {
-    const auto search{resource_cache.find(buffer.GetHash())};
-    if (search == resource_cache.end()) {
-        const GLuint index{
-            glGetProgramResourceIndex(program.handle, GL_UNIFORM_BLOCK, buffer.GetName().c_str())};
-        resource_cache[buffer.GetHash()] = index;
-        return index;
+bool CachedShader::IsProgramReady() {
+    if (program_type == Maxwell::ShaderProgram::Geometry) {
+        return AreGeometryProgramsReady();
+    }
+    if (!link_pending) {
+        return true;
+    }
+    GLint completed{GL_TRUE};
+    glGetProgramiv(program.handle, GL_COMPLETION_STATUS_ARB, &completed);
+    if (completed != GL_TRUE) {
+        return false;
     }
+    FinishLink();
+    return true;
+}
 
-    return search->second;
+bool CachedShader::IsPassthroughGeometryShader(GLenum primitive_mode) const {
+    if (!is_passthrough_geometry) {
+        return false;
+    }
+    // The shader copies whole input primitives, so it is only skippable when it emits exactly one
+    // primitive of the same class as its input. Adjacency topologies are kept; dropping their
+    // shader would change the primitive type the rasterizer sees.
+    switch (primitive_mode) {
+    case GL_POINTS:
+        return gs_output_vertices == 1;
+    case GL_LINES:
+    case GL_LINE_STRIP:
+        return gs_output_vertices == 2;
+    case GL_TRIANGLES:
+    case GL_TRIANGLE_STRIP:
+    case GL_TRIANGLE_FAN:
+        return gs_output_vertices == 3;
+    default:
+        return false;
+    }
 }
 
-GLint CachedShader::GetUniformLocation(const GLShader::SamplerEntry& sampler) {
-    const auto search{uniform_cache.find(sampler.GetHash())};
-    if (search == uniform_cache.end()) {
-        const GLint index{glGetUniformLocation(program.handle, sampler.GetName().c_str())};
-        uniform_cache[sampler.GetHash()] = index;
-        return index;
+void CachedShader::CompileDeferred(OGLProgram& target_program, const std::string& source,
+                                   GLenum gl_type) {
+    static auto& compile_counter = Common::GetPerfCounter("gpu_shader_compiles");
+    compile_counter.Add();
+
+    const GLuint shader{glCreateShader(gl_type)};
+    const char* source_ptr{source.c_str()};
+    glShaderSource(shader, 1, &source_ptr, nullptr);
+    glCompileShader(shader);
+
+    // Deliberately avoid querying any compile or link status here - doing so would stall until
+    // the driver's compiler threads finish. Status is validated when the link is finished.
+    target_program.handle = glCreateProgram();
+    glProgramParameteri(target_program.handle, GL_PROGRAM_SEPARABLE, GL_TRUE);
+    glAttachShader(target_program.handle, shader);
+    glLinkProgram(target_program.handle);
+    glDetachShader(target_program.handle, shader);
+    glDeleteShader(shader);
+}
+
+void CachedShader::FinishDeferredLink(OGLProgram& target_program, const std::string& debug_name) {
+    GLint result{GL_FALSE};
+    glGetProgramiv(target_program.handle, GL_LINK_STATUS, &result);
+    if (result != GL_TRUE) {
+        GLint info_log_length{};
+        glGetProgramiv(target_program.handle, GL_INFO_LOG_LENGTH, &info_log_length);
+        std::string program_error(info_log_length, ' ');
+        glGetProgramInfoLog(target_program.handle, info_log_length, nullptr,
+                            program_error.data());
+        LOG_ERROR(Render_OpenGL, "Error linking shader:\n{}", program_error);
     }
+    ASSERT_MSG(result == GL_TRUE, "Shader not linked");
 
-    return search->second;
+    ValidateUniformBlockSizes(target_program.handle);
+    LabelGLObject(GL_PROGRAM, target_program.handle, addr, debug_name);
 }
 
-GLuint CachedShader::LazyGeometryProgram(OGLProgram& target_program,
-                                         const std::string& glsl_topology, u32 max_vertices,
-                                         const std::string& debug_name) {
-    if (target_program.handle != 0) {
-        return target_program.handle;
+void CachedShader::FinishLink() {
+    FinishDeferredLink(program, {});
+    link_pending = false;
+
+    if (pending_disk_entry) {
+        pending_disk_cache->SaveEntry(std::move(*pending_disk_entry), program.handle);
+        pending_disk_entry.reset();
     }
+}
+
+void CachedShader::PrecompileGeometryPrograms() {
+    const auto compile = [this](GeometryProgram& variant, const char* glsl_topology,
+                                u32 max_vertices) {
+        CompileDeferred(variant.program, GeometryShaderSource(glsl_topology, max_vertices),
+                        GL_GEOMETRY_SHADER);
+        variant.link_pending = true;
+    };
+    compile(geometry_programs.points, "points", 1);
+    compile(geometry_programs.lines, "lines", 2);
+    compile(geometry_programs.lines_adjacency, "lines_adjacency", 4);
+    compile(geometry_programs.triangles, "triangles", 3);
+    compile(geometry_programs.triangles_adjacency, "triangles_adjacency", 6);
+}
+
+bool CachedShader::AreGeometryProgramsReady() {
+    bool ready = true;
+    const auto poll = [&](GeometryProgram& variant, const char* debug_name) {
+        if (!variant.link_pending) {
+            return;
+        }
+        GLint completed{GL_TRUE};
+        glGetProgramiv(variant.program.handle, GL_COMPLETION_STATUS_ARB, &completed);
+        if (completed != GL_TRUE) {
+            ready = false;
+            return;
+        }
+        FinishDeferredLink(variant.program, debug_name);
+        variant.link_pending = false;
+    };
+    poll(geometry_programs.points, "ShaderPoints");
+    poll(geometry_programs.lines, "ShaderLines");
+    poll(geometry_programs.lines_adjacency, "ShaderLinesAdjacency");
+    poll(geometry_programs.triangles, "ShaderTriangles");
+    poll(geometry_programs.triangles_adjacency, "ShaderTrianglesAdjacency");
+    return ready;
+}
+
+std::string CachedShader::GeometryShaderSource(const std::string& glsl_topology,
+                                               u32 max_vertices) const {
     std::string source = "#version 430 core\n";
     source += "layout (" + glsl_topology + ") in;\n";
     source += "#define MAX_VERTEX_INPUT " + std::to_string(max_vertices) + '\n';
     source += geometry_programs.code;
+    return source;
+}
+
+GLuint CachedShader::LazyGeometryProgram(GeometryProgram& target_program,
+                                         const std::string& glsl_topology, u32 max_vertices,
+                                         const std::string& debug_name) {
+    if (target_program.program.handle != 0) {
+        return target_program.program.handle;
+    }
+    const std::string source = GeometryShaderSource(glsl_topology, max_vertices);
 
     OGLShader shader;
     shader.Create(source.c_str(), GL_GEOMETRY_SHADER);
-    target_program.Create(true, shader.handle);
-    SetShaderUniformBlockBindings(target_program.handle);
-    LabelGLObject(GL_PROGRAM, target_program.handle, addr, debug_name);
-    return target_program.handle;
+    target_program.program.Create(true, shader.handle);
+    ValidateUniformBlockSizes(target_program.program.handle);
+    LabelGLObject(GL_PROGRAM, target_program.program.handle, addr, debug_name);
+    return target_program.program.handle;
 };
 
 static bool IsSchedInstruction(std::size_t offset, std::size_t main_offset) {
@@ -185,7 +415,13 @@ void CachedShader::CalculateProperties() {
     }
 }
 
-ShaderCacheOpenGL::ShaderCacheOpenGL(RasterizerOpenGL& rasterizer) : RasterizerCache{rasterizer} {}
+ShaderCacheOpenGL::ShaderCacheOpenGL(RasterizerOpenGL& rasterizer) : RasterizerCache{rasterizer} {
+    if (GLAD_GL_ARB_parallel_shader_compile) {
+        // Ask the driver to spin up its own compiler thread pool so deferred links complete in
+        // the background while emulation keeps running.
+        glMaxShaderCompilerThreadsARB(std::thread::hardware_concurrency());
+    }
+}
 
 Shader ShaderCacheOpenGL::GetStageProgram(Maxwell::ShaderProgram program) {
     const VAddr program_addr{GetShaderAddress(program)};
@@ -194,8 +430,9 @@ Shader ShaderCacheOpenGL::GetStageProgram(Maxwell::ShaderProgram program) {
     Shader shader{TryGet(program_addr)};
 
     if (!shader) {
-        // No shader found - create a new one
-        shader = std::make_shared<CachedShader>(program_addr, program);
+        // No shader found - create a new one, feeding it from the disk cache when possible
+        disk_cache.LoadCache();
+        shader = std::make_shared<CachedShader>(program_addr, program, disk_cache);
         Register(shader);
     }
 
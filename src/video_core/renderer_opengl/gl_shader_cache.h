@@ -4,13 +4,13 @@
 
 #pragma once
 
-#include <map>
 #include <memory>
 
 #include "common/assert.h"
 #include "common/common_types.h"
 #include "video_core/rasterizer_cache.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
+#include "video_core/renderer_opengl/gl_shader_disk_cache.h"
 #include "video_core/renderer_opengl/gl_shader_gen.h"
 
 namespace OpenGL {
@@ -23,7 +23,8 @@ using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
 class CachedShader final : public RasterizerCacheObject {
 public:
-    CachedShader(VAddr addr, Maxwell::ShaderProgram program_type);
+    CachedShader(VAddr addr, Maxwell::ShaderProgram program_type,
+                 ShaderDiskCacheOpenGL& disk_cache);
 
     VAddr GetAddr() const override {
         return addr;
@@ -70,17 +71,46 @@ public:
         }
     }
 
-    /// Gets the GL program resource location for the specified resource, caching as needed
-    GLuint GetProgramResourceIndex(const GLShader::ConstBufferEntry& buffer);
+    /// Returns true when the program has finished linking and can be bound for drawing. Always
+    /// true when asynchronous shader compilation is disabled.
+    bool IsProgramReady();
 
-    /// Gets the GL uniform location for the specified resource, caching as needed
-    GLint GetUniformLocation(const GLShader::SamplerEntry& sampler);
+    /// Returns true when this geometry shader only copies its input primitive to the output
+    /// stream, so the whole stage can be dropped for the given primitive topology.
+    bool IsPassthroughGeometryShader(GLenum primitive_mode) const;
 
 private:
+    /// A geometry program specialized for one input topology class.
+    struct GeometryProgram {
+        OGLProgram program;
+        bool link_pending{};
+    };
+
     /// Generates a geometry shader or returns one that already exists.
-    GLuint LazyGeometryProgram(OGLProgram& target_program, const std::string& glsl_topology,
+    GLuint LazyGeometryProgram(GeometryProgram& target_program, const std::string& glsl_topology,
                                u32 max_vertices, const std::string& debug_name);
 
+    /// Kicks off deferred compiles for every topology variant so the driver's compiler threads
+    /// build them in the background instead of the first draw stalling on a mid-frame compile.
+    void PrecompileGeometryPrograms();
+
+    /// Polls the pending topology variants, finishing the links that completed. Returns true
+    /// once every variant is ready to be bound.
+    bool AreGeometryProgramsReady();
+
+    /// Builds the final source of a topology variant from the stored geometry shader code.
+    std::string GeometryShaderSource(const std::string& glsl_topology, u32 max_vertices) const;
+
+    /// Compiles and links a program without querying any status, letting the driver finish
+    /// the link on one of its own compiler threads.
+    void CompileDeferred(OGLProgram& target_program, const std::string& source, GLenum gl_type);
+
+    /// Validates a deferred link and performs the per-program setup that had to wait for it.
+    void FinishDeferredLink(OGLProgram& target_program, const std::string& debug_name);
+
+    /// Validates the main program's deferred link and flushes the held back disk cache entry.
+    void FinishLink();
+
     void CalculateProperties();
 
     VAddr addr;
@@ -97,15 +127,22 @@ private:
     // topology class.
     struct {
         std::string code;
-        OGLProgram points;
-        OGLProgram lines;
-        OGLProgram lines_adjacency;
-        OGLProgram triangles;
-        OGLProgram triangles_adjacency;
+        GeometryProgram points;
+        GeometryProgram lines;
+        GeometryProgram lines_adjacency;
+        GeometryProgram triangles;
+        GeometryProgram triangles_adjacency;
     } geometry_programs;
 
-    std::map<u32, GLuint> resource_cache;
-    std::map<u32, GLint> uniform_cache;
+    // True when the geometry shader provably only copies its input primitive to the output
+    // stream; gs_output_vertices holds the vertex count it emits per primitive.
+    bool is_passthrough_geometry{};
+    u32 gs_output_vertices{};
+
+    // Deferred link state used by asynchronous shader compilation.
+    bool link_pending{};
+    ShaderDiskCacheOpenGL* pending_disk_cache{};
+    std::unique_ptr<ShaderDiskCacheEntry> pending_disk_entry;
 };
 
 class ShaderCacheOpenGL final : public RasterizerCache<Shader> {
@@ -114,6 +151,9 @@ public:
 
     /// Gets the current specified shader stage program
     Shader GetStageProgram(Maxwell::ShaderProgram program);
+
+private:
+    ShaderDiskCacheOpenGL disk_cache;
 };
 
 } // namespace OpenGL
@@ -2,11 +2,14 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <array>
+#include <iterator>
 #include <map>
 #include <optional>
 #include <set>
 #include <string>
 #include <string_view>
+#include <type_traits>
 #include <unordered_set>
 
 #include <fmt/format.h>
@@ -51,11 +54,10 @@ public:
 };
 
 /// Generates code to use for a swizzle operation.
-static std::string GetSwizzle(u64 elem) {
+static const char* GetSwizzle(u64 elem) {
     ASSERT(elem <= 3);
-    std::string swizzle = ".";
-    swizzle += "xyzw"[elem];
-    return swizzle;
+    constexpr std::array<const char*, 4> swizzle{".x", ".y", ".z", ".w"};
+    return swizzle[elem];
 }
 
 /// Translate topology
@@ -246,6 +248,12 @@ private:
 
 class ShaderWriter {
 public:
+    /// The reserve hint avoids repeated reallocation of the output buffer while the program is
+    /// emitted; generated sources run into hundreds of kilobytes.
+    explicit ShaderWriter(std::size_t reserve_hint) {
+        shader_source.reserve(reserve_hint);
+    }
+
     void AddExpression(std::string_view text) {
         DEBUG_ASSERT(scope >= 0);
         if (!text.empty()) {
@@ -266,6 +274,15 @@ public:
         AddNewLine();
     }
 
+    /// Formats a line directly into the output buffer, avoiding a formatted temporary
+    template <typename... Args, typename = std::enable_if_t<sizeof...(Args) != 0>>
+    void AddLine(const char* format, const Args&... args) {
+        DEBUG_ASSERT(scope >= 0);
+        AppendIndentation();
+        fmt::format_to(std::back_inserter(shader_source), format, args...);
+        AddNewLine();
+    }
+
     void AddNewLine() {
         DEBUG_ASSERT(scope >= 0);
         shader_source += '\n';
@@ -306,12 +323,12 @@ public:
     GLSLRegister(std::size_t index, const std::string& suffix) : index{index}, suffix{suffix} {}
 
     /// Gets the GLSL type string for a register
-    static std::string GetTypeString() {
+    static constexpr const char* GetTypeString() {
         return "float";
     }
 
     /// Gets the GLSL register prefix string, used for declarations and referencing
-    static std::string GetPrefixString() {
+    static constexpr const char* GetPrefixString() {
         return "reg_";
     }
 
@@ -497,7 +514,7 @@ public:
                                     std::optional<Register> vertex = {}) {
         const std::string dest = GetRegisterAsFloat(reg);
         const std::string src = GetInputAttribute(attribute, input_mode, vertex) + GetSwizzle(elem);
-        shader.AddLine(dest + " = " + src + ';');
+        shader.AddLine("{} = {};", dest, src);
     }
 
     std::string GetLocalMemoryAsFloat(const std::string& index) {
@@ -510,13 +527,13 @@ public:
     }
 
     void SetLocalMemoryAsFloat(const std::string& index, const std::string& value) {
-        shader.AddLine("lmem[" + index + "] = " + value + ';');
+        shader.AddLine("lmem[{}] = {};", index, value);
     }
 
     void SetLocalMemoryAsInteger(const std::string& index, const std::string& value,
                                  bool is_signed = false) {
         const std::string func{is_signed ? "intBitsToFloat" : "uintBitsToFloat"};
-        shader.AddLine("lmem[" + index + "] = " + func + '(' + value + ");");
+        shader.AddLine("lmem[{}] = {}({});", index, func, value);
     }
 
     std::string GetConditionCode(const Tegra::Shader::ConditionCode cc) const {
@@ -537,7 +554,7 @@ public:
     }
 
     void SetInternalFlag(const InternalFlag flag, const std::string& value) const {
-        shader.AddLine(GetInternalFlag(flag) + " = " + value + ';');
+        shader.AddLine("{} = {};", GetInternalFlag(flag), value);
     }
 
     /**
@@ -563,9 +580,8 @@ public:
             // drivers from complaining about out of boundary writes, guard them.
             const std::string buf_index{"((" + GetRegisterAsInteger(buf_reg) + ") % " +
                                         std::to_string(MAX_GEOMETRY_BUFFERS) + ')'};
-            shader.AddLine("amem[" + buf_index + "][" +
-                           std::to_string(static_cast<u32>(attribute)) + ']' + GetSwizzle(elem) +
-                           " = " + src + ';');
+            shader.AddLine("amem[{}][{}]{} = {};", buf_index, static_cast<u32>(attribute),
+                           GetSwizzle(elem), src);
             return;
         }
 
@@ -579,15 +595,15 @@ public:
 
             clip_distances[index] = true;
             fixed_pipeline_output_attributes_used.insert(attribute);
-            shader.AddLine(dest + '[' + std::to_string(index) + "] = " + src + ';');
+            shader.AddLine("{}[{}] = {};", dest, index, src);
             break;
         }
         case Attribute::Index::PointSize:
             fixed_pipeline_output_attributes_used.insert(attribute);
-            shader.AddLine(dest + " = " + src + ';');
+            shader.AddLine("{} = {};", dest, src);
             break;
         default:
-            shader.AddLine(dest + GetSwizzle(elem) + " = " + src + ';');
+            shader.AddLine("{}{} = {};", dest, GetSwizzle(elem), src);
             break;
         }
     }
@@ -689,11 +705,15 @@ public:
     }
 
 private:
-    /// Generates declarations for registers.
+    /// Generates declarations for registers. Only registers the decompiled code actually
+    /// referenced are declared; the rest would be dead globals the driver has to eliminate.
     void GenerateRegisters(const std::string& suffix) {
         for (const auto& reg : regs) {
-            declarations.AddLine(GLSLRegister::GetTypeString() + ' ' + reg.GetPrefixString() +
-                                 std::to_string(reg.GetIndex()) + '_' + suffix + " = 0;");
+            if (!used_registers[reg.GetIndex()]) {
+                continue;
+            }
+            declarations.AddLine("{} {}{}_{} = 0;", GLSLRegister::GetTypeString(),
+                                 reg.GetPrefixString(), reg.GetIndex(), suffix);
         }
         declarations.AddNewLine();
     }
@@ -701,8 +721,7 @@ private:
     /// Generates declarations for local memory.
     void GenerateLocalMemory() {
         if (local_memory_size > 0) {
-            declarations.AddLine("float lmem[" + std::to_string((local_memory_size - 1 + 4) / 4) +
-                                 "];");
+            declarations.AddLine("float lmem[{}];", (local_memory_size - 1 + 4) / 4);
             declarations.AddNewLine();
         }
     }
@@ -711,7 +730,7 @@ private:
     void GenerateInternalFlags() {
         for (u32 flag = 0; flag < static_cast<u32>(InternalFlag::Amount); flag++) {
             const InternalFlag code = static_cast<InternalFlag>(flag);
-            declarations.AddLine("bool " + GetInternalFlag(code) + " = false;");
+            declarations.AddLine("bool {} = false;", GetInternalFlag(code));
         }
         declarations.AddNewLine();
     }
@@ -731,8 +750,8 @@ private:
             if (stage == Maxwell3D::Regs::ShaderStage::Geometry) {
                 attr = "gs_" + attr + "[]";
             }
-            declarations.AddLine("layout (location = " + std::to_string(idx) + ") " +
-                                 GetInputFlags(element.first) + "in vec4 " + attr + ';');
+            declarations.AddLine("layout (location = {}) {}in vec4 {};", idx,
+                                 GetInputFlags(element.first), attr);
         }
 
         declarations.AddNewLine();
@@ -745,31 +764,35 @@ private:
             const u32 idx = static_cast<u32>(index) -
                             static_cast<u32>(Attribute::Index::Attribute_0) +
                             GENERIC_VARYING_START_LOCATION;
-            declarations.AddLine("layout (location = " + std::to_string(idx) + ") out vec4 " +
-                                 GetOutputAttribute(index) + ';');
+            declarations.AddLine("layout (location = {}) out vec4 {};", idx,
+                                 GetOutputAttribute(index));
         }
         declarations.AddNewLine();
     }
 
-    /// Generates declarations for constant buffers.
+    /// Generates declarations for constant buffers. Binding points are assigned statically from
+    /// the entry's position so the rasterizer never has to query or patch them at draw time.
     void GenerateConstBuffers() {
+        u32 binding = GetConstBufferBinding(stage, 0);
         for (const auto& entry : GetConstBuffersDeclarations()) {
-            declarations.AddLine("layout (std140) uniform " + entry.GetName());
+            declarations.AddLine("layout (std140, binding = {}) uniform {}", binding++,
+                                 entry.GetName());
             declarations.AddLine('{');
-            declarations.AddLine("    vec4 c" + std::to_string(entry.GetIndex()) +
-                                 "[MAX_CONSTBUFFER_ELEMENTS];");
+            declarations.AddLine("    vec4 c{}[MAX_CONSTBUFFER_ELEMENTS];", entry.GetIndex());
             declarations.AddLine("};");
             declarations.AddNewLine();
         }
         declarations.AddNewLine();
     }
 
-    /// Generates declarations for samplers.
+    /// Generates declarations for samplers. Texture units are assigned statically from the
+    /// entry's position so the rasterizer never has to query or patch them at draw time.
     void GenerateSamplers() {
         const auto& samplers = GetSamplers();
+        u32 binding = GetTextureBinding(stage, 0);
         for (const auto& sampler : samplers) {
-            declarations.AddLine("uniform " + sampler.GetTypeString() + ' ' + sampler.GetName() +
-                                 ';');
+            declarations.AddLine("layout (binding = {}) uniform {} {};", binding++,
+                                 sampler.GetTypeString(), sampler.GetName());
         }
         declarations.AddNewLine();
     }
@@ -779,13 +802,12 @@ private:
         if (stage != Maxwell3D::Regs::ShaderStage::Geometry)
             return;
 
-        declarations.AddLine(
-            "layout (" + GetTopologyName(header.common3.output_topology) +
-            ", max_vertices = " + std::to_string(header.common4.max_output_vertices) + ") out;");
+        declarations.AddLine("layout ({}, max_vertices = {}) out;",
+                             GetTopologyName(header.common3.output_topology),
+                             static_cast<u32>(header.common4.max_output_vertices));
         declarations.AddNewLine();
 
-        declarations.AddLine("vec4 amem[" + std::to_string(MAX_GEOMETRY_BUFFERS) + "][" +
-                             std::to_string(MAX_ATTRIBUTES) + "];");
+        declarations.AddLine("vec4 amem[{}][{}];", MAX_GEOMETRY_BUFFERS, MAX_ATTRIBUTES);
         declarations.AddNewLine();
 
         constexpr char buffer[] = "amem[output_buffer]";
@@ -837,7 +859,9 @@ private:
             return "0";
         }
 
-        return regs[reg.GetSwizzledIndex(elem)].GetString();
+        const u64 index = reg.GetSwizzledIndex(elem);
+        used_registers[index] = true;
+        return regs[index].GetString();
     }
 
     /**
@@ -1015,6 +1039,7 @@ private:
     ShaderWriter& shader;
     ShaderWriter& declarations;
     std::vector<GLSLRegister> regs;
+    std::array<bool, Register::NumRegisters> used_registers{};
     std::unordered_map<Attribute::Index, Tegra::Shader::IpaMode> declr_input_attribute;
     std::set<Attribute::Index> declr_output_attribute;
     std::array<ConstBufferEntry, Maxwell3D::Regs::MaxConstBuffers> declr_const_buffers;
@@ -3792,6 +3817,205 @@ private:
         return program_counter;
     }
 
+    /// Returns whether a BRA-like instruction only takes its branch conditionally.
+    static bool IsBranchConditional(const Instruction& instr) {
+        using Tegra::Shader::Pred;
+        return instr.pred.pred_index != static_cast<u64>(Pred::UnusedIndex) ||
+               instr.flow_condition_code != Tegra::Shader::ConditionCode::T;
+    }
+
+    /// Returns the condition under which a BRA-like instruction takes its branch. The predicate
+    /// and the condition code are combined when the instruction uses both.
+    std::string GetBranchCondition(const Instruction& instr) {
+        using Tegra::Shader::Pred;
+        std::string result;
+        if (instr.pred.pred_index != static_cast<u64>(Pred::UnusedIndex)) {
+            result = GetPredicateCondition(instr.pred.pred_index, instr.negate_pred != 0);
+        }
+        if (instr.flow_condition_code != Tegra::Shader::ConditionCode::T) {
+            const std::string cc = regs.GetConditionCode(instr.flow_condition_code);
+            result = result.empty() ? cc : '(' + result + ") && (" + cc + ')';
+        }
+        return result;
+    }
+
+    /**
+     * Finds the latch of a loop headed at the given offset: the last BRA inside the range that
+     * jumps back to it. Returns PROGRAM_END when the offset heads no loop.
+     */
+    u32 FindBackEdge(u32 head, u32 end) const {
+        const u32 scan_end = std::min(end, static_cast<u32>(shader_length / sizeof(u64)));
+        u32 latch = PROGRAM_END;
+        for (u32 offset = head + 1; offset < scan_end; ++offset) {
+            if (IsSchedInstruction(offset)) {
+                continue;
+            }
+            const Instruction instr = {program_code[offset]};
+            const auto opcode = OpCode::Decode(instr);
+            if (!opcode || opcode->get().GetId() != OpCode::Id::BRA) {
+                continue;
+            }
+            if (instr.bra.constant_buffer == 0 && offset + instr.bra.GetBranchTarget() == head) {
+                latch = offset;
+            }
+        }
+        return latch;
+    }
+
+    /**
+     * Compiles a range of instructions as structured control flow, recovering if/else blocks and
+     * do-while loops from the branch targets. Forward conditional branches guard the code they
+     * skip, an unconditional branch at the end of a guarded block introduces an else, and the
+     * last branch back to the start of a range closes a do-while loop. Conditional jumps to the
+     * instruction following a loop latch become breaks.
+     *
+     * When emit is false nothing is written to the shader and only the structure is validated, so
+     * a failed attempt leaves no partial output behind.
+     *
+     * @param begin the offset of the starting instruction.
+     * @param end the offset where the compilation should stop (exclusive).
+     * @param break_target the offset a branch may jump to as a loop break, PROGRAM_END if none.
+     * @param emit whether to generate code or only check that the range is structurable.
+     * @return false when the range does not reduce to these constructs and the caller has to
+     * fall back to the dispatch loop.
+     */
+    bool CompileStructuredRange(u32 begin, u32 end, u32 break_target, bool emit) {
+        using Tegra::Shader::Pred;
+
+        u32 offset = begin;
+        while (offset < end && offset != PROGRAM_END) {
+            if (IsSchedInstruction(offset)) {
+                ++offset;
+                continue;
+            }
+
+            // Any remaining branch back to this offset makes it the head of a do-while loop.
+            // Back edges from nested loops sharing this head are consumed innermost-first by the
+            // recursive call, which sees the same head as the start of its own range.
+            const u32 latch = FindBackEdge(offset, end);
+            if (latch != PROGRAM_END) {
+                const Instruction latch_instr = {program_code[latch]};
+                if (latch_instr.bra.constant_buffer != 0) {
+                    return false;
+                }
+                if (emit) {
+                    shader.AddLine("do {");
+                    ++shader.scope;
+                }
+                if (!CompileStructuredRange(offset, latch, latch + 1, emit)) {
+                    return false;
+                }
+                if (emit) {
+                    --shader.scope;
+                    const std::string condition = GetBranchCondition(latch_instr);
+                    shader.AddLine("} while (" + (condition.empty() ? "true" : condition) +
+                                   ");");
+                }
+                offset = latch + 1;
+                continue;
+            }
+
+            const Instruction instr = {program_code[offset]};
+            const auto opcode = OpCode::Decode(instr);
+            if (opcode) {
+                switch (opcode->get().GetId()) {
+                case OpCode::Id::SSY:
+                case OpCode::Id::PBK:
+                case OpCode::Id::SYNC:
+                case OpCode::Id::BRK:
+                    // The flow stack has no structured equivalent here, leave these shaders to
+                    // the dispatch loop.
+                    return false;
+                case OpCode::Id::BRA: {
+                    if (instr.bra.constant_buffer != 0) {
+                        return false;
+                    }
+                    const u32 target = offset + instr.bra.GetBranchTarget();
+                    if (target == break_target) {
+                        // A jump to the instruction following the enclosing loop's latch leaves
+                        // the loop.
+                        if (!IsBranchConditional(instr)) {
+                            if (emit) {
+                                shader.AddLine("break;");
+                            }
+                            return true;
+                        }
+                        if (emit) {
+                            shader.AddLine("if (" + GetBranchCondition(instr) + ") {");
+                            ++shader.scope;
+                            shader.AddLine("break;");
+                            --shader.scope;
+                            shader.AddLine('}');
+                        }
+                        ++offset;
+                        continue;
+                    }
+                    if (target <= offset || target > end || !IsBranchConditional(instr)) {
+                        return false;
+                    }
+
+                    // The branch skips [offset + 1, target), so that block executes when the
+                    // condition does not hold. An unconditional branch at its end jumps over an
+                    // else block.
+                    u32 then_end = target;
+                    u32 merge = target;
+                    if (target - 1 > offset && !IsSchedInstruction(target - 1)) {
+                        const Instruction last = {program_code[target - 1]};
+                        const auto last_opcode = OpCode::Decode(last);
+                        if (last_opcode && last_opcode->get().GetId() == OpCode::Id::BRA &&
+                            last.bra.constant_buffer == 0 && !IsBranchConditional(last)) {
+                            const u32 else_end = (target - 1) + last.bra.GetBranchTarget();
+                            if (else_end > target && else_end <= end) {
+                                then_end = target - 1;
+                                merge = else_end;
+                            }
+                        }
+                    }
+
+                    if (emit) {
+                        shader.AddLine("if (!(" + GetBranchCondition(instr) + ")) {");
+                        ++shader.scope;
+                    }
+                    if (!CompileStructuredRange(offset + 1, then_end, break_target, emit)) {
+                        return false;
+                    }
+                    if (merge != target) {
+                        if (emit) {
+                            --shader.scope;
+                            shader.AddLine("} else {");
+                            ++shader.scope;
+                        }
+                        if (!CompileStructuredRange(target, merge, break_target, emit)) {
+                            return false;
+                        }
+                    }
+                    if (emit) {
+                        --shader.scope;
+                        shader.AddLine('}');
+                    }
+                    offset = merge;
+                    continue;
+                }
+                default:
+                    break;
+                }
+            }
+
+            if (emit) {
+                offset = CompileInstr(offset);
+            } else {
+                // Mirror CompileInstr: an unconditional EXIT terminates the program, everything
+                // else falls through to the next instruction.
+                const bool ends_program =
+                    opcode && opcode->get().GetId() == OpCode::Id::EXIT &&
+                    instr.flow.cond == Tegra::Shader::FlowCondition::Always &&
+                    instr.pred.pred_index == static_cast<u64>(Pred::UnusedIndex);
+                offset = ends_program ? PROGRAM_END : offset + 1;
+            }
+        }
+        return true;
+    }
+
     void Generate(const std::string& suffix) {
         // Add declarations for all subroutines
         for (const auto& subroutine : subroutines) {
@@ -3817,6 +4041,12 @@ private:
                 if (CompileRange(subroutine.begin, subroutine.end) != PROGRAM_END) {
                     shader.AddLine("return false;");
                 }
+            } else if (CompileStructuredRange(subroutine.begin, subroutine.end, PROGRAM_END,
+                                              false)) {
+                // The branches reduce to ifs and loops: emit straight GLSL so the driver does
+                // not have to optimize through the jump-table dispatch loop below.
+                CompileStructuredRange(subroutine.begin, subroutine.end, PROGRAM_END, true);
+                shader.AddLine("return false;");
             } else {
                 labels.insert(subroutine.begin);
                 shader.AddLine("uint jmp_to = " + std::to_string(subroutine.begin) + "u;");
@@ -3888,8 +4118,11 @@ private:
     u64 local_memory_size;
     std::size_t shader_length;
 
-    ShaderWriter shader;
-    ShaderWriter declarations;
+    // Reserving the output buffers up front from the program size avoids repeatedly
+    // reallocating them while the source is emitted; eight output bytes per program byte
+    // covers typical shaders.
+    ShaderWriter shader{shader_length * 8};
+    ShaderWriter declarations{2048};
     GLSLRegisterManager regs{shader, declarations, stage, suffix, header};
 
     // Declarations
@@ -3916,4 +4149,137 @@ std::optional<ProgramResult> DecompileProgram(const ProgramCode& program_code, u
     return {};
 }
 
+bool IsPassthroughGeometryShader(const ProgramCode& program_code, u32 main_offset) {
+    using Tegra::Shader::Pred;
+
+    // sched instructions appear once every 4 instructions.
+    constexpr u32 SchedPeriod = 4;
+
+    // Tag describing which attribute word a register was loaded from. The encoding only has to
+    // be unique per (attribute, element) pair.
+    const auto AttributeTag = [](u64 index, u64 element) { return (index << 2) | element; };
+
+    // Attribute provenance of every register, or 0 when the register holds anything else.
+    std::array<u64, Register::ZeroIndex + 1> loaded_tag{};
+
+    // Attribute words written between two vertex emits. A passthrough shader stores the same set
+    // of words for every emitted vertex, and that set has to include the full position.
+    std::set<u64> stored_tags;
+    std::set<u64> reference_tags;
+    bool saw_emit = false;
+
+    for (u32 offset = main_offset; offset < program_code.size(); ++offset) {
+        if (((offset - main_offset) % SchedPeriod) == 0) {
+            // Skip sched instructions
+            continue;
+        }
+        const Instruction instr = {program_code[offset]};
+        if (instr.value == 0 || (instr.value >> 52) == 0x50b) {
+            // Ran past the end of the program without finding an EXIT
+            return false;
+        }
+
+        const auto opcode = OpCode::Decode(instr);
+        if (!opcode) {
+            return false;
+        }
+        if (instr.pred.full_pred != Pred::UnusedIndex) {
+            // Predicated execution breaks the linear copy sequence
+            return false;
+        }
+
+        switch (opcode->get().GetId()) {
+        case OpCode::Id::LD_A: {
+            if (instr.gpr8.Value() != Register::ZeroIndex) {
+                // Indirect attribute loads can address anything
+                return false;
+            }
+            u64 element = instr.attribute.fmt20.element;
+            u64 index = static_cast<u64>(instr.attribute.fmt20.index.Value());
+            const u64 num_words = static_cast<u64>(instr.attribute.fmt20.size.Value()) + 1;
+            if (instr.gpr0.Value() + num_words > loaded_tag.size()) {
+                return false;
+            }
+            for (u64 reg_offset = 0; reg_offset < num_words; ++reg_offset) {
+                loaded_tag[instr.gpr0.Value() + reg_offset] = AttributeTag(index, element);
+                element = (element + 1) % 4;
+                index += element == 0 ? 1 : 0;
+            }
+            break;
+        }
+        case OpCode::Id::ST_A: {
+            if (instr.gpr8.Value() != Register::ZeroIndex) {
+                return false;
+            }
+            u64 element = instr.attribute.fmt20.element;
+            u64 index = static_cast<u64>(instr.attribute.fmt20.index.Value());
+            const u64 num_words = static_cast<u64>(instr.attribute.fmt20.size.Value()) + 1;
+            if (instr.gpr0.Value() + num_words > loaded_tag.size()) {
+                return false;
+            }
+            for (u64 reg_offset = 0; reg_offset < num_words; ++reg_offset) {
+                const u64 tag = AttributeTag(index, element);
+                if (loaded_tag[instr.gpr0.Value() + reg_offset] != tag) {
+                    // The stored value is not the unmodified load of the same attribute word
+                    return false;
+                }
+                stored_tags.insert(tag);
+                element = (element + 1) % 4;
+                index += element == 0 ? 1 : 0;
+            }
+            break;
+        }
+        case OpCode::Id::OUT_R: {
+            if (instr.gpr20.Value() != Register::ZeroIndex) {
+                // Stream buffer outputs are not copies
+                return false;
+            }
+            if (instr.out.emit) {
+                if (stored_tags.empty()) {
+                    return false;
+                }
+                if (!saw_emit) {
+                    reference_tags = stored_tags;
+                } else if (stored_tags != reference_tags) {
+                    // Each emitted vertex has to be a copy of the same attribute set
+                    return false;
+                }
+                saw_emit = true;
+                stored_tags.clear();
+            }
+            // gpr0 receives the next output pointer
+            loaded_tag[instr.gpr0.Value()] = 0;
+            break;
+        }
+        case OpCode::Id::ISBERD:
+        case OpCode::Id::MOV_C:
+        case OpCode::Id::MOV_R:
+        case OpCode::Id::MOV_IMM:
+        case OpCode::Id::MOV32_IMM:
+            // Plain moves only shuffle the input vertex pointers around; they never produce an
+            // attribute value themselves.
+            loaded_tag[instr.gpr0.Value()] = 0;
+            break;
+        case OpCode::Id::EXIT: {
+            if (!saw_emit || !stored_tags.empty()) {
+                return false;
+            }
+            // The copied set has to at least cover the full output position
+            for (u64 element = 0; element < 4; ++element) {
+                const u64 position_tag =
+                    AttributeTag(static_cast<u64>(Attribute::Index::Position), element);
+                if (reference_tags.count(position_tag) == 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+        default:
+            // Arithmetic, branches, texture accesses, ... may all transform the primitive
+            return false;
+        }
+    }
+    return false;
+}
+
 } // namespace OpenGL::GLShader::Decompiler
\ No newline at end of file
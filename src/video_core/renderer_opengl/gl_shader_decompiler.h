@@ -22,4 +22,10 @@ std::optional<ProgramResult> DecompileProgram(const ProgramCode& program_code, u
                                               Maxwell3D::Regs::ShaderStage stage,
                                               const std::string& suffix);
 
+/// Analyzes a geometry shader program and returns true when it provably only copies its input
+/// vertices to the output stream, so the whole stage can be skipped for matching topologies. The
+/// analysis is conservative: anything but the canonical load/store/emit copy sequence keeps the
+/// shader.
+bool IsPassthroughGeometryShader(const ProgramCode& program_code, u32 main_offset);
+
 } // namespace OpenGL::GLShader::Decompiler
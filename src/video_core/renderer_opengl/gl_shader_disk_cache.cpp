@@ -0,0 +1,312 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <cstring>
+#include <mutex>
+
+#include <fmt/format.h>
+
+#include "common/assert.h"
+#include "common/cityhash.h"
+#include "common/common_paths.h"
+#include "common/file_util.h"
+#include "common/logging/log.h"
+#include "core/core.h"
+#include "core/hle/kernel/process.h"
+#include "video_core/renderer_opengl/gl_shader_disk_cache.h"
+
+namespace OpenGL {
+
+using Maxwell = Tegra::Engines::Maxwell3D::Regs;
+
+namespace {
+
+constexpr u32 CacheMagic = 0x31435359; // 'YSC1'
+// Version 2: binding points are baked into the cached GLSL as layout qualifiers
+constexpr u32 CacheVersion = 2;
+
+struct CacheFileHeader {
+    u32 magic;
+    u32 version;
+    u64 driver_hash;
+};
+
+struct CacheEntryHeader {
+    u64 unique_identifier;
+    u32 program_type;
+    u32 binary_format;
+    u64 code_size;
+    u64 binary_size;
+    u32 const_buffer_count;
+    u32 sampler_count;
+};
+
+/// Trivially copyable representation of a ConstBufferEntry for serialization.
+struct RawConstBufferEntry {
+    u32 index;
+    u32 max_offset;
+    u32 stage;
+    u8 is_indirect;
+};
+
+/// Trivially copyable representation of a SamplerEntry for serialization.
+struct RawSamplerEntry {
+    u64 offset;
+    u64 index;
+    u32 stage;
+    u32 type;
+    u8 is_array;
+    u8 is_shadow;
+};
+
+/// Shaders loaded or compiled by a previous launch in this emulator instance, keyed by cache file
+/// path. The renderer and its cache objects die with the title, but the blobs stay valid for the
+/// lifetime of the process, so relaunching a title skips the file parse and starts with every
+/// previously compiled shader available to the new GL context.
+std::mutex retained_shaders_mutex;
+std::unordered_map<std::string, std::shared_ptr<std::unordered_map<u64, ShaderDiskCacheEntry>>>
+    retained_shaders;
+
+} // Anonymous namespace
+
+void ShaderDiskCacheOpenGL::LoadCache() {
+    if (is_loaded) {
+        return;
+    }
+    is_loaded = true;
+
+    const std::string path{GetCachePath()};
+    if (path.empty()) {
+        return;
+    }
+    is_usable = true;
+
+    {
+        std::lock_guard<std::mutex> lock(retained_shaders_mutex);
+        const auto iter = retained_shaders.find(path);
+        if (iter != retained_shaders.end()) {
+            entries = iter->second;
+            LOG_INFO(Render_OpenGL, "Retained {} shaders from a previous launch", entries->size());
+            return;
+        }
+        retained_shaders.emplace(path, entries);
+    }
+
+    FileUtil::IOFile file(path, "rb");
+    if (!file.IsOpen()) {
+        return;
+    }
+
+    CacheFileHeader header{};
+    if (file.ReadBytes(&header, sizeof(header)) != sizeof(header) ||
+        header.magic != CacheMagic || header.version != CacheVersion) {
+        LOG_INFO(Render_OpenGL, "Deleting shader cache file with a stale version");
+        file.Close();
+        FileUtil::Delete(path);
+        return;
+    }
+    const bool same_driver{header.driver_hash == GetDriverHash()};
+
+    while (true) {
+        CacheEntryHeader entry_header{};
+        if (file.ReadBytes(&entry_header, sizeof(entry_header)) != sizeof(entry_header)) {
+            break;
+        }
+
+        ShaderDiskCacheEntry entry;
+        entry.unique_identifier = entry_header.unique_identifier;
+        entry.program_type = entry_header.program_type;
+        entry.binary_format = static_cast<GLenum>(entry_header.binary_format);
+
+        entry.code.resize(entry_header.code_size);
+        if (file.ReadBytes(entry.code.data(), entry.code.size()) != entry.code.size()) {
+            break;
+        }
+
+        bool corrupt{};
+        for (u32 i = 0; i < entry_header.const_buffer_count; ++i) {
+            RawConstBufferEntry raw{};
+            if (file.ReadBytes(&raw, sizeof(raw)) != sizeof(raw)) {
+                corrupt = true;
+                break;
+            }
+            GLShader::ConstBufferEntry buffer;
+            if (raw.is_indirect != 0) {
+                buffer.MarkAsUsedIndirect(raw.index, static_cast<Maxwell::ShaderStage>(raw.stage));
+            } else {
+                buffer.MarkAsUsed(raw.index, raw.max_offset,
+                                  static_cast<Maxwell::ShaderStage>(raw.stage));
+            }
+            entry.entries.const_buffer_entries.push_back(buffer);
+        }
+        for (u32 i = 0; i < entry_header.sampler_count && !corrupt; ++i) {
+            RawSamplerEntry raw{};
+            if (file.ReadBytes(&raw, sizeof(raw)) != sizeof(raw)) {
+                corrupt = true;
+                break;
+            }
+            entry.entries.texture_samplers.emplace_back(
+                static_cast<Maxwell::ShaderStage>(raw.stage), raw.offset, raw.index,
+                static_cast<Tegra::Shader::TextureType>(raw.type), raw.is_array != 0,
+                raw.is_shadow != 0);
+        }
+        if (corrupt ||
+            file.ReadBytes(entry.entries.clip_distances.data(),
+                           sizeof(entry.entries.clip_distances)) !=
+                sizeof(entry.entries.clip_distances)) {
+            break;
+        }
+        u64 shader_length{};
+        if (file.ReadBytes(&shader_length, sizeof(shader_length)) != sizeof(shader_length)) {
+            break;
+        }
+        entry.entries.shader_length = static_cast<std::size_t>(shader_length);
+
+        entry.binary.resize(entry_header.binary_size);
+        if (file.ReadBytes(entry.binary.data(), entry.binary.size()) != entry.binary.size()) {
+            break;
+        }
+        if (!same_driver) {
+            // The host driver changed - the decompiled source is still valid but the program
+            // binary is not, so drop it and let the shader recompile from source.
+            entry.binary.clear();
+            entry.binary_format = 0;
+        }
+
+        const u64 key{entry.unique_identifier};
+        entries->emplace(key, std::move(entry));
+    }
+
+    LOG_INFO(Render_OpenGL, "Loaded {} shaders from the disk cache", entries->size());
+}
+
+const ShaderDiskCacheEntry* ShaderDiskCacheOpenGL::GetEntry(u64 unique_identifier) const {
+    const auto search{entries->find(unique_identifier)};
+    return search != entries->end() ? &search->second : nullptr;
+}
+
+void ShaderDiskCacheOpenGL::SaveEntry(ShaderDiskCacheEntry entry, GLuint program_handle) {
+    if (entries->find(entry.unique_identifier) != entries->end()) {
+        return;
+    }
+
+    if (program_handle != 0) {
+        GLint num_formats{};
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &num_formats);
+        GLint binary_length{};
+        if (num_formats > 0) {
+            glGetProgramiv(program_handle, GL_PROGRAM_BINARY_LENGTH, &binary_length);
+        }
+        if (binary_length > 0) {
+            entry.binary.resize(binary_length);
+            glGetProgramBinary(program_handle, binary_length, nullptr, &entry.binary_format,
+                               entry.binary.data());
+        }
+    }
+
+    if (is_usable) {
+        AppendEntryToFile(entry);
+    }
+
+    // Keep the entry in memory regardless of whether the file write succeeded: within a session
+    // the same shader routinely reappears at a different guest address, and the hash lookup in
+    // GetEntry is what lets those skip the decompiler. The map is shared with the retained
+    // process-wide store, so the entry also survives into later launches of this title.
+    entries->emplace(entry.unique_identifier, std::move(entry));
+}
+
+void ShaderDiskCacheOpenGL::AppendEntryToFile(const ShaderDiskCacheEntry& entry) {
+    const std::string path{GetCachePath()};
+    const bool new_file{!FileUtil::Exists(path)};
+    FileUtil::IOFile file(path, "ab");
+    if (!file.IsOpen()) {
+        LOG_ERROR(Render_OpenGL, "Failed to open shader cache file {}", path);
+        is_usable = false;
+        return;
+    }
+    if (new_file && !WriteHeader(file)) {
+        file.Close();
+        FileUtil::Delete(path);
+        is_usable = false;
+        return;
+    }
+
+    CacheEntryHeader entry_header{};
+    entry_header.unique_identifier = entry.unique_identifier;
+    entry_header.program_type = entry.program_type;
+    entry_header.binary_format = static_cast<u32>(entry.binary_format);
+    entry_header.code_size = entry.code.size();
+    entry_header.binary_size = entry.binary.size();
+    entry_header.const_buffer_count =
+        static_cast<u32>(entry.entries.const_buffer_entries.size());
+    entry_header.sampler_count = static_cast<u32>(entry.entries.texture_samplers.size());
+
+    bool ok{file.WriteObject(entry_header) == 1};
+    ok = ok && file.WriteBytes(entry.code.data(), entry.code.size()) == entry.code.size();
+    for (const auto& buffer : entry.entries.const_buffer_entries) {
+        RawConstBufferEntry raw{};
+        raw.index = buffer.GetIndex();
+        raw.max_offset = buffer.IsIndirect() ? 0 : buffer.GetSize() - 1;
+        raw.stage = static_cast<u32>(buffer.GetStage());
+        raw.is_indirect = buffer.IsIndirect() ? 1 : 0;
+        ok = ok && file.WriteObject(raw) == 1;
+    }
+    for (const auto& sampler : entry.entries.texture_samplers) {
+        RawSamplerEntry raw{};
+        raw.offset = sampler.GetOffset();
+        raw.index = sampler.GetIndex();
+        raw.stage = static_cast<u32>(sampler.GetStage());
+        raw.type = static_cast<u32>(sampler.GetType());
+        raw.is_array = sampler.IsArray() ? 1 : 0;
+        raw.is_shadow = sampler.IsShadow() ? 1 : 0;
+        ok = ok && file.WriteObject(raw) == 1;
+    }
+    ok = ok && file.WriteBytes(entry.entries.clip_distances.data(),
+                               sizeof(entry.entries.clip_distances)) ==
+                   sizeof(entry.entries.clip_distances);
+    const u64 shader_length{static_cast<u64>(entry.entries.shader_length)};
+    ok = ok && file.WriteObject(shader_length) == 1;
+    ok = ok && file.WriteBytes(entry.binary.data(), entry.binary.size()) == entry.binary.size();
+
+    if (!ok) {
+        LOG_ERROR(Render_OpenGL, "Failed to write shader cache entry, disabling disk cache");
+        file.Close();
+        FileUtil::Delete(path);
+        is_usable = false;
+    }
+}
+
+std::string ShaderDiskCacheOpenGL::GetCachePath() const {
+    const auto* process{Core::System::GetInstance().CurrentProcess()};
+    if (process == nullptr) {
+        return {};
+    }
+    const u64 title_id{process->GetTitleID()};
+    if (title_id == 0) {
+        return {};
+    }
+    const std::string& shader_dir{FileUtil::GetUserPath(FileUtil::UserPath::ShaderDir)};
+    if (!FileUtil::CreateFullPath(shader_dir)) {
+        return {};
+    }
+    return fmt::format("{}{:016X}.bin", shader_dir, title_id);
+}
+
+bool ShaderDiskCacheOpenGL::WriteHeader(FileUtil::IOFile& file) const {
+    CacheFileHeader header{};
+    header.magic = CacheMagic;
+    header.version = CacheVersion;
+    header.driver_hash = GetDriverHash();
+    return file.WriteObject(header) == 1;
+}
+
+u64 ShaderDiskCacheOpenGL::GetDriverHash() const {
+    const std::string driver{
+        fmt::format("{} {} {}", reinterpret_cast<const char*>(glGetString(GL_VENDOR)),
+                    reinterpret_cast<const char*>(glGetString(GL_RENDERER)),
+                    reinterpret_cast<const char*>(glGetString(GL_VERSION)))};
+    return Common::CityHash64(driver.data(), driver.size());
+}
+
+} // namespace OpenGL
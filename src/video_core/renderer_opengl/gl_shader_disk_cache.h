@@ -0,0 +1,88 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <glad/glad.h>
+
+#include "common/common_types.h"
+#include "video_core/renderer_opengl/gl_shader_gen.h"
+
+namespace FileUtil {
+class IOFile;
+}
+
+namespace OpenGL {
+
+/// Describes a shader stored in the disk cache, addressed by the guest code hash.
+struct ShaderDiskCacheEntry {
+    u64 unique_identifier{};
+    u32 program_type{};
+
+    /// Decompiled GLSL source code, used to skip the decompiler on warm runs.
+    std::string code;
+    GLShader::ShaderEntries entries;
+
+    /// Driver program binary, used to skip compilation entirely. May be empty when the
+    /// driver does not support program binaries or the entry describes a geometry shader.
+    GLenum binary_format{};
+    std::vector<u8> binary;
+
+    bool HasProgramBinary() const {
+        return !binary.empty();
+    }
+};
+
+/**
+ * Persistent on-disk cache of decompiled GLSL and driver program binaries, keyed by the
+ * hash of the guest shader code. One cache file is kept per title under the user shader
+ * directory. Entries whose program binaries were produced by a different driver are
+ * dropped at load time, keeping only the decompiled source.
+ *
+ * Loaded entries are additionally retained in memory for the lifetime of the process, shared
+ * between cache instances by title. The renderer and this object die with the title, but the
+ * blobs stay valid, so relaunching the same title skips the file parse and starts with every
+ * previously compiled shader available.
+ */
+class ShaderDiskCacheOpenGL {
+public:
+    /// Loads the cache file for the currently running title. Safe to call more than once.
+    void LoadCache();
+
+    /// Returns the cached entry for the passed code hash or nullptr if it is not present.
+    const ShaderDiskCacheEntry* GetEntry(u64 unique_identifier) const;
+
+    /// Records a freshly compiled shader, fetching the program binary from the driver when
+    /// program_handle is not zero. The entry is always kept in memory, keyed by code hash, so
+    /// the same shader reappearing at a different guest address skips the decompiler; it is
+    /// additionally appended to the cache file when one is usable.
+    void SaveEntry(ShaderDiskCacheEntry entry, GLuint program_handle);
+
+private:
+    /// Builds the cache file path for the current title, or an empty string when there is
+    /// no title to key on.
+    std::string GetCachePath() const;
+
+    /// Writes the file header identifying the cache version and host driver.
+    bool WriteHeader(FileUtil::IOFile& file) const;
+
+    /// Appends an entry to the cache file, disabling the file on any write failure.
+    void AppendEntryToFile(const ShaderDiskCacheEntry& entry);
+
+    /// Hashes the host driver strings so stale program binaries can be rejected.
+    u64 GetDriverHash() const;
+
+    /// Shared with the process-wide retained store once LoadCache has resolved the title.
+    std::shared_ptr<std::unordered_map<u64, ShaderDiskCacheEntry>> entries =
+        std::make_shared<std::unordered_map<u64, ShaderDiskCacheEntry>>();
+    bool is_loaded{};
+    bool is_usable{};
+};
+
+} // namespace OpenGL
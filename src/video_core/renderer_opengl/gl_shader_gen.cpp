@@ -25,7 +25,8 @@ ProgramResult GenerateVertexShader(const ShaderSetup& setup) {
 
 layout (location = 0) out vec4 position;
 
-layout(std140) uniform vs_config {
+// The binding must match the stage index used by glBindBufferRange in SetupShaders
+layout(std140, binding = 0) uniform vs_config {
     vec4 viewport_flip;
     uvec4 config_pack; // instance_id, flip_stage, y_direction, padding
     uvec4 alpha_test;
@@ -104,7 +105,8 @@ out gl_PerVertex {
 layout (location = 0) in vec4 gs_position[];
 layout (location = 0) out vec4 position;
 
-layout (std140) uniform gs_config {
+// The binding must match the stage index used by glBindBufferRange in SetupShaders
+layout (std140, binding = 3) uniform gs_config {
     vec4 viewport_flip;
     uvec4 config_pack; // instance_id, flip_stage, y_direction, padding
     uvec4 alpha_test;
@@ -143,7 +145,8 @@ layout(location = 7) out vec4 FragColor7;
 
 layout (location = 0) in vec4 position;
 
-layout (std140) uniform fs_config {
+// The binding must match the stage index used by glBindBufferRange in SetupShaders
+layout (std140, binding = 4) uniform fs_config {
     vec4 viewport_flip;
     uvec4 config_pack; // instance_id, flip_stage, y_direction, padding
     uvec4 alpha_test;
@@ -18,6 +18,52 @@ using ProgramCode = std::vector<u64>;
 
 enum : u32 { POSITION_VARYING_LOCATION = 0, GENERIC_VARYING_START_LOCATION = 1 };
 
+/// Number of shader stages that are actually decompiled to GLSL: vertex, geometry and fragment.
+/// Tessellation is never decompiled, so those stages do not get a binding range of their own and
+/// the generated binding points stay within the minimum limits the GL guarantees.
+constexpr u32 NUM_DECOMPILED_STAGES = 3;
+
+/// Index of a stage among the decompiled stages, used to carve out its binding ranges.
+constexpr u32 GetStageBindingSlot(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage) {
+    switch (stage) {
+    case Tegra::Engines::Maxwell3D::Regs::ShaderStage::Vertex:
+        return 0;
+    case Tegra::Engines::Maxwell3D::Regs::ShaderStage::Geometry:
+        return 1;
+    case Tegra::Engines::Maxwell3D::Regs::ShaderStage::Fragment:
+        return 2;
+    default:
+        // Tessellation stages are never decompiled
+        return 0;
+    }
+}
+
+/// Returns the fixed uniform buffer binding point for a stage's const buffer entry. Bindings
+/// [0, MaxShaderStage) are reserved for the per-stage config uniform blocks; const buffers follow,
+/// grouped by stage. entry_index is the position of the entry within the shader's
+/// const_buffer_entries vector, so the assignment depends only on the entries themselves and can
+/// be baked into the generated (and disk-cached) GLSL as a layout(binding) qualifier.
+constexpr u32 GetConstBufferBinding(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage,
+                                    u32 entry_index) {
+    return static_cast<u32>(Tegra::Engines::Maxwell3D::Regs::MaxShaderStage) +
+           GetStageBindingSlot(stage) *
+               static_cast<u32>(Tegra::Engines::Maxwell3D::Regs::MaxConstBuffers) +
+           entry_index;
+}
+
+/// Returns the fixed texture unit for a stage's sampler entry, using the same position-based
+/// scheme as GetConstBufferBinding.
+constexpr u32 GetTextureBinding(Tegra::Engines::Maxwell3D::Regs::ShaderStage stage,
+                                u32 entry_index) {
+    return GetStageBindingSlot(stage) *
+               static_cast<u32>(Tegra::Engines::Maxwell3D::Regs::NumTextureSamplers) +
+           entry_index;
+}
+
+/// Total number of texture units addressable by the generated shaders.
+constexpr u32 NUM_TEXTURE_BINDINGS =
+    NUM_DECOMPILED_STAGES * static_cast<u32>(Tegra::Engines::Maxwell3D::Regs::NumTextureSamplers);
+
 class ConstBufferEntry {
     using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
@@ -48,6 +94,10 @@ public:
         return index;
     }
 
+    Maxwell::ShaderStage GetStage() const {
+        return stage;
+    }
+
     unsigned GetSize() const {
         return max_offset + 1;
     }
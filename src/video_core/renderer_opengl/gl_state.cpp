@@ -464,21 +464,36 @@ void OpenGLState::ApplyPolygonOffset() const {
 }
 
 void OpenGLState::ApplyTextures() const {
+    bool has_delta{};
+    std::size_t first{}, last{};
+    std::array<GLuint, GLShader::NUM_TEXTURE_BINDINGS> textures;
+    for (std::size_t i = 0; i < std::size(textures); ++i) {
+        textures[i] = texture_units[i].texture;
+        if (textures[i] != cur_state.texture_units[i].texture) {
+            if (!has_delta) {
+                first = i;
+                has_delta = true;
+            }
+            last = i;
+        }
+    }
+    if (has_delta) {
+        glBindTextures(static_cast<GLuint>(first), static_cast<GLsizei>(last - first + 1),
+                       textures.data() + first);
+    }
+    // Swizzles are texture state rather than unit state, so they still have to be updated one
+    // texture at a time through the unit the texture is bound to.
     for (std::size_t i = 0; i < std::size(texture_units); ++i) {
         const auto& texture_unit = texture_units[i];
         const auto& cur_state_texture_unit = cur_state.texture_units[i];
 
-        if (texture_unit.texture != cur_state_texture_unit.texture) {
-            glActiveTexture(TextureUnits::MaxwellTexture(static_cast<int>(i)).Enum());
-            glBindTexture(texture_unit.target, texture_unit.texture);
-        }
-        // Update the texture swizzle
         if (texture_unit.swizzle.r != cur_state_texture_unit.swizzle.r ||
             texture_unit.swizzle.g != cur_state_texture_unit.swizzle.g ||
             texture_unit.swizzle.b != cur_state_texture_unit.swizzle.b ||
             texture_unit.swizzle.a != cur_state_texture_unit.swizzle.a) {
             std::array<GLint, 4> mask = {texture_unit.swizzle.r, texture_unit.swizzle.g,
                                          texture_unit.swizzle.b, texture_unit.swizzle.a};
+            glActiveTexture(TextureUnits::MaxwellTexture(static_cast<int>(i)).Enum());
             glTexParameteriv(texture_unit.target, GL_TEXTURE_SWIZZLE_RGBA, mask.data());
         }
     }
@@ -487,7 +502,7 @@ void OpenGLState::ApplyTextures() const {
 void OpenGLState::ApplySamplers() const {
     bool has_delta{};
     std::size_t first{}, last{};
-    std::array<GLuint, Tegra::Engines::Maxwell3D::Regs::NumTextureSamplers> samplers;
+    std::array<GLuint, GLShader::NUM_TEXTURE_BINDINGS> samplers;
     for (std::size_t i = 0; i < std::size(samplers); ++i) {
         samplers[i] = texture_units[i].sampler;
         if (samplers[i] != cur_state.texture_units[i].sampler) {
@@ -541,9 +556,7 @@ void OpenGLState::ApplyDepthClamp() const {
     }
 }
 
-void OpenGLState::Apply() const {
-    ApplyFramebufferState();
-    ApplyVertexBufferState();
+void OpenGLState::ApplyShaderProgram() const {
     // Uniform buffer
     if (draw.uniform_buffer != cur_state.draw.uniform_buffer) {
         glBindBuffer(GL_UNIFORM_BUFFER, draw.uniform_buffer);
@@ -558,7 +571,9 @@ void OpenGLState::Apply() const {
     if (draw.program_pipeline != cur_state.draw.program_pipeline) {
         glBindProgramPipeline(draw.program_pipeline);
     }
-    // Clip distance
+}
+
+void OpenGLState::ApplyClipDistances() const {
     for (std::size_t i = 0; i < clip_distance.size(); ++i) {
         if (clip_distance[i] != cur_state.clip_distance[i]) {
             if (clip_distance[i]) {
@@ -568,14 +583,22 @@ void OpenGLState::Apply() const {
             }
         }
     }
-    // Point
+}
+
+void OpenGLState::ApplyPointSize() const {
     if (point.size != cur_state.point.size) {
         glPointSize(point.size);
     }
+}
+
+void OpenGLState::ApplyFragmentColorClamp() const {
     if (fragment_color_clamp.enabled != cur_state.fragment_color_clamp.enabled) {
         glClampColor(GL_CLAMP_FRAGMENT_COLOR_ARB,
                      fragment_color_clamp.enabled ? GL_TRUE : GL_FALSE);
     }
+}
+
+void OpenGLState::ApplyMultisample() const {
     if (multisample_control.alpha_to_coverage != cur_state.multisample_control.alpha_to_coverage) {
         if (multisample_control.alpha_to_coverage) {
             glEnable(GL_SAMPLE_ALPHA_TO_COVERAGE);
@@ -590,6 +613,16 @@ void OpenGLState::Apply() const {
             glDisable(GL_SAMPLE_ALPHA_TO_ONE);
         }
     }
+}
+
+void OpenGLState::Apply() const {
+    ApplyFramebufferState();
+    ApplyVertexBufferState();
+    ApplyShaderProgram();
+    ApplyClipDistances();
+    ApplyPointSize();
+    ApplyFragmentColorClamp();
+    ApplyMultisample();
     ApplyDepthClamp();
     ApplyColorMask();
     ApplyViewport();
@@ -7,10 +7,12 @@
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "common/microprofile.h"
+#include "core/core.h"
+#include "core/perf_stats.h"
 #include "video_core/renderer_opengl/gl_state.h"
 #include "video_core/renderer_opengl/gl_stream_buffer.h"
 
-MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Orphaning",
+MICROPROFILE_DEFINE(OpenGL_StreamBuffer, "OpenGL", "Stream Buffer Sync",
                     MP_RGB(128, 128, 192));
 
 namespace OpenGL {
@@ -33,6 +35,7 @@ OGLStreamBuffer::OGLStreamBuffer(GLenum target, GLsizeiptr size, bool prefer_coh
     if (GLAD_GL_ARB_buffer_storage) {
         persistent = true;
         coherent = prefer_coherent;
+        segment_size = buffer_size / static_cast<GLsizeiptr>(NUM_SEGMENTS);
         const GLbitfield flags =
             GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | (coherent ? GL_MAP_COHERENT_BIT : 0);
         glBufferStorage(gl_target, allocate_size, nullptr, flags);
@@ -44,6 +47,12 @@ OGLStreamBuffer::OGLStreamBuffer(GLenum target, GLsizeiptr size, bool prefer_coh
 }
 
 OGLStreamBuffer::~OGLStreamBuffer() {
+    for (GLsync& fence : segment_fences) {
+        if (fence != nullptr) {
+            glDeleteSync(fence);
+            fence = nullptr;
+        }
+    }
     if (persistent) {
         glBindBuffer(gl_target, gl_buffer.handle);
         glUnmapBuffer(gl_target);
@@ -70,17 +79,23 @@ std::tuple<u8*, GLintptr, bool> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr a
 
     bool invalidate = false;
     if (buffer_pos + size > buffer_size) {
-        buffer_pos = 0;
         invalidate = true;
 
         if (persistent) {
-            glUnmapBuffer(gl_target);
+            // The ring wraps mid-segment, so guard the partially filled tail segment before the
+            // next trip around reaches it. Completed segments were already fenced on Unmap.
+            FenceSegment(static_cast<std::size_t>(buffer_pos) / segment_size);
         }
+        buffer_pos = 0;
     }
 
-    if (invalidate || !persistent) {
+    if (persistent) {
+        // Reusing a segment only waits on the draws that touched it last trip around the ring,
+        // instead of orphaning the whole allocation and stalling in the driver.
+        WaitSegments(buffer_pos, size);
+    } else {
         MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
-        GLbitfield flags = GL_MAP_WRITE_BIT | (persistent ? GL_MAP_PERSISTENT_BIT : 0) |
+        GLbitfield flags = GL_MAP_WRITE_BIT |
                            (coherent ? GL_MAP_COHERENT_BIT : GL_MAP_FLUSH_EXPLICIT_BIT) |
                            (invalidate ? GL_MAP_INVALIDATE_BUFFER_BIT : GL_MAP_UNSYNCHRONIZED_BIT);
         mapped_ptr = static_cast<u8*>(
@@ -91,6 +106,14 @@ std::tuple<u8*, GLintptr, bool> OGLStreamBuffer::Map(GLsizeiptr size, GLintptr a
     return std::make_tuple(mapped_ptr + buffer_pos - mapped_offset, buffer_pos, invalidate);
 }
 
+bool OGLStreamBuffer::WouldInvalidate(GLsizeiptr size, GLintptr alignment) const {
+    GLintptr pos = buffer_pos;
+    if (alignment > 0) {
+        pos = Common::AlignUp<std::size_t>(pos, alignment);
+    }
+    return pos + size > buffer_size;
+}
+
 void OGLStreamBuffer::Unmap(GLsizeiptr size) {
     ASSERT(size <= mapped_size);
 
@@ -100,9 +123,49 @@ void OGLStreamBuffer::Unmap(GLsizeiptr size) {
 
     if (!persistent) {
         glUnmapBuffer(gl_target);
+    } else if (size > 0) {
+        // Fence every segment the write position moves past, so reuse of it next trip around
+        // waits for exactly the draws that read from it.
+        const std::size_t first = static_cast<std::size_t>(buffer_pos) / segment_size;
+        const std::size_t last = static_cast<std::size_t>(buffer_pos + size) / segment_size;
+        for (std::size_t segment = first; segment < last; ++segment) {
+            FenceSegment(segment);
+        }
     }
 
     buffer_pos += size;
 }
 
+void OGLStreamBuffer::FenceSegment(std::size_t segment) {
+    if (segment >= segment_fences.size()) {
+        return;
+    }
+    GLsync& fence = segment_fences[segment];
+    if (fence != nullptr) {
+        glDeleteSync(fence);
+    }
+    fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void OGLStreamBuffer::WaitSegments(GLintptr start, GLsizeiptr size) {
+    const std::size_t first = static_cast<std::size_t>(start) / segment_size;
+    const std::size_t last = static_cast<std::size_t>(start + size - 1) / segment_size;
+    for (std::size_t segment = first; segment <= last && segment < segment_fences.size();
+         ++segment) {
+        GLsync& fence = segment_fences[segment];
+        if (fence == nullptr) {
+            continue;
+        }
+        // Poll first: most of the time the GPU finished with the segment a full trip ago and
+        // the fence is already signaled. Only a wait the GPU has not reached counts as a stall.
+        if (glClientWaitSync(fence, 0, 0) == GL_TIMEOUT_EXPIRED) {
+            MICROPROFILE_SCOPE(OpenGL_StreamBuffer);
+            Core::System::GetInstance().GetPerfStats().AddStreamBufferStall();
+            glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, GL_TIMEOUT_IGNORED);
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+}
+
 } // namespace OpenGL
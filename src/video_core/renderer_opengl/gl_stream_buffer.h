@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <array>
 #include <tuple>
 #include <glad/glad.h>
 #include "common/common_types.h"
@@ -22,16 +23,32 @@ public:
     /*
      * Allocates a linear chunk of memory in the GPU buffer with at least "size" bytes
      * and the optional alignment requirement.
-     * If the buffer is full, the whole buffer is reallocated which invalidates old chunks.
+     * If the buffer is full, the write position wraps around and previous chunks are
+     * invalidated. With persistent mapping the buffer is treated as a ring of fenced
+     * segments: reuse of a segment waits only on the draws that touched it, instead of
+     * orphaning the whole allocation.
      * The return values are the pointer to the new chunk, the offset within the buffer,
      * and the invalidation flag for previous chunks.
      * The actual used size must be specified on unmapping the chunk.
      */
     std::tuple<u8*, GLintptr, bool> Map(GLsizeiptr size, GLintptr alignment = 0);
 
+    /// Whether mapping a chunk of the given size would wrap the ring and invalidate the
+    /// previously written chunks.
+    bool WouldInvalidate(GLsizeiptr size, GLintptr alignment = 0) const;
+
     void Unmap(GLsizeiptr size);
 
 private:
+    /// Places a fence guarding reuse of the given ring segment, replacing any previous one.
+    void FenceSegment(std::size_t segment);
+
+    /// Waits for the fences of every segment the range [start, start + size) touches.
+    void WaitSegments(GLintptr start, GLsizeiptr size);
+
+    /// Number of fenced segments the persistently mapped buffer is divided into.
+    static constexpr std::size_t NUM_SEGMENTS = 8;
+
     OGLBuffer gl_buffer;
     GLenum gl_target;
 
@@ -43,6 +60,10 @@ private:
     GLintptr mapped_offset = 0;
     GLsizeiptr mapped_size = 0;
     u8* mapped_ptr = nullptr;
+
+    /// Sync objects guarding reuse of each ring segment, null while a segment is idle.
+    std::array<GLsync, NUM_SEGMENTS> segment_fences{};
+    GLsizeiptr segment_size = 0;
 };
 
 } // namespace OpenGL
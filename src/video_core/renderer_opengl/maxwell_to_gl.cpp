@@ -0,0 +1,31 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "video_core/renderer_opengl/maxwell_to_gl.h"
+
+namespace OpenGL {
+namespace MaxwellToGL {
+
+GLenum UnimplementedTranslation(const char* name, u32 value, GLenum fallback) {
+    LOG_ERROR(Render_OpenGL, "Unimplemented {}={}", name, value);
+    return fallback;
+}
+
+GLenum UnreachableTranslation(const char* name, u32 value) {
+    LOG_CRITICAL(Render_OpenGL, "Unimplemented {}={}", name, value);
+    UNREACHABLE();
+    return {};
+}
+
+GLenum UnimplementedVertexType(Maxwell::VertexAttribute attrib) {
+    LOG_CRITICAL(Render_OpenGL, "Unimplemented vertex type={}, size={}", attrib.TypeString(),
+                 attrib.SizeString());
+    UNREACHABLE();
+    return {};
+}
+
+} // namespace MaxwellToGL
+} // namespace OpenGL
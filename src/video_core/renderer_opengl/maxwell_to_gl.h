@@ -5,9 +5,9 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <glad/glad.h>
 #include "common/common_types.h"
-#include "common/logging/log.h"
 #include "video_core/engines/maxwell_3d.h"
 
 namespace OpenGL {
@@ -24,426 +24,605 @@ namespace MaxwellToGL {
 
 using Maxwell = Tegra::Engines::Maxwell3D::Regs;
 
+// Each translation below is a constexpr table indexed by the Maxwell register value (normalized
+// to a compact range where the hardware encoding is sparse), so the hot path is a bounds check
+// and a single load. The tables are populated through set() helpers that index with the enum
+// constants from maxwell_3d.h/texture.h; an entry that does not fit its table is an out-of-range
+// access during constant evaluation and fails to compile, which keeps the tables in sync with
+// the enum definitions. Logging for unimplemented values lives out of line in maxwell_to_gl.cpp
+// so that it does not inhibit inlining of the lookups.
+
+/// Table entry for Maxwell values with no OpenGL translation; never a valid GL token.
+constexpr GLenum InvalidTranslation = 0xFFFFFFFF;
+
+/// Logs the unimplemented value and returns the fallback token. Defined out of line.
+GLenum UnimplementedTranslation(const char* name, u32 value, GLenum fallback);
+
+/// As above for values that indicate an emulation bug rather than a missing case; asserts.
+GLenum UnreachableTranslation(const char* name, u32 value);
+
+/// Out-of-line failure path for VertexType(), which logs both the type and the size field.
+GLenum UnimplementedVertexType(Maxwell::VertexAttribute attrib);
+
+namespace detail {
+
+// The vertex attribute type and size bitfields are 3 and 6 bits wide, so the table covers every
+// encodable combination and the lookup needs no bounds check.
+constexpr std::size_t VertexTypeIndex(Maxwell::VertexAttribute::Type type,
+                                      Maxwell::VertexAttribute::Size size) {
+    return static_cast<std::size_t>(type) * 64 + static_cast<std::size_t>(size);
+}
+
+constexpr std::array<GLenum, 8 * 64> MakeVertexTypeTable() {
+    using Type = Maxwell::VertexAttribute::Type;
+    using Size = Maxwell::VertexAttribute::Size;
+
+    std::array<GLenum, 8 * 64> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set4 = [&table](Type type, Size s1, Size s2, Size s3, Size s4, GLenum gl) {
+        table[VertexTypeIndex(type, s1)] = gl;
+        table[VertexTypeIndex(type, s2)] = gl;
+        table[VertexTypeIndex(type, s3)] = gl;
+        table[VertexTypeIndex(type, s4)] = gl;
+    };
+
+    for (const Type type : {Type::UnsignedInt, Type::UnsignedNorm}) {
+        set4(type, Size::Size_8, Size::Size_8_8, Size::Size_8_8_8, Size::Size_8_8_8_8,
+             GL_UNSIGNED_BYTE);
+        set4(type, Size::Size_16, Size::Size_16_16, Size::Size_16_16_16, Size::Size_16_16_16_16,
+             GL_UNSIGNED_SHORT);
+        set4(type, Size::Size_32, Size::Size_32_32, Size::Size_32_32_32, Size::Size_32_32_32_32,
+             GL_UNSIGNED_INT);
+        table[VertexTypeIndex(type, Size::Size_10_10_10_2)] = GL_UNSIGNED_INT_2_10_10_10_REV;
+    }
+    for (const Type type : {Type::SignedInt, Type::SignedNorm}) {
+        set4(type, Size::Size_8, Size::Size_8_8, Size::Size_8_8_8, Size::Size_8_8_8_8, GL_BYTE);
+        set4(type, Size::Size_16, Size::Size_16_16, Size::Size_16_16_16, Size::Size_16_16_16_16,
+             GL_SHORT);
+        set4(type, Size::Size_32, Size::Size_32_32, Size::Size_32_32_32, Size::Size_32_32_32_32,
+             GL_INT);
+        table[VertexTypeIndex(type, Size::Size_10_10_10_2)] = GL_INT_2_10_10_10_REV;
+    }
+    set4(Type::Float, Size::Size_16, Size::Size_16_16, Size::Size_16_16_16, Size::Size_16_16_16_16,
+         GL_HALF_FLOAT);
+    set4(Type::Float, Size::Size_32, Size::Size_32_32, Size::Size_32_32_32, Size::Size_32_32_32_32,
+         GL_FLOAT);
+    return table;
+}
+
+constexpr std::array<GLenum, 8 * 64> VertexTypeTable = MakeVertexTypeTable();
+
+constexpr std::array<GLenum, 3> MakeIndexFormatTable() {
+    std::array<GLenum, 3> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::IndexFormat format, GLenum gl) {
+        table[static_cast<std::size_t>(format)] = gl;
+    };
+    set(Maxwell::IndexFormat::UnsignedByte, GL_UNSIGNED_BYTE);
+    set(Maxwell::IndexFormat::UnsignedShort, GL_UNSIGNED_SHORT);
+    set(Maxwell::IndexFormat::UnsignedInt, GL_UNSIGNED_INT);
+    return table;
+}
+
+constexpr std::array<GLenum, 3> IndexFormatTable = MakeIndexFormatTable();
+
+constexpr std::array<GLenum, 0xf> MakePrimitiveTopologyTable() {
+    std::array<GLenum, 0xf> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::PrimitiveTopology topology, GLenum gl) {
+        table[static_cast<std::size_t>(topology)] = gl;
+    };
+    set(Maxwell::PrimitiveTopology::Points, GL_POINTS);
+    set(Maxwell::PrimitiveTopology::Lines, GL_LINES);
+    set(Maxwell::PrimitiveTopology::LineStrip, GL_LINE_STRIP);
+    set(Maxwell::PrimitiveTopology::Triangles, GL_TRIANGLES);
+    set(Maxwell::PrimitiveTopology::TriangleStrip, GL_TRIANGLE_STRIP);
+    return table;
+}
+
+constexpr std::array<GLenum, 0xf> PrimitiveTopologyTable = MakePrimitiveTopologyTable();
+
+constexpr std::size_t TextureFilterIndex(Tegra::Texture::TextureFilter filter,
+                                         Tegra::Texture::TextureMipmapFilter mip_filter) {
+    return static_cast<std::size_t>(filter) * 4 + static_cast<std::size_t>(mip_filter);
+}
+
+constexpr std::array<GLenum, 3 * 4> MakeTextureFilterTable() {
+    using Tegra::Texture::TextureFilter;
+    using Tegra::Texture::TextureMipmapFilter;
+
+    std::array<GLenum, 3 * 4> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](TextureFilter filter, TextureMipmapFilter mip, GLenum gl) {
+        table[TextureFilterIndex(filter, mip)] = gl;
+    };
+    set(TextureFilter::Linear, TextureMipmapFilter::None, GL_LINEAR);
+    set(TextureFilter::Linear, TextureMipmapFilter::Nearest, GL_NEAREST_MIPMAP_LINEAR);
+    set(TextureFilter::Linear, TextureMipmapFilter::Linear, GL_LINEAR_MIPMAP_LINEAR);
+    set(TextureFilter::Nearest, TextureMipmapFilter::None, GL_NEAREST);
+    set(TextureFilter::Nearest, TextureMipmapFilter::Nearest, GL_NEAREST_MIPMAP_NEAREST);
+    set(TextureFilter::Nearest, TextureMipmapFilter::Linear, GL_LINEAR_MIPMAP_NEAREST);
+    return table;
+}
+
+constexpr std::array<GLenum, 3 * 4> TextureFilterTable = MakeTextureFilterTable();
+
+constexpr std::array<GLenum, 8> MakeWrapModeTable() {
+    using Tegra::Texture::WrapMode;
+
+    std::array<GLenum, 8> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](WrapMode mode, GLenum gl) {
+        table[static_cast<std::size_t>(mode)] = gl;
+    };
+    set(WrapMode::Wrap, GL_REPEAT);
+    set(WrapMode::Mirror, GL_MIRRORED_REPEAT);
+    set(WrapMode::ClampToEdge, GL_CLAMP_TO_EDGE);
+    set(WrapMode::Border, GL_CLAMP_TO_BORDER);
+    // TODO(Subv): GL_CLAMP was removed as of OpenGL 3.1, to implement GL_CLAMP, we can use
+    // GL_CLAMP_TO_BORDER to get the border color of the texture, and then sample the edge to
+    // manually mix them. However the shader part of this is not yet implemented.
+    set(WrapMode::ClampOGL, GL_CLAMP_TO_BORDER);
+    set(WrapMode::MirrorOnceClampToEdge, GL_MIRROR_CLAMP_TO_EDGE);
+    // Falls back to GL_MIRROR_CLAMP_TO_EDGE at runtime when the extension is missing
+    set(WrapMode::MirrorOnceBorder, GL_MIRROR_CLAMP_TO_BORDER_EXT);
+    return table;
+}
+
+constexpr std::array<GLenum, 8> WrapModeTable = MakeWrapModeTable();
+
+constexpr std::array<GLenum, 8> MakeDepthCompareFuncTable() {
+    using Tegra::Texture::DepthCompareFunc;
+
+    std::array<GLenum, 8> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](DepthCompareFunc func, GLenum gl) {
+        table[static_cast<std::size_t>(func)] = gl;
+    };
+    set(DepthCompareFunc::Never, GL_NEVER);
+    set(DepthCompareFunc::Less, GL_LESS);
+    set(DepthCompareFunc::LessEqual, GL_LEQUAL);
+    set(DepthCompareFunc::Equal, GL_EQUAL);
+    set(DepthCompareFunc::NotEqual, GL_NOTEQUAL);
+    set(DepthCompareFunc::Greater, GL_GREATER);
+    set(DepthCompareFunc::GreaterEqual, GL_GEQUAL);
+    set(DepthCompareFunc::Always, GL_ALWAYS);
+    return table;
+}
+
+constexpr std::array<GLenum, 8> DepthCompareFuncTable = MakeDepthCompareFuncTable();
+
+/// Native equations occupy 1-5 and the Nouveau-style aliases 0x8006-0x800b; the aliases are
+/// remapped directly after the native range so one table serves both encodings.
+constexpr std::size_t BlendEquationIndex(u32 raw) {
+    if (raw - 1 < 5) {
+        return raw - 1;
+    }
+    if (raw - 0x8006 < 6) {
+        return 5 + (raw - 0x8006);
+    }
+    return 11;
+}
+
+constexpr std::array<GLenum, 11> MakeBlendEquationTable() {
+    using Equation = Maxwell::Blend::Equation;
+
+    std::array<GLenum, 11> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Equation equation, GLenum gl) {
+        table[BlendEquationIndex(static_cast<u32>(equation))] = gl;
+    };
+    set(Equation::Add, GL_FUNC_ADD);
+    set(Equation::AddGL, GL_FUNC_ADD);
+    set(Equation::Subtract, GL_FUNC_SUBTRACT);
+    set(Equation::SubtractGL, GL_FUNC_SUBTRACT);
+    set(Equation::ReverseSubtract, GL_FUNC_REVERSE_SUBTRACT);
+    set(Equation::ReverseSubtractGL, GL_FUNC_REVERSE_SUBTRACT);
+    set(Equation::Min, GL_MIN);
+    set(Equation::MinGL, GL_MIN);
+    set(Equation::Max, GL_MAX);
+    set(Equation::MaxGL, GL_MAX);
+    return table;
+}
+
+constexpr std::array<GLenum, 11> BlendEquationTable = MakeBlendEquationTable();
+
+/// Native factors occupy 0x1-0x64 and the Nouveau-style aliases sit in four short runs that are
+/// remapped past the native range.
+constexpr std::size_t BlendFactorIndex(u32 raw) {
+    if (raw < 0x65) {
+        return raw;
+    }
+    if (raw - 0x4000 < 2) {
+        return 0x65 + (raw - 0x4000); // ZeroGL, OneGL
+    }
+    if (raw - 0x4300 < 9) {
+        return 0x67 + (raw - 0x4300); // SourceColorGL-SourceAlphaSaturateGL
+    }
+    if (raw - 0xc001 < 4) {
+        return 0x70 + (raw - 0xc001); // ConstantColorGL-OneMinusConstantAlphaGL
+    }
+    if (raw - 0xc900 < 4) {
+        return 0x74 + (raw - 0xc900); // Source1ColorGL-OneMinusSource1AlphaGL
+    }
+    return 0x78;
+}
+
+constexpr std::array<GLenum, 0x78> MakeBlendFuncTable() {
+    using Factor = Maxwell::Blend::Factor;
+
+    std::array<GLenum, 0x78> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Factor factor, GLenum gl) {
+        table[BlendFactorIndex(static_cast<u32>(factor))] = gl;
+    };
+    set(Factor::Zero, GL_ZERO);
+    set(Factor::ZeroGL, GL_ZERO);
+    set(Factor::One, GL_ONE);
+    set(Factor::OneGL, GL_ONE);
+    set(Factor::SourceColor, GL_SRC_COLOR);
+    set(Factor::SourceColorGL, GL_SRC_COLOR);
+    set(Factor::OneMinusSourceColor, GL_ONE_MINUS_SRC_COLOR);
+    set(Factor::OneMinusSourceColorGL, GL_ONE_MINUS_SRC_COLOR);
+    set(Factor::SourceAlpha, GL_SRC_ALPHA);
+    set(Factor::SourceAlphaGL, GL_SRC_ALPHA);
+    set(Factor::OneMinusSourceAlpha, GL_ONE_MINUS_SRC_ALPHA);
+    set(Factor::OneMinusSourceAlphaGL, GL_ONE_MINUS_SRC_ALPHA);
+    set(Factor::DestAlpha, GL_DST_ALPHA);
+    set(Factor::DestAlphaGL, GL_DST_ALPHA);
+    set(Factor::OneMinusDestAlpha, GL_ONE_MINUS_DST_ALPHA);
+    set(Factor::OneMinusDestAlphaGL, GL_ONE_MINUS_DST_ALPHA);
+    set(Factor::DestColor, GL_DST_COLOR);
+    set(Factor::DestColorGL, GL_DST_COLOR);
+    set(Factor::OneMinusDestColor, GL_ONE_MINUS_DST_COLOR);
+    set(Factor::OneMinusDestColorGL, GL_ONE_MINUS_DST_COLOR);
+    set(Factor::SourceAlphaSaturate, GL_SRC_ALPHA_SATURATE);
+    set(Factor::SourceAlphaSaturateGL, GL_SRC_ALPHA_SATURATE);
+    set(Factor::Source1Color, GL_SRC1_COLOR);
+    set(Factor::Source1ColorGL, GL_SRC1_COLOR);
+    set(Factor::OneMinusSource1Color, GL_ONE_MINUS_SRC1_COLOR);
+    set(Factor::OneMinusSource1ColorGL, GL_ONE_MINUS_SRC1_COLOR);
+    set(Factor::Source1Alpha, GL_SRC1_ALPHA);
+    set(Factor::Source1AlphaGL, GL_SRC1_ALPHA);
+    set(Factor::OneMinusSource1Alpha, GL_ONE_MINUS_SRC1_ALPHA);
+    set(Factor::OneMinusSource1AlphaGL, GL_ONE_MINUS_SRC1_ALPHA);
+    set(Factor::ConstantColor, GL_CONSTANT_COLOR);
+    set(Factor::ConstantColorGL, GL_CONSTANT_COLOR);
+    set(Factor::OneMinusConstantColor, GL_ONE_MINUS_CONSTANT_COLOR);
+    set(Factor::OneMinusConstantColorGL, GL_ONE_MINUS_CONSTANT_COLOR);
+    set(Factor::ConstantAlpha, GL_CONSTANT_ALPHA);
+    set(Factor::ConstantAlphaGL, GL_CONSTANT_ALPHA);
+    set(Factor::OneMinusConstantAlpha, GL_ONE_MINUS_CONSTANT_ALPHA);
+    set(Factor::OneMinusConstantAlphaGL, GL_ONE_MINUS_CONSTANT_ALPHA);
+    return table;
+}
+
+constexpr std::array<GLenum, 0x78> BlendFuncTable = MakeBlendFuncTable();
+
+constexpr std::array<GLenum, 8> MakeSwizzleSourceTable() {
+    using Tegra::Texture::SwizzleSource;
+
+    std::array<GLenum, 8> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](SwizzleSource source, GLenum gl) {
+        table[static_cast<std::size_t>(source)] = gl;
+    };
+    set(SwizzleSource::Zero, GL_ZERO);
+    set(SwizzleSource::R, GL_RED);
+    set(SwizzleSource::G, GL_GREEN);
+    set(SwizzleSource::B, GL_BLUE);
+    set(SwizzleSource::A, GL_ALPHA);
+    set(SwizzleSource::OneInt, GL_ONE);
+    set(SwizzleSource::OneFloat, GL_ONE);
+    return table;
+}
+
+constexpr std::array<GLenum, 8> SwizzleSourceTable = MakeSwizzleSourceTable();
+
+/// New-style values are 0x200-0x207 and the NV04-style values 1-8; the two encodings list the
+/// operations in the same order, so they share one table.
+constexpr std::size_t ComparisonOpIndex(u32 raw) {
+    if (raw - 0x200 < 8) {
+        return raw - 0x200;
+    }
+    if (raw - 1 < 8) {
+        return raw - 1;
+    }
+    return 8;
+}
+
+constexpr std::array<GLenum, 8> MakeComparisonOpTable() {
+    std::array<GLenum, 8> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::ComparisonOp op, GLenum gl) {
+        table[ComparisonOpIndex(static_cast<u32>(op))] = gl;
+    };
+    set(Maxwell::ComparisonOp::Never, GL_NEVER);
+    set(Maxwell::ComparisonOp::NeverOld, GL_NEVER);
+    set(Maxwell::ComparisonOp::Less, GL_LESS);
+    set(Maxwell::ComparisonOp::LessOld, GL_LESS);
+    set(Maxwell::ComparisonOp::Equal, GL_EQUAL);
+    set(Maxwell::ComparisonOp::EqualOld, GL_EQUAL);
+    set(Maxwell::ComparisonOp::LessEqual, GL_LEQUAL);
+    set(Maxwell::ComparisonOp::LessEqualOld, GL_LEQUAL);
+    set(Maxwell::ComparisonOp::Greater, GL_GREATER);
+    set(Maxwell::ComparisonOp::GreaterOld, GL_GREATER);
+    set(Maxwell::ComparisonOp::NotEqual, GL_NOTEQUAL);
+    set(Maxwell::ComparisonOp::NotEqualOld, GL_NOTEQUAL);
+    set(Maxwell::ComparisonOp::GreaterEqual, GL_GEQUAL);
+    set(Maxwell::ComparisonOp::GreaterEqualOld, GL_GEQUAL);
+    set(Maxwell::ComparisonOp::Always, GL_ALWAYS);
+    set(Maxwell::ComparisonOp::AlwaysOld, GL_ALWAYS);
+    return table;
+}
+
+constexpr std::array<GLenum, 8> ComparisonOpTable = MakeComparisonOpTable();
+
+/// Native ops occupy 0-8 (ZeroOGL aliases 0) and the GL-token aliases sit in three short runs.
+constexpr std::size_t StencilOpIndex(u32 raw) {
+    if (raw <= 8) {
+        return raw;
+    }
+    if (raw - 0x1E00 < 4) {
+        return 9 + (raw - 0x1E00); // KeepOGL, ReplaceOGL, IncrOGL, DecrOGL
+    }
+    if (raw == 0x150A) {
+        return 13; // InvertOGL
+    }
+    if (raw - 0x8507 < 2) {
+        return 14 + (raw - 0x8507); // IncrWrapOGL, DecrWrapOGL
+    }
+    return 16;
+}
+
+constexpr std::array<GLenum, 16> MakeStencilOpTable() {
+    std::array<GLenum, 16> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::StencilOp op, GLenum gl) {
+        table[StencilOpIndex(static_cast<u32>(op))] = gl;
+    };
+    set(Maxwell::StencilOp::Keep, GL_KEEP);
+    set(Maxwell::StencilOp::KeepOGL, GL_KEEP);
+    set(Maxwell::StencilOp::Zero, GL_ZERO);
+    set(Maxwell::StencilOp::ZeroOGL, GL_ZERO);
+    set(Maxwell::StencilOp::Replace, GL_REPLACE);
+    set(Maxwell::StencilOp::ReplaceOGL, GL_REPLACE);
+    set(Maxwell::StencilOp::Incr, GL_INCR);
+    set(Maxwell::StencilOp::IncrOGL, GL_INCR);
+    set(Maxwell::StencilOp::Decr, GL_DECR);
+    set(Maxwell::StencilOp::DecrOGL, GL_DECR);
+    set(Maxwell::StencilOp::Invert, GL_INVERT);
+    set(Maxwell::StencilOp::InvertOGL, GL_INVERT);
+    set(Maxwell::StencilOp::IncrWrap, GL_INCR_WRAP);
+    set(Maxwell::StencilOp::IncrWrapOGL, GL_INCR_WRAP);
+    set(Maxwell::StencilOp::DecrWrap, GL_DECR_WRAP);
+    set(Maxwell::StencilOp::DecrWrapOGL, GL_DECR_WRAP);
+    return table;
+}
+
+constexpr std::array<GLenum, 16> StencilOpTable = MakeStencilOpTable();
+
+constexpr std::size_t FrontFaceIndex(u32 raw) {
+    return raw - 0x0900;
+}
+
+constexpr std::array<GLenum, 2> MakeFrontFaceTable() {
+    std::array<GLenum, 2> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::Cull::FrontFace front_face, GLenum gl) {
+        table[FrontFaceIndex(static_cast<u32>(front_face))] = gl;
+    };
+    set(Maxwell::Cull::FrontFace::ClockWise, GL_CW);
+    set(Maxwell::Cull::FrontFace::CounterClockWise, GL_CCW);
+    return table;
+}
+
+constexpr std::array<GLenum, 2> FrontFaceTable = MakeFrontFaceTable();
+
+constexpr std::size_t CullFaceIndex(u32 raw) {
+    return raw - 0x0404;
+}
+
+constexpr std::array<GLenum, 5> MakeCullFaceTable() {
+    std::array<GLenum, 5> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::Cull::CullFace cull_face, GLenum gl) {
+        table[CullFaceIndex(static_cast<u32>(cull_face))] = gl;
+    };
+    set(Maxwell::Cull::CullFace::Front, GL_FRONT);
+    set(Maxwell::Cull::CullFace::Back, GL_BACK);
+    set(Maxwell::Cull::CullFace::FrontAndBack, GL_FRONT_AND_BACK);
+    return table;
+}
+
+constexpr std::array<GLenum, 5> CullFaceTable = MakeCullFaceTable();
+
+constexpr std::size_t LogicOpIndex(u32 raw) {
+    return raw - 0x1500;
+}
+
+constexpr std::array<GLenum, 16> MakeLogicOpTable() {
+    std::array<GLenum, 16> table{};
+    for (auto& entry : table) {
+        entry = InvalidTranslation;
+    }
+    const auto set = [&table](Maxwell::LogicOperation operation, GLenum gl) {
+        table[LogicOpIndex(static_cast<u32>(operation))] = gl;
+    };
+    set(Maxwell::LogicOperation::Clear, GL_CLEAR);
+    set(Maxwell::LogicOperation::And, GL_AND);
+    set(Maxwell::LogicOperation::AndReverse, GL_AND_REVERSE);
+    set(Maxwell::LogicOperation::Copy, GL_COPY);
+    set(Maxwell::LogicOperation::AndInverted, GL_AND_INVERTED);
+    set(Maxwell::LogicOperation::NoOp, GL_NOOP);
+    set(Maxwell::LogicOperation::Xor, GL_XOR);
+    set(Maxwell::LogicOperation::Or, GL_OR);
+    set(Maxwell::LogicOperation::Nor, GL_NOR);
+    set(Maxwell::LogicOperation::Equiv, GL_EQUIV);
+    set(Maxwell::LogicOperation::Invert, GL_INVERT);
+    set(Maxwell::LogicOperation::OrReverse, GL_OR_REVERSE);
+    set(Maxwell::LogicOperation::CopyInverted, GL_COPY_INVERTED);
+    set(Maxwell::LogicOperation::OrInverted, GL_OR_INVERTED);
+    set(Maxwell::LogicOperation::Nand, GL_NAND);
+    set(Maxwell::LogicOperation::Set, GL_SET);
+    return table;
+}
+
+constexpr std::array<GLenum, 16> LogicOpTable = MakeLogicOpTable();
+
+} // namespace detail
+
 inline GLenum VertexType(Maxwell::VertexAttribute attrib) {
-    switch (attrib.type) {
-    case Maxwell::VertexAttribute::Type::UnsignedInt:
-    case Maxwell::VertexAttribute::Type::UnsignedNorm: {
-
-        switch (attrib.size) {
-        case Maxwell::VertexAttribute::Size::Size_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8_8_8:
-            return GL_UNSIGNED_BYTE;
-        case Maxwell::VertexAttribute::Size::Size_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16_16:
-            return GL_UNSIGNED_SHORT;
-        case Maxwell::VertexAttribute::Size::Size_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32_32:
-            return GL_UNSIGNED_INT;
-        case Maxwell::VertexAttribute::Size::Size_10_10_10_2:
-            return GL_UNSIGNED_INT_2_10_10_10_REV;
-        }
-
-        LOG_CRITICAL(Render_OpenGL, "Unimplemented vertex size={}", attrib.SizeString());
-        UNREACHABLE();
-        return {};
-    }
-
-    case Maxwell::VertexAttribute::Type::SignedInt:
-    case Maxwell::VertexAttribute::Type::SignedNorm: {
-
-        switch (attrib.size) {
-        case Maxwell::VertexAttribute::Size::Size_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8_8:
-        case Maxwell::VertexAttribute::Size::Size_8_8_8_8:
-            return GL_BYTE;
-        case Maxwell::VertexAttribute::Size::Size_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16_16:
-            return GL_SHORT;
-        case Maxwell::VertexAttribute::Size::Size_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32_32:
-            return GL_INT;
-        case Maxwell::VertexAttribute::Size::Size_10_10_10_2:
-            return GL_INT_2_10_10_10_REV;
-        }
-
-        LOG_CRITICAL(Render_OpenGL, "Unimplemented vertex size={}", attrib.SizeString());
-        UNREACHABLE();
-        return {};
-    }
-
-    case Maxwell::VertexAttribute::Type::Float: {
-        switch (attrib.size) {
-        case Maxwell::VertexAttribute::Size::Size_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16:
-        case Maxwell::VertexAttribute::Size::Size_16_16_16_16:
-            return GL_HALF_FLOAT;
-        case Maxwell::VertexAttribute::Size::Size_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32:
-        case Maxwell::VertexAttribute::Size::Size_32_32_32_32:
-            return GL_FLOAT;
-        }
-    }
-    }
-
-    LOG_CRITICAL(Render_OpenGL, "Unimplemented vertex type={}", attrib.TypeString());
-    UNREACHABLE();
-    return {};
+    const GLenum gl = detail::VertexTypeTable[detail::VertexTypeIndex(attrib.type, attrib.size)];
+    if (gl == InvalidTranslation) {
+        return UnimplementedVertexType(attrib);
+    }
+    return gl;
 }
 
 inline GLenum IndexFormat(Maxwell::IndexFormat index_format) {
-    switch (index_format) {
-    case Maxwell::IndexFormat::UnsignedByte:
-        return GL_UNSIGNED_BYTE;
-    case Maxwell::IndexFormat::UnsignedShort:
-        return GL_UNSIGNED_SHORT;
-    case Maxwell::IndexFormat::UnsignedInt:
-        return GL_UNSIGNED_INT;
+    const auto index = static_cast<std::size_t>(index_format);
+    if (index >= detail::IndexFormatTable.size()) {
+        return UnreachableTranslation("index_format", static_cast<u32>(index_format));
     }
-    LOG_CRITICAL(Render_OpenGL, "Unimplemented index_format={}", static_cast<u32>(index_format));
-    UNREACHABLE();
-    return {};
+    return detail::IndexFormatTable[index];
 }
 
 inline GLenum PrimitiveTopology(Maxwell::PrimitiveTopology topology) {
-    switch (topology) {
-    case Maxwell::PrimitiveTopology::Points:
-        return GL_POINTS;
-    case Maxwell::PrimitiveTopology::Lines:
-        return GL_LINES;
-    case Maxwell::PrimitiveTopology::LineStrip:
-        return GL_LINE_STRIP;
-    case Maxwell::PrimitiveTopology::Triangles:
-        return GL_TRIANGLES;
-    case Maxwell::PrimitiveTopology::TriangleStrip:
-        return GL_TRIANGLE_STRIP;
-    }
-    LOG_CRITICAL(Render_OpenGL, "Unimplemented topology={}", static_cast<u32>(topology));
-    UNREACHABLE();
-    return {};
+    const auto index = static_cast<std::size_t>(topology);
+    if (index >= detail::PrimitiveTopologyTable.size() ||
+        detail::PrimitiveTopologyTable[index] == InvalidTranslation) {
+        return UnreachableTranslation("topology", static_cast<u32>(topology));
+    }
+    return detail::PrimitiveTopologyTable[index];
 }
 
 inline GLenum TextureFilterMode(Tegra::Texture::TextureFilter filter_mode,
                                 Tegra::Texture::TextureMipmapFilter mip_filter_mode) {
-    switch (filter_mode) {
-    case Tegra::Texture::TextureFilter::Linear: {
-        switch (mip_filter_mode) {
-        case Tegra::Texture::TextureMipmapFilter::None:
-            return GL_LINEAR;
-        case Tegra::Texture::TextureMipmapFilter::Nearest:
-            return GL_NEAREST_MIPMAP_LINEAR;
-        case Tegra::Texture::TextureMipmapFilter::Linear:
-            return GL_LINEAR_MIPMAP_LINEAR;
-        }
-    }
-    case Tegra::Texture::TextureFilter::Nearest: {
-        switch (mip_filter_mode) {
-        case Tegra::Texture::TextureMipmapFilter::None:
-            return GL_NEAREST;
-        case Tegra::Texture::TextureMipmapFilter::Nearest:
-            return GL_NEAREST_MIPMAP_NEAREST;
-        case Tegra::Texture::TextureMipmapFilter::Linear:
-            return GL_LINEAR_MIPMAP_NEAREST;
-        }
-    }
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented texture filter mode={}", static_cast<u32>(filter_mode));
-    return GL_LINEAR;
+    const std::size_t index = detail::TextureFilterIndex(filter_mode, mip_filter_mode);
+    if (index >= detail::TextureFilterTable.size() ||
+        detail::TextureFilterTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("texture filter mode", static_cast<u32>(filter_mode),
+                                        GL_LINEAR);
+    }
+    return detail::TextureFilterTable[index];
 }
 
 inline GLenum WrapMode(Tegra::Texture::WrapMode wrap_mode) {
-    switch (wrap_mode) {
-    case Tegra::Texture::WrapMode::Wrap:
-        return GL_REPEAT;
-    case Tegra::Texture::WrapMode::Mirror:
-        return GL_MIRRORED_REPEAT;
-    case Tegra::Texture::WrapMode::ClampToEdge:
-        return GL_CLAMP_TO_EDGE;
-    case Tegra::Texture::WrapMode::Border:
-        return GL_CLAMP_TO_BORDER;
-    case Tegra::Texture::WrapMode::ClampOGL:
-        // TODO(Subv): GL_CLAMP was removed as of OpenGL 3.1, to implement GL_CLAMP, we can use
-        // GL_CLAMP_TO_BORDER to get the border color of the texture, and then sample the edge to
-        // manually mix them. However the shader part of this is not yet implemented.
-        return GL_CLAMP_TO_BORDER;
-    case Tegra::Texture::WrapMode::MirrorOnceClampToEdge:
+    const auto index = static_cast<std::size_t>(wrap_mode);
+    if (index >= detail::WrapModeTable.size() ||
+        detail::WrapModeTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("texture wrap mode", static_cast<u32>(wrap_mode),
+                                        GL_REPEAT);
+    }
+    if (wrap_mode == Tegra::Texture::WrapMode::MirrorOnceBorder && !GL_EXT_texture_mirror_clamp) {
         return GL_MIRROR_CLAMP_TO_EDGE;
-    case Tegra::Texture::WrapMode::MirrorOnceBorder:
-        if (GL_EXT_texture_mirror_clamp) {
-            return GL_MIRROR_CLAMP_TO_BORDER_EXT;
-        } else {
-            return GL_MIRROR_CLAMP_TO_EDGE;
-        }
     }
-    LOG_ERROR(Render_OpenGL, "Unimplemented texture wrap mode={}", static_cast<u32>(wrap_mode));
-    return GL_REPEAT;
+    return detail::WrapModeTable[index];
 }
 
 inline GLenum DepthCompareFunc(Tegra::Texture::DepthCompareFunc func) {
-    switch (func) {
-    case Tegra::Texture::DepthCompareFunc::Never:
-        return GL_NEVER;
-    case Tegra::Texture::DepthCompareFunc::Less:
-        return GL_LESS;
-    case Tegra::Texture::DepthCompareFunc::LessEqual:
-        return GL_LEQUAL;
-    case Tegra::Texture::DepthCompareFunc::Equal:
-        return GL_EQUAL;
-    case Tegra::Texture::DepthCompareFunc::NotEqual:
-        return GL_NOTEQUAL;
-    case Tegra::Texture::DepthCompareFunc::Greater:
-        return GL_GREATER;
-    case Tegra::Texture::DepthCompareFunc::GreaterEqual:
-        return GL_GEQUAL;
-    case Tegra::Texture::DepthCompareFunc::Always:
-        return GL_ALWAYS;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented texture depth compare function ={}",
-              static_cast<u32>(func));
-    return GL_GREATER;
+    const auto index = static_cast<std::size_t>(func);
+    if (index >= detail::DepthCompareFuncTable.size()) {
+        return UnimplementedTranslation("texture depth compare function ", static_cast<u32>(func),
+                                        GL_GREATER);
+    }
+    return detail::DepthCompareFuncTable[index];
 }
 
 inline GLenum BlendEquation(Maxwell::Blend::Equation equation) {
-    switch (equation) {
-    case Maxwell::Blend::Equation::Add:
-    case Maxwell::Blend::Equation::AddGL:
-        return GL_FUNC_ADD;
-    case Maxwell::Blend::Equation::Subtract:
-    case Maxwell::Blend::Equation::SubtractGL:
-        return GL_FUNC_SUBTRACT;
-    case Maxwell::Blend::Equation::ReverseSubtract:
-    case Maxwell::Blend::Equation::ReverseSubtractGL:
-        return GL_FUNC_REVERSE_SUBTRACT;
-    case Maxwell::Blend::Equation::Min:
-    case Maxwell::Blend::Equation::MinGL:
-        return GL_MIN;
-    case Maxwell::Blend::Equation::Max:
-    case Maxwell::Blend::Equation::MaxGL:
-        return GL_MAX;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented blend equation={}", static_cast<u32>(equation));
-    return GL_FUNC_ADD;
+    const std::size_t index = detail::BlendEquationIndex(static_cast<u32>(equation));
+    if (index >= detail::BlendEquationTable.size() ||
+        detail::BlendEquationTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("blend equation", static_cast<u32>(equation), GL_FUNC_ADD);
+    }
+    return detail::BlendEquationTable[index];
 }
 
 inline GLenum BlendFunc(Maxwell::Blend::Factor factor) {
-    switch (factor) {
-    case Maxwell::Blend::Factor::Zero:
-    case Maxwell::Blend::Factor::ZeroGL:
-        return GL_ZERO;
-    case Maxwell::Blend::Factor::One:
-    case Maxwell::Blend::Factor::OneGL:
-        return GL_ONE;
-    case Maxwell::Blend::Factor::SourceColor:
-    case Maxwell::Blend::Factor::SourceColorGL:
-        return GL_SRC_COLOR;
-    case Maxwell::Blend::Factor::OneMinusSourceColor:
-    case Maxwell::Blend::Factor::OneMinusSourceColorGL:
-        return GL_ONE_MINUS_SRC_COLOR;
-    case Maxwell::Blend::Factor::SourceAlpha:
-    case Maxwell::Blend::Factor::SourceAlphaGL:
-        return GL_SRC_ALPHA;
-    case Maxwell::Blend::Factor::OneMinusSourceAlpha:
-    case Maxwell::Blend::Factor::OneMinusSourceAlphaGL:
-        return GL_ONE_MINUS_SRC_ALPHA;
-    case Maxwell::Blend::Factor::DestAlpha:
-    case Maxwell::Blend::Factor::DestAlphaGL:
-        return GL_DST_ALPHA;
-    case Maxwell::Blend::Factor::OneMinusDestAlpha:
-    case Maxwell::Blend::Factor::OneMinusDestAlphaGL:
-        return GL_ONE_MINUS_DST_ALPHA;
-    case Maxwell::Blend::Factor::DestColor:
-    case Maxwell::Blend::Factor::DestColorGL:
-        return GL_DST_COLOR;
-    case Maxwell::Blend::Factor::OneMinusDestColor:
-    case Maxwell::Blend::Factor::OneMinusDestColorGL:
-        return GL_ONE_MINUS_DST_COLOR;
-    case Maxwell::Blend::Factor::SourceAlphaSaturate:
-    case Maxwell::Blend::Factor::SourceAlphaSaturateGL:
-        return GL_SRC_ALPHA_SATURATE;
-    case Maxwell::Blend::Factor::Source1Color:
-    case Maxwell::Blend::Factor::Source1ColorGL:
-        return GL_SRC1_COLOR;
-    case Maxwell::Blend::Factor::OneMinusSource1Color:
-    case Maxwell::Blend::Factor::OneMinusSource1ColorGL:
-        return GL_ONE_MINUS_SRC1_COLOR;
-    case Maxwell::Blend::Factor::Source1Alpha:
-    case Maxwell::Blend::Factor::Source1AlphaGL:
-        return GL_SRC1_ALPHA;
-    case Maxwell::Blend::Factor::OneMinusSource1Alpha:
-    case Maxwell::Blend::Factor::OneMinusSource1AlphaGL:
-        return GL_ONE_MINUS_SRC1_ALPHA;
-    case Maxwell::Blend::Factor::ConstantColor:
-    case Maxwell::Blend::Factor::ConstantColorGL:
-        return GL_CONSTANT_COLOR;
-    case Maxwell::Blend::Factor::OneMinusConstantColor:
-    case Maxwell::Blend::Factor::OneMinusConstantColorGL:
-        return GL_ONE_MINUS_CONSTANT_COLOR;
-    case Maxwell::Blend::Factor::ConstantAlpha:
-    case Maxwell::Blend::Factor::ConstantAlphaGL:
-        return GL_CONSTANT_ALPHA;
-    case Maxwell::Blend::Factor::OneMinusConstantAlpha:
-    case Maxwell::Blend::Factor::OneMinusConstantAlphaGL:
-        return GL_ONE_MINUS_CONSTANT_ALPHA;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented blend factor={}", static_cast<u32>(factor));
-    return GL_ZERO;
+    const std::size_t index = detail::BlendFactorIndex(static_cast<u32>(factor));
+    if (index >= detail::BlendFuncTable.size() ||
+        detail::BlendFuncTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("blend factor", static_cast<u32>(factor), GL_ZERO);
+    }
+    return detail::BlendFuncTable[index];
 }
 
 inline GLenum SwizzleSource(Tegra::Texture::SwizzleSource source) {
-    switch (source) {
-    case Tegra::Texture::SwizzleSource::Zero:
-        return GL_ZERO;
-    case Tegra::Texture::SwizzleSource::R:
-        return GL_RED;
-    case Tegra::Texture::SwizzleSource::G:
-        return GL_GREEN;
-    case Tegra::Texture::SwizzleSource::B:
-        return GL_BLUE;
-    case Tegra::Texture::SwizzleSource::A:
-        return GL_ALPHA;
-    case Tegra::Texture::SwizzleSource::OneInt:
-    case Tegra::Texture::SwizzleSource::OneFloat:
-        return GL_ONE;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented swizzle source={}", static_cast<u32>(source));
-    return GL_ZERO;
+    const auto index = static_cast<std::size_t>(source);
+    if (index >= detail::SwizzleSourceTable.size() ||
+        detail::SwizzleSourceTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("swizzle source", static_cast<u32>(source), GL_ZERO);
+    }
+    return detail::SwizzleSourceTable[index];
 }
 
 inline GLenum ComparisonOp(Maxwell::ComparisonOp comparison) {
-    switch (comparison) {
-    case Maxwell::ComparisonOp::Never:
-    case Maxwell::ComparisonOp::NeverOld:
-        return GL_NEVER;
-    case Maxwell::ComparisonOp::Less:
-    case Maxwell::ComparisonOp::LessOld:
-        return GL_LESS;
-    case Maxwell::ComparisonOp::Equal:
-    case Maxwell::ComparisonOp::EqualOld:
-        return GL_EQUAL;
-    case Maxwell::ComparisonOp::LessEqual:
-    case Maxwell::ComparisonOp::LessEqualOld:
-        return GL_LEQUAL;
-    case Maxwell::ComparisonOp::Greater:
-    case Maxwell::ComparisonOp::GreaterOld:
-        return GL_GREATER;
-    case Maxwell::ComparisonOp::NotEqual:
-    case Maxwell::ComparisonOp::NotEqualOld:
-        return GL_NOTEQUAL;
-    case Maxwell::ComparisonOp::GreaterEqual:
-    case Maxwell::ComparisonOp::GreaterEqualOld:
-        return GL_GEQUAL;
-    case Maxwell::ComparisonOp::Always:
-    case Maxwell::ComparisonOp::AlwaysOld:
-        return GL_ALWAYS;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented comparison op={}", static_cast<u32>(comparison));
-    return GL_ALWAYS;
+    const std::size_t index = detail::ComparisonOpIndex(static_cast<u32>(comparison));
+    if (index >= detail::ComparisonOpTable.size()) {
+        return UnimplementedTranslation("comparison op", static_cast<u32>(comparison), GL_ALWAYS);
+    }
+    return detail::ComparisonOpTable[index];
 }
 
 inline GLenum StencilOp(Maxwell::StencilOp stencil) {
-    switch (stencil) {
-    case Maxwell::StencilOp::Keep:
-    case Maxwell::StencilOp::KeepOGL:
-        return GL_KEEP;
-    case Maxwell::StencilOp::Zero:
-    case Maxwell::StencilOp::ZeroOGL:
-        return GL_ZERO;
-    case Maxwell::StencilOp::Replace:
-    case Maxwell::StencilOp::ReplaceOGL:
-        return GL_REPLACE;
-    case Maxwell::StencilOp::Incr:
-    case Maxwell::StencilOp::IncrOGL:
-        return GL_INCR;
-    case Maxwell::StencilOp::Decr:
-    case Maxwell::StencilOp::DecrOGL:
-        return GL_DECR;
-    case Maxwell::StencilOp::Invert:
-    case Maxwell::StencilOp::InvertOGL:
-        return GL_INVERT;
-    case Maxwell::StencilOp::IncrWrap:
-    case Maxwell::StencilOp::IncrWrapOGL:
-        return GL_INCR_WRAP;
-    case Maxwell::StencilOp::DecrWrap:
-    case Maxwell::StencilOp::DecrWrapOGL:
-        return GL_DECR_WRAP;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented stencil op={}", static_cast<u32>(stencil));
-    return GL_KEEP;
+    const std::size_t index = detail::StencilOpIndex(static_cast<u32>(stencil));
+    if (index >= detail::StencilOpTable.size() ||
+        detail::StencilOpTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("stencil op", static_cast<u32>(stencil), GL_KEEP);
+    }
+    return detail::StencilOpTable[index];
 }
 
 inline GLenum FrontFace(Maxwell::Cull::FrontFace front_face) {
-    switch (front_face) {
-    case Maxwell::Cull::FrontFace::ClockWise:
-        return GL_CW;
-    case Maxwell::Cull::FrontFace::CounterClockWise:
-        return GL_CCW;
+    const std::size_t index = detail::FrontFaceIndex(static_cast<u32>(front_face));
+    if (index >= detail::FrontFaceTable.size()) {
+        return UnimplementedTranslation("front face cull", static_cast<u32>(front_face), GL_CCW);
     }
-    LOG_ERROR(Render_OpenGL, "Unimplemented front face cull={}", static_cast<u32>(front_face));
-    return GL_CCW;
+    return detail::FrontFaceTable[index];
 }
 
 inline GLenum CullFace(Maxwell::Cull::CullFace cull_face) {
-    switch (cull_face) {
-    case Maxwell::Cull::CullFace::Front:
-        return GL_FRONT;
-    case Maxwell::Cull::CullFace::Back:
-        return GL_BACK;
-    case Maxwell::Cull::CullFace::FrontAndBack:
-        return GL_FRONT_AND_BACK;
+    const std::size_t index = detail::CullFaceIndex(static_cast<u32>(cull_face));
+    if (index >= detail::CullFaceTable.size() ||
+        detail::CullFaceTable[index] == InvalidTranslation) {
+        return UnimplementedTranslation("cull face", static_cast<u32>(cull_face), GL_BACK);
     }
-    LOG_ERROR(Render_OpenGL, "Unimplemented cull face={}", static_cast<u32>(cull_face));
-    return GL_BACK;
+    return detail::CullFaceTable[index];
 }
 
 inline GLenum LogicOp(Maxwell::LogicOperation operation) {
-    switch (operation) {
-    case Maxwell::LogicOperation::Clear:
-        return GL_CLEAR;
-    case Maxwell::LogicOperation::And:
-        return GL_AND;
-    case Maxwell::LogicOperation::AndReverse:
-        return GL_AND_REVERSE;
-    case Maxwell::LogicOperation::Copy:
-        return GL_COPY;
-    case Maxwell::LogicOperation::AndInverted:
-        return GL_AND_INVERTED;
-    case Maxwell::LogicOperation::NoOp:
-        return GL_NOOP;
-    case Maxwell::LogicOperation::Xor:
-        return GL_XOR;
-    case Maxwell::LogicOperation::Or:
-        return GL_OR;
-    case Maxwell::LogicOperation::Nor:
-        return GL_NOR;
-    case Maxwell::LogicOperation::Equiv:
-        return GL_EQUIV;
-    case Maxwell::LogicOperation::Invert:
-        return GL_INVERT;
-    case Maxwell::LogicOperation::OrReverse:
-        return GL_OR_REVERSE;
-    case Maxwell::LogicOperation::CopyInverted:
-        return GL_COPY_INVERTED;
-    case Maxwell::LogicOperation::OrInverted:
-        return GL_OR_INVERTED;
-    case Maxwell::LogicOperation::Nand:
-        return GL_NAND;
-    case Maxwell::LogicOperation::Set:
-        return GL_SET;
-    }
-    LOG_ERROR(Render_OpenGL, "Unimplemented logic operation={}", static_cast<u32>(operation));
-    return GL_COPY;
+    const std::size_t index = detail::LogicOpIndex(static_cast<u32>(operation));
+    if (index >= detail::LogicOpTable.size()) {
+        return UnimplementedTranslation("logic operation", static_cast<u32>(operation), GL_COPY);
+    }
+    return detail::LogicOpTable[index];
 }
 
 } // namespace MaxwellToGL
@@ -21,6 +21,7 @@
 #include "core/tracer/recorder.h"
 #include "video_core/morton.h"
 #include "video_core/renderer_opengl/gl_rasterizer.h"
+#include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/renderer_opengl.h"
 
 namespace OpenGL {
@@ -119,12 +120,21 @@ void RendererOpenGL::SwapBuffers(
     std::optional<std::reference_wrapper<const Tegra::FramebufferConfig>> framebuffer) {
     ScopeAcquireGLContext acquire_context{render_window};
 
-    Core::System::GetInstance().GetPerfStats().EndSystemFrame();
+    // In asynchronous GPU mode this runs on the GPU thread while the emulation thread keeps
+    // producing frames; pacing then happens on the producer side (GPUThread::ThreadManager)
+    // so that host present stalls cannot throttle emulation.
+    const bool pace_here = !Settings::values.use_asynchronous_gpu_emulation;
+
+    if (pace_here) {
+        Core::System::GetInstance().GetPerfStats().EndSystemFrame();
+    }
 
     // Maintain the rasterizer's state as a priority
     OpenGLState prev_state = OpenGLState::GetCurState();
     state.Apply();
 
+    Core::System::GetInstance().GetPerfStats().BeginPhase(Core::PerfStats::Phase::Swap);
+
     if (framebuffer) {
         // If framebuffer is provided, reload it from memory to a texture
         if (screen_info.texture.width != (GLsizei)framebuffer->get().width ||
@@ -139,13 +149,30 @@ void RendererOpenGL::SwapBuffers(
         // Load the framebuffer from memory, draw it to the screen, and swap buffers
         LoadFBToScreenInfo(*framebuffer);
         DrawScreen();
+
+        if (Settings::values.dump_frames) {
+            CaptureScreen();
+        } else if (frame_capturer) {
+            // Flush the in-flight readbacks when dumping is turned off mid-session
+            frame_capturer.reset();
+        }
+
+        Core::System::GetInstance().GetPerfStats().RecordFramePresented();
         render_window.SwapBuffers();
+        Core::System::GetInstance().GetPerfStats().RecordSwapCompleted();
     }
 
+    Core::System::GetInstance().GetPerfStats().EndPhase(Core::PerfStats::Phase::Swap);
+
+    // Flush the batched deletions for all GL objects released during this frame
+    ReleaseDeferredResources();
+
     render_window.PollEvents();
 
-    Core::System::GetInstance().FrameLimiter().DoFrameLimiting(CoreTiming::GetGlobalTimeUs());
-    Core::System::GetInstance().GetPerfStats().BeginSystemFrame();
+    if (pace_here) {
+        Core::System::GetInstance().FrameLimiter().DoFrameLimiting(CoreTiming::GetGlobalTimeUs());
+        Core::System::GetInstance().GetPerfStats().BeginSystemFrame();
+    }
 
     // Restore the rasterizer state
     prev_state.Apply();
@@ -326,41 +353,18 @@ void RendererOpenGL::ConfigureFramebufferTexture(TextureInfo& texture,
 
 void RendererOpenGL::DrawScreenTriangles(const ScreenInfo& screen_info, float x, float y, float w,
                                          float h) {
-    const auto& texcoords = screen_info.display_texcoords;
-    auto left = texcoords.left;
-    auto right = texcoords.right;
-    if (framebuffer_transform_flags != Tegra::FramebufferConfig::TransformFlags::Unset) {
-        if (framebuffer_transform_flags == Tegra::FramebufferConfig::TransformFlags::FlipV) {
-            // Flip the framebuffer vertically
-            left = texcoords.right;
-            right = texcoords.left;
-        } else {
-            // Other transformations are unsupported
-            LOG_CRITICAL(Render_OpenGL, "Unsupported framebuffer_transform_flags={}",
-                         static_cast<u32>(framebuffer_transform_flags));
-            UNIMPLEMENTED();
-        }
-    }
-
-    ASSERT_MSG(framebuffer_crop_rect.top == 0, "Unimplemented");
-    ASSERT_MSG(framebuffer_crop_rect.left == 0, "Unimplemented");
-
-    // Scale the output by the crop width/height. This is commonly used with 1280x720 rendering
-    // (e.g. handheld mode) on a 1920x1080 framebuffer.
-    f32 scale_u = 1.f, scale_v = 1.f;
-    if (framebuffer_crop_rect.GetWidth() > 0) {
-        scale_u = static_cast<f32>(framebuffer_crop_rect.GetWidth()) / screen_info.texture.width;
-    }
-    if (framebuffer_crop_rect.GetHeight() > 0) {
-        scale_v = static_cast<f32>(framebuffer_crop_rect.GetHeight()) / screen_info.texture.height;
-    }
-
-    std::array<ScreenRectVertex, 4> vertices = {{
-        ScreenRectVertex(x, y, texcoords.top * scale_u, left * scale_v),
-        ScreenRectVertex(x + w, y, texcoords.bottom * scale_u, left * scale_v),
-        ScreenRectVertex(x, y + h, texcoords.top * scale_u, right * scale_v),
-        ScreenRectVertex(x + w, y + h, texcoords.bottom * scale_u, right * scale_v),
-    }};
+    // The quad only depends on the window layout and the guest framebuffer configuration; skip
+    // regenerating and re-uploading it on the frames (nearly all of them) where neither changed.
+    const bool quad_dirty =
+        x != screen_quad_state.x || y != screen_quad_state.y || w != screen_quad_state.w ||
+        h != screen_quad_state.h ||
+        framebuffer_transform_flags != screen_quad_state.transform_flags ||
+        framebuffer_crop_rect.left != screen_quad_state.crop_rect.left ||
+        framebuffer_crop_rect.top != screen_quad_state.crop_rect.top ||
+        framebuffer_crop_rect.right != screen_quad_state.crop_rect.right ||
+        framebuffer_crop_rect.bottom != screen_quad_state.crop_rect.bottom ||
+        screen_info.texture.width != screen_quad_state.texture_width ||
+        screen_info.texture.height != screen_quad_state.texture_height;
 
     state.texture_units[0].texture = screen_info.display_texture;
     state.texture_units[0].swizzle = {GL_RED, GL_GREEN, GL_BLUE, GL_ALPHA};
@@ -370,7 +374,57 @@ void RendererOpenGL::DrawScreenTriangles(const ScreenInfo& screen_info, float x,
     // QTBUG-50987
     state.framebuffer_srgb.enabled = OpenGLState::GetsRGBUsed();
     state.Apply();
-    glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+
+    if (quad_dirty) {
+        screen_quad_state = {x,
+                             y,
+                             w,
+                             h,
+                             framebuffer_transform_flags,
+                             framebuffer_crop_rect,
+                             screen_info.texture.width,
+                             screen_info.texture.height};
+
+        const auto& texcoords = screen_info.display_texcoords;
+        auto left = texcoords.left;
+        auto right = texcoords.right;
+        if (framebuffer_transform_flags != Tegra::FramebufferConfig::TransformFlags::Unset) {
+            if (framebuffer_transform_flags == Tegra::FramebufferConfig::TransformFlags::FlipV) {
+                // Flip the framebuffer vertically
+                left = texcoords.right;
+                right = texcoords.left;
+            } else {
+                // Other transformations are unsupported
+                LOG_CRITICAL(Render_OpenGL, "Unsupported framebuffer_transform_flags={}",
+                             static_cast<u32>(framebuffer_transform_flags));
+                UNIMPLEMENTED();
+            }
+        }
+
+        ASSERT_MSG(framebuffer_crop_rect.top == 0, "Unimplemented");
+        ASSERT_MSG(framebuffer_crop_rect.left == 0, "Unimplemented");
+
+        // Scale the output by the crop width/height. This is commonly used with 1280x720 rendering
+        // (e.g. handheld mode) on a 1920x1080 framebuffer.
+        f32 scale_u = 1.f, scale_v = 1.f;
+        if (framebuffer_crop_rect.GetWidth() > 0) {
+            scale_u =
+                static_cast<f32>(framebuffer_crop_rect.GetWidth()) / screen_info.texture.width;
+        }
+        if (framebuffer_crop_rect.GetHeight() > 0) {
+            scale_v =
+                static_cast<f32>(framebuffer_crop_rect.GetHeight()) / screen_info.texture.height;
+        }
+
+        const std::array<ScreenRectVertex, 4> vertices = {{
+            ScreenRectVertex(x, y, texcoords.top * scale_u, left * scale_v),
+            ScreenRectVertex(x + w, y, texcoords.bottom * scale_u, left * scale_v),
+            ScreenRectVertex(x, y + h, texcoords.top * scale_u, right * scale_v),
+            ScreenRectVertex(x + w, y + h, texcoords.bottom * scale_u, right * scale_v),
+        }};
+        glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices.data());
+    }
+
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
     // restore default state
     state.framebuffer_srgb.enabled = false;
@@ -396,14 +450,22 @@ void RendererOpenGL::DrawScreen() {
     glViewport(0, 0, layout.width, layout.height);
     glClear(GL_COLOR_BUFFER_BIT);
 
-    // Set projection matrix
-    std::array<GLfloat, 3 * 2> ortho_matrix =
-        MakeOrthographicMatrix((float)layout.width, (float)layout.height);
-    glUniformMatrix3x2fv(uniform_modelview_matrix, 1, GL_FALSE, ortho_matrix.data());
+    // Uniform values are program object state and persist across frames, so the projection and
+    // the texture unit index only need to be uploaded when the window has actually been resized.
+    if (layout.width != projection_width || layout.height != projection_height) {
+        projection_width = layout.width;
+        projection_height = layout.height;
+
+        // Set projection matrix
+        std::array<GLfloat, 3 * 2> ortho_matrix =
+            MakeOrthographicMatrix((float)layout.width, (float)layout.height);
+        glUniformMatrix3x2fv(uniform_modelview_matrix, 1, GL_FALSE, ortho_matrix.data());
+
+        // Bind texture in Texture Unit 0
+        glUniform1i(uniform_color_texture, 0);
+    }
 
-    // Bind texture in Texture Unit 0
     glActiveTexture(GL_TEXTURE0);
-    glUniform1i(uniform_color_texture, 0);
 
     DrawScreenTriangles(screen_info, (float)screen.left, (float)screen.top,
                         (float)screen.GetWidth(), (float)screen.GetHeight());
@@ -414,6 +476,24 @@ void RendererOpenGL::DrawScreen() {
 /// Updates the framerate
 void RendererOpenGL::UpdateFramerate() {}
 
+/// Queues an asynchronous readback of the frame that was just drawn
+void RendererOpenGL::CaptureScreen() {
+    const u32 interval = std::max<u32>(Settings::values.dump_frames_interval, 1);
+    if (static_cast<u32>(m_current_frame) % interval != 0) {
+        return;
+    }
+
+    if (!frame_capturer) {
+        frame_capturer = std::make_unique<FrameCapturer>();
+    }
+
+    // The renderer state is applied at this point, so the read framebuffer is the default one;
+    // read from its back buffer, which still holds the frame DrawScreen just produced.
+    const auto& layout = render_window.GetFramebufferLayout();
+    glReadBuffer(GL_BACK);
+    frame_capturer->Capture(layout.width, layout.height, static_cast<u64>(m_current_frame));
+}
+
 static const char* GetSource(GLenum source) {
 #define RET(s)                                                                                     \
     case GL_DEBUG_SOURCE_##s:                                                                      \
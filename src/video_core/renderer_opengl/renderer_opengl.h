@@ -4,11 +4,13 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 #include <glad/glad.h>
 #include "common/common_types.h"
 #include "common/math_util.h"
 #include "video_core/renderer_base.h"
+#include "video_core/renderer_opengl/gl_frame_capturer.h"
 #include "video_core/renderer_opengl/gl_resource_manager.h"
 #include "video_core/renderer_opengl/gl_state.h"
 
@@ -69,6 +71,7 @@ private:
     void DrawScreen();
     void DrawScreenTriangles(const ScreenInfo& screen_info, float x, float y, float w, float h);
     void UpdateFramerate();
+    void CaptureScreen();
 
     // Loads framebuffer from emulated memory into the display information structure
     void LoadFBToScreenInfo(const Tegra::FramebufferConfig& framebuffer);
@@ -100,6 +103,27 @@ private:
     /// Used for transforming the framebuffer orientation
     Tegra::FramebufferConfig::TransformFlags framebuffer_transform_flags;
     MathUtil::Rectangle<int> framebuffer_crop_rect;
+
+    /// Inputs the cached screen quad was last generated from. The quad only changes on window
+    /// resizes and framebuffer reconfiguration, so the present pass skips regenerating and
+    /// re-uploading the vertex buffer while these match.
+    struct {
+        float x = -1.0f;
+        float y = -1.0f;
+        float w = -1.0f;
+        float h = -1.0f;
+        Tegra::FramebufferConfig::TransformFlags transform_flags{};
+        MathUtil::Rectangle<int> crop_rect;
+        GLsizei texture_width = 0;
+        GLsizei texture_height = 0;
+    } screen_quad_state;
+
+    /// Layout size the projection matrix was last uploaded for
+    unsigned projection_width = 0;
+    unsigned projection_height = 0;
+
+    /// Asynchronous frame readback, created on first use when frame dumping is enabled
+    std::unique_ptr<FrameCapturer> frame_capturer;
 };
 
 } // namespace OpenGL
@@ -19,6 +19,7 @@
 #include <cassert>
 #include <cstdint>
 #include <cstring>
+#include <thread>
 #include <vector>
 
 #include "video_core/textures/astc.h"
@@ -1599,28 +1600,60 @@ namespace Tegra::Texture::ASTC {
 
 std::vector<uint8_t> Decompress(std::vector<uint8_t>& data, uint32_t width, uint32_t height,
                                 uint32_t depth, uint32_t block_width, uint32_t block_height) {
-    uint32_t blockIdx = 0;
     std::vector<uint8_t> outData(height * width * depth * 4);
-    for (uint32_t k = 0; k < depth; k++) {
-        for (uint32_t j = 0; j < height; j += block_height) {
-            for (uint32_t i = 0; i < width; i += block_width) {
 
-                uint8_t* blockPtr = data.data() + blockIdx * 16;
+    const uint32_t block_rows = (height + block_height - 1) / block_height;
+    const uint32_t blocks_per_row = (width + block_width - 1) / block_width;
 
-                // Blocks can be at most 12x12
-                uint32_t uncompData[144];
-                ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
+    // Decompresses a single row of blocks. Every block writes to a disjoint region of the
+    // output, so rows can be processed concurrently without synchronization.
+    const auto DecompressBlockRow = [&](uint32_t k, uint32_t block_row) {
+        const uint32_t j = block_row * block_height;
+        uint32_t blockIdx = (k * block_rows + block_row) * blocks_per_row;
+        for (uint32_t i = 0; i < width; i += block_width) {
 
-                uint32_t decompWidth = std::min(block_width, width - i);
-                uint32_t decompHeight = std::min(block_height, height - j);
+            uint8_t* blockPtr = data.data() + blockIdx * 16;
 
-                uint8_t* outRow = outData.data() + (j * width + i) * 4;
-                for (uint32_t jj = 0; jj < decompHeight; jj++) {
-                    memcpy(outRow + jj * width * 4, uncompData + jj * block_width, decompWidth * 4);
-                }
+            // Blocks can be at most 12x12
+            uint32_t uncompData[144];
+            ASTCC::DecompressBlock(blockPtr, block_width, block_height, uncompData);
+
+            uint32_t decompWidth = std::min(block_width, width - i);
+            uint32_t decompHeight = std::min(block_height, height - j);
+
+            uint8_t* outRow = outData.data() + (j * width + i) * 4;
+            for (uint32_t jj = 0; jj < decompHeight; jj++) {
+                memcpy(outRow + jj * width * 4, uncompData + jj * block_width, decompWidth * 4);
+            }
+
+            blockIdx++;
+        }
+    };
+
+    const uint32_t num_threads{
+        std::min(std::max(std::thread::hardware_concurrency(), 1u), block_rows)};
 
-                blockIdx++;
+    for (uint32_t k = 0; k < depth; k++) {
+        // Spinning up threads is only worth it when there is enough work per slice.
+        if (num_threads <= 1 || block_rows < num_threads * 2) {
+            for (uint32_t block_row = 0; block_row < block_rows; block_row++) {
+                DecompressBlockRow(k, block_row);
             }
+            continue;
+        }
+
+        std::vector<std::thread> workers;
+        workers.reserve(num_threads);
+        for (uint32_t thread_idx = 0; thread_idx < num_threads; thread_idx++) {
+            workers.emplace_back([&, thread_idx] {
+                for (uint32_t block_row = thread_idx; block_row < block_rows;
+                     block_row += num_threads) {
+                    DecompressBlockRow(k, block_row);
+                }
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
         }
     }
 
@@ -4,6 +4,11 @@
 
 #include <cmath>
 #include <cstring>
+
+#ifdef ARCHITECTURE_x86_64
+#include <emmintrin.h>
+#endif
+
 #include "common/alignment.h"
 #include "common/assert.h"
 #include "core/memory.h"
@@ -46,11 +51,28 @@ constexpr u32 fast_swizzle_align = 16;
 constexpr auto legacy_swizzle_table = SwizzleTable<gob_size_y, gob_size_x, gob_size_z>();
 constexpr auto fast_swizzle_table = SwizzleTable<gob_size_y, 4, fast_swizzle_align>();
 
+/// Copies a single 16-byte swizzle sector, using vector registers where available.
+static inline void CopySwizzleSector(u8* dst, const u8* src) {
+#ifdef ARCHITECTURE_x86_64
+    // SSE2 is baseline on x86_64. The source and destination are only guaranteed to be aligned
+    // to the sector size relative to their buffers, so use unaligned accesses.
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+#else
+    std::memcpy(dst, src, fast_swizzle_align);
+#endif
+}
+
 /**
  * This function manages ALL the GOBs(Group of Bytes) Inside a single block.
  * Instead of going gob by gob, we map the coordinates inside a block and manage from
  * those. Block_Width is assumed to be 1.
+ *
+ * When static_bytes_per_pixel is non-zero the per-pixel copy has a compile-time size, so the
+ * compiler can turn it into plain loads/stores and vectorize the inner loop; zero keeps the size
+ * a runtime value for the exotic formats that do not get their own instantiation.
  */
+template <u32 static_bytes_per_pixel>
 void PreciseProcessBlock(u8* const swizzled_data, u8* const unswizzled_data, const bool unswizzle,
                          const u32 x_start, const u32 y_start, const u32 z_start, const u32 x_end,
                          const u32 y_end, const u32 z_end, const u32 tile_offset,
@@ -69,7 +91,11 @@ void PreciseProcessBlock(u8* const swizzled_data, u8* const unswizzled_data, con
                 const u32 pixel_index{x * out_bytes_per_pixel + pixel_base};
                 data_ptrs[unswizzle] = swizzled_data + swizzle_offset;
                 data_ptrs[!unswizzle] = unswizzled_data + pixel_index;
-                std::memcpy(data_ptrs[0], data_ptrs[1], bytes_per_pixel);
+                if constexpr (static_bytes_per_pixel != 0) {
+                    std::memcpy(data_ptrs[0], data_ptrs[1], static_bytes_per_pixel);
+                } else {
+                    std::memcpy(data_ptrs[0], data_ptrs[1], bytes_per_pixel);
+                }
             }
             pixel_base += stride_x;
             if ((y + 1) % gob_size_y == 0)
@@ -105,7 +131,7 @@ void FastProcessBlock(u8* const swizzled_data, u8* const unswizzled_data, const
                 const u32 pixel_index{out_x + pixel_base};
                 data_ptrs[unswizzle] = swizzled_data + swizzle_offset;
                 data_ptrs[!unswizzle] = unswizzled_data + pixel_index;
-                std::memcpy(data_ptrs[0], data_ptrs[1], fast_swizzle_align);
+                CopySwizzleSector(data_ptrs[0], data_ptrs[1]);
             }
             pixel_base += stride_x;
             if ((y + 1) % gob_size_y == 0)
@@ -124,7 +150,7 @@ void FastProcessBlock(u8* const swizzled_data, u8* const unswizzled_data, const
  * Documentation for the memory layout and decoding can be found at:
  *  https://envytools.readthedocs.io/en/latest/hw/memory/g80-surface.html#blocklinear-surfaces
  */
-template <bool fast>
+template <bool fast, u32 static_bytes_per_pixel = 0>
 void SwizzledData(u8* const swizzled_data, u8* const unswizzled_data, const bool unswizzle,
                   const u32 width, const u32 height, const u32 depth, const u32 bytes_per_pixel,
                   const u32 out_bytes_per_pixel, const u32 block_height, const u32 block_depth,
@@ -154,14 +180,15 @@ void SwizzledData(u8* const swizzled_data, u8* const unswizzled_data, const bool
             for (u32 xb = 0; xb < blocks_on_x; xb++) {
                 const u32 x_start = xb * block_x_elements;
                 const u32 x_end = std::min(width, x_start + block_x_elements);
-                if (fast) {
+                if constexpr (fast) {
                     FastProcessBlock(swizzled_data, unswizzled_data, unswizzle, x_start, y_start,
                                      z_start, x_end, y_end, z_end, tile_offset, xy_block_size,
                                      layer_z, stride_x, bytes_per_pixel, out_bytes_per_pixel);
                 } else {
-                    PreciseProcessBlock(swizzled_data, unswizzled_data, unswizzle, x_start, y_start,
-                                        z_start, x_end, y_end, z_end, tile_offset, xy_block_size,
-                                        layer_z, stride_x, bytes_per_pixel, out_bytes_per_pixel);
+                    PreciseProcessBlock<static_bytes_per_pixel>(
+                        swizzled_data, unswizzled_data, unswizzle, x_start, y_start, z_start, x_end,
+                        y_end, z_end, tile_offset, xy_block_size, layer_z, stride_x,
+                        bytes_per_pixel, out_bytes_per_pixel);
                 }
                 tile_offset += block_size;
             }
@@ -176,11 +203,50 @@ void CopySwizzledData(u32 width, u32 height, u32 depth, u32 bytes_per_pixel,
         SwizzledData<true>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
                            bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
                            width_spacing);
-    } else {
-        SwizzledData<false>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
-                            bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
-                            width_spacing);
+        return;
+    }
+
+    // The precise path copies one pixel at a time; pick the kernel instantiated for the pixel
+    // size, so the copy size is a compile-time constant in the hot loop. The output pixel size
+    // only differs when a format conversion is involved, which the generic kernel handles.
+    if (bytes_per_pixel == out_bytes_per_pixel) {
+        switch (bytes_per_pixel) {
+        case 1:
+            SwizzledData<false, 1>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
+                                   bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
+                                   width_spacing);
+            return;
+        case 2:
+            SwizzledData<false, 2>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
+                                   bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
+                                   width_spacing);
+            return;
+        case 4:
+            SwizzledData<false, 4>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
+                                   bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
+                                   width_spacing);
+            return;
+        case 8:
+            SwizzledData<false, 8>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
+                                   bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
+                                   width_spacing);
+            return;
+        case 12:
+            SwizzledData<false, 12>(swizzled_data, unswizzled_data, unswizzle, width, height,
+                                    depth, bytes_per_pixel, out_bytes_per_pixel, block_height,
+                                    block_depth, width_spacing);
+            return;
+        case 16:
+            SwizzledData<false, 16>(swizzled_data, unswizzled_data, unswizzle, width, height,
+                                    depth, bytes_per_pixel, out_bytes_per_pixel, block_height,
+                                    block_depth, width_spacing);
+            return;
+        }
     }
+
+    SwizzledData<false>(swizzled_data, unswizzled_data, unswizzle, width, height, depth,
+                        bytes_per_pixel, out_bytes_per_pixel, block_height, block_depth,
+                        width_spacing);
 }
 
 u32 BytesPerPixel(TextureFormat format) {
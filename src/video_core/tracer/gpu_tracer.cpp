@@ -0,0 +1,147 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include "common/alignment.h"
+#include "common/cityhash.h"
+#include "common/logging/log.h"
+#include "core/memory.h"
+#include "core/memory_setup.h"
+#include "video_core/memory_manager.h"
+#include "video_core/tracer/gpu_tracer.h"
+
+namespace Tegra::Tracer {
+
+Recorder::Recorder(const std::string& path) : file(path, "wb") {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to create GPU trace file {}", path);
+        return;
+    }
+
+    const TraceHeader header{TRACE_MAGIC, TRACE_VERSION};
+    file.WriteObject(header);
+    LOG_INFO(HW_GPU, "Recording GPU trace to {}", path);
+}
+
+Recorder::~Recorder() = default;
+
+bool Recorder::IsGood() const {
+    return file.IsOpen();
+}
+
+void Recorder::RecordMethodCall(const GPU::MethodCall& method_call) {
+    file.WriteObject(RecordType::MethodCall);
+    const MethodCallRecord record{method_call.method, method_call.argument,
+                                  method_call.subchannel, method_call.method_count};
+    file.WriteObject(record);
+}
+
+void Recorder::CaptureMemory(MemoryManager& memory_manager) {
+    for (const auto& region : memory_manager.GetMappedRegions()) {
+        scratch.resize(region.size);
+        Memory::ReadBlock(region.cpu_addr, scratch.data(), region.size);
+
+        const u64 hash{
+            Common::CityHash64(reinterpret_cast<const char*>(scratch.data()), region.size)};
+        const auto [it, inserted] = region_hashes.try_emplace(region.gpu_addr, hash);
+        if (!inserted && it->second == hash) {
+            continue;
+        }
+        it->second = hash;
+
+        file.WriteObject(RecordType::MemoryUpdate);
+        const MemoryUpdateRecord record{region.cpu_addr, region.gpu_addr, region.size};
+        file.WriteObject(record);
+        file.WriteBytes(scratch.data(), region.size);
+    }
+}
+
+void Recorder::RecordDispatchBoundary() {
+    file.WriteObject(RecordType::DispatchBoundary);
+}
+
+Player::Player(const std::string& path, GPU& gpu) : file(path, "rb"), gpu(gpu) {
+    if (!file.IsOpen()) {
+        LOG_ERROR(HW_GPU, "Failed to open GPU trace file {}", path);
+        return;
+    }
+
+    TraceHeader header{};
+    if (file.ReadArray(&header, 1) != 1 || header.magic != TRACE_MAGIC ||
+        header.version != TRACE_VERSION) {
+        LOG_ERROR(HW_GPU, "GPU trace file {} has an invalid header", path);
+        return;
+    }
+
+    good = true;
+}
+
+Player::~Player() = default;
+
+bool Player::IsGood() const {
+    return good;
+}
+
+void Player::EnsureRegion(VAddr cpu_addr, GPUVAddr gpu_addr, u64 size) {
+    const VAddr aligned_start{Common::AlignDown(cpu_addr, Memory::PAGE_SIZE)};
+    const VAddr aligned_end{Common::AlignUp(cpu_addr + size, Memory::PAGE_SIZE)};
+    const u64 aligned_size{aligned_end - aligned_start};
+
+    auto& block = backing_blocks[aligned_start];
+    if (block.size() < aligned_size) {
+        // (Re)back the guest range with host memory owned by the player; blocks never move once
+        // mapped, so growth allocates a larger block and remaps the range.
+        block.resize(aligned_size);
+        Memory::MapMemoryRegion(page_table, aligned_start, aligned_size, block.data());
+    }
+
+    if (mapped_gpu_regions.emplace(gpu_addr).second) {
+        auto& memory_manager = gpu.MemoryManager();
+        memory_manager.AllocateSpace(gpu_addr, size, MemoryManager::PAGE_SIZE);
+        memory_manager.MapBufferEx(cpu_addr, gpu_addr, size);
+    }
+}
+
+bool Player::PlayDispatch() {
+    // The player backs guest memory with its own page table, so playback does not depend on a
+    // kernel process being loaded.
+    Memory::SetCurrentPageTable(&page_table);
+
+    RecordType type{};
+    while (file.ReadArray(&type, 1) == 1) {
+        switch (type) {
+        case RecordType::MethodCall: {
+            MethodCallRecord record{};
+            if (file.ReadArray(&record, 1) != 1) {
+                return false;
+            }
+            gpu.CallMethod(
+                {record.method, record.argument, record.subchannel, record.method_count});
+            break;
+        }
+        case RecordType::MemoryUpdate: {
+            MemoryUpdateRecord record{};
+            if (file.ReadArray(&record, 1) != 1) {
+                return false;
+            }
+            EnsureRegion(record.cpu_addr, record.gpu_addr, record.size);
+            scratch.resize(record.size);
+            if (file.ReadBytes(scratch.data(), record.size) != record.size) {
+                return false;
+            }
+            Memory::WriteBlock(record.cpu_addr, scratch.data(), record.size);
+            break;
+        }
+        case RecordType::DispatchBoundary:
+            return true;
+        default:
+            LOG_ERROR(HW_GPU, "GPU trace contains unknown record type {}",
+                      static_cast<u32>(type));
+            return false;
+        }
+    }
+    return false;
+}
+
+} // namespace Tegra::Tracer
@@ -0,0 +1,125 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "common/common_types.h"
+#include "common/file_util.h"
+#include "core/memory.h"
+#include "video_core/gpu.h"
+
+namespace Tegra::Tracer {
+
+// GPU trace file layout (little-endian): a TraceHeader followed by a stream of records, each a
+// one-byte RecordType and its fixed-size payload. MemoryUpdate payloads are followed by the raw
+// region contents. Dispatch boundaries delimit the command lists of one DmaPusher::DispatchCalls,
+// so a replayer can pace playback the way the title paced submission.
+
+constexpr u32 TRACE_MAGIC = 0x52544759; // 'YGTR'
+constexpr u32 TRACE_VERSION = 1;
+
+struct TraceHeader {
+    u32 magic;
+    u32 version;
+};
+static_assert(sizeof(TraceHeader) == 0x8, "TraceHeader has incorrect size");
+
+enum class RecordType : u8 {
+    MethodCall = 0,
+    MemoryUpdate = 1,
+    DispatchBoundary = 2,
+};
+
+#pragma pack(push, 1)
+struct MethodCallRecord {
+    u32 method;
+    u32 argument;
+    u32 subchannel;
+    u32 method_count;
+};
+
+struct MemoryUpdateRecord {
+    u64 cpu_addr;
+    u64 gpu_addr;
+    u64 size;
+    // Followed by size bytes of region contents
+};
+#pragma pack(pop)
+
+/**
+ * Streams GPU method calls and referenced guest memory to a trace file. Memory is captured at
+ * dispatch granularity: before each DmaPusher::DispatchCalls the mapped GPU regions are hashed
+ * and only regions whose contents changed since the last capture are re-written, which keeps
+ * traces compact while still reproducing what the engines could observe.
+ */
+class Recorder {
+public:
+    explicit Recorder(const std::string& path);
+    ~Recorder();
+
+    /// Whether the trace file was created successfully
+    bool IsGood() const;
+
+    /// Records a single GPU method call. Called from GPU::CallMethod.
+    void RecordMethodCall(const GPU::MethodCall& method_call);
+
+    /// Captures mapped guest memory that changed since the last capture.
+    void CaptureMemory(MemoryManager& memory_manager);
+
+    /// Marks the end of one DmaPusher::DispatchCalls.
+    void RecordDispatchBoundary();
+
+private:
+    FileUtil::IOFile file;
+
+    /// Content hash of each mapped region at the last capture, keyed by GPU address
+    std::unordered_map<GPUVAddr, u64> region_hashes;
+
+    /// Scratch buffer for reading back region contents
+    std::vector<u8> scratch;
+};
+
+/**
+ * Drives a Tegra::GPU from a recorded trace, without the CPU emulator. The player owns a private
+ * page table backing the recorded guest regions, so no kernel process is required; it installs
+ * the table for the duration of playback.
+ */
+class Player {
+public:
+    explicit Player(const std::string& path, GPU& gpu);
+    ~Player();
+
+    /// Whether the trace file was opened and its header validated
+    bool IsGood() const;
+
+    /// Plays back records up to and including the next dispatch boundary.
+    /// Returns false when the end of the trace has been reached.
+    bool PlayDispatch();
+
+private:
+    /// Maps backing for a recorded guest region into the private page table and the GPU MMU.
+    void EnsureRegion(VAddr cpu_addr, GPUVAddr gpu_addr, u64 size);
+
+    FileUtil::IOFile file;
+    GPU& gpu;
+    bool good = false;
+
+    /// Private page table backing all recorded guest regions
+    Memory::PageTable page_table{36};
+
+    /// Host storage for the recorded guest regions, keyed by page-aligned guest address
+    std::unordered_map<VAddr, std::vector<u8>> backing_blocks;
+
+    /// GPU regions that have already been mapped into the GPU MMU
+    std::unordered_set<GPUVAddr> mapped_gpu_regions;
+
+    /// Scratch buffer for streaming region contents out of the trace file
+    std::vector<u8> scratch;
+};
+
+} // namespace Tegra::Tracer
@@ -3,6 +3,9 @@
 // Refer to the license.txt file included.
 
 #include <memory>
+#include "common/assert.h"
+#include "common/logging/log.h"
+#include "core/settings.h"
 #include "video_core/renderer_base.h"
 #include "video_core/renderer_opengl/renderer_opengl.h"
 #include "video_core/video_core.h"
@@ -10,7 +13,19 @@
 namespace VideoCore {
 
 std::unique_ptr<RendererBase> CreateRenderer(Core::Frontend::EmuWindow& emu_window) {
-    return std::make_unique<OpenGL::RendererOpenGL>(emu_window);
+    switch (Settings::values.renderer_backend) {
+    case Settings::RendererBackend::OpenGL:
+        return std::make_unique<OpenGL::RendererOpenGL>(emu_window);
+    case Settings::RendererBackend::Vulkan:
+        // TODO: Instantiate the Vulkan renderer here once one exists. Falling back to OpenGL
+        // keeps titles bootable on configs that already request the Vulkan backend.
+        LOG_ERROR(Render, "Vulkan backend requested but not available, falling back to OpenGL");
+        return std::make_unique<OpenGL::RendererOpenGL>(emu_window);
+    default:
+        UNREACHABLE_MSG("Invalid renderer backend {}",
+                        static_cast<u32>(Settings::values.renderer_backend));
+        return nullptr;
+    }
 }
 
 } // namespace VideoCore
@@ -106,9 +106,10 @@ void TelemetryJson::Complete() {
     impl->SerializeSection(Telemetry::FieldType::UserSystem, "UserSystem");
 
     auto content = impl->TopSection().dump();
-    // Send the telemetry async but don't handle the errors since they were written to the log
+    // Send the telemetry async but don't handle the errors since they were written to the log.
+    // The pooled client keeps its TLS session and JWT across submissions.
     Common::DetachedTasks::AddTask([host{impl->host}, content]() {
-        Client{host, "", ""}.PostJson("/telemetry", content, true);
+        GetPooledClient(host, "", "")->PostJson("/telemetry", content, true);
     });
 }
 
@@ -119,8 +120,8 @@ bool TelemetryJson::SubmitTestcase() {
     impl->SerializeSection(Telemetry::FieldType::UserSystem, "UserSystem");
 
     auto content = impl->TopSection().dump();
-    Client client(impl->host, impl->username, impl->token);
-    auto value = client.PostJson("/gamedb/testcase", content, false);
+    const auto client = GetPooledClient(impl->host, impl->username, impl->token);
+    auto value = client->PostJson("/gamedb/testcase", content, false);
 
     return value.result_code == Common::WebResult::Code::Success;
 }
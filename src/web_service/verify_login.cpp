@@ -10,8 +10,8 @@
 namespace WebService {
 
 bool VerifyLogin(const std::string& host, const std::string& username, const std::string& token) {
-    Client client(host, username, token);
-    auto reply = client.GetJson("/profile", false).returned_data;
+    const auto client = GetPooledClient(host, username, token);
+    auto reply = client->GetJson("/profile", false).returned_data;
     if (reply.empty()) {
         return false;
     }
@@ -3,8 +3,10 @@
 // Refer to the license.txt file included.
 
 #include <cstdlib>
+#include <map>
 #include <mutex>
 #include <string>
+#include <tuple>
 #include <LUrlParser.h>
 #include <httplib.h>
 #include "common/common_types.h"
@@ -34,6 +36,10 @@ struct Client::Impl {
     /// A generic function handles POST, GET and DELETE request together
     Common::WebResult GenericJson(const std::string& method, const std::string& path,
                                   const std::string& data, bool allow_anonymous) {
+        // Pooled clients may be used from several detached tasks at once; requests through one
+        // client (and thus one connection/JWT) are serialized.
+        std::lock_guard<std::mutex> lock(send_mutex);
+
         if (jwt.empty()) {
             UpdateJWT();
         }
@@ -164,6 +170,7 @@ struct Client::Impl {
     std::string token;
     std::string jwt;
     std::unique_ptr<httplib::Client> cli;
+    std::mutex send_mutex;
 
     struct JWTCache {
         std::mutex mutex;
@@ -193,4 +200,22 @@ Common::WebResult Client::DeleteJson(const std::string& path, const std::string&
     return impl->GenericJson("DELETE", path, data, allow_anonymous);
 }
 
+std::shared_ptr<Client> GetPooledClient(std::string host, std::string username,
+                                        std::string token) {
+    static std::mutex pool_mutex;
+    static std::map<std::tuple<std::string, std::string, std::string>, std::shared_ptr<Client>>
+        pool;
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+    auto key = std::make_tuple(std::move(host), std::move(username), std::move(token));
+    const auto iter = pool.find(key);
+    if (iter != pool.end()) {
+        return iter->second;
+    }
+
+    auto client = std::make_shared<Client>(std::get<0>(key), std::get<1>(key), std::get<2>(key));
+    pool.emplace(std::move(key), client);
+    return client;
+}
+
 } // namespace WebService
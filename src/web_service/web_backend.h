@@ -51,4 +51,13 @@ private:
     std::unique_ptr<Impl> impl;
 };
 
+/**
+ * Returns a process-wide client for the given host and credentials, creating one on first use.
+ * Pooled clients keep their underlying HTTP client (and with it the cached TLS session and JWT)
+ * alive across requests, so repeated calls skip the authentication round-trip and reconnect with
+ * an abbreviated TLS handshake instead of a full one. Requests through one pooled client are
+ * serialized; independent callers still run concurrently through different hosts/credentials.
+ */
+std::shared_ptr<Client> GetPooledClient(std::string host, std::string username, std::string token);
+
 } // namespace WebService
@@ -19,8 +19,10 @@
 EmuThread::EmuThread(GRenderWindow* render_window) : render_window(render_window) {}
 
 void EmuThread::run() {
-    if (!Settings::values.use_multi_core) {
-        // Single core mode must acquire OpenGL context for entire emulation session
+    if (!Settings::values.use_multi_core &&
+        !Settings::values.use_asynchronous_gpu_emulation) {
+        // Single core mode must acquire OpenGL context for entire emulation session, unless
+        // the GPU thread owns the context instead
         render_window->MakeCurrent();
     }
 
@@ -356,14 +356,39 @@ void Config::ReadValues() {
     qt_config->beginGroup("Core");
     Settings::values.use_cpu_jit = qt_config->value("use_cpu_jit", true).toBool();
     Settings::values.use_multi_core = qt_config->value("use_multi_core", false).toBool();
+    Settings::values.enable_host_thread_scheduling =
+        qt_config->value("enable_host_thread_scheduling", false).toBool();
+    Settings::values.host_cpu_thread_affinity =
+        qt_config->value("host_cpu_thread_affinity", 0).toUInt();
+    Settings::values.host_gpu_thread_affinity =
+        qt_config->value("host_gpu_thread_affinity", 0).toUInt();
+    Settings::values.host_audio_thread_affinity =
+        qt_config->value("host_audio_thread_affinity", 0).toUInt();
+    Settings::values.host_numa_node = qt_config->value("host_numa_node", -1).toInt();
     qt_config->endGroup();
 
     qt_config->beginGroup("Renderer");
+    Settings::values.renderer_backend =
+        static_cast<Settings::RendererBackend>(qt_config->value("backend", 0).toInt());
     Settings::values.resolution_factor = qt_config->value("resolution_factor", 1.0).toFloat();
+    Settings::values.use_dynamic_resolution =
+        qt_config->value("use_dynamic_resolution", false).toBool();
+    Settings::values.dynamic_resolution_min =
+        qt_config->value("dynamic_resolution_min", 1.0).toFloat();
+    Settings::values.gpu_cache_budget_mb =
+        qt_config->value("gpu_cache_budget_mb", 2048).toUInt();
     Settings::values.use_frame_limit = qt_config->value("use_frame_limit", true).toBool();
     Settings::values.frame_limit = qt_config->value("frame_limit", 100).toInt();
     Settings::values.use_accurate_gpu_emulation =
         qt_config->value("use_accurate_gpu_emulation", false).toBool();
+    Settings::values.use_asynchronous_gpu_emulation =
+        qt_config->value("use_asynchronous_gpu_emulation", false).toBool();
+    Settings::values.use_asynchronous_shaders =
+        qt_config->value("use_asynchronous_shaders", false).toBool();
+    Settings::values.use_texture_upload_dedup =
+        qt_config->value("use_texture_upload_dedup", false).toBool();
+    Settings::values.dump_frames = qt_config->value("dump_frames", false).toBool();
+    Settings::values.dump_frames_interval = qt_config->value("dump_frames_interval", 1).toUInt();
 
     Settings::values.bg_red = qt_config->value("bg_red", 0.0).toFloat();
     Settings::values.bg_green = qt_config->value("bg_green", 0.0).toFloat();
@@ -431,6 +456,11 @@ void Config::ReadValues() {
     Settings::values.program_args = qt_config->value("program_args", "").toString().toStdString();
     Settings::values.dump_exefs = qt_config->value("dump_exefs", false).toBool();
     Settings::values.dump_nso = qt_config->value("dump_nso", false).toBool();
+    Settings::values.dump_shader_corpus = qt_config->value("dump_shader_corpus", false).toBool();
+    Settings::values.use_cpu_framebuffer_copy =
+        qt_config->value("use_cpu_framebuffer_copy", false).toBool();
+    Settings::values.record_ipc_events = qt_config->value("record_ipc_events", false).toBool();
+    Settings::values.dump_trace = qt_config->value("dump_trace", false).toBool();
     qt_config->endGroup();
 
     qt_config->beginGroup("WebService");
@@ -600,13 +630,30 @@ void Config::SaveValues() {
     qt_config->beginGroup("Core");
     qt_config->setValue("use_cpu_jit", Settings::values.use_cpu_jit);
     qt_config->setValue("use_multi_core", Settings::values.use_multi_core);
+    qt_config->setValue("enable_host_thread_scheduling",
+                        Settings::values.enable_host_thread_scheduling);
+    qt_config->setValue("host_cpu_thread_affinity", Settings::values.host_cpu_thread_affinity);
+    qt_config->setValue("host_gpu_thread_affinity", Settings::values.host_gpu_thread_affinity);
+    qt_config->setValue("host_audio_thread_affinity", Settings::values.host_audio_thread_affinity);
+    qt_config->setValue("host_numa_node", Settings::values.host_numa_node);
     qt_config->endGroup();
 
     qt_config->beginGroup("Renderer");
+    qt_config->setValue("backend", static_cast<int>(Settings::values.renderer_backend));
     qt_config->setValue("resolution_factor", (double)Settings::values.resolution_factor);
+    qt_config->setValue("use_dynamic_resolution", Settings::values.use_dynamic_resolution);
+    qt_config->setValue("dynamic_resolution_min",
+                        (double)Settings::values.dynamic_resolution_min);
+    qt_config->setValue("gpu_cache_budget_mb", Settings::values.gpu_cache_budget_mb);
     qt_config->setValue("use_frame_limit", Settings::values.use_frame_limit);
     qt_config->setValue("frame_limit", Settings::values.frame_limit);
     qt_config->setValue("use_accurate_gpu_emulation", Settings::values.use_accurate_gpu_emulation);
+    qt_config->setValue("use_asynchronous_gpu_emulation",
+                        Settings::values.use_asynchronous_gpu_emulation);
+    qt_config->setValue("use_asynchronous_shaders", Settings::values.use_asynchronous_shaders);
+    qt_config->setValue("use_texture_upload_dedup", Settings::values.use_texture_upload_dedup);
+    qt_config->setValue("dump_frames", Settings::values.dump_frames);
+    qt_config->setValue("dump_frames_interval", Settings::values.dump_frames_interval);
 
     // Cast to double because Qt's written float values are not human-readable
     qt_config->setValue("bg_red", (double)Settings::values.bg_red);
@@ -651,6 +698,10 @@ void Config::SaveValues() {
     qt_config->setValue("program_args", QString::fromStdString(Settings::values.program_args));
     qt_config->setValue("dump_exefs", Settings::values.dump_exefs);
     qt_config->setValue("dump_nso", Settings::values.dump_nso);
+    qt_config->setValue("dump_shader_corpus", Settings::values.dump_shader_corpus);
+    qt_config->setValue("use_cpu_framebuffer_copy", Settings::values.use_cpu_framebuffer_copy);
+    qt_config->setValue("record_ipc_events", Settings::values.record_ipc_events);
+    qt_config->setValue("dump_trace", Settings::values.dump_trace);
     qt_config->endGroup();
 
     qt_config->beginGroup("WebService");
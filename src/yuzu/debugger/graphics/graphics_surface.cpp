@@ -11,6 +11,9 @@
 #include <QPushButton>
 #include <QScrollArea>
 #include <QSpinBox>
+
+#include <cstring>
+
 #include "common/vector_math.h"
 #include "core/core.h"
 #include "core/memory.h"
@@ -381,8 +384,16 @@ void GraphicsSurfaceWidget::OnUpdate() {
 
     // TODO: Implement a good way to visualize alpha components!
 
-    QImage decoded_image(surface_width, surface_height, QImage::Format_ARGB32);
     std::optional<VAddr> address = gpu.MemoryManager().GpuToCpuAddress(surface_address);
+    if (!address) {
+        surface_picture_label->hide();
+        surface_info_label->setText(tr("(unmapped surface address)"));
+        surface_info_label->setAlignment(Qt::AlignCenter);
+        surface_picker_x_control->setEnabled(false);
+        surface_picker_y_control->setEnabled(false);
+        save_surface->setEnabled(false);
+        return;
+    }
 
     // TODO(bunnei): Will not work with BCn formats that swizzle 4x4 tiles.
     // Needs to be fixed if we plan to use this feature more, otherwise we may remove it.
@@ -395,15 +406,13 @@ void GraphicsSurfaceWidget::OnUpdate() {
 
     surface_picture_label->show();
 
+    // The decoded data is tightly packed RGBA bytes, which QImage can take scanline-wise with a
+    // plain copy; going through setPixel for every pixel made refreshes of large render targets
+    // freeze the UI.
+    QImage decoded_image(surface_width, surface_height, QImage::Format_RGBA8888);
+    const std::size_t row_bytes = static_cast<std::size_t>(surface_width) * 4;
     for (unsigned int y = 0; y < surface_height; ++y) {
-        for (unsigned int x = 0; x < surface_width; ++x) {
-            Math::Vec4<u8> color;
-            color[0] = texture_data[x + y * surface_width + 0];
-            color[1] = texture_data[x + y * surface_width + 1];
-            color[2] = texture_data[x + y * surface_width + 2];
-            color[3] = texture_data[x + y * surface_width + 3];
-            decoded_image.setPixel(x, y, qRgba(color.r(), color.g(), color.b(), color.a()));
-        }
+        std::memcpy(decoded_image.scanLine(y), texture_data.data() + y * row_bytes, row_bytes);
     }
 
     pixmap = QPixmap::fromImage(decoded_image);
@@ -145,10 +145,12 @@ bool WaitTreeExpandableItem::IsExpandable() const {
 }
 
 QString WaitTreeWaitObject::GetText() const {
+    const auto type_name = object.GetTypeName();
+    const auto name = object.GetName();
     return tr("[%1]%2 %3")
         .arg(object.GetObjectId())
-        .arg(QString::fromStdString(object.GetTypeName()),
-             QString::fromStdString(object.GetName()));
+        .arg(QString::fromUtf8(type_name.data(), static_cast<int>(type_name.size())),
+             QString::fromUtf8(name.data(), static_cast<int>(name.size())));
 }
 
 std::unique_ptr<WaitTreeWaitObject> WaitTreeWaitObject::make(const Kernel::WaitObject& object) {
@@ -189,8 +191,7 @@ QString WaitTreeWaitObject::GetResetTypeQString(Kernel::ResetType reset_type) {
     return {};
 }
 
-WaitTreeObjectList::WaitTreeObjectList(
-    const std::vector<Kernel::SharedPtr<Kernel::WaitObject>>& list, bool w_all)
+WaitTreeObjectList::WaitTreeObjectList(const Kernel::Thread::ThreadWaitObjects& list, bool w_all)
     : object_list(list), wait_all(w_all) {}
 
 WaitTreeObjectList::~WaitTreeObjectList() = default;
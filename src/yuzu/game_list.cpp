@@ -261,8 +261,10 @@ void GameList::clearFilter() {
     search_field->clear();
 }
 
-void GameList::AddEntry(const QList<QStandardItem*>& entry_items) {
-    item_model->invisibleRootItem()->appendRow(entry_items);
+void GameList::AddEntries(const QList<QList<QStandardItem*>>& entry_items) {
+    for (const auto& entry : entry_items) {
+        item_model->invisibleRootItem()->appendRow(entry);
+    }
 }
 
 void GameList::ValidateEntry(const QModelIndex& item) {
@@ -430,7 +432,9 @@ void GameList::PopulateAsync(const QString& dir_path, bool deep_scan) {
 
     GameListWorker* worker = new GameListWorker(vfs, dir_path, deep_scan, compatibility_list);
 
-    connect(worker, &GameListWorker::EntryReady, this, &GameList::AddEntry, Qt::QueuedConnection);
+    qRegisterMetaType<QList<QList<QStandardItem*>>>("QList<QList<QStandardItem*>>");
+    connect(worker, &GameListWorker::EntriesReady, this, &GameList::AddEntries,
+            Qt::QueuedConnection);
     connect(worker, &GameListWorker::Finished, this, &GameList::DonePopulating,
             Qt::QueuedConnection);
     // Use DirectConnection here because worker->Cancel() is thread-safe and we want it to cancel
@@ -77,7 +77,7 @@ private slots:
     void onFilterCloseClicked();
 
 private:
-    void AddEntry(const QList<QStandardItem*>& entry_items);
+    void AddEntries(const QList<QList<QStandardItem*>>& entry_items);
     void ValidateEntry(const QModelIndex& item);
     void DonePopulating(QStringList watch_list);
 
@@ -25,12 +25,12 @@
 #include "yuzu/util/util.h"
 
 /**
- * Gets the default icon (for games without valid SMDH)
- * @param large If true, returns large icon (48x48), otherwise returns small icon (24x24)
- * @return QPixmap default icon
+ * Gets the default icon (for games without valid control data)
+ * @param size Width and height of the icon, in pixels
+ * @return QImage default icon
  */
-static QPixmap GetDefaultIcon(u32 size) {
-    QPixmap icon(size, size);
+static QImage GetDefaultIcon(u32 size) {
+    QImage icon(size, size, QImage::Format_ARGB32);
     icon.fill(Qt::transparent);
     return icon;
 }
@@ -56,21 +56,15 @@ public:
     static const int FileTypeRole = Qt::UserRole + 4;
 
     GameListItemPath() = default;
-    GameListItemPath(const QString& game_path, const std::vector<u8>& picture_data,
-                     const QString& game_name, const QString& game_type, u64 program_id) {
+    GameListItemPath(const QString& game_path, const QImage& picture, const QString& game_name,
+                     const QString& game_type, u64 program_id) {
         setData(game_path, FullPathRole);
         setData(game_name, TitleRole);
         setData(qulonglong(program_id), ProgramIdRole);
         setData(game_type, FileTypeRole);
 
-        const u32 size = UISettings::values.icon_size;
-
-        QPixmap picture;
-        if (!picture.loadFromData(picture_data.data(), static_cast<u32>(picture_data.size()))) {
-            picture = GetDefaultIcon(size);
-        }
-        picture = picture.scaled(size, size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
-
+        // The picture is an already-decoded, pre-scaled QImage rather than a QPixmap: it is
+        // produced on the worker thread, where pixmap use is not allowed.
         setData(picture, Qt::DecorationRole);
     }
 
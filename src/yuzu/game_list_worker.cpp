@@ -2,14 +2,22 @@
 // Licensed under GPLv2 or any later version
 // Refer to the license.txt file included.
 
+#include <atomic>
+#include <future>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include <QDataStream>
+#include <QDateTime>
 #include <QDir>
+#include <QFile>
 #include <QFileInfo>
+#include <QImage>
+#include <fmt/format.h>
 
+#include "common/cityhash.h"
 #include "common/common_paths.h"
 #include "common/file_util.h"
 #include "core/file_sys/content_archive.h"
@@ -27,6 +35,101 @@
 #include "yuzu/ui_settings.h"
 
 namespace {
+constexpr int ENTRY_BATCH_SIZE = 50;
+
+constexpr quint32 METADATA_CACHE_MAGIC = 0x434C4759; // 'YGLC'
+constexpr quint32 METADATA_CACHE_VERSION = 1;
+
+constexpr quint32 ICON_CACHE_MAGIC = 0x43494759; // 'YGIC'
+constexpr quint32 ICON_CACHE_VERSION = 1;
+
+QString GetMetadataCachePath() {
+    return QString::fromStdString(FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) +
+                                  "game_list.cache");
+}
+
+QString GetIconCacheDir() {
+    return QString::fromStdString(FileUtil::GetUserPath(FileUtil::UserPath::CacheDir) +
+                                  "icons" DIR_SEP);
+}
+
+/// Decoded icons are cached per (content hash, resolution), so each icon size configured in the
+/// UI gets its own pre-scaled entry and a setting change doesn't invalidate the other sizes.
+QString GetIconCachePath(u64 icon_hash, u32 size) {
+    return GetIconCacheDir() + QString::fromStdString(fmt::format("{:016x}_{}.bin", icon_hash, size));
+}
+
+bool LoadCachedIcon(const QString& path, u32 size, QImage& out) {
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic{};
+    quint32 version{};
+    quint32 width{};
+    quint32 height{};
+    quint32 format{};
+    stream >> magic >> version >> width >> height >> format;
+    if (magic != ICON_CACHE_MAGIC || version != ICON_CACHE_VERSION || width != size ||
+        height != size) {
+        return false;
+    }
+
+    QImage image(width, height, static_cast<QImage::Format>(format));
+    const int num_bytes = image.byteCount();
+    if (stream.readRawData(reinterpret_cast<char*>(image.bits()), num_bytes) != num_bytes) {
+        return false;
+    }
+
+    out = std::move(image);
+    return true;
+}
+
+void SaveCachedIcon(const QString& path, const QImage& image) {
+    FileUtil::CreateFullPath(GetIconCacheDir().toStdString());
+    QFile file(path);
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    // The pixels are stored raw rather than re-encoded as PNG, so a cache hit is a plain read
+    // with no image decode at all.
+    QDataStream stream(&file);
+    stream << ICON_CACHE_MAGIC << ICON_CACHE_VERSION << static_cast<quint32>(image.width())
+           << static_cast<quint32>(image.height()) << static_cast<quint32>(image.format());
+    stream.writeRawData(reinterpret_cast<const char*>(image.constBits()), image.byteCount());
+}
+
+/**
+ * Decodes and pre-scales a game icon, serving repeat requests from the on-disk cache.
+ * Runs on the worker thread; the result is shipped to the model as an already-decoded QImage so
+ * the UI thread never touches the PNG/JPEG data.
+ */
+QImage DecodeIcon(const QByteArray& icon_data, u32 size) {
+    if (icon_data.isEmpty()) {
+        return GetDefaultIcon(size);
+    }
+
+    const u64 icon_hash = Common::CityHash64(icon_data.constData(), icon_data.size());
+    const QString cache_path = GetIconCachePath(icon_hash, size);
+
+    QImage image;
+    if (LoadCachedIcon(cache_path, size, image)) {
+        return image;
+    }
+
+    if (!image.loadFromData(icon_data)) {
+        return GetDefaultIcon(size);
+    }
+
+    image = image.scaled(size, size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation)
+                .convertToFormat(QImage::Format_ARGB32);
+    SaveCachedIcon(cache_path, image);
+    return image;
+}
+
 void GetMetadataFromControlNCA(const FileSys::PatchManager& patch_manager, const FileSys::NCA& nca,
                                std::vector<u8>& icon, std::string& name) {
     auto [nacp, icon_file] = patch_manager.ParseControlNCA(nca);
@@ -45,6 +148,60 @@ bool IsExtractedNCAMain(const std::string& file_name) {
     return QFileInfo(QString::fromStdString(file_name)).fileName() == "main";
 }
 
+/// A file found during the directory walk that passed the extension filter, together with the
+/// stat results gathered while walking so the processing step doesn't have to touch the disk
+/// again for unchanged files.
+struct ScanCandidate {
+    std::string physical_name;
+    qint64 size;
+    qint64 mtime;
+};
+
+struct DirectoryScanResult {
+    std::vector<ScanCandidate> candidates;
+    QStringList watch_list;
+};
+
+/**
+ * Recursively enumerates scan candidates under a directory. Only stats files and filters them by
+ * extension — no file is ever opened — so multiple directories can be walked on separate threads
+ * at once, which hides per-entry latency on network filesystems.
+ */
+DirectoryScanResult ScanFileSystemDirectory(const std::string& dir_path, unsigned int recursion,
+                                            const std::atomic_bool& stop_processing) {
+    DirectoryScanResult result;
+
+    const auto callback = [&](u64* num_entries_out, const std::string& directory,
+                              const FileUtil::DirectoryEntryInfo& entry) -> bool {
+        if (stop_processing) {
+            // Breaks the callback loop.
+            return false;
+        }
+
+        const std::string physical_name = directory + DIR_SEP + entry.virtual_name;
+        if (entry.is_directory) {
+            if (recursion > 0) {
+                result.watch_list.append(QString::fromStdString(physical_name));
+                auto sub = ScanFileSystemDirectory(physical_name, recursion - 1, stop_processing);
+                result.candidates.insert(result.candidates.end(),
+                                         std::make_move_iterator(sub.candidates.begin()),
+                                         std::make_move_iterator(sub.candidates.end()));
+                result.watch_list.append(sub.watch_list);
+            }
+        } else if (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name)) {
+            const QFileInfo file_info(QString::fromStdString(physical_name));
+            result.candidates.push_back(
+                {physical_name, static_cast<qint64>(entry.size),
+                 file_info.lastModified().toMSecsSinceEpoch()});
+        }
+
+        return true;
+    };
+
+    FileUtil::ForeachDirectoryEntryInfo(nullptr, dir_path, callback);
+    return result;
+}
+
 QString FormatGameName(const std::string& physical_name) {
     const QString physical_name_as_qstring = QString::fromStdString(physical_name);
     const QFileInfo file_info(physical_name_as_qstring);
@@ -102,8 +259,13 @@ QList<QStandardItem*> MakeGameListEntry(const std::string& path, const std::stri
     const auto file_type = loader.GetFileType();
     const auto file_type_string = QString::fromStdString(Loader::GetFileTypeString(file_type));
 
+    const QImage picture =
+        DecodeIcon(QByteArray::fromRawData(reinterpret_cast<const char*>(icon.data()),
+                                           static_cast<int>(icon.size())),
+                   UISettings::values.icon_size);
+
     QList<QStandardItem*> list{
-        new GameListItemPath(FormatGameName(path), icon, QString::fromStdString(name),
+        new GameListItemPath(FormatGameName(path), picture, QString::fromStdString(name),
                              file_type_string, program_id),
         new GameListItemCompat(compatibility),
         new GameListItem(file_type_string),
@@ -147,8 +309,8 @@ void GameListWorker::AddInstalledTitlesToGameList() {
         if (control != nullptr)
             GetMetadataFromControlNCA(patch, *control, icon, name);
 
-        emit EntryReady(MakeGameListEntry(file->GetFullPath(), name, icon, *loader, program_id,
-                                          compatibility_list, patch));
+        QueueEntry(MakeGameListEntry(file->GetFullPath(), name, icon, *loader, program_id,
+                                     compatibility_list, patch));
     }
 
     const auto control_data = cache.ListEntriesFilter(FileSys::TitleType::Application,
@@ -164,15 +326,15 @@ void GameListWorker::AddInstalledTitlesToGameList() {
 
 void GameListWorker::FillControlMap(const std::string& dir_path) {
     const auto nca_control_callback = [this](u64* num_entries_out, const std::string& directory,
-                                             const std::string& virtual_name) -> bool {
+                                             const FileUtil::DirectoryEntryInfo& entry) -> bool {
         if (stop_processing) {
             // Breaks the callback loop
             return false;
         }
 
-        const std::string physical_name = directory + DIR_SEP + virtual_name;
+        const std::string physical_name = directory + DIR_SEP + entry.virtual_name;
         const QFileInfo file_info(QString::fromStdString(physical_name));
-        if (!file_info.isDir() && file_info.suffix() == QStringLiteral("nca")) {
+        if (!entry.is_directory && file_info.suffix() == QStringLiteral("nca")) {
             auto nca =
                 std::make_unique<FileSys::NCA>(vfs->OpenFile(physical_name, FileSys::Mode::Read));
             if (nca->GetType() == FileSys::NCAContentType::Control) {
@@ -183,71 +345,216 @@ void GameListWorker::FillControlMap(const std::string& dir_path) {
         return true;
     };
 
-    FileUtil::ForeachDirectoryEntry(nullptr, dir_path, nca_control_callback);
+    FileUtil::ForeachDirectoryEntryInfo(nullptr, dir_path, nca_control_callback);
 }
 
 void GameListWorker::AddFstEntriesToGameList(const std::string& dir_path, unsigned int recursion) {
-    const auto callback = [this, recursion](u64* num_entries_out, const std::string& directory,
-                                            const std::string& virtual_name) -> bool {
+    // Walk each top-level subdirectory on its own thread. The walk only stats files and filters
+    // them by extension; everything that actually opens a file runs afterwards on this thread,
+    // where the loaders and the VFS are used single-threaded as before.
+    DirectoryScanResult scan;
+    std::vector<std::future<DirectoryScanResult>> subdir_scans;
+
+    const auto callback = [&](u64* num_entries_out, const std::string& directory,
+                              const FileUtil::DirectoryEntryInfo& entry) -> bool {
         if (stop_processing) {
             // Breaks the callback loop.
             return false;
         }
 
-        const std::string physical_name = directory + DIR_SEP + virtual_name;
-        const bool is_dir = FileUtil::IsDirectory(physical_name);
-        if (!is_dir &&
-            (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name))) {
-            auto loader = Loader::GetLoader(vfs->OpenFile(physical_name, FileSys::Mode::Read));
-            if (!loader) {
-                return true;
+        const std::string physical_name = directory + DIR_SEP + entry.virtual_name;
+        if (entry.is_directory) {
+            if (recursion > 0) {
+                scan.watch_list.append(QString::fromStdString(physical_name));
+                subdir_scans.emplace_back(std::async(std::launch::async, ScanFileSystemDirectory,
+                                                     physical_name, recursion - 1,
+                                                     std::cref(stop_processing)));
             }
+        } else if (HasSupportedFileExtension(physical_name) || IsExtractedNCAMain(physical_name)) {
+            const QFileInfo file_info(QString::fromStdString(physical_name));
+            scan.candidates.push_back(
+                {physical_name, static_cast<qint64>(entry.size),
+                 file_info.lastModified().toMSecsSinceEpoch()});
+        }
 
-            const auto file_type = loader->GetFileType();
-            if ((file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) &&
-                !UISettings::values.show_unknown) {
-                return true;
-            }
+        return true;
+    };
+
+    FileUtil::ForeachDirectoryEntryInfo(nullptr, dir_path, callback);
 
-            std::vector<u8> icon;
-            const auto res1 = loader->ReadIcon(icon);
+    for (auto& subdir_scan : subdir_scans) {
+        auto sub = subdir_scan.get();
+        scan.candidates.insert(scan.candidates.end(),
+                               std::make_move_iterator(sub.candidates.begin()),
+                               std::make_move_iterator(sub.candidates.end()));
+        scan.watch_list.append(sub.watch_list);
+    }
 
-            u64 program_id = 0;
-            const auto res2 = loader->ReadProgramId(program_id);
+    watch_list.append(scan.watch_list);
 
-            std::string name = " ";
-            const auto res3 = loader->ReadTitle(name);
+    for (const auto& candidate : scan.candidates) {
+        if (stop_processing) {
+            break;
+        }
 
-            const FileSys::PatchManager patch{program_id};
+        const std::string& physical_name = candidate.physical_name;
 
-            if (res1 != Loader::ResultStatus::Success && res3 != Loader::ResultStatus::Success &&
-                res2 == Loader::ResultStatus::Success) {
-                // Use from metadata pool.
-                if (nca_control_map.find(program_id) != nca_control_map.end()) {
-                    const auto& nca = nca_control_map[program_id];
-                    GetMetadataFromControlNCA(patch, *nca, icon, name);
-                }
-            }
+        const auto cached = metadata_cache.find(physical_name);
+        if (cached != metadata_cache.end() && cached->second.size == candidate.size &&
+            cached->second.mtime == candidate.mtime) {
+            // The file has not changed since the last scan, so reuse its metadata without
+            // reopening it or decrypting any NCA headers.
+            EmitEntry(physical_name, cached->second);
+            continue;
+        }
 
-            emit EntryReady(MakeGameListEntry(physical_name, name, icon, *loader, program_id,
-                                              compatibility_list, patch));
-        } else if (is_dir && recursion > 0) {
-            watch_list.append(QString::fromStdString(physical_name));
-            AddFstEntriesToGameList(physical_name, recursion - 1);
+        auto loader = Loader::GetLoader(vfs->OpenFile(physical_name, FileSys::Mode::Read));
+        if (!loader) {
+            continue;
         }
 
-        return true;
+        const auto file_type = loader->GetFileType();
+        if ((file_type == Loader::FileType::Unknown || file_type == Loader::FileType::Error) &&
+            !UISettings::values.show_unknown) {
+            continue;
+        }
+
+        std::vector<u8> icon;
+        const auto res1 = loader->ReadIcon(icon);
+
+        u64 program_id = 0;
+        const auto res2 = loader->ReadProgramId(program_id);
+
+        std::string name = " ";
+        const auto res3 = loader->ReadTitle(name);
+
+        const FileSys::PatchManager patch{program_id};
+
+        if (res1 != Loader::ResultStatus::Success && res3 != Loader::ResultStatus::Success &&
+            res2 == Loader::ResultStatus::Success) {
+            // Use from metadata pool.
+            if (nca_control_map.find(program_id) != nca_control_map.end()) {
+                const auto& nca = nca_control_map[program_id];
+                GetMetadataFromControlNCA(patch, *nca, icon, name);
+            }
+        }
+
+        CachedGameEntry entry{};
+        entry.size = candidate.size;
+        entry.mtime = candidate.mtime;
+        entry.program_id = program_id;
+        entry.name = QString::fromStdString(name);
+        entry.file_type = QString::fromStdString(Loader::GetFileTypeString(file_type));
+        // Note: installing an update does not touch the scanned file, so the cached add-on
+        // line can go stale until the file itself changes or the cache is deleted.
+        entry.patch_versions = FormatPatchNameVersions(patch, *loader, loader->IsRomFSUpdatable());
+        entry.icon =
+            QByteArray(reinterpret_cast<const char*>(icon.data()), static_cast<int>(icon.size()));
+
+        EmitEntry(physical_name, entry);
+        metadata_cache.insert_or_assign(physical_name, std::move(entry));
+        metadata_cache_dirty = true;
+    }
+}
+
+void GameListWorker::EmitEntry(const std::string& path, const CachedGameEntry& entry) {
+    const auto it = FindMatchingCompatibilityEntry(compatibility_list, entry.program_id);
+
+    // The game list uses this as compatibility number for untested games
+    QString compatibility{"99"};
+    if (it != compatibility_list.end()) {
+        compatibility = it->second.first;
+    }
+
+    QList<QStandardItem*> list{
+        new GameListItemPath(FormatGameName(path),
+                             DecodeIcon(entry.icon, UISettings::values.icon_size), entry.name,
+                             entry.file_type, entry.program_id),
+        new GameListItemCompat(compatibility),
+        new GameListItem(entry.file_type),
+        new GameListItemSize(static_cast<u64>(entry.size)),
     };
 
-    FileUtil::ForeachDirectoryEntry(nullptr, dir_path, callback);
+    if (UISettings::values.show_add_ons) {
+        list.insert(2, new GameListItem(entry.patch_versions));
+    }
+
+    QueueEntry(std::move(list));
+}
+
+void GameListWorker::QueueEntry(QList<QStandardItem*> entry) {
+    pending_entries.append(std::move(entry));
+    if (pending_entries.size() >= ENTRY_BATCH_SIZE) {
+        FlushEntries();
+    }
+}
+
+void GameListWorker::FlushEntries() {
+    if (pending_entries.isEmpty()) {
+        return;
+    }
+
+    emit EntriesReady(pending_entries);
+    pending_entries.clear();
+}
+
+void GameListWorker::LoadMetadataCache() {
+    QFile file(GetMetadataCachePath());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    quint32 magic{};
+    quint32 version{};
+    stream >> magic >> version;
+    if (magic != METADATA_CACHE_MAGIC || version != METADATA_CACHE_VERSION) {
+        return;
+    }
+
+    quint32 count{};
+    stream >> count;
+    for (quint32 i = 0; i < count && stream.status() == QDataStream::Ok; ++i) {
+        QString path;
+        quint64 program_id{};
+        CachedGameEntry entry{};
+        stream >> path >> entry.size >> entry.mtime >> program_id >> entry.name >>
+            entry.file_type >> entry.patch_versions >> entry.icon;
+        entry.program_id = program_id;
+        metadata_cache.insert_or_assign(path.toStdString(), std::move(entry));
+    }
+}
+
+void GameListWorker::SaveMetadataCache() {
+    if (!metadata_cache_dirty) {
+        return;
+    }
+
+    FileUtil::CreateFullPath(FileUtil::GetUserPath(FileUtil::UserPath::CacheDir));
+    QFile file(GetMetadataCachePath());
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+
+    QDataStream stream(&file);
+    stream << METADATA_CACHE_MAGIC << METADATA_CACHE_VERSION
+           << static_cast<quint32>(metadata_cache.size());
+    for (const auto& [path, entry] : metadata_cache) {
+        stream << QString::fromStdString(path) << entry.size << entry.mtime
+               << static_cast<quint64>(entry.program_id) << entry.name << entry.file_type
+               << entry.patch_versions << entry.icon;
+    }
 }
 
 void GameListWorker::run() {
     stop_processing = false;
     watch_list.append(dir_path);
+    LoadMetadataCache();
     FillControlMap(dir_path.toStdString());
     AddInstalledTitlesToGameList();
     AddFstEntriesToGameList(dir_path.toStdString(), deep_scan ? 256 : 0);
+    FlushEntries();
+    SaveMetadataCache();
     nca_control_map.clear();
     emit Finished(watch_list);
 }
@@ -10,6 +10,7 @@
 #include <string>
 #include <unordered_map>
 
+#include <QByteArray>
 #include <QList>
 #include <QObject>
 #include <QRunnable>
@@ -45,11 +46,13 @@ public:
 
 signals:
     /**
-     * The `EntryReady` signal is emitted once an entry has been prepared and is ready
-     * to be added to the game list.
-     * @param entry_items a list with `QStandardItem`s that make up the columns of the new entry.
+     * The `EntriesReady` signal is emitted once a batch of entries has been prepared and is ready
+     * to be added to the game list. Entries are delivered in batches rather than one at a time to
+     * keep the number of cross-thread signal deliveries small for large libraries.
+     * @param entry_items a list of entries, each a list with the `QStandardItem`s that make up
+     *        the columns of one new row.
      */
-    void EntryReady(QList<QStandardItem*> entry_items);
+    void EntriesReady(QList<QList<QStandardItem*>> entry_items);
 
     /**
      * After the worker has traversed the game directory looking for entries, this signal is emitted
@@ -58,12 +61,40 @@ signals:
     void Finished(QStringList watch_list);
 
 private:
+    /// Metadata extracted from one scanned file, cached across launcher runs and validated
+    /// against the file's current size and modification time.
+    struct CachedGameEntry {
+        qint64 size;
+        qint64 mtime;
+        u64 program_id;
+        QString name;
+        QString file_type;
+        QString patch_versions;
+        QByteArray icon;
+    };
+
     void AddInstalledTitlesToGameList();
     void FillControlMap(const std::string& dir_path);
     void AddFstEntriesToGameList(const std::string& dir_path, unsigned int recursion = 0);
 
+    /// Queues an entry built from a scanned file's (possibly cached) metadata for the next batch.
+    void EmitEntry(const std::string& path, const CachedGameEntry& entry);
+
+    /// Appends one prepared row to the pending batch, emitting EntriesReady once it is full.
+    void QueueEntry(QList<QStandardItem*> entry);
+    /// Emits any queued entries that did not fill a whole batch.
+    void FlushEntries();
+
+    /// Reads the metadata cache of the previous scan from the cache directory.
+    void LoadMetadataCache();
+    /// Writes the metadata cache back out if any entry was added or refreshed.
+    void SaveMetadataCache();
+
     std::shared_ptr<FileSys::VfsFilesystem> vfs;
+    std::map<std::string, CachedGameEntry> metadata_cache;
+    bool metadata_cache_dirty = false;
     std::map<u64, std::unique_ptr<FileSys::NCA>> nca_control_map;
+    QList<QList<QStandardItem*>> pending_entries;
     QStringList watch_list;
     QString dir_path;
     bool deep_scan;
@@ -335,15 +335,42 @@ void Config::ReadValues() {
     // Core
     Settings::values.use_cpu_jit = sdl2_config->GetBoolean("Core", "use_cpu_jit", true);
     Settings::values.use_multi_core = sdl2_config->GetBoolean("Core", "use_multi_core", false);
+    Settings::values.enable_host_thread_scheduling =
+        sdl2_config->GetBoolean("Core", "enable_host_thread_scheduling", false);
+    Settings::values.host_cpu_thread_affinity =
+        static_cast<u32>(sdl2_config->GetInteger("Core", "host_cpu_thread_affinity", 0));
+    Settings::values.host_gpu_thread_affinity =
+        static_cast<u32>(sdl2_config->GetInteger("Core", "host_gpu_thread_affinity", 0));
+    Settings::values.host_audio_thread_affinity =
+        static_cast<u32>(sdl2_config->GetInteger("Core", "host_audio_thread_affinity", 0));
+    Settings::values.host_numa_node =
+        static_cast<s32>(sdl2_config->GetInteger("Core", "host_numa_node", -1));
 
     // Renderer
+    Settings::values.renderer_backend = static_cast<Settings::RendererBackend>(
+        sdl2_config->GetInteger("Renderer", "backend", 0));
     Settings::values.resolution_factor =
         (float)sdl2_config->GetReal("Renderer", "resolution_factor", 1.0);
+    Settings::values.use_dynamic_resolution =
+        sdl2_config->GetBoolean("Renderer", "use_dynamic_resolution", false);
+    Settings::values.dynamic_resolution_min =
+        (float)sdl2_config->GetReal("Renderer", "dynamic_resolution_min", 1.0);
+    Settings::values.gpu_cache_budget_mb =
+        static_cast<u32>(sdl2_config->GetInteger("Renderer", "gpu_cache_budget_mb", 2048));
     Settings::values.use_frame_limit = sdl2_config->GetBoolean("Renderer", "use_frame_limit", true);
     Settings::values.frame_limit =
         static_cast<u16>(sdl2_config->GetInteger("Renderer", "frame_limit", 100));
     Settings::values.use_accurate_gpu_emulation =
         sdl2_config->GetBoolean("Renderer", "use_accurate_gpu_emulation", false);
+    Settings::values.use_asynchronous_gpu_emulation =
+        sdl2_config->GetBoolean("Renderer", "use_asynchronous_gpu_emulation", false);
+    Settings::values.use_asynchronous_shaders =
+        sdl2_config->GetBoolean("Renderer", "use_asynchronous_shaders", false);
+    Settings::values.use_texture_upload_dedup =
+        sdl2_config->GetBoolean("Renderer", "use_texture_upload_dedup", false);
+    Settings::values.dump_frames = sdl2_config->GetBoolean("Renderer", "dump_frames", false);
+    Settings::values.dump_frames_interval =
+        static_cast<u32>(sdl2_config->GetInteger("Renderer", "dump_frames_interval", 1));
 
     Settings::values.bg_red = (float)sdl2_config->GetReal("Renderer", "bg_red", 0.0);
     Settings::values.bg_green = (float)sdl2_config->GetReal("Renderer", "bg_green", 0.0);
@@ -369,6 +396,13 @@ void Config::ReadValues() {
     Settings::values.program_args = sdl2_config->Get("Debugging", "program_args", "");
     Settings::values.dump_exefs = sdl2_config->GetBoolean("Debugging", "dump_exefs", false);
     Settings::values.dump_nso = sdl2_config->GetBoolean("Debugging", "dump_nso", false);
+    Settings::values.dump_shader_corpus =
+        sdl2_config->GetBoolean("Debugging", "dump_shader_corpus", false);
+    Settings::values.use_cpu_framebuffer_copy =
+        sdl2_config->GetBoolean("Debugging", "use_cpu_framebuffer_copy", false);
+    Settings::values.record_ipc_events =
+        sdl2_config->GetBoolean("Debugging", "record_ipc_events", false);
+    Settings::values.dump_trace = sdl2_config->GetBoolean("Debugging", "dump_trace", false);
 
     const auto title_list = sdl2_config->Get("AddOns", "title_ids", "");
     std::stringstream ss(title_list);
@@ -84,7 +84,26 @@ use_cpu_jit =
 # 0 (default): Disabled, 1: Enabled
 use_multi_core=
 
+# Whether to pin emulation host threads and raise their priority
+# 0 (default): Disabled, 1: Enabled
+enable_host_thread_scheduling=
+
+# Host core affinity masks for the CPU, GPU and audio emulation threads, as a bitmask of host
+# cores. 0 (default) leaves a thread unpinned. Only used when host thread scheduling is enabled.
+host_cpu_thread_affinity=
+host_gpu_thread_affinity=
+host_audio_thread_affinity=
+
+# NUMA node to prefer for guest RAM and JIT code pages on multi-socket hosts. Only used when host
+# thread scheduling is enabled and should match the node of the pinned CPU thread cores.
+# -1 (default): Disabled, 0+: Preferred node index
+host_numa_node=
+
 [Renderer]
+# Which graphics backend to use for rendering
+# 0 (default): OpenGL, 1: Vulkan (falls back to OpenGL when unavailable)
+backend =
+
 # Whether to use software or hardware rendering.
 # 0: Software, 1 (default): Hardware
 use_hw_renderer =
@@ -98,6 +117,18 @@ use_shader_jit =
 # factor for the Switch resolution
 resolution_factor =
 
+# Whether to lower the resolution factor automatically when frame times exceed the 60 FPS budget
+# 0 (default): Off, 1: On
+use_dynamic_resolution =
+
+# Lowest resolution factor the dynamic resolution controller may fall back to
+# 0.25 - resolution_factor. 1.0 (default)
+dynamic_resolution_min =
+
+# Estimated GPU memory budget for the surface cache in megabytes; least recently used idle
+# surfaces are evicted once the estimate exceeds it. 0: unlimited, 2048 (default)
+gpu_cache_budget_mb =
+
 # Whether to enable V-Sync (caps the framerate at 60FPS) or not.
 # 0 (default): Off, 1: On
 use_vsync =
@@ -114,6 +145,27 @@ frame_limit =
 # 0 (default): Off (fast), 1 : On (slow)
 use_accurate_gpu_emulation =
 
+# Whether to process the GPU command stream on a dedicated host thread
+# 0 (default): Off (synchronous), 1 : On (asynchronous)
+use_asynchronous_gpu_emulation =
+
+# Whether to compile shaders on the driver's worker threads instead of stalling draws
+# 0 (default): Off, 1 : On
+use_asynchronous_shaders =
+
+# Whether to skip texture uploads whose content matches an already-uploaded surface by copying
+# it GPU-side instead (helps titles that re-upload identical atlases at different addresses)
+# 0 (default): Off, 1 : On
+use_texture_upload_dedup =
+
+# Whether to dump presented frames to <dump>/frames/ via asynchronous readback
+# 0 (default): Off, 1 : On
+dump_frames =
+
+# Dump every Nth presented frame when dump_frames is enabled
+# 1 (default): every frame
+dump_frames_interval =
+
 # The clear color for the renderer. What shows up on the sides of the bottom screen.
 # Must be in range of 0.0-1.0. Defaults to 1.0 for all.
 bg_red =
@@ -210,6 +262,17 @@ gdbstub_port=24689
 dump_exefs=false
 # Determines whether or not yuzu will dump all NSOs it attempts to load while loading them
 dump_nso=false
+# Determines whether every guest shader reaching the GL shader cache is dumped as raw Maxwell
+# bytecode into <dump>/shader_corpus/, for offline benchmarking with yuzu-shader-bench
+dump_shader_corpus=false
+# Determines whether framebuffers are deswizzled and uploaded on the CPU at presentation time
+# instead of being sampled from the rasterizer cache
+use_cpu_framebuffer_copy=false
+# Determines whether dispatched IPC commands are recorded into a binary event ring, dumped to
+# <dump>/ipc_events.txt on shutdown
+record_ipc_events=false
+# Streams MicroProfile scope events to <log>/microprofile_trace.json in chrome://tracing format
+dump_trace=false
 
 [WebService]
 # Whether or not to enable telemetry
@@ -134,7 +134,7 @@ bool EmuWindow_SDL2::SupportsRequiredGLExtensions() {
     return unsupported_ext.empty();
 }
 
-EmuWindow_SDL2::EmuWindow_SDL2(bool fullscreen) {
+EmuWindow_SDL2::EmuWindow_SDL2(bool fullscreen, bool hidden) {
     InputCommon::Init();
 
     SDL_SetMainReady();
@@ -156,19 +156,24 @@ EmuWindow_SDL2::EmuWindow_SDL2(bool fullscreen) {
 
     std::string window_title = fmt::format("yuzu {} | {}-{}", Common::g_build_fullname,
                                            Common::g_scm_branch, Common::g_scm_desc);
+    u32 window_flags = SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI;
+    if (hidden) {
+        // Benchmark mode renders to an offscreen context; the window is never shown
+        window_flags |= SDL_WINDOW_HIDDEN;
+    }
     render_window =
         SDL_CreateWindow(window_title.c_str(),
                          SDL_WINDOWPOS_UNDEFINED, // x position
                          SDL_WINDOWPOS_UNDEFINED, // y position
                          Layout::ScreenUndocked::Width, Layout::ScreenUndocked::Height,
-                         SDL_WINDOW_OPENGL | SDL_WINDOW_RESIZABLE | SDL_WINDOW_ALLOW_HIGHDPI);
+                         window_flags);
 
     if (render_window == nullptr) {
         LOG_CRITICAL(Frontend, "Failed to create SDL2 window! {}", SDL_GetError());
         exit(1);
     }
 
-    if (fullscreen) {
+    if (fullscreen && !hidden) {
         Fullscreen();
     }
 
@@ -209,6 +214,11 @@ EmuWindow_SDL2::~EmuWindow_SDL2() {
 
 void EmuWindow_SDL2::SwapBuffers() {
     SDL_GL_SwapWindow(render_window);
+    presented_frames.fetch_add(1, std::memory_order_relaxed);
+}
+
+u64 EmuWindow_SDL2::GetPresentedFrameCount() const {
+    return presented_frames.load(std::memory_order_relaxed);
 }
 
 void EmuWindow_SDL2::PollEvents() {
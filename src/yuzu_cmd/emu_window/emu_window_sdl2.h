@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <utility>
 #include "core/frontend/emu_window.h"
@@ -12,7 +13,7 @@ struct SDL_Window;
 
 class EmuWindow_SDL2 : public Core::Frontend::EmuWindow {
 public:
-    explicit EmuWindow_SDL2(bool fullscreen);
+    explicit EmuWindow_SDL2(bool fullscreen, bool hidden = false);
     ~EmuWindow_SDL2();
 
     /// Swap buffers to display the next frame
@@ -30,6 +31,9 @@ public:
     /// Whether the window is still open, and a close request hasn't yet been sent
     bool IsOpen() const;
 
+    /// Number of frames presented since the window was created, used by the benchmark mode
+    u64 GetPresentedFrameCount() const;
+
 private:
     /// Called by PollEvents when a key is pressed or released.
     void OnKeyEvent(int key, u8 state);
@@ -68,6 +72,9 @@ private:
     /// Is the window still open?
     bool is_open = true;
 
+    /// Number of frames presented so far; atomic since the GPU thread may own presentation
+    std::atomic<u64> presented_frames{0};
+
     /// Internal SDL2 render window
     SDL_Window* render_window;
 
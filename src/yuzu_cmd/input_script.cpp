@@ -0,0 +1,58 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include "common/logging/log.h"
+#include "input_common/keyboard.h"
+#include "input_common/main.h"
+#include "yuzu_cmd/input_script.h"
+
+bool InputScript::Load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        LOG_ERROR(Frontend, "Failed to open input script {}", path);
+        return false;
+    }
+
+    std::string line;
+    std::size_t line_number = 0;
+    while (std::getline(file, line)) {
+        ++line_number;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream tokens(line);
+        u64 frame;
+        std::string action;
+        int key_code;
+        if (!(tokens >> frame >> action >> key_code) ||
+            (action != "press" && action != "release")) {
+            LOG_ERROR(Frontend, "Malformed input script line {}: \"{}\"", line_number, line);
+            return false;
+        }
+
+        events.push_back({frame, key_code, action == "press"});
+    }
+
+    std::stable_sort(events.begin(), events.end(),
+                     [](const Event& lhs, const Event& rhs) { return lhs.frame < rhs.frame; });
+
+    LOG_INFO(Frontend, "Loaded input script {} with {} events", path, events.size());
+    return true;
+}
+
+void InputScript::Update(u64 frame) {
+    auto* const keyboard = InputCommon::GetKeyboard();
+    while (next_event < events.size() && events[next_event].frame <= frame) {
+        const Event& event = events[next_event++];
+        if (event.pressed) {
+            keyboard->PressKey(event.key_code);
+        } else {
+            keyboard->ReleaseKey(event.key_code);
+        }
+    }
+}
@@ -0,0 +1,41 @@
+// Copyright 2018 yuzu Emulator Project
+// Licensed under GPLv2 or any later version
+// Refer to the license.txt file included.
+
+#pragma once
+
+#include <string>
+#include <vector>
+#include "common/common_types.h"
+
+/**
+ * Replays a recorded input script against the emulated keyboard, so benchmark runs exercise the
+ * same inputs on every machine. The script is a plain text file with one event per line:
+ *
+ *     <frame> press <key_code>
+ *     <frame> release <key_code>
+ *
+ * where <frame> is the presented frame the event fires on and <key_code> matches the
+ * engine:keyboard button codes from the input configuration. Lines starting with '#' are ignored.
+ */
+class InputScript {
+public:
+    /// Loads a script from the given path; returns false and logs on parse errors.
+    bool Load(const std::string& path);
+
+    /// Fires all events scheduled up to and including the given presented frame. Call once per
+    /// emulated frame from the emulation thread.
+    void Update(u64 frame);
+
+private:
+    struct Event {
+        u64 frame;
+        int key_code;
+        bool pressed;
+    };
+
+    /// Script events, sorted by frame
+    std::vector<Event> events;
+    /// Index of the next event to fire
+    std::size_t next_event = 0;
+};
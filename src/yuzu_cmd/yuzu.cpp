@@ -16,6 +16,7 @@
 #include "common/logging/filter.h"
 #include "common/logging/log.h"
 #include "common/microprofile.h"
+#include "common/microprofile_dump.h"
 #include "common/scm_rev.h"
 #include "common/scope_exit.h"
 #include "common/string_util.h"
@@ -26,10 +27,13 @@
 #include "core/gdbstub/gdbstub.h"
 #include "core/hle/service/filesystem/filesystem.h"
 #include "core/loader/loader.h"
+#include "core/perf_stats.h"
 #include "core/settings.h"
 #include "core/telemetry_session.h"
+#include "video_core/gpu.h"
 #include "yuzu_cmd/config.h"
 #include "yuzu_cmd/emu_window/emu_window_sdl2.h"
+#include "yuzu_cmd/input_script.h"
 
 #include <getopt.h>
 #ifndef _MSC_VER
@@ -57,6 +61,11 @@ static void PrintHelp(const char* argv0) {
               << " [options] <filename>\n"
                  "-g, --gdbport=NUMBER  Enable gdb stub on port NUMBER\n"
                  "-f, --fullscreen      Start in fullscreen mode\n"
+                 "-b, --benchmark=N     Run N frames headless, print PerfStats as JSON and exit\n"
+                 "-i, --input-script=FILE  Replay a recorded input script (requires --benchmark)\n"
+                 "-t, --record-gpu-trace=FILE  Record the GPU command stream to a trace file\n"
+                 "-m, --microprofile-dump=FILE  Dump aggregated MicroProfile timers to a CSV "
+                 "file on exit\n"
                  "-h, --help            Display this help and exit\n"
                  "-v, --version         Output version information and exit\n"
                  "-p, --program         Pass following string as arguments to executable\n";
@@ -106,14 +115,22 @@ int main(int argc, char** argv) {
 
     bool fullscreen = false;
 
+    u64 benchmark_frames = 0;
+    std::string input_script_path;
+    std::string gpu_trace_path;
+    std::string microprofile_dump_path;
+
     static struct option long_options[] = {
-        {"gdbport", required_argument, 0, 'g'}, {"fullscreen", no_argument, 0, 'f'},
-        {"help", no_argument, 0, 'h'},          {"version", no_argument, 0, 'v'},
-        {"program", optional_argument, 0, 'p'}, {0, 0, 0, 0},
+        {"gdbport", required_argument, 0, 'g'},      {"fullscreen", no_argument, 0, 'f'},
+        {"benchmark", required_argument, 0, 'b'},    {"input-script", required_argument, 0, 'i'},
+        {"record-gpu-trace", required_argument, 0, 't'},
+        {"microprofile-dump", required_argument, 0, 'm'},
+        {"help", no_argument, 0, 'h'},               {"version", no_argument, 0, 'v'},
+        {"program", optional_argument, 0, 'p'},      {0, 0, 0, 0},
     };
 
     while (optind < argc) {
-        char arg = getopt_long(argc, argv, "g:fhvp::", long_options, &option_index);
+        char arg = getopt_long(argc, argv, "g:fb:i:t:m:hvp::", long_options, &option_index);
         if (arg != -1) {
             switch (arg) {
             case 'g':
@@ -131,6 +148,25 @@ int main(int argc, char** argv) {
                 fullscreen = true;
                 LOG_INFO(Frontend, "Starting in fullscreen mode...");
                 break;
+            case 'b':
+                errno = 0;
+                benchmark_frames = strtoull(optarg, &endarg, 0);
+                if (endarg == optarg || benchmark_frames == 0)
+                    errno = EINVAL;
+                if (errno != 0) {
+                    perror("--benchmark");
+                    exit(1);
+                }
+                break;
+            case 'i':
+                input_script_path = optarg;
+                break;
+            case 't':
+                gpu_trace_path = optarg;
+                break;
+            case 'm':
+                microprofile_dump_path = optarg;
+                break;
             case 'h':
                 PrintHelp(argv[0]);
                 return 0;
@@ -159,6 +195,11 @@ int main(int argc, char** argv) {
     MicroProfileOnThreadCreate("EmuThread");
     SCOPE_EXIT({ MicroProfileShutdown(); });
 
+    if (!microprofile_dump_path.empty()) {
+        // Headless servers cannot reach the web UI, so capture everything and dump on exit
+        MicroProfileSetEnableAllGroups(true);
+    }
+
     if (filepath.empty()) {
         LOG_CRITICAL(Frontend, "Failed to load ROM: No ROM specified");
         return -1;
@@ -167,12 +208,24 @@ int main(int argc, char** argv) {
     // Apply the command line arguments
     Settings::values.gdbstub_port = gdb_port;
     Settings::values.use_gdbstub = use_gdbstub;
+    if (benchmark_frames > 0) {
+        // Benchmark runs measure how fast emulation can go, so never wait on the frame limiter
+        Settings::values.use_frame_limit = false;
+    }
     Settings::Apply();
 
-    std::unique_ptr<EmuWindow_SDL2> emu_window{std::make_unique<EmuWindow_SDL2>(fullscreen)};
+    std::unique_ptr<EmuWindow_SDL2> emu_window{
+        std::make_unique<EmuWindow_SDL2>(fullscreen, benchmark_frames > 0)};
+
+    InputScript input_script;
+    const bool replay_input = !input_script_path.empty();
+    if (replay_input && !input_script.Load(input_script_path)) {
+        return -1;
+    }
 
     if (!Settings::values.use_multi_core) {
-        // Single core mode must acquire OpenGL context for entire emulation session
+        // Single core mode must acquire OpenGL context for entire emulation session. With
+        // asynchronous GPU emulation the GPU thread takes it over during initialization.
         emu_window->MakeCurrent();
     }
 
@@ -217,8 +270,39 @@ int main(int argc, char** argv) {
 
     Core::Telemetry().AddField(Telemetry::FieldType::App, "Frontend", "SDL");
 
-    while (emu_window->IsOpen()) {
-        system.RunLoop();
+    if (!gpu_trace_path.empty()) {
+        system.GPU().StartTraceRecording(gpu_trace_path);
+    }
+
+    if (benchmark_frames > 0) {
+        while (emu_window->IsOpen() && emu_window->GetPresentedFrameCount() < benchmark_frames) {
+            if (replay_input) {
+                input_script.Update(emu_window->GetPresentedFrameCount());
+            }
+            system.RunLoop();
+        }
+
+        // Frame-time percentiles and per-phase walltime accumulated over the whole run
+        std::cout << system.GetPerfStats().GetMachineReadableDump() << std::endl;
+
+        const auto results = system.GetAndResetPerfStats();
+        std::cout << fmt::format("{{\"benchmark_frames\":{},\"system_fps\":{:.3f},"
+                                 "\"game_fps\":{:.3f},\"frametime\":{:.6f},"
+                                 "\"emulation_speed\":{:.3f},\"audio_underruns\":{}}}",
+                                 emu_window->GetPresentedFrameCount(), results.system_fps,
+                                 results.game_fps, results.frametime, results.emulation_speed,
+                                 results.audio_underruns)
+                  << std::endl;
+    } else {
+        while (emu_window->IsOpen()) {
+            system.RunLoop();
+        }
+    }
+
+    if (!microprofile_dump_path.empty()) {
+        if (!Common::DumpMicroProfileTimers(microprofile_dump_path)) {
+            LOG_ERROR(Frontend, "Failed to write MicroProfile dump to {}", microprofile_dump_path);
+        }
     }
 
     detached_tasks.WaitForAllTasks();